@@ -18,7 +18,7 @@ flags_for_eigen = ['-fpermissive']
 # working with Eigen.  I really want to eliminate Eigen from the
 # build!
 for flag in ['-Wall', '-Werror', '-O3', '-std=c++11', '-Isrc', '-Iinclude', '-g',
-             '-mtune=native', '-flto'] + flags_for_eigen:
+             '-mtune=native', '-flto', '-pthread', '-fno-trapping-math'] + flags_for_eigen:
     if not os.system('cd testing-flags && g++ %s %s -c test.c' %
                      (flags, flag)):
         flags += ' ' + flag
@@ -27,7 +27,7 @@ for flag in ['-Wall', '-Werror', '-O3', '-std=c++11', '-Isrc', '-Iinclude', '-g'
 if len(flags) > 0:
     flags = flags[1:]
 linkflags = ''
-for flag in ['-lpopt', '-lprofiler', '-g', '-lfftw3', '-flto']:
+for flag in ['-lpopt', '-lprofiler', '-g', '-lfftw3', '-lfftw3f', '-flto', '-pthread']:
     if not os.system('cd testing-flags && g++ %s %s -o test test.c' %
                      (flags, flag)):
         linkflags += ' ' + flag
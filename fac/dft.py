@@ -6,12 +6,13 @@ import string
 src = facfile.facfile('.dft.fac')
 
 generic_sources = """
-  lattice utilities Faddeeva
-  GridDescription Grid ReciprocalGrid
+  lattice utilities Faddeeva Profiler GridParallel
+  GridDescription Grid ReciprocalGrid FieldFile AsyncOutput
+  RadialDistributionTable
   IdealGas ChemicalPotential
   HardSpheres ExternalPotential
   Functional ContactDensity
-  Gaussian Pow WaterSaftFast WaterSaft_by_handFast
+  Gaussian Pow VectorMath WaterSaftFast WaterSaft_by_handFast
   EffectivePotentialToDensity
   equation-of-state water-constants
   compute-surface-tension
@@ -19,7 +20,7 @@ generic_sources = """
   Precision ConjugateGradient
   QuadraticLineMinimizer SteepestDescent
   vector3d
-  new/Minimize new/NewFunctional
+  new/Minimize new/NewFunctional new/Sweep
 """.split()
 
 for x in generic_sources:
@@ -40,6 +41,7 @@ mkdats = """
   papers/fuzzy-fmt/figs/new-melting
   papers/fuzzy-fmt/figs/walls
   papers/fuzzy-fmt/figs/new-walls
+  papers/fuzzy-fmt/figs/new-walls-sweep
   papers/fuzzy-fmt/figs/new-bh-walls
   papers/fuzzy-fmt/figs/new-bh-soft-walls
   papers/fuzzy-fmt/figs/soft-sphere
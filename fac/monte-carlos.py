@@ -11,10 +11,12 @@ monte_carlos = """
    square-well-monte-carlo liquid-vapor-monte-carlo
    radial-distribution-monte-carlo grand-monte-carlo new-soft
    free-energy-monte-carlo free-energy-monte-carlo-infinite-case
+   square-well-reweight
 """.split()
 
 utility_files = """
-   polyhedra square-well grand InitBox
+   polyhedra square-well grand InitBox sphere-cells event-chain
+   move-scheduler checkerboard reweighting
 """.split()
 
 for x in utility_files:
@@ -34,15 +34,22 @@
 // DJR added
 #include <iostream>
 
-extern long djr_memused;
-extern long djr_mempeak;
+// These are atomic since Grids may be made and freed on other threads
+// (e.g. by async_output).
+extern std::atomic<long> djr_memused;
+extern std::atomic<long> djr_mempeak;
+
+inline void djr_track_alloc(long mem) {
+  long now = djr_memused += mem;
+  long peak = djr_mempeak;
+  while (now > peak && !djr_mempeak.compare_exchange_weak(peak, now));
+}
 
 #define TRACK_ALLOC_FOR_DJR {long mem = cols()*rows()*sizeof(Scalar); \
                              if (mem > 100) { \
-                               djr_memused += mem; \
+                               djr_track_alloc(mem); \
                                std::cout << "Alloc " << mem/1024.0/1024.0 << ", now using " \
                                          << djr_memused/1024.0/1024.0 << std::endl; \
-                               if (djr_memused > djr_mempeak) djr_mempeak = djr_memused; \
                              }}
 
 #define TRACK_FREE_FOR_DJR(sz)  {long mem = sz*sizeof(Scalar); \
@@ -56,8 +63,7 @@ extern long djr_mempeak;
 #undef TRACK_ALLOC_FOR_DJR
 #undef TRACK_FREE_FOR_DJR
 #define TRACK_ALLOC_FOR_DJR {long mem = cols()*rows()*sizeof(Scalar); \
-                            if (mem > 100) djr_memused += mem; \
-                            if (djr_memused > djr_mempeak) djr_mempeak = djr_memused;}
+                            if (mem > 100) djr_track_alloc(mem);}
 #define TRACK_FREE_FOR_DJR(sz) {long mem = sz*sizeof(Scalar); \
                             if (mem > 100) djr_memused -= mem;}
 // end DJR added.
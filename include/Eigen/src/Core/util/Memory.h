@@ -137,13 +137,21 @@ template<typename T> inline T* ei_construct_elements_of_array(T *ptr, std::size_
   return ptr;
 }
 
-/** allocates \a size objects of type T. The returned pointer is guaranteed to have 16 bytes alignment.
-  * On allocation error, the returned pointer is undefined, but if exceptions are enabled then a std::bad_alloc is thrown.
+// DJR added: the dynamic matrix storage gets its memory from deft's
+// field allocator (field_malloc in src/utilities.cpp, the same place
+// that defines djr_memused), which gives 64-byte alignment, huge pages
+// and reuse of large arrays.  Freeing needs the size, which the
+// storage always knows.
+void *ei_field_malloc(std::size_t size);
+void ei_field_free(void *ptr, std::size_t size);
+
+/** allocates \a size objects of type T. The returned pointer is guaranteed to have 64 bytes alignment.
+  * On allocation error, the program exits.
   * The default constructor of T is called.
   */
 template<typename T> inline T* ei_aligned_new(std::size_t size)
 {
-  T *result = reinterpret_cast<T*>(ei_aligned_malloc(sizeof(T)*size));
+  T *result = reinterpret_cast<T*>(ei_field_malloc(sizeof(T)*size));
   return ei_construct_elements_of_array(result, size);
 }
 
@@ -200,7 +208,7 @@ template<typename T> inline void ei_destruct_elements_of_array(T *ptr, std::size
 template<typename T> inline void ei_aligned_delete(T *ptr, std::size_t size)
 {
   ei_destruct_elements_of_array<T>(ptr, size);
-  ei_aligned_free(ptr);
+  ei_field_free(ptr, sizeof(T)*size);
 }
 
 /** \internal delete objects constructed with ei_conditional_aligned_new
@@ -0,0 +1,127 @@
+// Deft is a density functional package developed by the research
+// group of Professor David Roundy
+//
+// Copyright 2010 The Deft Authors
+//
+// Deft is free software; you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// You should have received a copy of the GNU General Public License
+// along with deft; if not, write to the Free Software Foundation,
+// Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+//
+// Please see the file AUTHORS for a list of authors.
+
+// This computes the same walls as new-walls.cpp, but for the whole
+// grid of temperatures and densities in a single run, reusing each
+// converged density as the starting guess for its neighbor.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/stat.h>
+#include "new/SFMTFluidFast.h"
+#include "new/SFMTFluidVeffFast.h"
+#include "new/HomogeneousSFMTFluidFast.h"
+#include "new/Sweep.h"
+
+/*--
+
+self.rule(exe, [exe], ["papers/fuzzy-fmt/figs/new-data/walls-sweep.dat"])
+
+--*/
+
+static double width = 30;
+const double dx = 0.01;
+const double dw = 0.01;
+const double spacing = 3.0; // space on each side
+const double rad = 1;
+
+class WallSweep : public SweepProblem {
+  // bulk finds the homogeneous fluid at our density, which tells us
+  // the chemical potential.
+  HomogeneousSFMTFluid bulk(double kT, double reduced_density) const {
+    HomogeneousSFMTFluid hf;
+    hf.sigma() = rad*pow(2,5.0/6.0);
+    hf.epsilon() = 1;
+    hf.kT() = kT;
+    hf.n() = reduced_density*pow(2,-5.0/2.0);
+    hf.mu() = 0;
+    hf.mu() = hf.d_by_dn(); // set mu based on derivative of hf
+    return hf;
+  }
+  // set_walls sets the external potential, and optionally also Veff
+  // within the walls (which we only need on a cold start).
+  void set_walls(SFMTFluidVeff *f, double kT, bool set_veff) const {
+    const int Ntot = f->Nx()*f->Ny()*f->Nz();
+    const Vector rz = f->get_rz();
+    for (int i=0; i<Ntot; i++) {
+      if (fabs(rz[i]) < spacing) {
+        const double Vmax = 500*kT;
+        f->Vext()[i] = Vmax; // this is "infinity" for our wall
+        if (set_veff) f->Veff()[i] = Vmax;
+      } else {
+        f->Vext()[i] = 0;
+      }
+    }
+  }
+public:
+  NewFunctional *create(double kT, double reduced_density) const {
+    HomogeneousSFMTFluid hf = bulk(kT, reduced_density);
+    SFMTFluidVeff *f = new SFMTFluidVeff(dw, dw, width + spacing, dx);
+    f->sigma() = hf.sigma();
+    f->epsilon() = hf.epsilon();
+    f->kT() = hf.kT();
+    f->mu() = hf.mu();
+    f->Vext() = 0;
+    f->Veff() = -kT*log(hf.n());
+    set_walls(f, kT, true);
+    return f;
+  }
+  void update(NewFunctional *nf, double kT, double reduced_density) const {
+    SFMTFluidVeff *f = static_cast<SFMTFluidVeff *>(nf);
+    HomogeneousSFMTFluid hf = bulk(kT, reduced_density);
+    // Rescale Veff so that the converged density carries over to
+    // the new temperature.
+    f->Veff() *= kT/f->kT();
+    f->kT() = kT;
+    f->mu() = hf.mu();
+    set_walls(f, kT, false);
+  }
+  void configure(Minimize *min) const {
+    min->set_relative_precision(0);
+    min->set_maxiter(10000);
+    min->set_miniter(9);
+    min->precondition(true);
+    // Even warm starts are far from converged, so the first
+    // iterations can get by with single precision FFTs.
+    min->set_single_precision_until(1e-5);
+  }
+  void output(FILE *o, const NewFunctional *nf, double, double) const {
+    const SFMTFluidVeff *f = static_cast<const SFMTFluidVeff *>(nf);
+    const int Nz = f->Nz();
+    Vector rz = f->get_rz();
+    Vector n = f->get_n();
+    for (int i=0; i<Nz/2; i++) {
+      fprintf(o, "%g\t%g\n", (rz[i] - spacing)/f->sigma(), n[i]*uipow(f->sigma(), 3));
+    }
+  }
+};
+
+int main(int argc, char **argv) {
+  int num_threads = 0;
+  if (argc > 1) sscanf(argv[1], "%d", &num_threads);
+
+  Vector kTs(100), densities(20);
+  for (int i=0; i<kTs.get_size(); i++) kTs[i] = 0.1*(i+1);
+  for (int i=0; i<densities.get_size(); i++) densities[i] = 0.1*(i+1);
+
+  mkdir("papers/fuzzy-fmt/figs/new-data", 0777); // make sure the directory exists
+  WallSweep walls;
+  const int failures = sweep(walls, kTs, densities,
+                             "papers/fuzzy-fmt/figs/new-data/walls-sweep.dat",
+                             num_threads, verbose);
+  if (failures) printf("FAIL: %d points gave a NaN energy\n", failures);
+  return failures;
+}
@@ -12,6 +12,7 @@
 #include "handymath.h"
 #include "vector3d.h"
 #include <iostream>
+#include <string>
 #include "version-identifier.h"
 
 // TODO items:
@@ -87,8 +88,11 @@ struct ising_simulation {
   simulation_parameters param; // the parameters that specify how to simulate
 
   long moves;   // the current number of moves
-  int *S;
-  energy E;      // system energy.
+  // The spins, S[j + i*N] being the spin at row i and column j.  A
+  // spin is between -Q/2 and Q/2-1, so a byte holds it, which lets us
+  // keep four times as large a lattice in cache as an int would.
+  signed char *S;
+  energy E;      // system energy, which each move updates.
 
   // the last time we printed status text (i.e. from initialization)
   double estimated_time_per_iteration = 0.1; // in units of seconds per iteration
@@ -126,13 +130,16 @@ struct ising_simulation {
 
   void flip_a_spin();
   void end_flip_updates();
-  double calculate_energy();
+  // calculate_energy counts up the energy of the whole lattice, which
+  // we only need when we start (E is updated by each move after that)
+  // and to check E.
+  int calculate_energy() const;
 
   long index_from_energy(energy E) const {
-    return param.J*param.N*param.N/2 + E.value/4;
+    return long(param.J)*param.N*param.N/2 + E.value/4;
   }
-  energy energy_from_index(int i) const {
-    return energy(4*(i - param.J*param.N*param.N/2));
+  energy energy_from_index(long i) const {
+    return energy(4*(i - long(param.J)*param.N*param.N/2));
   }
 
   void compute_ln_dos(dos_types dos_type);
@@ -157,8 +164,8 @@ ising_simulation::ising_simulation(simulation_parameters par)
   estimated_time_per_iteration = 0.1;
   moves = 0;
   const int J = param.J;
-  const int N = param.N;
-  S = new int[N*N];
+  const long N = param.N;
+  S = new signed char[N*N];
   // energy histogram
   energy_levels = J*N*N;
   ln_energy_weights = new double[energy_levels]();
@@ -166,12 +173,12 @@ ising_simulation::ising_simulation(simulation_parameters par)
   energy_histogram = new long[energy_levels]();
   //printf("energy_levels %ld\n", energy_levels);
 
-  for (int i = 0; i < N; i++) {
-    for (int j = 0; j < N; j++) {
+  for (long i = 0; i < N; i++) {
+    for (long j = 0; j < N; j++) {
       S[i+N*j] = ((random::ran64()/8) % 2)*2-1; // initialize to random
     }
   }
-  calculate_energy();
+  E = energy(calculate_energy());
   min_energy = E;
   max_energy = E;
   max_entropy_energy = E;
@@ -199,16 +206,17 @@ ising_simulation::~ising_simulation() {
 
 void ising_simulation::flip_a_spin() {
   const int J = param.J;
-  const int N = param.N;
+  const long N = param.N;
   moves += 1;
-  int k = random::ran64() % (N*N);
-  int i = k % N;
-  int j = k / N;
+  const long k = random::ran64() % (N*N);
+  const long i = k % N;
+  const long j = k / N;
+  const long ip1 = (i == N-1) ? 0 : i+1, im1 = (i == 0) ? N-1 : i-1;
+  const long jp1 = (j == N-1) ? 0 : j+1, jm1 = (j == 0) ? N-1 : j-1;
   int old = S[j + i*N];
   S[j + i*N] = random_flip(S[j + i*N]);
 
-  int neighbor_spins = S[j + ((i+1) % N)*N] + S[j + ((i-1+N) % N)*N] +
-                       S[((j+1) % N) + i*N] + S[((j-1+N) % N) + i*N];
+  int neighbor_spins = S[j + ip1*N] + S[j + im1*N] + S[jp1 + i*N] + S[jm1 + i*N];
 
   const energy deltaE = energy(J*(old - S[j + i*N])*neighbor_spins);
 
@@ -396,19 +404,20 @@ void ising_simulation::end_flip_updates(){
   }
 }
 
-double ising_simulation::calculate_energy() {
-  const int N = param.N;
+int ising_simulation::calculate_energy() const {
+  const long N = param.N;
   const int J = param.J;
-  E.value = 0;
-  for (int i = 0; i < N; i++) {
-    for (int j = 0; j < N; j++) {
-      // we want to enforce periodic boundary conditions.
-      int neighbor_spins = S[(i+1) % N + j*N] + S[i + ((j+1) % N)*N];
-
-      E.value += -J*neighbor_spins*S[i+j*N];
+  int total = 0;
+  for (long j = 0; j < N; j++) {
+    // we want to enforce periodic boundary conditions.
+    const signed char *row = S + j*N, *next_row = S + ((j == N-1) ? 0 : j+1)*N;
+    for (long i = 0; i < N; i++) {
+      int neighbor_spins = row[(i == N-1) ? 0 : i+1] + next_row[i];
+
+      total += -J*neighbor_spins*row[i];
     }
   }
-  return E.value;
+  return total;
 }
 
 void ising_simulation::compute_ln_dos(dos_types dos_type) {
@@ -498,6 +507,24 @@ long get_next_output(long next_output) {
   return 2*next_output;
 }
 
+// write_spins writes the spins as the rows of a numpy array.  We
+// format each row ourselves and write it all at once, since an
+// fprintf for each spin would take longer than the simulation itself
+// on a large lattice.
+void write_spins(FILE *f, const signed char *S, long N) {
+  char formatted[256][8]; // "%2d," for each value a spin could have
+  for (int s = -128; s < 128; s++) snprintf(formatted[s+128], 8, "%2d,", s);
+  std::string row;
+  fprintf(f, "S = np.array([\n");
+  for (long i=0; i<N; i++) {
+    row = "\t[";
+    for (long j=0; j<N; j++) row += formatted[S[i+N*j]+128];
+    row += "],\n";
+    fputs(row.c_str(), f);
+  }
+  fprintf(f, "])\n");
+}
+
 // ---------------------------------------------------------------------
 // Initialize Main
 // ---------------------------------------------------------------------
@@ -741,16 +768,21 @@ int main(int argc, const char *argv[]) {
         fscanf(rfile, " ])\n");
 
         fscanf(rfile, " S = np.array([\n");
-        for (int i=0; i<param.N; i++) {
+        for (long i=0; i<param.N; i++) {
           fscanf(rfile, "\t[");
-          for (int j=0; j<param.N; j++) {
-            fscanf(rfile,"%2d,", &ising.S[i+param.N*j]);
+          for (long j=0; j<param.N; j++) {
+            int spin;
+            fscanf(rfile,"%2d,", &spin);
+            ising.S[i+param.N*j] = spin;
           }
           fscanf(rfile, "],\n");
         }
         fscanf(rfile, "])\n");
 
         fclose(rfile);
+        // The energy we read had better be the energy of the spins we
+        // read.
+        assert(ising.E.value == ising.calculate_energy());
       }
       } else {
         printf("I do not know how to resume yet!\n");
@@ -790,6 +822,10 @@ int main(int argc, const char *argv[]) {
              days, hours, minutes, seconds, ising.moves,
              fraction_done, ising.E.value);
       fflush(stdout);
+      // Each move updates the energy, so it should never need
+      // recounting, but we check it (when assertions are on) in case
+      // a move ever gets it wrong.
+      assert(ising.E.value == ising.calculate_energy());
 
       if (ising.moves == next_output) {
         // Save energy histogram
@@ -882,15 +918,7 @@ int main(int argc, const char *argv[]) {
           fprintf(ising_out,"\t%ld,\n", ising.energy_histogram[i]);
         }
         fprintf(ising_out, "])\n");
-        fprintf(ising_out, "S = np.array([\n");
-        for (int i=0; i<param.N; i++) {
-          fprintf(ising_out, "\t[");
-          for (int j=0; j<param.N; j++) {
-            fprintf(ising_out,"%2d,", ising.S[i+param.N*j]);
-          }
-          fprintf(ising_out, "],\n");
-        }
-        fprintf(ising_out, "])\n");
+        write_spins(ising_out, ising.S, param.N);
     
         fclose(ising_out);
       }
@@ -21,6 +21,8 @@
 #include "equation-of-state.h"
 #include "LineMinimizer.h"
 #include "ContactDensity.h"
+#include "RadialDistributionTable.h"
+#include "Reduction.h"
 #include "utilities.h"
 #include "handymath.h"
 #include "errno.h"
@@ -32,17 +34,12 @@
 int count =0;
 double radial_distribution(double gsigma, double r);
 double py_rdf (double eta, double r);
-double mc (double local_eta, double r, double r_step, double g[]);
 
 
 // Maximum and spacing values for plotting
 
-double mc_r_step;
-const int num_eta = 10;
-const double eta_step = 0.5/num_eta;
-const int num_r_in_gmc = 1300;
-const int gsize = num_r_in_gmc*(num_eta+1);
-double * g = new double[gsize];
+// The Monte-Carlo g(r) of the homogeneous fluid, which main reads in.
+RadialDistributionTable gmc;
 
 // The functions for different ways of computing the pair distribution function.
 
@@ -66,7 +63,7 @@ double pairdist_this_work_mc(const Grid &gsigma, const Grid &density, const Grid
   const double r = sqrt(r01.dot(r01));
   const double eta0 = gsigma_to_eta(gsigma(r0));
   const double eta1 = gsigma_to_eta(gsigma(r1));
-  return (mc(eta0, r, mc_r_step, g) + mc(eta1, r, mc_r_step, g))/2;
+  return (gmc(eta0, r) + gmc(eta1, r))/2;
 }
 double pairdist_fischer(const Grid &gsigma, const Grid &n, const Grid &nA, const Grid &n3,
                         const Grid &nbar_sokolowski, Cartesian r0, Cartesian r1) {
@@ -77,7 +74,7 @@ double pairdist_fischer(const Grid &gsigma, const Grid &n, const Grid &nA, const
   const Cartesian r01 = Cartesian(r0 - r1);
   const double r = sqrt(r01.dot(r01));
   const double eta = n3(Cartesian(0.5*(r0+r1)));
-  return mc(eta, r, mc_r_step, g);
+  return gmc(eta, r);
 }
 double pairdist_sokolowski(const Grid &gsigma, const Grid &n, const Grid &nA, const Grid &n3,
                            const Grid &nbar_sokolowski, Cartesian r0, Cartesian r1) {
@@ -90,7 +87,7 @@ double pairdist_sokolowski(const Grid &gsigma, const Grid &n, const Grid &nA, co
   const double eta1 = nbar_sokolowski(r1)*(4.0/3.0*M_PI);
   const double eta = (eta0 + eta1)/2.0;
 
-  return mc(eta, r, mc_r_step, g);
+  return gmc(eta, r);
 }
 
 const char *fun[] = {
@@ -118,87 +115,6 @@ static const double dx = .1/1.5;
 //speration delta of 1 when going around the circular wall and not
 //having to worry about a gridpoint being within the wall.
 
-void read_mc() {
-  char *fname = new char[4096];
-  sprintf(fname, "papers/pair-correlation/figs/gr-0.10.dat");
-  FILE *in = fopen(fname, "r");
-  if (!in) {
-    fprintf(stderr, "Unable to open file %s!!!!\n", fname);
-    delete[] fname;
-    fclose(in);
-    exit(1);
-  }
-  double num1;
-  double num2;
-  if (fscanf(in, " %lg %*g %lg", &num1, &num2) != 2) {
-    printf("Error reading file...\n");
-    delete[] fname;
-    fclose(in);
-    exit(1);
-  }
-  mc_r_step = 2*(num2 - num1);
-  delete[] fname;
-  fclose(in);
-  for (int i=0; i<num_r_in_gmc; i++) {
-    g[i] = 1.0;
-  }
-  for (double eta = eta_step; eta < 0.5001; eta += eta_step) {
-    char *fname = new char[4096];
-    sprintf(fname, "papers/pair-correlation/figs/gr-%2.2f.dat", eta);
-    FILE *in = fopen(fname, "r");
-    if (!in) {
-      fprintf(stderr, "Unable to open file %s!!!!\n", fname);
-      delete[] fname;
-      exit(1);
-    }
-    int i=0;
-    while (fscanf(in, " %*g %lg", &num1) == 1) {
-      g[int(floor(num_r_in_gmc*(eta/eta_step)))+i] = num1/eta;
-      i++;
-    }
-    if (i!=num_r_in_gmc) {
-      printf("There  are not num_r_in_gmc lines in papers/pair-correlation/figs/gr-%2.2f.dat which is a problem in walls.cpp\n", eta);
-      exit(1);
-    }
-    delete[] fname;
-    fclose(in);
-  }
-}
-
-double mc(double local_eta, double r, double r_step, double g[]) {
-  int low_eta_i = floor(local_eta/eta_step);
-  int high_eta_i = low_eta_i + 1;
-  double g_low_eta;
-  double g_high_eta;
-  double fac;
-  int j=0;
-  double r_floor;
-  if (r < 2) {
-    return 0;
-  }
-  if (high_eta_i > num_eta) {
-    //fprintf(stderr, "Error. Trying to interpolate to eta = %g, but our max is %g\n", local_eta, num_eta*eta_step);
-    return NAN;
-  }
-  if (r < 2 +(r_step/2.0)) {
-    fac = (r-2.0)/(0.5*r_step);
-    g_low_eta = (1-fac)*g[low_eta_i*num_r_in_gmc]+fac*g[low_eta_i*num_r_in_gmc + 1];
-    g_high_eta = (1-fac)*g[high_eta_i*num_r_in_gmc]+fac*g[high_eta_i*num_r_in_gmc + 1];
-  } else if (r > 14.985) {
-    return 1.0;
-  } else {
-    j = floor((r-2.0+0.5*r_step)/r_step);
-    r_floor = 2+(j-0.5)*r_step;
-    fac = (r-r_floor)/r_step;
-    g_low_eta = (1-fac)*g[low_eta_i*num_r_in_gmc+j] + fac*g[low_eta_i*num_r_in_gmc+j+1];
-    g_high_eta = (1-fac)*g[high_eta_i*num_r_in_gmc+j] + fac*g[high_eta_i*num_r_in_gmc+j+1];
-  }
-  //printf("low_eta_i = %d and high_eta_i = %d\n", low_eta_i*num_r_in_gmc+j, high_eta_i*num_r_in_gmc+j);
-  //fflush(stdout);
-  fac = (local_eta-(low_eta_i)*eta_step)/eta_step;
-  return (1-fac)*g_low_eta + fac*g_high_eta;
-}
-
 double notinsphere(Cartesian r) {
   const double x = r.x();
   const double y = r.y();
@@ -281,6 +197,17 @@ void run_with_eta(double eta, const char *name, Functional fhs) {
   // here you choose the values of z0 to use
   // dx is the resolution at which we compute the density.
   char *plotname = new char[4096];
+  // The points r1 of the plots, and the density at each of them, are
+  // the same for every z0 and every version, so we find them once.
+  std::vector<Cartesian> r1s;
+  std::vector<int> row_ends;
+  for (double x = 0; x < 4; x += dx) {
+    for (double z1 = -4; z1 <= 9; z1 += dx) r1s.push_back(Cartesian(x,0,z1));
+    row_ends.push_back(r1s.size());
+  }
+  const long num_points = r1s.size();
+  std::vector<double> density_r1(num_points), g3(num_points);
+  density.Sample(&r1s[0], num_points, &density_r1[0]);
   for (double z0 = 2.1; z0 < 4.5; z0 += 2.1) {
     // For each z0, we now pick one of our methods for computing the
     // pair distribution function:
@@ -294,15 +221,21 @@ void run_with_eta(double eta, const char *name, Functional fhs) {
       // the +1 for z0 and z1 are to shift the plot over, so that a sphere touching the wall
       // is at z = 0, to match with the monte carlo data
       const Cartesian r0(0,0,z0);
-      for (double x = 0; x < 4; x += dx) {
-        for (double z1 = -4; z1 <= 9; z1 += dx) {
-          const Cartesian r1(x,0,z1);
-          double g2 = pairdists[version](gsigma, density, nA, n3, nbar_sokolowski, r0, r1);
-          double n_bulk = (3.0/4.0/M_PI)*eta;
-          double g3 = g2*density(r0)*density(r1)/n_bulk/n_bulk;
-          fprintf(out, "%g\t", g3);
-          fprintf(xfile, "%g\t", x);
-          fprintf(zfile, "%g\t", z1);
+      const double n_bulk = (3.0/4.0/M_PI)*eta;
+      const double density_r0 = density(r0);
+      // Each point only reads the grids, so we can do them all at once.
+      grid_parallel_for(num_points, [&](long start, long end) {
+          for (long i=start; i<end; i++) {
+            double g2 = pairdists[version](gsigma, density, nA, n3, nbar_sokolowski, r0, r1s[i]);
+            g3[i] = g2*density_r0*density_r1[i]/n_bulk/n_bulk;
+          }
+        });
+      long i = 0;
+      for (unsigned row = 0; row < row_ends.size(); row++) {
+        for (; i < row_ends[row]; i++) {
+          fprintf(out, "%g\t", g3[i]);
+          fprintf(xfile, "%g\t", r1s[i].x());
+          fprintf(zfile, "%g\t", r1s[i].z());
         }
         fprintf(out, "\n");
         fprintf(xfile, "\n");
@@ -449,7 +382,7 @@ void run_with_eta(double eta, const char *name, Functional fhs) {
 }
 
 int main(int argc, char **argv) {
-  read_mc();
+  if (!gmc.ReadMonteCarlo("papers/pair-correlation/figs/gr", 10, 0.05, 1300)) exit(1);
   double this_eta = 0;
   if (argc > 1) {
     sscanf(argv[1], "%lg", &this_eta);
@@ -21,6 +21,7 @@
 #include "equation-of-state.h"
 #include "LineMinimizer.h"
 #include "ContactDensity.h"
+#include "RadialDistributionTable.h"
 #include "utilities.h"
 #include "handymath.h"
 #include "errno.h"
@@ -32,7 +33,6 @@
 int count = 0;
 double radial_distribution(double gsigma, double r);
 double py_rdf (double eta, double r);
-double mc (double local_eta, double r, double r_step, double g[]);
 
 const double sigma = 2.0;
 // Maximum and spacing values for plotting
@@ -40,12 +40,8 @@ const double zmax = 6;
 const double xmax = 4;
 const double dx = 0.1;
 
-double mc_r_step;
-const int num_eta = 10;
-const double eta_step = 0.5/num_eta;
-const int num_r_in_gmc = 1300;
-const int gsize = num_r_in_gmc*(num_eta+1);
-double * g = new double[gsize];
+// The Monte-Carlo g(r) of the homogeneous fluid, which main reads in.
+RadialDistributionTable gmc;
 
 // The functions for different ways of computing the pair distribution function.
 double pairdist_this_work(const Grid &gsigma, const Grid &density, const Grid &nA, const Grid &n3, const Grid &nbar_sokolowski, Cartesian r0, Cartesian r1) {
@@ -65,13 +61,13 @@ double pairdist_this_work_mc(const Grid &gsigma, const Grid &density, const Grid
   const double r = sqrt(r01.dot(r01));
   const double eta0 = gsigma_to_eta(gsigma(r0));
   const double eta1 = gsigma_to_eta(gsigma(r1));
-  return (mc(eta0, r, mc_r_step, g) + mc(eta1, r, mc_r_step, g))/2.0;
+  return (gmc(eta0, r) + gmc(eta1, r))/2.0;
 }
 double pairdist_gloor(const Grid &gsigma, const Grid &n, const Grid &nA, const Grid &n3, const Grid &nbar_sokolowski, Cartesian r0, Cartesian r1) {
   const Cartesian r01 = Cartesian(r0 - r1);
   const double r = sqrt(r01.dot(r01));
   const double eta = 4.0/3.0*M_PI*1*1*1*(n(r0) + n(r1))/2.0;
-  return mc(eta, r,mc_r_step,g);
+  return gmc(eta, r);
 }
 double pairdist_fischer(const Grid &gsigma, const Grid &n, const Grid &nA, const Grid &n3, const Grid &nbar_sokolowski, Cartesian r0, Cartesian r1) {
   // This implements the pair distribution function of Fischer and
@@ -81,7 +77,7 @@ double pairdist_fischer(const Grid &gsigma, const Grid &n, const Grid &nA, const
   const Cartesian r01 = Cartesian(r0 - r1);
   const double r = sqrt(r01.dot(r01));
   const double eta = n3(Cartesian(0.5*(r0+r1)));
-  return mc(eta, r, mc_r_step, g);
+  return gmc(eta, r);
 }
 double pairdist_sokolowski(const Grid &gsigma, const Grid &n, const Grid &nA, const Grid &n3, const Grid &nbar_sokolowski, Cartesian r0, Cartesian r1) {
   // This implements the pair distribution function of Sokolowski and
@@ -93,7 +89,7 @@ double pairdist_sokolowski(const Grid &gsigma, const Grid &n, const Grid &nA, co
   const double eta1 = nbar_sokolowski(r1)*(4.0/3.0*M_PI);
   const double eta = (eta0 + eta1)/2.0;
 
-  return mc(eta, r, mc_r_step, g);
+  return gmc(eta, r);
 }
 
 const char *fun[] = {
@@ -117,87 +113,6 @@ static double width = 30;
 const double dw = 0.0001;
 const double spacing = 3; // space on each side
 
-void read_mc() {
-  char *fname = new char[4096];
-  sprintf(fname, "papers/pair-correlation/figs/gr-0.10.dat");
-  FILE *in = fopen(fname, "r");
-  if (!in) {
-    fprintf(stderr, "Unable to open file %s!!!!\n", fname);
-    delete[] fname;
-    fclose(in);
-    exit(1);
-  }
-  double num1;
-  double num2;
-  if (fscanf(in, " %lg %*g %lg", &num1, &num2) != 2) {
-    printf("Error reading file...\n");
-    delete[] fname;
-    fclose(in);
-    exit(1);
-  }
-  mc_r_step = 2*(num2 - num1);
-  delete[] fname;
-  fclose(in);
-  for (int i=0; i<num_r_in_gmc; i++) {
-    g[i] = 1.0;
-  }
-  for (double eta = eta_step; eta < 0.5001; eta += eta_step) {
-    char *fname = new char[4096];
-    sprintf(fname, "papers/pair-correlation/figs/gr-%2.2f.dat", eta);
-    FILE *in = fopen(fname, "r");
-    if (!in) {
-      fprintf(stderr, "Unable to open file %s!!!!\n", fname);
-      delete[] fname;
-      exit(1);
-    }
-    int i=0;
-    while (fscanf(in, " %*g %lg", &num1) == 1) {
-      g[int(floor(num_r_in_gmc*(eta/eta_step)))+i] = num1/eta;
-      i++;
-    }
-    if (i!=num_r_in_gmc) {
-      printf("There  are not num_r_in_gmc lines in papers/pair-correlation/figs/gr-%2.2f.dat which is a problem in walls.cpp\n", eta);
-      exit(1);
-    }
-    delete[] fname;
-    fclose(in);
-  }
-}
-
-double mc(double local_eta, double r, double r_step, double g[]) {
-  int low_eta_i = floor(local_eta/eta_step);
-  int high_eta_i = low_eta_i + 1;
-  double g_low_eta;
-  double g_high_eta;
-  double fac;
-  int j=0;
-  double r_floor;
-  if (r < 2) {
-    return 0;
-  }
-  if (high_eta_i > num_eta) {
-    //fprintf(stderr, "Error. Trying to interpolate to eta = %g, but our max is %g\n", local_eta, num_eta*eta_step);
-    return NAN;
-  }
-  if (r < 2 +(r_step/2.0)) {
-    fac = (r-2.0)/(0.5*r_step);
-    g_low_eta = (1-fac)*g[low_eta_i*num_r_in_gmc]+fac*g[low_eta_i*num_r_in_gmc + 1];
-    g_high_eta = (1-fac)*g[high_eta_i*num_r_in_gmc]+fac*g[high_eta_i*num_r_in_gmc + 1];
-  } else if (r > 14.985) {
-    return 1.0;
-  } else {
-    j = floor((r-2.0+0.5*r_step)/r_step);
-    r_floor = 2+(j-0.5)*r_step;
-    fac = (r-r_floor)/r_step;
-    g_low_eta = (1-fac)*g[low_eta_i*num_r_in_gmc+j] + fac*g[low_eta_i*num_r_in_gmc+j+1];
-    g_high_eta = (1-fac)*g[high_eta_i*num_r_in_gmc+j] + fac*g[high_eta_i*num_r_in_gmc+j+1];
-  }
-  //printf("low_eta_i = %d and high_eta_i = %d\n", low_eta_i*num_r_in_gmc+j, high_eta_i*num_r_in_gmc+j);
-  //fflush(stdout);
-  fac = (local_eta-(low_eta_i)*eta_step)/eta_step;
-  return (1-fac)*g_low_eta + fac*g_high_eta;
-}
-
 double notinwall(Cartesian r) {
   const double z = r.z();
   if (fabs(z) > spacing) {
@@ -555,7 +470,7 @@ self.rule(exe, [exe], [os.path.dirname(exe)+'/walls.dat',
 int main(int, char **) {
   FILE *fout = fopen("papers/pair-correlation/figs/wallsfillingfracInfo.txt", "w");
   fclose(fout);
-  read_mc();
+  if (!gmc.ReadMonteCarlo("papers/pair-correlation/figs/gr", 10, 0.05, 1300)) exit(1);
   printf("Done with read\n");
   bool run_dadz;
   for (int i = 1; i <= 4; i ++) {
@@ -21,6 +21,7 @@
 #include "LineMinimizer.h"
 #include "utilities.h"
 #include "handymath.h"
+#include "AsyncOutput.h"
 
 const double nmtobohr = 18.8972613; // Converts nm to bohr
 const double nm = 18.8972613;
@@ -225,6 +226,10 @@ int main(int argc, char *argv[]) {
     }
     char *plotnameslice = new char[1024];
     snprintf(plotnameslice, 1024, "papers/water-saft/figs/rods-slice-%04.1f-%04.1f.dat", diameter/nm, distance/nm);
+    // The plot is written in the background while we go on to the
+    // next distance.
+    const std::string slicename(plotnameslice);
+    auto plot_slice = [slicename](const Grid &d) { plot_grids_yz_directions(slicename.c_str(), d); };
 
     printf("The bulk energy per cell should be %g\n", EperCell);
     double energy;
@@ -232,7 +237,7 @@ int main(int argc, char *argv[]) {
       energy = (min.energy() - EperCell)/width;
       Grid density(gd, EffectivePotentialToDensity()(new_water_prop.kT, gd, potential));
       printf("Using liquid in middle initially.\n");
-      plot_grids_yz_directions(plotnameslice, density);
+      async_output(density, plot_slice);
       {
         double peak = peak_memory()/1024.0/1024;
         double current = current_memory()/1024.0/1024;
@@ -242,7 +247,7 @@ int main(int argc, char *argv[]) {
       energy = (min2.energy() - EperCell)/width;
       Grid density(gd, EffectivePotentialToDensity()(new_water_prop.kT, gd, potential2));
       printf("Using vapor in middle initially.\n");    
-      plot_grids_yz_directions(plotnameslice, density);
+      async_output(density, plot_slice);
       {
         double peak = peak_memory()/1024.0/1024;
         double current = current_memory()/1024.0/1024;
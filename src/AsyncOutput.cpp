@@ -0,0 +1,162 @@
+// Deft is a density functional package developed by the research
+// group of Professor David Roundy
+//
+// Copyright 2010 The Deft Authors
+//
+// Deft is free software; you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// You should have received a copy of the GNU General Public License
+// along with deft; if not, write to the Free Software Foundation,
+// Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+//
+// Please see the file AUTHORS for a list of authors.
+
+#include "AsyncOutput.h"
+
+#include <stdlib.h>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <condition_variable>
+
+struct AsyncTask {
+  long bytes;
+  std::function<void()> run;
+};
+
+// The writer thread is started by the first task, and is stopped (after
+// finishing every task) by an atexit handler.
+struct AsyncQueue {
+  std::mutex lock;
+  std::condition_variable changed;
+  std::deque<AsyncTask> tasks;
+  long queued_bytes; // including the task being run
+  long limit;
+  bool running, stopping;
+  std::thread writer;
+  AsyncQueue() : queued_bytes(0), running(false), stopping(false) {
+    const char *mb = getenv("DEFT_ASYNC_OUTPUT_MB");
+    limit = mb ? atol(mb)*1024*1024 : 1024L*1024*1024;
+  }
+};
+
+static AsyncQueue &async_queue() {
+  static AsyncQueue *q = new AsyncQueue(); // never destroyed, since the atexit handler needs it
+  return *q;
+}
+
+static void write_everything() {
+  AsyncQueue &q = async_queue();
+  std::unique_lock<std::mutex> guard(q.lock);
+  while (true) {
+    while (q.tasks.empty() && !q.stopping) q.changed.wait(guard);
+    if (q.tasks.empty()) return; // we are stopping, and have nothing left to do
+    // We take the task out of the queue, so that clearing t.run below
+    // really does free the snapshot.
+    AsyncTask t;
+    t.bytes = q.tasks.front().bytes;
+    t.run.swap(q.tasks.front().run);
+    guard.unlock();
+    t.run();
+    t.run = std::function<void()>(); // free the snapshot before we say it is gone
+    guard.lock();
+    q.tasks.pop_front();
+    q.queued_bytes -= t.bytes;
+    q.changed.notify_all();
+  }
+}
+
+// on_writer says whether we are running on the writer thread, i.e. in
+// a task.  The caller must hold q.lock.
+static bool on_writer(const AsyncQueue &q) {
+  return q.running && std::this_thread::get_id() == q.writer.get_id();
+}
+
+static void stop_writing() {
+  AsyncQueue &q = async_queue();
+  {
+    std::unique_lock<std::mutex> guard(q.lock);
+    if (!q.running) return;
+    if (on_writer(q)) {
+      // A task has called exit, so the writer cannot join itself.
+      // Instead we write whatever is left right here, after dropping
+      // the task that is running (which will never finish).
+      q.queued_bytes -= q.tasks.front().bytes;
+      q.tasks.pop_front();
+      while (!q.tasks.empty()) {
+        AsyncTask t;
+        t.bytes = q.tasks.front().bytes;
+        t.run.swap(q.tasks.front().run);
+        q.tasks.pop_front();
+        q.queued_bytes -= t.bytes;
+        guard.unlock();
+        t.run();
+        guard.lock();
+      }
+      q.changed.notify_all();
+      q.writer.detach();
+      q.running = false;
+      return;
+    }
+    q.stopping = true;
+    q.changed.notify_all();
+  }
+  q.writer.join();
+  std::lock_guard<std::mutex> guard(q.lock);
+  q.running = false;
+  q.stopping = false;
+}
+
+void async_run(long bytes, const std::function<void()> &task) {
+  AsyncQueue &q = async_queue();
+  std::unique_lock<std::mutex> guard(q.lock);
+  if (on_writer(q)) {
+    // A task is asking for more output.  It would wait forever for
+    // room in the queue (or for its turn) if we queued it, since it
+    // is the writer itself, so we run it right away.
+    guard.unlock();
+    task();
+    return;
+  }
+  while (!q.tasks.empty() && q.queued_bytes + bytes > q.limit) q.changed.wait(guard);
+  AsyncTask t;
+  t.bytes = bytes;
+  t.run = task;
+  q.tasks.push_back(t);
+  q.queued_bytes += bytes;
+  if (!q.running) {
+    static bool registered = false;
+    if (!registered) atexit(stop_writing);
+    registered = true;
+    q.running = true;
+    q.writer = std::thread(write_everything);
+  }
+  q.changed.notify_all();
+}
+
+void async_output(const Grid &g, const std::function<void(const Grid &)> &write) {
+  // The shared_ptr lets the task be copied (as std::function requires)
+  // without copying the snapshot.
+  std::shared_ptr<Grid> snapshot(new Grid(g));
+  async_run(g.rows()*sizeof(double), [snapshot, write]() { write(*snapshot); });
+}
+
+void async_output_flush() {
+  AsyncQueue &q = async_queue();
+  std::unique_lock<std::mutex> guard(q.lock);
+  // A task cannot wait for itself to finish, and anything it asked to
+  // write has already been written.
+  if (on_writer(q)) return;
+  while (!q.tasks.empty()) q.changed.wait(guard);
+}
+
+void async_output_set_limit(long bytes) {
+  AsyncQueue &q = async_queue();
+  std::lock_guard<std::mutex> guard(q.lock);
+  q.limit = bytes;
+  q.changed.notify_all();
+}
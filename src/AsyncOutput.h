@@ -0,0 +1,51 @@
+// -*- mode: C++; -*-
+
+#pragma once
+
+#include <functional>
+#include "Grid.h"
+
+// The async_output functions write plots and data files on a
+// background thread, so that a minimization need not sit idle while
+// we format megabytes of text or postscript.  Each call takes a
+// snapshot of whatever it needs and returns at once; the writes are
+// then done one at a time, in the order they were asked for.
+//
+// The snapshots are bounded: if more than the limit (by default 1 GB,
+// or DEFT_ASYNC_OUTPUT_MB megabytes) is waiting to be written, the
+// next call blocks until enough has been written.  Everything is
+// flushed when the program exits (including through exit), so no
+// output is ever lost.
+//
+// A typical use is
+//
+//   std::string name = plotname;
+//   async_output(density, [name](const Grid &d) {
+//     d.epsNativeSlice(name.c_str(), ...);
+//   });
+//
+// where the lambda must capture by value (in particular copying any
+// file name into a std::string), since it runs after the caller has
+// moved on.
+//
+// Two things behave differently when called from within a write,
+// i.e. on the writer thread.  A write that asks for more output (or
+// for a flush) cannot wait on itself, so the new output is written
+// at once, before the call returns, and does not count against the
+// limit.  A write that calls exit cannot be waited for either, so the
+// writes still queued are then done on the writer thread, and the
+// write that called exit never finishes.
+
+// async_output runs write on a copy of g.
+void async_output(const Grid &g, const std::function<void(const Grid &)> &write);
+// async_run runs task, which owns a snapshot taking the given number
+// of bytes.  This is for output that needs more than one Grid, or
+// data other than a Grid.
+void async_run(long bytes, const std::function<void()> &task);
+// async_output_flush waits for everything queued so far to be
+// written.
+void async_output_flush();
+// async_output_set_limit sets how many bytes of snapshots may be
+// waiting at once.  A single snapshot larger than the limit is
+// allowed when nothing else is waiting.
+void async_output_set_limit(long bytes);
@@ -36,10 +36,10 @@ public:
   }
 
   VectorXd transform(const GridDescription &gd, double kT, const VectorXd &Veff) const {
-    return f(gd, kT, (Veff/(-kT)).cwise().exp());
+    return f(gd, kT, vector_exp(Veff/(-kT)));
   }
   double integral(const GridDescription &gd, double kT, const VectorXd &x) const {
-    return f.integral(gd, kT, (x/(-kT)).cwise().exp());
+    return f.integral(gd, kT, vector_exp(x/(-kT)));
   }
   double transform(double kT, double n) const {
     return f(kT, exp(-n/kT));
@@ -51,6 +51,13 @@ public:
   double d_by_dT(double kT, double n) const {
     return f.d_by_dT(kT, exp(-n/kT));
   }
+  VectorXd transform_batch(const VectorXd &kT, const VectorXd &V) const {
+    return f.transform_batch(kT, vector_exp((-V).cwise()/kT));
+  }
+  VectorXd derive_batch(const VectorXd &kT, const VectorXd &V) const {
+    const VectorXd n = vector_exp((-V).cwise()/kT);
+    return (n.cwise()/(-kT)).cwise()*f.derive_batch(kT, n);
+  }
   Functional grad(const Functional &ingrad, const Functional &V, bool ispgrad) const {
     Functional n = exp(-V/kT());
     if (ispgrad) return f.grad(-ingrad/kT(), n, false);
@@ -61,11 +68,12 @@ public:
   }
   void grad(const GridDescription &gd, double kT, const VectorXd &Veff,
             const VectorXd &ingrad, VectorXd *outgrad, VectorXd *outpgrad) const {
+    const VectorXd n = vector_exp(Veff/(-kT));
     if (outpgrad) {
       Grid g(gd);
       g.setZero();
-      f.grad(gd, kT, (Veff/(-kT)).cwise().exp(), ingrad, &g, 0);
-      *outgrad += (Veff/(-kT)).cwise().exp().cwise()*g/(-kT);
+      f.grad(gd, kT, n, ingrad, &g, 0);
+      *outgrad += n.cwise()*g/(-kT);
       //*outpgrad += g/(-kT);
       // we think the above should be:
       *outpgrad += g.cwise()/(Veff - VectorXd::Ones(gd.NxNyNz)*kT);
@@ -73,8 +81,8 @@ public:
     } else {
       Grid g(gd);
       g.setZero();
-      f.grad(gd, kT, (Veff/(-kT)).cwise().exp(), ingrad, &g, 0);
-      *outgrad += (Veff/(-kT)).cwise().exp().cwise()*g/(-kT);
+      f.grad(gd, kT, n, ingrad, &g, 0);
+      *outgrad += n.cwise()*g/(-kT);
     }
   }
   void print_summary(const char *prefix, double e, std::string name) const {
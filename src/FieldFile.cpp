@@ -0,0 +1,222 @@
+// Deft is a density functional package developed by the research
+// group of Professor David Roundy
+//
+// Copyright 2010 The Deft Authors
+//
+// Deft is free software; you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// You should have received a copy of the GNU General Public License
+// along with deft; if not, write to the Free Software Foundation,
+// Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+//
+// Please see the file AUTHORS for a list of authors.
+
+#include "FieldFile.h"
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+// The header is laid out as follows, with every number in native
+// byte order:
+//
+//   bytes 0-7      the magic string "DEFTFLD1"
+//   bytes 8-11     the uint32 0x01020304, to catch a byte order mismatch
+//   bytes 12-15    the uint32 number of parameters
+//   bytes 16-39    Nx, Ny and Nz as int64s
+//   bytes 40-111   a1, a2 and a3 as doubles
+//   bytes 112-     the parameters, each a 32-byte name (padded with
+//                  zeros) followed by a double
+//
+// and the remainder is zero.
+static const char field_magic[] = "DEFTFLD1";
+static const uint32_t field_byte_order = 0x01020304;
+static const long field_parameters_start = 112;
+static const long field_parameter_bytes = 40;
+static const long field_name_bytes = 32;
+static const long field_max_parameters =
+  (field_header_bytes - field_parameters_start)/field_parameter_bytes;
+
+FieldHeader::FieldHeader() : Nx(0), Ny(0), Nz(0) {
+  for (int i=0; i<3; i++) a1[i] = a2[i] = a3[i] = 0;
+}
+
+void FieldHeader::set_parameter(const char *name, double value) {
+  for (unsigned i=0; i<parameters.size(); i++) {
+    if (parameters[i].first == name) {
+      parameters[i].second = value;
+      return;
+    }
+  }
+  parameters.push_back(std::make_pair(std::string(name), value));
+}
+
+bool FieldHeader::get_parameter(const char *name, double *value) const {
+  for (unsigned i=0; i<parameters.size(); i++) {
+    if (parameters[i].first == name) {
+      *value = parameters[i].second;
+      return true;
+    }
+  }
+  return false;
+}
+
+bool write_field_file(const char *fname, const FieldHeader &h, const double *data) {
+  if (long(h.parameters.size()) > field_max_parameters) {
+    printf("Too many parameters (%d) for field file %s!\n", int(h.parameters.size()), fname);
+    return false;
+  }
+  char header[field_header_bytes];
+  memset(header, 0, sizeof(header));
+  memcpy(header, field_magic, 8);
+  const uint32_t num_parameters = h.parameters.size();
+  memcpy(header + 8, &field_byte_order, 4);
+  memcpy(header + 12, &num_parameters, 4);
+  const int64_t N[3] = { h.Nx, h.Ny, h.Nz };
+  memcpy(header + 16, N, sizeof(N));
+  memcpy(header + 40, h.a1, sizeof(h.a1));
+  memcpy(header + 64, h.a2, sizeof(h.a2));
+  memcpy(header + 88, h.a3, sizeof(h.a3));
+  for (unsigned i=0; i<num_parameters; i++) {
+    char *p = header + field_parameters_start + i*field_parameter_bytes;
+    if (h.parameters[i].first.size() >= size_t(field_name_bytes)) {
+      printf("Parameter name %s is too long for field file %s!\n",
+             h.parameters[i].first.c_str(), fname);
+      return false;
+    }
+    strcpy(p, h.parameters[i].first.c_str());
+    memcpy(p + field_name_bytes, &h.parameters[i].second, sizeof(double));
+  }
+
+  FILE *f = fopen(fname, "wb");
+  if (!f) {
+    printf("Unable to create file %s!\n", fname);
+    return false;
+  }
+  const size_t size = h.size();
+  if (fwrite(header, 1, sizeof(header), f) != sizeof(header)
+      || fwrite(data, sizeof(double), size, f) != size) {
+    printf("Error writing field file %s!\n", fname);
+    fclose(f);
+    return false;
+  }
+  if (fclose(f)) {
+    printf("Error writing field file %s!\n", fname);
+    return false;
+  }
+  return true;
+}
+
+FieldFile::FieldFile() : mapping(0), mapped_bytes(0), values(0) {}
+
+FieldFile::~FieldFile() {
+  close();
+}
+
+void FieldFile::close() {
+  if (mapping) munmap(mapping, mapped_bytes);
+  mapping = 0;
+  mapped_bytes = 0;
+  values = 0;
+  h = FieldHeader();
+}
+
+bool FieldFile::open(const char *fname) {
+  close();
+  const int fd = ::open(fname, O_RDONLY);
+  if (fd < 0) {
+    printf("Unable to open field file %s!\n", fname);
+    return false;
+  }
+  struct stat st;
+  char header[field_header_bytes];
+  if (fstat(fd, &st) || st.st_size < field_header_bytes
+      || pread(fd, header, sizeof(header), 0) != long(sizeof(header))
+      || memcmp(header, field_magic, 8)) {
+    printf("%s is not a field file!\n", fname);
+    ::close(fd);
+    return false;
+  }
+  uint32_t byte_order, num_parameters;
+  memcpy(&byte_order, header + 8, 4);
+  memcpy(&num_parameters, header + 12, 4);
+  if (byte_order != field_byte_order) {
+    printf("Field file %s was written on a machine with a different byte order!\n", fname);
+    ::close(fd);
+    return false;
+  }
+  if (num_parameters > field_max_parameters) {
+    printf("Field file %s has a corrupt header!\n", fname);
+    ::close(fd);
+    return false;
+  }
+  int64_t N[3];
+  memcpy(N, header + 16, sizeof(N));
+  h.Nx = N[0];
+  h.Ny = N[1];
+  h.Nz = N[2];
+  memcpy(h.a1, header + 40, sizeof(h.a1));
+  memcpy(h.a2, header + 64, sizeof(h.a2));
+  memcpy(h.a3, header + 88, sizeof(h.a3));
+  for (unsigned i=0; i<num_parameters; i++) {
+    const char *p = header + field_parameters_start + i*field_parameter_bytes;
+    char name[field_name_bytes];
+    memcpy(name, p, field_name_bytes);
+    name[field_name_bytes-1] = 0;
+    double value;
+    memcpy(&value, p + field_name_bytes, sizeof(double));
+    h.parameters.push_back(std::make_pair(std::string(name), value));
+  }
+  if (N[0] < 0 || N[1] < 0 || N[2] < 0
+      || st.st_size < field_header_bytes + long(sizeof(double))*h.size()) {
+    printf("Field file %s is truncated!\n", fname);
+    ::close(fd);
+    h = FieldHeader();
+    return false;
+  }
+
+  mapped_bytes = field_header_bytes + sizeof(double)*h.size();
+  mapping = mmap(0, mapped_bytes, PROT_READ, MAP_SHARED, fd, 0);
+  ::close(fd); // the mapping keeps the file open
+  if (mapping == MAP_FAILED) {
+    printf("Unable to map field file %s!\n", fname);
+    mapping = 0;
+    mapped_bytes = 0;
+    h = FieldHeader();
+    return false;
+  }
+  values = (const double *)((const char *)mapping + field_header_bytes);
+  return true;
+}
+
+void FieldFile::line(int axis, int i, int j, double *out) const {
+  const long N[3] = { h.Nx, h.Ny, h.Nz };
+  const long stride[3] = { long(h.Ny)*h.Nz, h.Nz, 1 };
+  // i and j are the indices along the other two axes, in order.
+  const int ai = axis == 0 ? 1 : 0, aj = axis == 2 ? 1 : 2;
+  const double *start = values + i*stride[ai] + j*stride[aj];
+  for (long n=0; n<N[axis]; n++) out[n] = start[n*stride[axis]];
+}
+
+void FieldFile::plane(int axis, int i, double *out) const {
+  if (axis == 0) {
+    // This plane is contiguous in the file.
+    const long NyNz = long(h.Ny)*h.Nz;
+    memcpy(out, values + i*NyNz, NyNz*sizeof(double));
+  } else if (axis == 1) {
+    for (long x=0; x<h.Nx; x++) {
+      memcpy(out + x*h.Nz, values + (x*h.Ny + i)*h.Nz, h.Nz*sizeof(double));
+    }
+  } else {
+    for (long x=0; x<h.Nx; x++) {
+      for (long y=0; y<h.Ny; y++) out[x*h.Ny + y] = values[(x*h.Ny + y)*h.Nz + i];
+    }
+  }
+}
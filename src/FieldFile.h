@@ -0,0 +1,82 @@
+// -*- mode: C++; -*-
+
+#pragma once
+
+#include <stddef.h>
+#include <string>
+#include <vector>
+
+// A field file holds one field on a 3D grid in binary, so that a
+// 512^3 density is a 1 GB file that can be mapped straight into
+// memory, rather than many more bytes of text that must be parsed.
+// The file is a 4096-byte header followed by Nx*Ny*Nz doubles in
+// native byte order, with z varying fastest, which is the order of
+// both Grid and the fields of the new code.
+//
+// The header holds the grid dimensions, the lattice vectors of the
+// cell and a list of named parameters (kT, the functional's
+// parameters, or anything else that describes how the field was
+// made).  Since the data starts on a page boundary, it can be mapped
+// without copying.  Grid::Save and Grid::Load read and write these
+// files for the old code.  Vector::mapped gives a Vector that maps a
+// field file copy-on-write, and assigning it into a functional's input
+// (e.g. f.Veff() = Vector::mapped(fname)) restarts a minimization from
+// a saved density.
+
+typedef std::vector<std::pair<std::string, double> > FieldParameters;
+
+struct FieldHeader {
+  FieldHeader();
+  int Nx, Ny, Nz;
+  double a1[3], a2[3], a3[3]; // the lattice vectors of the cell
+  FieldParameters parameters;
+
+  long size() const { return long(Nx)*Ny*Nz; }
+  void set_parameter(const char *name, double value);
+  // get_parameter returns false (and leaves value alone) if there is
+  // no such parameter.
+  bool get_parameter(const char *name, double *value) const;
+};
+
+// field_header_bytes is the size of the header, and is where the data
+// starts.
+static const long field_header_bytes = 4096;
+
+// write_field_file writes data (which has h.size() elements) to
+// fname.  It prints a message and returns false if anything goes
+// wrong.
+bool write_field_file(const char *fname, const FieldHeader &h, const double *data);
+
+// A FieldFile maps a field file read-only, so only the parts of it
+// that are actually used are read from disk.  This makes it cheap to
+// pull a line or a plane out of a huge file.
+class FieldFile {
+public:
+  FieldFile();
+  ~FieldFile();
+  // open returns false (printing why) if fname is not a field file
+  // that we can read.
+  bool open(const char *fname);
+  void close();
+
+  const FieldHeader &header() const { return h; }
+  const double *data() const { return values; }
+  double operator()(int x, int y, int z) const {
+    return values[(long(x)*h.Ny + y)*h.Nz + z];
+  }
+  // line copies the points along the given axis (0, 1 or 2 for x, y
+  // or z) that have the other two indices i and j (in xyz order) into
+  // out, which must have room for them.
+  void line(int axis, int i, int j, double *out) const;
+  // plane copies the plane perpendicular to the given axis at index
+  // i into out, with the later of the remaining axes varying fastest.
+  void plane(int axis, int i, double *out) const;
+
+private:
+  FieldHeader h;
+  void *mapping;
+  size_t mapped_bytes;
+  const double *values;
+  FieldFile(const FieldFile &); // not copyable
+  void operator=(const FieldFile &);
+};
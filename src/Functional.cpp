@@ -16,6 +16,8 @@
 
 #include "Functionals.h"
 #include "handymath.h"
+#include "VectorMath.h"
+#include "GridParallel.h"
 #include "Grid.h"
 
 bool FunctionalInterface::I_have_analytic_grad() const {
@@ -65,7 +67,37 @@ void FunctionalInterface::print_summary(const char *prefix, double e, std::strin
 }
 
 double FunctionalInterface::integral(const GridDescription &gd, double kT, const VectorXd &x) const {
-  return transform(gd, kT, x).sum()*gd.dvolume;
+  return grid_sum(transform(gd, kT, x))*gd.dvolume;
+}
+
+VectorXd vector_exp(const VectorXd &x) {
+  VectorXd out(x.rows());
+  vm_exp(x.data(), out.data(), x.rows());
+  return out;
+}
+
+VectorXd vector_log(const VectorXd &x) {
+  VectorXd out(x.rows());
+  vm_log(x.data(), out.data(), x.rows());
+  return out;
+}
+
+VectorXd vector_sqrt(const VectorXd &x) {
+  VectorXd out(x.rows());
+  vm_sqrt(x.data(), out.data(), x.rows());
+  return out;
+}
+
+VectorXd FunctionalInterface::transform_batch(const VectorXd &kT, const VectorXd &x) const {
+  VectorXd out(x.rows());
+  for (int i=0; i<x.rows(); i++) out[i] = transform(kT[i], x[i]);
+  return out;
+}
+
+VectorXd FunctionalInterface::derive_batch(const VectorXd &kT, const VectorXd &x) const {
+  VectorXd out(x.rows());
+  for (int i=0; i<x.rows(); i++) out[i] = derive(kT[i], x[i]);
+  return out;
 }
 
 // The following is a "fake" functional, used for dumping code to
@@ -333,6 +365,12 @@ public:
   double d_by_dT(double, double) const {
     return 0;
   }
+  VectorXd transform_batch(const VectorXd &, const VectorXd &x) const {
+    return VectorXd::Ones(x.rows());
+  }
+  VectorXd derive_batch(const VectorXd &, const VectorXd &x) const {
+    return VectorXd::Ones(x.rows());
+  }
   Functional grad(const Functional &, const Functional &, bool) const {
     return Functional(0.0);
   }
@@ -367,6 +405,12 @@ public:
   double d_by_dT(double, double) const {
     return 0;
   }
+  VectorXd transform_batch(const VectorXd &, const VectorXd &x) const {
+    return c*VectorXd::Ones(x.rows());
+  }
+  VectorXd derive_batch(const VectorXd &, const VectorXd &x) const {
+    return VectorXd::Zero(x.rows());
+  }
   Functional grad(const Functional &, const Functional &, bool) const {
     return Functional(0.0);
   }
@@ -477,12 +521,12 @@ public:
     // the sum, just in case we want to print it!
     VectorXd f2data(f2(gd, kT, data));
     VectorXd f1f2data(f1.justMe(gd, kT, f2data));
-    double e = gd.dvolume*f1f2data.sum();
+    double e = gd.dvolume*grid_sum(f1f2data);
     f1.set_last_energy(e);
     Functional *nxt = f1.next();
     while (nxt) {
-      f1f2data += nxt->justMe(gd, kT, f2data);
-      double etot = gd.dvolume*f1f2data.sum();
+      grid_add(&f1f2data, nxt->justMe(gd, kT, f2data));
+      double etot = gd.dvolume*grid_sum(f1f2data);
       nxt->set_last_energy(etot - e);
       e = etot;
       nxt = nxt->next();
@@ -499,6 +543,12 @@ public:
     double f2n = f2(kT, n);
     return f1.d_by_dT(kT, f2n) + f2.d_by_dT(kT,n)*f1.derive(kT, f2n);
   }
+  VectorXd transform_batch(const VectorXd &kT, const VectorXd &x) const {
+    return f1.transform_batch(kT, f2.transform_batch(kT, x));
+  }
+  VectorXd derive_batch(const VectorXd &kT, const VectorXd &x) const {
+    return f1.derive_batch(kT, f2.transform_batch(kT, x)).cwise()*f2.derive_batch(kT, x);
+  }
   Functional grad(const Functional &ingrad, const Functional &x, bool ispgrad) const {
     return f2.grad(f1.grad(ingrad, f2(x), ispgrad), x, ispgrad);
   }
@@ -550,7 +600,9 @@ public:
   }
 
   VectorXd transform(const GridDescription &gd, double kT, const VectorXd &data) const {
-    return f1(gd, kT, data).cwise()/f2(gd, kT, data);
+    VectorXd out = f1(gd, kT, data);
+    grid_assign(&out, out.cwise()/f2(gd, kT, data));
+    return out;
   }
   double transform(double kT, double n) const {
     return f1(kT, n)/f2(kT, n);
@@ -563,6 +615,14 @@ public:
     double f2n = f2(kT, n);
     return f1.d_by_dT(kT, n)/f2n - f1(kT, n)*f2.d_by_dT(kT, n)/(f2n*f2n);
   }
+  VectorXd transform_batch(const VectorXd &kT, const VectorXd &x) const {
+    return f1.transform_batch(kT, x).cwise()/f2.transform_batch(kT, x);
+  }
+  VectorXd derive_batch(const VectorXd &kT, const VectorXd &x) const {
+    const VectorXd f2x = f2.transform_batch(kT, x);
+    const VectorXd f1x_over_f2x = f1.transform_batch(kT, x).cwise()/f2x;
+    return (f1.derive_batch(kT, x) - f1x_over_f2x.cwise()*f2.derive_batch(kT, x)).cwise()/f2x;
+  }
   Functional grad(const Functional &ingrad, const Functional &x, bool ispgrad) const {
     return f1.grad(ingrad/f2(x), x, ispgrad) - f2.grad(f1(x)*ingrad/sqr(f2(x)), x, ispgrad);
   }
@@ -571,10 +631,13 @@ public:
   }
   void grad(const GridDescription &gd, double kT, const VectorXd &data,
             const VectorXd &ingrad, VectorXd *outgrad, VectorXd *outpgrad) const {
-    VectorXd out2 = f2(gd, kT, data);
-    f1.grad(gd, kT, data, ingrad.cwise()/out2, outgrad, outpgrad);
-    f2.grad(gd, kT, data, (ingrad.cwise()*f1(gd, kT, data)).cwise()/((-out2).cwise()*out2),
-            outgrad, outpgrad);
+    const VectorXd out2 = f2(gd, kT, data);
+    VectorXd ingrad1(out2.rows());
+    grid_assign(&ingrad1, ingrad.cwise()/out2);
+    f1.grad(gd, kT, data, ingrad1, outgrad, outpgrad);
+    VectorXd ingrad2 = f1(gd, kT, data);
+    grid_assign(&ingrad2, (ingrad.cwise()*ingrad2).cwise()/((-out2).cwise()*out2));
+    f2.grad(gd, kT, data, ingrad2, outgrad, outpgrad);
   }
   bool I_have_analytic_grad() const {
     return f1.I_have_analytic_grad() && f2.I_have_analytic_grad();
@@ -603,7 +666,9 @@ public:
   }
 
   VectorXd transform(const GridDescription &gd, double kT, const VectorXd &data) const {
-    return f1(gd, kT, data).cwise()*f2(gd, kT, data);
+    VectorXd out = f1(gd, kT, data);
+    grid_multiply(&out, f2(gd, kT, data));
+    return out;
   }
   double transform(double kT, double n) const {
     return f1(kT, n)*f2(kT, n);
@@ -614,6 +679,13 @@ public:
   double d_by_dT(double kT, double n) const {
     return f1(kT, n)*f2.d_by_dT(kT, n) + f1.d_by_dT(kT, n)*f2(kT, n);
   }
+  VectorXd transform_batch(const VectorXd &kT, const VectorXd &x) const {
+    return f1.transform_batch(kT, x).cwise()*f2.transform_batch(kT, x);
+  }
+  VectorXd derive_batch(const VectorXd &kT, const VectorXd &x) const {
+    return f1.transform_batch(kT, x).cwise()*f2.derive_batch(kT, x)
+      + f1.derive_batch(kT, x).cwise()*f2.transform_batch(kT, x);
+  }
   Functional grad(const Functional &ingrad, const Functional &x, bool ispgrad) const {
     return f2.grad(f1(x)*ingrad, x, ispgrad) + f1.grad(f2(x)*ingrad, x, ispgrad);
   }
@@ -622,8 +694,12 @@ public:
   }
   void grad(const GridDescription &gd, double kT, const VectorXd &data,
             const VectorXd &ingrad, VectorXd *outgrad, VectorXd *outpgrad) const {
-    f1.grad(gd, kT, data, ingrad.cwise()*f2(gd, kT, data), outgrad, outpgrad);
-    f2.grad(gd, kT, data, ingrad.cwise()*f1(gd, kT, data), outgrad, outpgrad);
+    VectorXd ingrad1 = f2(gd, kT, data);
+    grid_multiply(&ingrad1, ingrad);
+    f1.grad(gd, kT, data, ingrad1, outgrad, outpgrad);
+    VectorXd ingrad2 = f1(gd, kT, data);
+    grid_multiply(&ingrad2, ingrad);
+    f2.grad(gd, kT, data, ingrad2, outgrad, outpgrad);
   }
   bool I_have_analytic_grad() const {
     return f1.I_have_analytic_grad() && f2.I_have_analytic_grad();
@@ -646,7 +722,7 @@ public:
   LogType() {}
 
   VectorXd transform(const GridDescription &, double, const VectorXd &data) const {
-    return data.cwise().log();
+    return vector_log(data);
   }
   double transform(double, double n) const {
     return log(n);
@@ -654,6 +730,12 @@ public:
   double derive(double, double n) const {
     return 1/n;
   }
+  VectorXd transform_batch(const VectorXd &, const VectorXd &x) const {
+    return vector_log(x);
+  }
+  VectorXd derive_batch(const VectorXd &, const VectorXd &x) const {
+    return x.cwise().inverse();
+  }
   double d_by_dT(double, double) const {
     return 0;
   }
@@ -665,8 +747,8 @@ public:
   }
   void grad(const GridDescription &, double, const VectorXd &data,
             const VectorXd &ingrad, VectorXd *outgrad, VectorXd *outpgrad) const {
-    *outgrad += ingrad.cwise()/data;
-    if (outpgrad) *outpgrad += ingrad.cwise()/data;
+    grid_add(outgrad, ingrad.cwise()/data);
+    if (outpgrad) grid_add(outpgrad, ingrad.cwise()/data);
   }
 };
 
@@ -680,7 +762,7 @@ public:
   ExpType() {}
 
   VectorXd transform(const GridDescription &, double, const VectorXd &data) const {
-    return data.cwise().exp();
+    return vector_exp(data);
   }
   double transform(double, double n) const {
     return exp(n);
@@ -688,6 +770,12 @@ public:
   double derive(double, double n) const {
     return exp(n);
   }
+  VectorXd transform_batch(const VectorXd &, const VectorXd &x) const {
+    return vector_exp(x);
+  }
+  VectorXd derive_batch(const VectorXd &, const VectorXd &x) const {
+    return vector_exp(x);
+  }
   double d_by_dT(double, double) const {
     return 0;
   }
@@ -699,8 +787,9 @@ public:
   }
   void grad(const GridDescription &, double, const VectorXd &data,
             const VectorXd &ingrad, VectorXd *outgrad, VectorXd *outpgrad) const {
-    *outgrad += ingrad.cwise() * data.cwise().exp();
-    if (outpgrad) *outpgrad += ingrad.cwise() * data.cwise().exp();
+    const VectorXd expdata = vector_exp(data);
+    grid_add(outgrad, ingrad.cwise() * expdata);
+    if (outpgrad) grid_add(outpgrad, ingrad.cwise() * expdata);
   }
 };
 
@@ -722,6 +811,12 @@ public:
   double derive(double, double n) const {
     return n/fabs(n);
   }
+  VectorXd transform_batch(const VectorXd &, const VectorXd &x) const {
+    return x.cwise().abs();
+  }
+  VectorXd derive_batch(const VectorXd &, const VectorXd &x) const {
+    return x.cwise()/x.cwise().abs();
+  }
   double d_by_dT(double, double) const {
     return 0;
   }
@@ -733,8 +828,8 @@ public:
   }
   void grad(const GridDescription &, double, const VectorXd &data,
             const VectorXd &ingrad, VectorXd *outgrad, VectorXd *outpgrad) const {
-    *outgrad += ingrad.cwise() * (data.cwise() / data.cwise().abs());
-    if (outpgrad) *outpgrad += ingrad.cwise() * (data.cwise() / data.cwise().abs());
+    grid_add(outgrad, ingrad.cwise() * (data.cwise() / data.cwise().abs()));
+    if (outpgrad) grid_add(outpgrad, ingrad.cwise() * (data.cwise() / data.cwise().abs()));
   }
 };
 
@@ -793,6 +888,12 @@ public:
   double d_by_dT(double kT, double n) const {
     return f.d_by_dT(kT, n);
   }
+  VectorXd transform_batch(const VectorXd &kT, const VectorXd &x) const {
+    return f.transform_batch(kT, x);
+  }
+  VectorXd derive_batch(const VectorXd &kT, const VectorXd &x) const {
+    return f.derive_batch(kT, x);
+  }
   Functional grad(const Functional &ingrad, const Functional &x, bool ispgrad) const {
     return Functional(constraint)*f.grad(ingrad, x, ispgrad);
   }
@@ -804,7 +905,7 @@ public:
     VectorXd mypgrad(data);
     mypgrad.setZero();
     f.pgrad(gd, kT, data, ingrad, &mypgrad);
-    *outpgrad += constraint.cwise() * mypgrad;
+    grid_add(outpgrad, constraint.cwise() * mypgrad);
   }
   void grad(const GridDescription &gd, double kT, const VectorXd &data,
             const VectorXd &ingrad, VectorXd *outgrad, VectorXd *outpgrad) const {
@@ -813,13 +914,13 @@ public:
       mygrad.setZero();
       mypgrad.setZero();
       f.grad(gd, kT, data, ingrad, &mygrad, &mypgrad);
-      *outgrad += constraint.cwise() * mygrad;
-      *outpgrad += constraint.cwise() * mypgrad;
+      grid_add(outgrad, constraint.cwise() * mygrad);
+      grid_add(outpgrad, constraint.cwise() * mypgrad);
     } else {
       VectorXd mygrad(data);
       mygrad.setZero();
       f.grad(gd, kT, data, ingrad, &mygrad, 0);
-      *outgrad += constraint.cwise() * mygrad;
+      grid_add(outgrad, constraint.cwise() * mygrad);
     }
   }
   void print_summary(const char *prefix, double e, std::string name) const {
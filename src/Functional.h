@@ -3,6 +3,8 @@
 #pragma once
 
 #include "ReciprocalGrid.h"
+#include "Profiler.h"
+#include "GridParallel.h"
 
 class Functional;
 
@@ -25,6 +27,12 @@ public:
                     const VectorXd &ingrad, VectorXd *outgrad, VectorXd *outpgrad) const = 0;
   virtual double derive(double kT, double data) const = 0;
   virtual double d_by_dT(double kT, double data) const = 0;
+  // The following evaluate the homogeneous transform and derivative
+  // for many points at once, with the ith point at temperature kT[i]
+  // and input x[i].  The default just loops over the scalar versions,
+  // so only override them when you can do better.
+  virtual VectorXd transform_batch(const VectorXd &kT, const VectorXd &x) const;
+  virtual VectorXd derive_batch(const VectorXd &kT, const VectorXd &x) const;
   virtual Functional grad(const Functional &ingrad, const Functional &x, bool ispgrad) const = 0;
   virtual Functional grad_T(const Functional &ingradT) const = 0;
 
@@ -116,7 +124,7 @@ public:
   }
   VectorXd operator()(const GridDescription &gd, double kT, const VectorXd &data) const {
     VectorXd out = itsCounter->ptr->transform(gd, kT, data);
-    if (mynext) out += (*mynext)(gd, kT, data);
+    if (mynext) grid_add(&out, (*mynext)(gd, kT, data));
     return out;
   }
   VectorXd operator()(double kT, const Grid &g) const {
@@ -130,11 +138,11 @@ public:
   }
   double integral(const GridDescription &gd, double kT, const VectorXd &data) const {
     // This takes care to save the energies of each term in the sum.
-    double e = itsCounter->ptr->integral(gd, kT, data);
-    set_last_energy(e);
-    Functional *nxt = next();
+    double e = 0;
+    const Functional *nxt = this;
     while (nxt) {
-      double enext = nxt->itsCounter->ptr->integral(gd, kT, data);
+      ProfileScope profile(nxt->itsCounter->name, "integral");
+      const double enext = nxt->itsCounter->ptr->integral(gd, kT, data);
       nxt->set_last_energy(enext);
       e += enext;
       nxt = nxt->next();
@@ -183,7 +191,10 @@ public:
   }
   void grad(const GridDescription &gd, double kT, const VectorXd &data,
             const VectorXd &ingrad, VectorXd *outgrad, VectorXd *outpgrad) const {
-    itsCounter->ptr->grad(gd, kT, data, ingrad, outgrad, outpgrad);
+    {
+      ProfileScope profile(itsCounter->name, "grad");
+      itsCounter->ptr->grad(gd, kT, data, ingrad, outgrad, outpgrad);
+    }
     if (mynext) mynext->grad(gd, kT, data, ingrad, outgrad, outpgrad);
   }
   void pgrad(double kT, const GridDescription &gd, const VectorXd &data, const VectorXd &ingrad,
@@ -192,7 +203,10 @@ public:
   }
   void pgrad(const GridDescription &gd, double kT, const VectorXd &data,
              const VectorXd &ingrad, VectorXd *outpgrad) const {
-    itsCounter->ptr->pgrad(gd, kT, data, ingrad, outpgrad);
+    {
+      ProfileScope profile(itsCounter->name, "pgrad");
+      itsCounter->ptr->pgrad(gd, kT, data, ingrad, outpgrad);
+    }
     if (mynext) mynext->pgrad(gd, kT, data, ingrad, outpgrad);
   }
   double derive(double kT, double data) const {
@@ -205,6 +219,19 @@ public:
     if (mynext) out += mynext->d_by_dT(kT, data);
     return out;
   }
+  // transform_batch and derive_batch are the homogeneous operator()
+  // and derive applied to many (kT, x) pairs at once, which saves
+  // walking the functional tree once per point.
+  VectorXd transform_batch(const VectorXd &kT, const VectorXd &x) const {
+    VectorXd out = itsCounter->ptr->transform_batch(kT, x);
+    if (mynext) out += mynext->transform_batch(kT, x);
+    return out;
+  }
+  VectorXd derive_batch(const VectorXd &kT, const VectorXd &x) const {
+    VectorXd out = itsCounter->ptr->derive_batch(kT, x);
+    if (mynext) out += mynext->derive_batch(kT, x);
+    return out;
+  }
   const std::string get_name() const { return itsCounter->name; }
   Functional set_name_stdstring(const std::string &n) { itsCounter->name = n; return *this; }
   Functional set_name(const char *n) {
@@ -351,6 +378,12 @@ Functional sqr(const Functional &);
 Functional sqrt(const Functional &);
 Functional constrain(const Grid &, Functional);
 
+// These apply the vectorized kernels of VectorMath.h to every element
+// of x, which is much faster than Eigen's cwise() versions.
+VectorXd vector_exp(const VectorXd &x);
+VectorXd vector_log(const VectorXd &x);
+VectorXd vector_sqrt(const VectorXd &x);
+
 Functional dV();
 
 
@@ -360,9 +393,16 @@ class ConvolveWith : public FunctionalInterface {
 public:
   ConvolveWith(Derived (*ff)(const GridDescription &, extra),
                extra e, bool isev)
-    : f(ff), data(e), iseven(isev) {}
+    : f(ff), data(e), iseven(isev) {
+    // We compute the k=0 value up front, since it needs a (tiny)
+    // GridDescription, which would otherwise be created (and FFTW
+    // planned) on every homogeneous evaluation.
+    Lattice lat(Cartesian(1,0,0), Cartesian(0,1,0), Cartesian(0,0,1));
+    GridDescription gd(lat, 2, 2, 2);
+    g0 = f(gd, data).func(Reciprocal(0,0,0)).real();
+  }
   ConvolveWith(const ConvolveWith &cw)
-    : f(cw.f), data(cw.data), iseven(cw.iseven) {}
+    : f(cw.f), data(cw.data), iseven(cw.iseven), g0(cw.g0) {}
   bool I_am_local() const {
     return false;
   }
@@ -376,19 +416,23 @@ public:
   EIGEN_STRONG_INLINE VectorXd transform(const GridDescription &gd, double, const VectorXd &x) const {
     Grid out(gd, x);
     ReciprocalGrid recip = out.fft();
-    recip.cwise() *= Eigen::CwiseNullaryOp<Derived, VectorXcd>(gd.NxNyNzOver2, 1, f(gd, data));
+    grid_multiply(&recip, Eigen::CwiseNullaryOp<Derived, VectorXcd>(gd.NxNyNzOver2, 1, f(gd, data)));
     return recip.ifft();
   }
   double gzero() const {
-    Lattice lat(Cartesian(1,0,0), Cartesian(0,1,0), Cartesian(0,0,1));
-    GridDescription gd(lat, 2, 2, 2);
-    return f(gd, data).func(Reciprocal(0,0,0)).real();
+    return g0;
   }
   double transform(double, double n) const {
-    return n*gzero();
+    return n*g0;
   }
   double derive(double, double) const {
-    return gzero();
+    return g0;
+  }
+  VectorXd transform_batch(const VectorXd &, const VectorXd &x) const {
+    return g0*x;
+  }
+  VectorXd derive_batch(const VectorXd &, const VectorXd &x) const {
+    return g0*VectorXd::Ones(x.rows());
   }
   double d_by_dT(double, double) const {
     return 0;
@@ -408,15 +452,20 @@ public:
                                 const VectorXd &ingrad, VectorXd *outgrad, VectorXd *outpgrad) const {
     Grid out(gd, ingrad);
     ReciprocalGrid recip = out.fft();
-    recip.cwise() *= Eigen::CwiseNullaryOp<Derived, VectorXcd>(gd.NxNyNzOver2, 1, f(gd, data));
-    if (iseven) out = recip.ifft();
-    else out = -recip.ifft();
-    *outgrad += out;
-    // FIXME: we will want to propogate preexisting preconditioning
-    if (outpgrad) *outpgrad += out;
+    grid_multiply(&recip, Eigen::CwiseNullaryOp<Derived, VectorXcd>(gd.NxNyNzOver2, 1, f(gd, data)));
+    out = recip.ifft();
+    if (iseven) {
+      grid_add(outgrad, out);
+      // FIXME: we will want to propogate preexisting preconditioning
+      if (outpgrad) grid_add(outpgrad, out);
+    } else {
+      grid_add(outgrad, -out);
+      if (outpgrad) grid_add(outpgrad, -out);
+    }
   }
 private:
   Derived (*f)(const GridDescription &, extra);
   extra data;
   bool iseven;
+  double g0; // the kernel at k = 0
 };
@@ -2,25 +2,29 @@
 #include "ReciprocalGrid.h"
 #include "handymath.h"
 #include "Functionals.h"
+#include "Profiler.h"
 #include <fftw3.h>
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// wrap_index puts i in 0 <= i < n without a loop.
+static inline int wrap_index(long i, int n) {
+  i %= n;
+  return int(i < 0 ? i + n : i);
+}
 
 double Grid::operator()(const Relative &r) const {
   double rx = r(0)*gd.Nx, ry = r(1)*gd.Ny, rz = r(2)*gd.Nz;
-  int ix = floor(rx), iy = floor(ry), iz = floor(rz);
-  double wx = rx-ix, wy = ry-iy, wz = rz-iz;
-  while (ix < 0) ix += gd.Nx;
-  while (iy < 0) iy += gd.Ny;
-  while (iz < 0) iz += gd.Nz;
-  while (ix >= gd.Nx) ix -= gd.Nx;
-  while (iy >= gd.Ny) iy -= gd.Ny;
-  while (iz >= gd.Nz) iz -= gd.Nz;
-  int ixp1 = (ix+1)%gd.Nx, iyp1 = (iy+1)%gd.Ny, izp1 = (iz+1)%gd.Nz;
-  while (ixp1 < 0) ixp1 += gd.Nx;
-  while (iyp1 < 0) iyp1 += gd.Ny;
-  while (izp1 < 0) izp1 += gd.Nz;
-  while (ixp1 >= gd.Nx) ixp1 -= gd.Nx;
-  while (iyp1 >= gd.Ny) iyp1 -= gd.Ny;
-  while (izp1 >= gd.Nz) izp1 -= gd.Nz;
+  const double fx = floor(rx), fy = floor(ry), fz = floor(rz);
+  double wx = rx-fx, wy = ry-fy, wz = rz-fz;
+  const int ix = wrap_index(long(fx), gd.Nx), iy = wrap_index(long(fy), gd.Ny),
+    iz = wrap_index(long(fz), gd.Nz);
+  const int ixp1 = (ix+1 == gd.Nx) ? 0 : ix+1, iyp1 = (iy+1 == gd.Ny) ? 0 : iy+1,
+    izp1 = (iz+1 == gd.Nz) ? 0 : iz+1;
   assert(wx>=0);
   assert(wy>=0);
   assert(wz>=0);
@@ -34,6 +38,100 @@ double Grid::operator()(const Relative &r) const {
     + wx*wy*wz*(*this)(ixp1,iyp1,izp1);
 }
 
+// interpolation_weights gives the weights of the taps grid points
+// around t (which is between the second and third point for tricubic
+// interpolation), and the derivatives of those weights.
+template<int taps>
+static inline void interpolation_weights(double t, double *w, double *dw);
+
+template<>
+inline void interpolation_weights<2>(double t, double *w, double *dw) {
+  w[0] = 1 - t;
+  w[1] = t;
+  dw[0] = -1;
+  dw[1] = 1;
+}
+
+// These are Catmull-Rom weights, which reproduce the grid values at
+// grid points, and have a continuous first derivative.
+template<>
+inline void interpolation_weights<4>(double t, double *w, double *dw) {
+  const double t2 = t*t, t3 = t2*t;
+  w[0] = 0.5*(-t3 + 2*t2 - t);
+  w[1] = 0.5*(3*t3 - 5*t2 + 2);
+  w[2] = 0.5*(-3*t3 + 4*t2 + t);
+  w[3] = 0.5*(t3 - t2);
+  dw[0] = 0.5*(-3*t2 + 4*t - 1);
+  dw[1] = 0.5*(9*t2 - 10*t);
+  dw[2] = 0.5*(-9*t2 + 8*t + 1);
+  dw[3] = 0.5*(3*t2 - 2*t);
+}
+
+template<int taps, bool want_gradients>
+static void sample_points(const double *data, const int N[3], const Matrix3d &toGrid,
+                          const Cartesian *r, long start, long end,
+                          double *values, Cartesian *gradients) {
+  const long stride[3] = { long(N[1])*N[2], N[2], 1 };
+  const int first = (taps == 4) ? -1 : 0;
+  for (long p=start; p<end; p++) {
+    const Vector3d u = toGrid*r[p];
+    // For each direction, the offsets of the points we need, and their
+    // weights and the derivatives of those weights.
+    long offset[3][taps];
+    double w[3][taps], dw[3][taps];
+    for (int k=0; k<3; k++) {
+      const double fl = floor(u[k]);
+      const int i0 = wrap_index(long(fl) + first, N[k]);
+      for (int a=0; a<taps; a++) {
+        const int i = (i0 + a < N[k]) ? i0 + a : i0 + a - N[k];
+        offset[k][a] = i*stride[k];
+      }
+      interpolation_weights<taps>(u[k] - fl, w[k], dw[k]);
+    }
+    double v = 0, gx = 0, gy = 0, gz = 0;
+    for (int a=0; a<taps; a++) {
+      for (int b=0; b<taps; b++) {
+        const double *line = data + offset[0][a] + offset[1][b];
+        double vz = 0, dvz = 0;
+        for (int c=0; c<taps; c++) {
+          vz += w[2][c]*line[offset[2][c]];
+          if (want_gradients) dvz += dw[2][c]*line[offset[2][c]];
+        }
+        v += w[0][a]*w[1][b]*vz;
+        if (want_gradients) {
+          gx += dw[0][a]*w[1][b]*vz;
+          gy += w[0][a]*dw[1][b]*vz;
+          gz += w[0][a]*w[1][b]*dvz;
+        }
+      }
+    }
+    values[p] = v;
+    // The gradient with respect to position is the gradient with
+    // respect to grid coordinates, times the transpose of toGrid.
+    if (want_gradients) gradients[p] = Cartesian(toGrid.transpose()*Vector3d(gx, gy, gz));
+  }
+}
+
+void Grid::Sample(const Cartesian *r, long n, double *values,
+                  Cartesian *gradients, Interpolation how) const {
+  // toGrid takes a position to coordinates in units of grid points,
+  // so we only work out the inverse of the lattice once.
+  Matrix3d toGrid;
+  for (int k=0; k<3; k++) toGrid.col(k) = gd.Lat.toRelative(Cartesian(Vector3d::Unit(k)));
+  const int N[3] = { gd.Nx, gd.Ny, gd.Nz };
+  for (int k=0; k<3; k++) toGrid.row(k) *= N[k];
+  const double *d = data();
+  grid_parallel_for(n, [&](long start, long end) {
+      if (how == tricubic) {
+        if (gradients) sample_points<4,true>(d, N, toGrid, r, start, end, values, gradients);
+        else sample_points<4,false>(d, N, toGrid, r, start, end, values, gradients);
+      } else {
+        if (gradients) sample_points<2,true>(d, N, toGrid, r, start, end, values, gradients);
+        else sample_points<2,false>(d, N, toGrid, r, start, end, values, gradients);
+      }
+    });
+}
+
 Grid::Grid(const GridDescription &gdin) : VectorXd(gdin.NxNyNz), gd(gdin) {
 }
 
@@ -51,6 +149,44 @@ void Grid::Set(double f(Cartesian)) {
   }
 }
 
+bool Grid::Save(const char *fname, const FieldParameters &parameters) const {
+  FieldHeader h;
+  h.Nx = gd.Nx;
+  h.Ny = gd.Ny;
+  h.Nz = gd.Nz;
+  for (int i=0; i<3; i++) {
+    h.a1[i] = gd.Lat.a1()[i];
+    h.a2[i] = gd.Lat.a2()[i];
+    h.a3[i] = gd.Lat.a3()[i];
+  }
+  h.parameters = parameters;
+  return write_field_file(fname, h, data());
+}
+
+bool Grid::Load(const char *fname, FieldParameters *parameters) {
+  FieldFile file;
+  if (!file.open(fname)) return false;
+  const FieldHeader &h = file.header();
+  if (h.Nx != gd.Nx || h.Ny != gd.Ny || h.Nz != gd.Nz) {
+    printf("Field file %s is %d x %d x %d rather than %d x %d x %d!\n",
+           fname, h.Nx, h.Ny, h.Nz, gd.Nx, gd.Ny, gd.Nz);
+    return false;
+  }
+  const Cartesian a[3] = { gd.Lat.a1(), gd.Lat.a2(), gd.Lat.a3() };
+  const double *ha[3] = { h.a1, h.a2, h.a3 };
+  for (int i=0; i<3; i++) {
+    for (int j=0; j<3; j++) {
+      if (fabs(a[i][j] - ha[i][j]) > 1e-10*(fabs(a[i][j]) + 1)) {
+        printf("Field file %s has a different lattice than our grid!\n", fname);
+        return false;
+      }
+    }
+  }
+  memcpy(data(), file.data(), gd.NxNyNz*sizeof(double));
+  if (parameters) *parameters = h.parameters;
+  return true;
+}
+
 void Grid::epsSlice(const char *fname,
                     Cartesian xmax, Cartesian ymax, Cartesian corner,
                     int resolution) const {
@@ -471,32 +607,167 @@ ReciprocalGrid fft(const GridDescription &gd, const VectorXd &g) {
   ReciprocalGrid out(gd);
   const double *mydata = g.data();
   fftw_plan p = fftw_plan_dft_r2c_3d(gd.Nx, gd.Ny, gd.Nz, (double *)mydata, (fftw_complex *)out.data(), FFTW_MEASURE);
+  profile_fft();
   fftw_execute(p);
   fftw_destroy_plan(p);
   out *= gd.dvolume;
   return out;
 }
 
+// RadialOrder holds the points of a grid sorted by their distance
+// from the origin (taking the nearest periodic image), grouped so that
+// points at exactly the same distance are summed together.  On a
+// cubic grid there are far fewer distinct distances than points, so
+// the radial profiles below only need one pass over the grid (to sum
+// each group) plus a cheap pass over the distinct distances.
+struct RadialOrder {
+  Cartesian a1, a2, a3;
+  int Nx, Ny, Nz;
+  std::vector<double> radius; // the distinct distances, increasing
+  std::vector<int> start; // group u is point[start[u]] to point[start[u+1]-1]
+  std::vector<int> point;
+};
+
+// Below this many points, threads aren't worth starting.
+static const int radial_thread_points = 1 << 18;
+
+static int radial_threads(int N) {
+  if (N < radial_thread_points) return 1;
+  int num_threads = std::thread::hardware_concurrency();
+  if (num_threads <= 0) num_threads = 1;
+  return num_threads;
+}
+
+static void run_in_threads(int num_threads, int N, const std::function<void(int,int)> &f) {
+  if (num_threads > N) num_threads = N;
+  std::vector<std::thread> threads;
+  for (int t=1; t<num_threads; t++) {
+    threads.push_back(std::thread(f, t*N/num_threads, (t+1)*N/num_threads));
+  }
+  if (num_threads > 0) f(0, N/num_threads);
+  for (unsigned t=0; t<threads.size(); t++) threads[t].join();
+}
+
+static bool same_vector(const Cartesian &a, const Cartesian &b) {
+  return a(0) == b(0) && a(1) == b(1) && a(2) == b(2);
+}
+
+// radial_order computes the RadialOrder for a grid.  This costs a
+// wignerSeitz and a sort, so we keep the few most recently used ones
+// around, since an analysis typically projects many grids that share
+// one GridDescription.
+static std::shared_ptr<const RadialOrder> radial_order(const GridDescription &gd) {
+  static std::mutex cache_lock;
+  static std::vector<std::shared_ptr<const RadialOrder> > cache;
+  const unsigned cache_size = 4;
+  {
+    std::lock_guard<std::mutex> lock(cache_lock);
+    for (unsigned i=0; i<cache.size(); i++) {
+      const RadialOrder &o = *cache[i];
+      if (o.Nx == gd.Nx && o.Ny == gd.Ny && o.Nz == gd.Nz && same_vector(o.a1, gd.Lat.a1())
+          && same_vector(o.a2, gd.Lat.a2()) && same_vector(o.a3, gd.Lat.a3())) {
+        std::shared_ptr<const RadialOrder> found = cache[i];
+        cache.erase(cache.begin() + i);
+        cache.insert(cache.begin(), found);
+        return found;
+      }
+    }
+  }
+
+  std::shared_ptr<RadialOrder> o(new RadialOrder);
+  o->a1 = gd.Lat.a1();
+  o->a2 = gd.Lat.a2();
+  o->a3 = gd.Lat.a3();
+  o->Nx = gd.Nx;
+  o->Ny = gd.Ny;
+  o->Nz = gd.Nz;
+  std::vector<double> r(gd.NxNyNz);
+  run_in_threads(radial_threads(gd.NxNyNz), gd.Nx, [&](int xstart, int xend) {
+      for (int x=xstart; x<xend; x++) {
+        for (int y=0; y<gd.Ny; y++) {
+          for (int z=0; z<gd.Nz; z++) {
+            Cartesian h(gd.Lat.wignerSeitz(gd.Lat.toCartesian(Relative(x*gd.dx,y*gd.dy,z*gd.dz))));
+            r[x*gd.NyNz + y*gd.Nz + z] = h.norm();
+          }
+        }
+      }
+    });
+  o->point.resize(gd.NxNyNz);
+  for (int i=0; i<gd.NxNyNz; i++) o->point[i] = i;
+  // A stable sort keeps the points within a group in grid order.
+  std::stable_sort(o->point.begin(), o->point.end(),
+                   [&](int a, int b) { return r[a] < r[b]; });
+  for (int i=0; i<gd.NxNyNz; i++) {
+    if (i == 0 || r[o->point[i]] != o->radius.back()) {
+      o->radius.push_back(r[o->point[i]]);
+      o->start.push_back(i);
+    }
+  }
+  o->start.push_back(gd.NxNyNz);
+
+  std::lock_guard<std::mutex> lock(cache_lock);
+  cache.insert(cache.begin(), o);
+  if (cache.size() > cache_size) cache.pop_back();
+  return o;
+}
+
+// group_sums adds up the grid over each group of a RadialOrder.
+static std::vector<double> group_sums(const RadialOrder &o, const double *data) {
+  const int Ngroups = o.radius.size();
+  std::vector<double> sums(Ngroups);
+  run_in_threads(radial_threads(o.point.size()), Ngroups, [&](int ustart, int uend) {
+      for (int u=ustart; u<uend; u++) {
+        double sum = 0;
+        for (int i=o.start[u]; i<o.start[u+1]; i++) sum += data[o.point[i]];
+        sums[u] = sum;
+      }
+    });
+  return sums;
+}
+
 void Grid::ShellProjection(const VectorXd &R, VectorXd *output) const {
   output->setZero();
   VectorXd norm(*output);
   const double wid = 0.5*pow(gd.fineLat.volume(), 1.0/3);
   const double oowid2 = 1/(wid*wid);
-  for (int x=0; x<gd.Nx; x++) {
-    for (int y=0; y<gd.Ny; y++) { 
-      for (int z=0; z<gd.Nz; z++) {
-        Cartesian h(gd.Lat.wignerSeitz(gd.Lat.toCartesian(Relative(x*gd.dx,y*gd.dy,z*gd.dz))));
-        double r = h.norm();
-        for (int ir=0;ir<R.rows();ir++) {
-          double dr = fabs(r-R[ir]);
-          if (dr < 3*wid) {
-            double w = exp(-oowid2*dr*dr);
-            norm[ir] += w;
-            (*output)[ir] += w*(*this)(x,y,z);
-          }
-        }
+  std::shared_ptr<const RadialOrder> o = radial_order(gd);
+  const std::vector<double> sums = group_sums(*o, data());
+  const int Ngroups = o->radius.size();
+
+  // We visit the radii in increasing order, so that the window of
+  // groups within 3*wid of R only ever slides outwards.
+  std::vector<int> order(R.rows());
+  for (int ir=0; ir<R.rows(); ir++) order[ir] = ir;
+  std::sort(order.begin(), order.end(), [&](int a, int b) { return R[a] < R[b]; });
+  int lo = 0, hi = 0;
+  for (unsigned j=0; j<order.size(); j++) {
+    const int ir = order[j];
+    while (lo < Ngroups && o->radius[lo] <= R[ir] - 3*wid) lo++;
+    if (hi < lo) hi = lo;
+    while (hi < Ngroups && o->radius[hi] < R[ir] + 3*wid) hi++;
+    for (int u=lo; u<hi; u++) {
+      double dr = fabs(o->radius[u]-R[ir]);
+      if (dr < 3*wid) {
+        double w = exp(-oowid2*dr*dr);
+        norm[ir] += w*(o->start[u+1] - o->start[u]);
+        (*output)[ir] += w*sums[u];
       }
     }
   }
   output->cwise() /= norm;
 }
+
+void Grid::RadialHistogram(double dr, VectorXd *output) const {
+  std::shared_ptr<const RadialOrder> o = radial_order(gd);
+  const std::vector<double> sums = group_sums(*o, data());
+  const int Nbins = output->rows();
+  output->setZero();
+  VectorXd count(*output);
+  for (unsigned u=0; u<sums.size(); u++) {
+    const double bin = floor(o->radius[u]/dr);
+    if (bin >= Nbins) break;
+    (*output)[int(bin)] += sums[u];
+    count[int(bin)] += o->start[u+1] - o->start[u];
+  }
+  output->cwise() /= count;
+}
@@ -3,6 +3,8 @@
 #pragma once
 
 #include "GridDescription.h"
+#include "FieldFile.h"
+#include "GridParallel.h"
 #include <stdio.h>
 
 #pragma GCC diagnostic push
@@ -44,6 +46,16 @@ public:
     return (*this)(gd.Lat.toRelative(r));
   }
   double operator()(const Relative &r) const;
+  // Sample interpolates the grid at the n points r, which is much
+  // faster than calling operator() n times.  It puts the values in
+  // values and, unless gradients is null, their gradients in
+  // gradients.  Trilinear interpolation gives just what operator()
+  // gives.  Tricubic (Catmull-Rom) interpolation uses the 64 nearest
+  // grid points rather than 8, so it costs more but is accurate to
+  // higher order in the grid spacing, and its gradient is continuous.
+  enum Interpolation { trilinear, tricubic };
+  void Sample(const Cartesian *r, long n, double *values,
+              Cartesian *gradients = 0, Interpolation how = trilinear) const;
   
   void Set(double f(Cartesian));
   void epsSlice(const char *fname, Cartesian xmax, Cartesian ymax,
@@ -52,14 +64,26 @@ public:
                       Cartesian xmax, Cartesian ymax, Cartesian corner) const;
   void epsNative1d(const char *fname, Cartesian xmin, Cartesian xmax, double yscale = 1, double xscale = 1, const char *comment = 0) const;
   void Dump1D(const char *fname, Cartesian xmin, Cartesian xmax) const;
+  // Save writes the grid to a binary field file (see FieldFile.h),
+  // along with our lattice and any parameters you give it.  Load
+  // reads one back (e.g. as an initial guess for a minimization),
+  // filling in parameters if you ask for them.  It returns false if
+  // the file can't be read or doesn't match our GridDescription.
+  bool Save(const char *fname, const FieldParameters &parameters = FieldParameters()) const;
+  bool Load(const char *fname, FieldParameters *parameters = 0);
   void epsRadial1d(const char *fname, double rmin = 0, double rmax = 0, double yscale = 1, double rscale = 1, const char *comment = 0) const;
+  // ShellProjection averages the grid over spherical shells about the
+  // origin with radii R, smoothing over a gaussian about half a grid
+  // spacing wide.  RadialHistogram instead averages over shells of
+  // thickness dr, so that (*output)[i] is the mean over points with
+  // i*dr <= r < (i+1)*dr, for as many bins as output already has.
+  // Both give NaN for a shell without any grid points in it.  The
+  // distance of each grid point from the origin is worked out once
+  // per GridDescription and cached, so these are cheap to call again.
   void ShellProjection(const VectorXd &R, VectorXd *output) const;
+  void RadialHistogram(double dr, VectorXd *output) const;
   double integrate() const {
-    double val = 0;
-    for (int i=0; i<gd.NxNyNz; i++) {
-      val += (*this)[i];
-    }
-    return val*gd.dvolume;
+    return grid_sum(*this)*gd.dvolume;
   }
   GridDescription description() const { return gd; }
 private:
@@ -0,0 +1,154 @@
+// Deft is a density functional package developed by the research
+// group of Professor David Roundy
+//
+// Copyright 2010 The Deft Authors
+//
+// Deft is free software; you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// You should have received a copy of the GNU General Public License
+// along with deft; if not, write to the Free Software Foundation,
+// Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+//
+// Please see the file AUTHORS for a list of authors.
+
+#include "GridParallel.h"
+
+#include <stdlib.h>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Below this many chunks we don't bother with the pool.
+static const long min_parallel_chunks = 4;
+
+// The pool hands out the chunks of one job at a time.  A worker
+// counts itself as active while it is taking chunks, and the caller
+// waits until every chunk is done *and* no worker is active, so that
+// no worker can still be looking at a job once its caller has moved
+// on.  The job is only changed while no worker is active.
+struct GridPool {
+  std::mutex lock;
+  std::condition_variable wake, finished;
+  std::vector<std::thread> threads;
+  const std::function<void(long,long)> *job;
+  long n, num_chunks;
+  std::atomic<long> next_chunk;
+  long chunks_done, active, generation;
+  bool stop;
+  std::mutex busy; // held by whichever thread is using the pool
+  GridPool() : job(0), n(0), num_chunks(0), next_chunk(0), chunks_done(0), active(0),
+               generation(0), stop(false) {}
+};
+
+static GridPool &grid_pool() {
+  static GridPool *pool = new GridPool(); // never destroyed, so workers may outlive main
+  return *pool;
+}
+
+static thread_local bool in_grid_parallel = false;
+
+static int default_threads() {
+  const char *env = getenv("DEFT_GRID_THREADS");
+  int num = env ? atoi(env) : 0;
+  if (num <= 0) num = std::thread::hardware_concurrency();
+  if (num <= 0) num = 1;
+  return num;
+}
+
+static int num_grid_threads = default_threads();
+
+// run_chunks does chunks of the current job until there are none
+// left, returning how many it did.
+static long run_chunks(GridPool &p) {
+  long done = 0;
+  while (true) {
+    const long c = p.next_chunk++;
+    if (c >= p.num_chunks) return done;
+    const long start = c*grid_chunk_size;
+    const long end = (start + grid_chunk_size < p.n) ? start + grid_chunk_size : p.n;
+    (*p.job)(start, end);
+    done++;
+  }
+}
+
+static void grid_worker(GridPool *p) {
+  in_grid_parallel = true;
+  long seen = 0;
+  std::unique_lock<std::mutex> l(p->lock);
+  while (true) {
+    p->wake.wait(l, [&]() { return p->stop || p->generation != seen; });
+    if (p->stop) return;
+    seen = p->generation;
+    p->active++;
+    l.unlock();
+    const long done = run_chunks(*p);
+    l.lock();
+    p->chunks_done += done;
+    p->active--;
+    if (p->active == 0) p->finished.notify_all();
+  }
+}
+
+// start_workers makes sure we have num_grid_threads - 1 workers,
+// which the caller (holding busy) makes up to num_grid_threads.
+static void start_workers(GridPool &p) {
+  if (int(p.threads.size()) == num_grid_threads - 1) return;
+  {
+    std::lock_guard<std::mutex> l(p.lock);
+    p.stop = true;
+  }
+  p.wake.notify_all();
+  for (unsigned i=0; i<p.threads.size(); i++) p.threads[i].join();
+  p.threads.clear();
+  p.stop = false;
+  for (int i=1; i<num_grid_threads; i++) p.threads.push_back(std::thread(grid_worker, &p));
+}
+
+void grid_parallel_for(long n, const std::function<void(long,long)> &f) {
+  const long num_chunks = (n + grid_chunk_size - 1)/grid_chunk_size;
+  GridPool &p = grid_pool();
+  std::unique_lock<std::mutex> busy(p.busy, std::defer_lock);
+  if (num_chunks < min_parallel_chunks || num_grid_threads < 2 || in_grid_parallel
+      || !busy.try_lock()) {
+    for (long start=0; start<n; start += grid_chunk_size) {
+      f(start, (start + grid_chunk_size < n) ? start + grid_chunk_size : n);
+    }
+    return;
+  }
+  start_workers(p);
+  {
+    // A worker that woke up too late for the last job might still be
+    // looking for chunks of it, so we wait for it to give up.
+    std::unique_lock<std::mutex> l(p.lock);
+    p.finished.wait(l, [&]() { return p.active == 0; });
+    p.job = &f;
+    p.n = n;
+    p.num_chunks = num_chunks;
+    p.next_chunk = 0;
+    p.chunks_done = 0;
+    p.generation++;
+  }
+  p.wake.notify_all();
+  in_grid_parallel = true;
+  const long done = run_chunks(p);
+  in_grid_parallel = false;
+  std::unique_lock<std::mutex> l(p.lock);
+  p.chunks_done += done;
+  p.finished.wait(l, [&]() { return p.active == 0 && p.chunks_done == p.num_chunks; });
+  p.job = 0;
+}
+
+int grid_threads() {
+  return num_grid_threads;
+}
+
+void grid_set_threads(int num_threads) {
+  GridPool &p = grid_pool();
+  std::lock_guard<std::mutex> busy(p.busy);
+  num_grid_threads = (num_threads > 0) ? num_threads : default_threads();
+}
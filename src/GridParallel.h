@@ -0,0 +1,37 @@
+// -*- mode: C++; -*-
+
+#pragma once
+
+#include "GridDescription.h"
+#include "Reduction.h"
+
+// GridParallel evaluates elementwise expressions over whole grids
+// (like ingrad.cwise()/out2, or a reciprocal-space kernel times a
+// ReciprocalGrid) in chunks on the thread pool of Reduction.h, and
+// sums grids the way grid_sum_of does.
+
+inline double grid_sum(const VectorXd &x) {
+  return grid_sum(x.data(), x.rows());
+}
+
+// These set *out to x, add x to *out, or multiply *out by x, where x
+// is any Eigen expression with as many rows as *out.  Since each
+// point is computed independently, x may refer to *out itself.
+template<typename Out, typename Derived>
+void grid_assign(Out *out, const Eigen::MatrixBase<Derived> &x) {
+  grid_parallel_for(out->rows(), [out, &x](long start, long end) {
+      out->segment(start, end - start) = x.segment(start, end - start);
+    });
+}
+template<typename Out, typename Derived>
+void grid_add(Out *out, const Eigen::MatrixBase<Derived> &x) {
+  grid_parallel_for(out->rows(), [out, &x](long start, long end) {
+      out->segment(start, end - start) += x.segment(start, end - start);
+    });
+}
+template<typename Out, typename Derived>
+void grid_multiply(Out *out, const Eigen::MatrixBase<Derived> &x) {
+  grid_parallel_for(out->rows(), [out, &x](long start, long end) {
+      out->segment(start, end - start).cwise() *= x.segment(start, end - start);
+    });
+}
@@ -33,6 +33,12 @@ public:
   double d_by_dT(double, double) const {
     return 1;
   }
+  VectorXd transform_batch(const VectorXd &kT, const VectorXd &) const {
+    return kT;
+  }
+  VectorXd derive_batch(const VectorXd &, const VectorXd &x) const {
+    return VectorXd::Zero(x.rows());
+  }
   Functional grad(const Functional &, const Functional &, bool) const {
     return Functional(0.0);
   }
@@ -0,0 +1,257 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include "Monte-Carlo/checkerboard.h"
+#include "Monte-Carlo/monte-carlo.h" // for ran()
+
+// DomainRandom is the random number generator of one domain for one
+// sweep.  It is SplitMix64, which is tiny and quick to seed, since
+// we seed one for every domain on every sweep.
+struct DomainRandom {
+  unsigned long long state;
+  explicit DomainRandom(unsigned long long seed) : state(seed) {}
+  unsigned long long next() {
+    unsigned long long z = (state += 0x9e3779b97f4a7c15ull);
+    z = (z ^ (z >> 30))*0xbf58476d1ce4e5b9ull;
+    z = (z ^ (z >> 27))*0x94d049bb133111ebull;
+    return z ^ (z >> 31);
+  }
+  double ran() { return (next() >> 11)*(1.0/9007199254740992.0); } // [0,1)
+  long below(long n) { return long(ran()*n); }
+  // ran3 is the same gaussian as the ran3() in monte-carlo.cpp.
+  Vector3d ran3() {
+    Vector3d out;
+    for (int k=0; k<3; k+=2) {
+      double x, y, r2;
+      do {
+        x = 2*ran() - 1;
+        y = 2*ran() - 1;
+        r2 = x*x + y*y;
+      } while (r2 >= 1 || r2 == 0);
+      const double fac = sqrt(-2*log(r2)/r2);
+      out[k] = x*fac;
+      if (k == 0) out[1] = y*fac;
+    }
+    return out;
+  }
+};
+
+// The threads wait at a Barrier after each color, so that no thread
+// starts on the next color while another may still be moving spheres
+// next to its domains.
+class Barrier {
+public:
+  explicit Barrier(int n) : n(n), waiting(0), generation(0) {}
+  void wait() {
+    std::unique_lock<std::mutex> l(lock);
+    const long mine = generation;
+    if (++waiting == n) {
+      waiting = 0;
+      generation++;
+      all_here.notify_all();
+    } else {
+      all_here.wait(l, [&]() { return generation != mine; });
+    }
+  }
+private:
+  std::mutex lock;
+  std::condition_variable all_here;
+  int n, waiting;
+  long generation;
+};
+
+static int default_threads() {
+  int num = std::thread::hardware_concurrency();
+  return (num > 0) ? num : 1;
+}
+
+Checkerboard::Checkerboard(const SphereGeometry &geometry, Vector3d *s, long n,
+                           double sc, int threads)
+  : g(geometry), spheres(s), N(n), scale(sc) {
+  set_threads(threads);
+  // The domains must be at least a diameter wide, so that spheres in
+  // two domains of the same color can never touch.  Making them a few
+  // move lengths wider than that keeps down the number of moves we
+  // reject for leaving their domain.
+  const double min_width = 2*g.R + 4*scale;
+  for (int k=0; k<3; k++) {
+    shift[k] = 0;
+    double extent = 0;
+    lo[k] = 0;
+    if (g.periodic[k] || g.wall[k]) {
+      lo[k] = -g.len[k]/2;
+      extent = g.len[k];
+    } else if (g.outer_radius > 0) {
+      lo[k] = -g.outer_radius;
+      extent = 2*g.outer_radius;
+    }
+    if (g.periodic[k] && g.len[k] < 4*g.R) {
+      printf("Checkerboard: a periodic cell of length %g is too small for spheres of radius %g\n",
+             g.len[k], g.R);
+      exit(1);
+    }
+    long n = long(extent/min_width);
+    if (g.periodic[k]) {
+      // Going around a periodic direction must bring us back to the
+      // same color, so we need an even number of domains.
+      n -= n % 2;
+      if (n < 2) n = 1;
+      ndomains[k] = n;
+      width[k] = extent/n;
+    } else if (n >= 1) {
+      // The random shift makes one more (partial) domain.
+      width[k] = extent/n;
+      ndomains[k] = n + 1;
+    } else {
+      // An open direction, or one too narrow to divide, is all one domain.
+      width[k] = 1;
+      ndomains[k] = 1;
+    }
+  }
+
+  neighbors.resize(num_domains());
+  for (long d=0; d<num_domains(); d++) {
+    const long c[3] = { d/(ndomains[1]*ndomains[2]), (d/ndomains[2]) % ndomains[1],
+                        d % ndomains[2] };
+    std::vector<long> nearby[3];
+    for (int k=0; k<3; k++) {
+      if (g.periodic[k] && ndomains[k] <= 3) {
+        for (long m=0; m<ndomains[k]; m++) nearby[k].push_back(m);
+      } else {
+        for (long m=c[k]-1; m<=c[k]+1; m++) {
+          if (g.periodic[k]) {
+            nearby[k].push_back((m + ndomains[k]) % ndomains[k]);
+          } else if (m >= 0 && m < ndomains[k]) {
+            nearby[k].push_back(m);
+          }
+        }
+      }
+    }
+    for (unsigned a=0; a<nearby[0].size(); a++) {
+      for (unsigned b=0; b<nearby[1].size(); b++) {
+        for (unsigned e=0; e<nearby[2].size(); e++) {
+          neighbors[d].push_back((nearby[0][a]*ndomains[1] + nearby[1][b])*ndomains[2]
+                                 + nearby[2][e]);
+        }
+      }
+    }
+  }
+}
+
+void Checkerboard::set_threads(int threads) {
+  num_threads = (threads > 0) ? threads : default_threads();
+}
+
+long Checkerboard::domain_of(const Vector3d &r) const {
+  long c[3];
+  for (int k=0; k<3; k++) {
+    if (ndomains[k] == 1) {
+      c[k] = 0;
+      continue;
+    }
+    c[k] = long(floor((r[k] - lo[k] + shift[k])/width[k]));
+    if (g.periodic[k]) {
+      c[k] %= ndomains[k];
+      if (c[k] < 0) c[k] += ndomains[k];
+    } else if (c[k] < 0) {
+      c[k] = 0;
+    } else if (c[k] >= ndomains[k]) {
+      c[k] = ndomains[k] - 1;
+    }
+  }
+  return (c[0]*ndomains[1] + c[1])*ndomains[2] + c[2];
+}
+
+long Checkerboard::sweep_domain(long d, unsigned long long seed) {
+  DomainRandom random(seed);
+  const long start = first[d], n = first[d+1] - first[d];
+  const double diameter2 = 4*g.R*g.R;
+  long accepted = 0;
+  for (long t=0; t<n; t++) {
+    const long i = members[start + random.below(n)];
+    const Vector3d trial = g.wrap(spheres[i] + scale*random.ran3());
+    if (g.outside(trial) || domain_of(trial) != d) continue;
+    bool overlaps = false;
+    for (unsigned nb=0; nb<neighbors[d].size() && !overlaps; nb++) {
+      const long other = neighbors[d][nb];
+      for (long m=first[other]; m<first[other+1]; m++) {
+        const long j = members[m];
+        if (j != i && g.separation(trial, spheres[j]).squaredNorm() < diameter2) {
+          overlaps = true;
+          break;
+        }
+      }
+    }
+    if (!overlaps) {
+      spheres[i] = trial;
+      accepted++;
+    }
+  }
+  return accepted;
+}
+
+long Checkerboard::sweep() {
+  for (int k=0; k<3; k++) {
+    shift[k] = (ndomains[k] > 1) ? ran()*width[k] : 0;
+  }
+  // Sort the spheres into domains.
+  const long nd = num_domains();
+  std::vector<long> domain(N);
+  first.assign(nd + 1, 0);
+  for (long i=0; i<N; i++) {
+    domain[i] = domain_of(spheres[i]);
+    first[domain[i] + 1]++;
+  }
+  for (long d=0; d<nd; d++) first[d+1] += first[d];
+  members.resize(N);
+  std::vector<long> filled(first.begin(), first.end() - 1);
+  for (long i=0; i<N; i++) members[filled[domain[i]]++] = i;
+
+  // Sort the domains that have spheres by color, and pick the order
+  // of the colors and the seeds of the domains.
+  std::vector<long> by_color[8];
+  for (long d=0; d<nd; d++) {
+    if (first[d+1] == first[d]) continue;
+    const long c[3] = { d/(ndomains[1]*ndomains[2]), (d/ndomains[2]) % ndomains[1],
+                        d % ndomains[2] };
+    by_color[(c[0] & 1) | (c[1] & 1) << 1 | (c[2] & 1) << 2].push_back(d);
+  }
+  int order[8];
+  for (int p=0; p<8; p++) order[p] = p;
+  for (int p=7; p>0; p--) {
+    int q = int(ran()*(p + 1));
+    if (q > p) q = p;
+    const int t = order[p];
+    order[p] = order[q];
+    order[q] = t;
+  }
+  const unsigned long long sweep_seed =
+    (unsigned long long)(ran()*4294967296.0) << 32 | (unsigned long long)(ran()*4294967296.0);
+
+  std::atomic<long> next[8];
+  for (int p=0; p<8; p++) next[p] = 0;
+  std::atomic<long> accepted(0);
+  Barrier barrier(num_threads);
+  auto work = [&]() {
+    long mine = 0;
+    for (int p=0; p<8; p++) {
+      const std::vector<long> &active = by_color[order[p]];
+      for (long a = next[p]++; a < long(active.size()); a = next[p]++) {
+        const long d = active[a];
+        DomainRandom hash(sweep_seed + d);
+        mine += sweep_domain(d, hash.next());
+      }
+      barrier.wait();
+    }
+    accepted += mine;
+  };
+  std::vector<std::thread> threads;
+  for (int t=1; t<num_threads; t++) threads.push_back(std::thread(work));
+  work();
+  for (unsigned t=0; t<threads.size(); t++) threads[t].join();
+  return accepted;
+}
@@ -0,0 +1,58 @@
+// -*- mode: C++; -*-
+
+#pragma once
+
+#include <vector>
+#include "Monte-Carlo/sphere-cells.h"
+
+// Checkerboard makes the same single-sphere trial moves as our hard
+// sphere driver, but on many threads at once.  The cell is cut into
+// domains at least a diameter wide, and the domains are colored like
+// a three dimensional checkerboard, with eight colors, so that no two
+// domains of one color touch.  We then go through the colors one at a
+// time, and the threads share out the domains of that color.  Each
+// sphere in such a domain gets moved only within its domain, so it can
+// only ever run into spheres in its own domain or the neighboring
+// ones, which are not moving.  That means no locks are needed, and the
+// threads never look at anything another thread is changing.
+//
+// Rejecting moves that would leave a domain is as symmetric as any
+// other rejection, so this satisfies detailed balance.  To let spheres
+// cross domain boundaries, each sweep shifts the domains by a random
+// offset and visits the colors in a random order.
+//
+// Each domain gets its own random number generator, seeded from ran()
+// at the start of each sweep, so the spheres end up in the same place
+// however many threads we use.
+
+class Checkerboard {
+public:
+  // The spheres belong to the caller, and are moved in place.  They
+  // must start out not overlapping and within the walls.  scale is the
+  // standard deviation of a trial move in each direction, and a
+  // num_threads of zero means one thread per core.
+  Checkerboard(const SphereGeometry &g, Vector3d *spheres, long N, double scale,
+               int num_threads = 0);
+  // sweep makes N trial moves, returning how many were accepted.
+  long sweep();
+  int threads() const { return num_threads; }
+  void set_threads(int num_threads);
+  long num_domains() const { return ndomains[0]*ndomains[1]*ndomains[2]; }
+
+private:
+  long domain_of(const Vector3d &r) const;
+  long sweep_domain(long d, unsigned long long seed);
+
+  SphereGeometry g;
+  Vector3d *spheres;
+  long N;
+  double scale;
+  int num_threads;
+  double lo[3], width[3], shift[3];
+  long ndomains[3];
+  // The spheres in domain d are members[first[d]] up to
+  // members[first[d+1]], and neighbors[d] lists the distinct domains
+  // next to d (including d itself).
+  std::vector<long> first, members;
+  std::vector< std::vector<long> > neighbors;
+};
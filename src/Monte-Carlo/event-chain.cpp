@@ -0,0 +1,128 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include "Monte-Carlo/event-chain.h"
+#include "Monte-Carlo/monte-carlo.h" // for ran() and ran3()
+
+// A sphere can move at most step between collision searches, which
+// must be short enough that only the nearest image of a sphere could
+// be hit in periodic directions.
+static double chain_step(const SphereGeometry &g) {
+  double step = g.R;
+  for (int k=0; k<3; k++) {
+    if (g.periodic[k]) {
+      if (g.len[k] <= 4*g.R) {
+        printf("EventChain: a periodic cell of length %g is too small for spheres of radius %g\n",
+               g.len[k], g.R);
+        exit(1);
+      }
+      if (g.len[k]/2 - 2*g.R < step) step = g.len[k]/2 - 2*g.R;
+    }
+  }
+  return step;
+}
+
+EventChain::EventChain(const SphereGeometry &g, Vector3d *s, long n)
+  : step(chain_step(g)), spheres(s), N(n), cells(g, s, n, step) {
+}
+
+void EventChain::rebuild() {
+  cells.rebuild();
+}
+
+long EventChain::chain(double length) {
+  const SphereGeometry &g = cells.geometry();
+  long i = long(ran()*N);
+  if (i >= N) i = N - 1;
+  Vector3d d(0,0,0);
+  if (g.outer_radius > 0 || g.inner_radius > 0) {
+    // A curved wall turns the chain to any direction at all, so for
+    // the reverse of each chain to be possible we have to be able to
+    // start out in any direction, too.
+    d = ran3();
+    d /= d.norm();
+  } else {
+    int axis = int(3*ran());
+    if (axis > 2) axis = 2;
+    d[axis] = (ran() < 0.5) ? 1 : -1;
+  }
+
+  const double diameter2 = 4*g.R*g.R;
+  long lifts = 0;
+  double remaining = length;
+  while (remaining > 0) {
+    double t = (remaining < step) ? remaining : step;
+    const Vector3d x = spheres[i];
+
+    // First look for the first sphere we would run into...
+    long hit = -1;
+    cells.for_each_near(x, i, [&](long j, const Vector3d &r) {
+        const double along = r.dot(d);
+        if (along <= 0) return false; // it is behind us
+        const double miss2 = r.squaredNorm() - along*along;
+        if (miss2 >= diameter2) return false; // we will pass it by
+        double tj = along - sqrt(diameter2 - miss2);
+        if (tj < 0) tj = 0; // we are touching it already
+        if (tj < t) {
+          t = tj;
+          hit = j;
+        }
+        return false;
+      });
+
+    // ...then see if we would run into a wall before that.
+    enum { no_wall, plane_wall, outer_wall, inner_wall } wall = no_wall;
+    int wall_axis = 0;
+    for (int k=0; k<3; k++) {
+      if (g.wall[k] && d[k] != 0) {
+        double tw = ((d[k] > 0 ? g.len[k]/2 : -g.len[k]/2) - x[k])/d[k];
+        if (tw < 0) tw = 0;
+        if (tw < t) {
+          t = tw;
+          wall = plane_wall;
+          wall_axis = k;
+        }
+      }
+    }
+    if (g.outer_radius > 0) {
+      const double b = x.dot(d);
+      const double disc = b*b - (x.squaredNorm() - g.outer_radius*g.outer_radius);
+      double tw = -b + ((disc > 0) ? sqrt(disc) : 0);
+      if (tw < 0) tw = 0;
+      if (tw < t) {
+        t = tw;
+        wall = outer_wall;
+      }
+    }
+    if (g.inner_radius > 0) {
+      const double b = x.dot(d);
+      const double disc = b*b - (x.squaredNorm() - g.inner_radius*g.inner_radius);
+      if (b < 0 && disc > 0) {
+        double tw = -b - sqrt(disc);
+        if (tw < 0) tw = 0;
+        if (tw < t) {
+          t = tw;
+          wall = inner_wall;
+        }
+      }
+    }
+
+    spheres[i] = g.wrap(x + t*d);
+    remaining -= t;
+    if (wall == plane_wall) {
+      spheres[i][wall_axis] = (d[wall_axis] > 0) ? g.len[wall_axis]/2 : -g.len[wall_axis]/2;
+      d[wall_axis] = -d[wall_axis];
+    } else if (wall == outer_wall || wall == inner_wall) {
+      const double radius = (wall == outer_wall) ? g.outer_radius : g.inner_radius;
+      spheres[i] *= radius/spheres[i].norm();
+      const Vector3d normal = spheres[i]/radius;
+      d -= 2*d.dot(normal)*normal;
+    }
+    cells.moved(i);
+    if (wall == no_wall && hit >= 0) {
+      i = hit;
+      lifts++;
+    }
+  }
+  return lifts;
+}
@@ -0,0 +1,39 @@
+// -*- mode: C++; -*-
+
+#pragma once
+
+#include "Monte-Carlo/sphere-cells.h"
+
+// EventChain moves hard spheres by event chains rather than by single
+// trial moves.  A chain picks a sphere and a direction, and slides
+// that sphere along until it would touch another one, at which point
+// the other sphere carries on in the same direction for whatever is
+// left of the chain's length.  Nothing is ever rejected, so at high
+// packing fractions this decorrelates far faster than the single
+// sphere moves our drivers make.  This is the "straight" event chain
+// of Bernard, Krauth and Wilson (2009), with hard walls reflecting the
+// direction of the chain.
+//
+// The geometry is any SphereGeometry, and collisions are found with a
+// SphereCells, so each step of a chain only looks at nearby spheres.
+
+class EventChain {
+public:
+  // The spheres belong to the caller, and are moved in place.  They
+  // must start out not overlapping and within the walls.
+  EventChain(const SphereGeometry &g, Vector3d *spheres, long N);
+  // chain runs one chain of the given total displacement, starting at
+  // a random sphere in a random direction along x, y or z (or in any
+  // direction, if there are spherical walls).  It returns the number
+  // of times the chain passed from one sphere to another.
+  long chain(double length);
+  // rebuild updates the cell list, for when the caller has moved
+  // spheres some other way.
+  void rebuild();
+
+private:
+  double step; // longest distance a sphere moves between collision searches
+  Vector3d *spheres;
+  long N;
+  SphereCells cells;
+};
@@ -50,8 +50,22 @@ const int z = 2;
 // Functions
 // ------------------------------------------------------------------------------
 
-// Tests validity of a shrunken version of the cell
-static bool overlap_in_small_cell(sw_simulation &sw, double scaling_factor);
+// Counts the pairs of balls that would overlap if the cell (and the
+// positions of the balls) were scaled down by scaling_factor.  This
+// looks at all pairs, so it is slow, and we only use it to start and
+// to double-check the running count.
+static int count_small_cell_overlaps(const sw_simulation &sw, double scaling_factor);
+
+// Counts the balls that ball id would overlap with in the scaled-down
+// cell.  This looks at every ball rather than just the neighbors of
+// id, since the neighbor tables only promise to hold the balls that
+// actually overlap, not those that overlap only in the small cell.
+static int small_cell_overlaps_of(const sw_simulation &sw, int id, double scaling_factor);
+
+// Moves a ball (via sw.move_a_ball) and updates the running count of
+// small-cell overlaps to match.
+static void move_a_ball_tracking_small_cell(sw_simulation &sw, double scaling_factor,
+                                            int *small_cell_overlaps);
 
 // States how long it's been since last took call.
 static void took(const char *name);
@@ -183,7 +197,7 @@ int main(int argc, const char *argv[]) {
     {"sf", '\0', POPT_ARG_DOUBLE, &scaling_factor, 0,
       "Factor by which to scale the small cell", "DOUBLE"},
     {"sc_period", '\0', POPT_ARG_INT, &small_cell_check_period, 0,
-     "Check the small cell every P iterations", "INT"},
+     "Recount the small cell overlaps from scratch every P iterations", "INT"},
     POPT_AUTOHELP
     POPT_TABLEEND
   };
@@ -635,22 +649,23 @@ int main(int argc, const char *argv[]) {
     sw.optimistic_samples[i] = 0;
   }
 
+  // We keep a running count of the pairs of balls that would overlap
+  // in the small cell, so that we can check the small cell after
+  // every move at the cost of looking at one ball rather than every
+  // pair.
+  int small_cell_overlaps = count_small_cell_overlaps(sw, scaling_factor);
+
   do {
     // ---------------------------------------------------------------
-    // Move each ball once, add to energy histogram
+    // Move each ball once, checking the small cell after each move
     // ---------------------------------------------------------------
     for(int i = 0; i < sw.N; i++){
-      sw.move_a_ball();
-    }
-
-    // just hacking stuff in to see what works
-    // do the small bit every 100 n^2 iterations for now
-    if (sw.iteration % small_cell_check_period == 0) {
+      move_a_ball_tracking_small_cell(sw, scaling_factor, &small_cell_overlaps);
       total_checks_of_small_cell++;
 
-      if(overlap_in_small_cell(sw,  scaling_factor)){
+      if(small_cell_overlaps){
         total_failed_small_checks++;
-        
+
         if (current_failed_run == 0){
           // then valid run just ended so record it
           valid_runs++;
@@ -682,6 +697,17 @@ int main(int argc, const char *argv[]) {
       }
     }
 
+    // Every so often we recount from scratch, to make sure that the
+    // running count hasn't gone wrong.
+    if (sw.iteration % small_cell_check_period == 0) {
+      const int recount = count_small_cell_overlaps(sw, scaling_factor);
+      if (recount != small_cell_overlaps) {
+        printf("Error: small cell overlap count is %i rather than %i!\n",
+               small_cell_overlaps, recount);
+        exit(1);
+      }
+    }
+
     // ---------------------------------------------------------------
     // Save to file
     // ---------------------------------------------------------------
@@ -760,25 +786,45 @@ int main(int argc, const char *argv[]) {
 // END OF MAIN
 // ------------------------------------------------------------------------------
 
-static bool overlap_in_small_cell(sw_simulation &sw, double scaling_factor){
-  double scaled_len[3];
-
-  for(int i=0; i < 3; i++){
-    scaled_len[i] = scaling_factor * sw.len[i];
-  }
+// Scaling the cell and all the positions by scaling_factor scales
+// every separation by the same factor, so two balls overlap in the
+// small cell when they are closer than (Ra + Rb)/scaling_factor in
+// the real one.
+static inline bool overlap_in_small_cell(const sw_simulation &sw, const ball &a, const ball &b,
+                                         double scaling_factor) {
+  const vector3d ab = periodic_diff(a.pos, b.pos, sw.len, sw.walls);
+  return ab.normsquared()*sqr(scaling_factor) < sqr(a.R + b.R);
+}
 
+static int count_small_cell_overlaps(const sw_simulation &sw, double scaling_factor){
+  int overlaps = 0;
   for(int i=0; i<sw.N; i++){
     for (int j=i+1; j<sw.N; j++) {
-      // copy pasting from overlap() in square-well.cpp for now
-      // contemplated adding a scaling parametor to overlap(), but decided on this for now.
-      const vector3d ab = periodic_diff(scaling_factor * sw.balls[i].pos, scaling_factor * sw.balls[j].pos,
-                                        scaled_len, sw.walls);
-      if (ab.normsquared() < sqr(sw.balls[i].R + sw.balls[j].R)) {
-        return true;
-      }
+      if (overlap_in_small_cell(sw, sw.balls[i], sw.balls[j], scaling_factor)) overlaps++;
     }
   }
-  return false;
+  return overlaps;
+}
+
+static int small_cell_overlaps_of(const sw_simulation &sw, int id, double scaling_factor){
+  const ball &a = sw.balls[id];
+  int overlaps = 0;
+  for (int i=0; i<sw.N; i++) {
+    if (i != id && overlap_in_small_cell(sw, a, sw.balls[i], scaling_factor)) overlaps++;
+  }
+  return overlaps;
+}
+
+static void move_a_ball_tracking_small_cell(sw_simulation &sw, double scaling_factor,
+                                            int *small_cell_overlaps){
+  // The ball only moved if the count of working moves went up.
+  const int id = sw.ball_to_move();
+  const long old_working = sw.moves.working;
+  const int old_overlaps = small_cell_overlaps_of(sw, id, scaling_factor);
+  sw.move_a_ball();
+  if (sw.moves.working != old_working) {
+    *small_cell_overlaps += small_cell_overlaps_of(sw, id, scaling_factor) - old_overlaps;
+  }
 }
 
 inline void print_all(const ball *p, int N) {
@@ -476,33 +476,95 @@ void sw_simulation::ln_dos_check(double * ln_dos) const {
 
 // TODO
 
-// 1. Remove debug prints from compute_ln_dos (Trotter)
-
-// 2. Move this compute_ln_dos to square-well.cpp, and then copy and
+// 1. Move this compute_ln_dos to square-well.cpp, and then copy and
 //    rename to grand.cpp.
 
-// 3. Think about actually making this grand.
+// 2. Think about actually making this grand.
 
-// 4. Keep track of actual biggest energy transition dynamically,
+// 3. Keep track of actual biggest energy transition dynamically,
 //    updating it each iteration.  This could then be used to make
 //    e.g. transition_matrix faster.  (Delay)
 
-// 5. Consider using collection rather than transition_matrix when
-//    determining bet, since we don't need things
-//    normalized. (Trotter)
-
-// 6. Consider using collection rather than transition_matrix when
-//    copying over into M, and doing the normalization ourselves, only
-//    adding things up once per column. (Trotter)
-
-// 7. Remove computing of errors from compute_ln_dos. (Trotter)
-
-// 8. Track histogram that represents the sum of the collection matrix
+// 4. Track histogram that represents the sum of the collection matrix
 //    we normalize by.  The idea here is when normalizing the
 //    collection matrix, we could just use the histogram value.
 //    Updating the histogram value would only require one increment
 //    per move.  (Delay)
 
+/* The following two functions work on banded matrices, which is what
+   our transition matrices are, since no single move changes the
+   energy by more than biggest_energy_transition.  A band of
+   half-width b holds A[i][j] (for |i-j| <= b) in
+   band[i*(2*b+1) + b + j - i].  Each takes O(n*b*b) work, and both
+   destroy the band. */
+
+// banded_ln_stationary finds the log of the stationary distribution
+// of a Markov chain with probability P[i][j] of going from i to j,
+// using the Grassmann-Taksar-Heyman form of Gaussian elimination.
+// This never subtracts, so it stays accurate when the distribution
+// spans hundreds of orders of magnitude.  Probability missing from a
+// row is treated as staying put.  A state that we can't reach from
+// below (or can't leave downwards) gets the same ln_pi as the state
+// below it, since we know nothing about it.
+static void banded_ln_stationary(int n, int b, double *band, double *ln_pi) {
+  const int w = 2*b + 1;
+  double *s = new double[n]();
+  for (int k = n-1; k > 0; k--) {
+    for (int j = max(0, k-b); j < k; j++) s[k] += band[k*w + b + j - k];
+    if (s[k] == 0) continue;
+    // Fold state k into the states below it.
+    for (int i = max(0, k-b); i < k; i++) {
+      const double pik = band[i*w + b + k - i]/s[k];
+      if (pik == 0) continue;
+      for (int j = max(0, k-b); j < k; j++) {
+        band[i*w + b + j - i] += pik*band[k*w + b + j - k];
+      }
+    }
+  }
+  ln_pi[0] = 0;
+  for (int k = 1; k < n; k++) {
+    double ln_biggest = -DBL_MAX;
+    for (int i = max(0, k-b); i < k; i++) {
+      if (band[i*w + b + k - i] > 0 && ln_pi[i] > ln_biggest) ln_biggest = ln_pi[i];
+    }
+    if (s[k] == 0 || ln_biggest == -DBL_MAX) {
+      ln_pi[k] = ln_pi[k-1];
+      continue;
+    }
+    double flow = 0;
+    for (int i = max(0, k-b); i < k; i++) {
+      if (band[i*w + b + k - i] > 0) flow += exp(ln_pi[i] - ln_biggest)*band[i*w + b + k - i];
+    }
+    ln_pi[k] = ln_biggest + log(flow/s[k]);
+  }
+  delete[] s;
+}
+
+// banded_solve solves A*x = rhs in place by Gaussian elimination
+// without pivoting, which is fine for the M-matrices we give it.  It
+// returns false if it meets a pivot that is not positive, which means
+// A wasn't an M-matrix after all.
+static bool banded_solve(int n, int b, double *band, double *x) {
+  const int w = 2*b + 1;
+  for (int k = 0; k < n; k++) {
+    const double pivot = band[k*w + b];
+    if (!(pivot > 0)) return false;
+    for (int i = k+1; i <= min(n-1, k+b); i++) {
+      const double c = band[i*w + b + k - i]/pivot;
+      if (c == 0) continue;
+      for (int j = k+1; j <= min(n-1, k+b); j++) {
+        band[i*w + b + j - i] -= c*band[k*w + b + j - k];
+      }
+      x[i] -= c*x[k];
+    }
+  }
+  for (int k = n-1; k >= 0; k--) {
+    for (int j = k+1; j <= min(n-1, k+b); j++) x[k] -= band[k*w + b + j - k]*x[j];
+    x[k] /= band[k*w + b];
+  }
+  return true;
+}
+
 double* sw_simulation::compute_ln_dos(dos_types dos_type) {
   if(dos_type == histogram_dos){
     for(int i = max_entropy_state; i < energy_levels; i++){
@@ -511,218 +573,55 @@ double* sw_simulation::compute_ln_dos(dos_types dos_type) {
       }
       else ln_dos[i] = -DBL_MAX;
     }
-  }
-  else if (1 /* try Gauss Jordan Elim */){
-    /* copy the collect matrix to M, subtract row sum from diagonal */
-    int bet = 0;
-    int emin = -1;
-    int emax = 0;
-    for (int e = 0; e < energy_levels; e++){
-      bool nonzero_found = false;
-      for(int de = -biggest_energy_transition; de <= biggest_energy_transition; de ++) {
-        //printf("%g \t", transition_matrix(e,e+de));
-        if (transition_matrix(e,e+de)){
-          bet = max(abs(de),bet);
-          nonzero_found = true;
-        }
-      }
-      //printf("\n");
-      if (nonzero_found) {
+    ln_dos_transitions = -1; // ln_dos no longer holds the transition dos
+  } else if (dos_type == transition_dos) {
+    /* The density of states is the stationary distribution of the
+       transition matrix, which we find directly with a banded solver.
+       The collection matrix only ever grows, so if it holds the same
+       number of transitions as last time, it is unchanged and so is
+       ln_dos.  This makes it cheap to call us every few thousand
+       moves. */
+    const int b = biggest_energy_transition;
+    const int w = 2*b + 1;
+    long *norm = new long[energy_levels];
+    long transitions = 0;
+    int emin = -1, emax = -1;
+    for (int e = 0; e < energy_levels; e++) {
+      norm[e] = 0;
+      for (int de = -b; de <= b; de++) norm[e] += collection(e, de);
+      transitions += norm[e];
+      if (norm[e]) {
+        if (emin < 0) emin = e;
         emax = e;
-      } else if(emax == 0){
-        emin = e;
       }
     }
-    emin++;
-    if (emax <= emin) {
-      // We have only ever explored one (or zero?) energies, so we
-      // know nothing about the density of states.  Just leave it as a
-      // constant!
-      for (int e = 0; e < energy_levels; e++){
-        ln_dos[e] =-DBL_MAX;
-      }
-      return ln_dos; // all done!
-    } else {
-      int cols = 2*bet + 1;
-      double * M = new double[(emax-emin + 1)*cols];
- 
-      for (int e = emin; e <= emax; e++){
-	for (int de  = -bet; de <= bet; de++){
-	  M[(e- emin)*cols + bet + de] = transition_matrix(e+de,e);
-	}
-	M[(e-emin)*cols + bet] -= 1;
-      }
-      /*
-      for (int e = emin; e <= emax; e++) {
-	printf("energy = %i; ",e);
-	for (int de = -bet; de <=bet; de ++){
-	  printf("%15g ",M[(e-emin)*cols + bet + de]);
-	}
-	printf("\n");
-      }*/
-
-
-
-      printf("\n");
-      for (int e = emin; e <= emax; e++) {
-	printf(":) final energy = %i; ",e);
-	for (int de = -bet; de <=bet; de ++){
-	  if (de == 0) {
-	    printf("| ");
-	  }
-	  printf("%15g ",M[(e-emin)*cols + bet +de]);
-	}
-	printf("\n");
-      }
-
-      
-      /* make matrix upper triangular up to last column */
-      for (int e = emin; e < emax; e++){
-	if (M[(e -emin) * cols + bet] != 0) {
-	  int ind1 = (e-emin)*cols + bet;
-
-	  /* normalize to get leading entry of each row of M to 1 */
-	  for (int de = 1; de <= min(bet,emax-e); de++) {
-	    M[(e - emin + de)*cols + bet -de] /= M[(e-emin)*cols + bet];
-	  }
-	  M[(e-emin)*cols +bet]  = 1;
-
-	  for (int de = 1; de <= bet; de++) {
-	    int ind2 = ind1 + de;
-	    if (M[ind2] != 0) {
-	      double c = M[ind2]/M[ind1];
-	      for (int de1 = 0; de1 <= min(bet,emax-e); de1++){
-		M[(e-emin+de1)*cols + bet + de - de1] -= c*M[(e-emin+de1)*cols + bet - de1];
-	      }
-	    }
-	  }
-	}
-      }
-      /*
-      for (int e = emin; e < emax; e++){
-	int ind1 = (e-emin)*cols + bet;
-	for (int de = 1; de <= min(bet,emax-e); de++) {
-	  int ind2 = (e-emin+de)*cols + bet -de;
-	  if (M[ind2] != 0){
-	    double c = M[ind2]/M[ind1];
-	    for (int de1 = 0; de1 <= bet; de1++){
-	      M[ind2+de1] -= c*M[ind1+de1];
-	    }
-	  }
-	}
-      */
-      
-      printf("\n");
-      for (int e = emin; e <= emax; e++) {
-	printf(":) final energy = %i; ",e);
-	for (int de = -bet; de <=bet; de ++){
-	  if (de == 0) {
-	    printf("| ");
-	  }
-	  printf("%15g ",M[(e-emin)*cols + bet +de]);
-	}
-	printf("\n");
-      }
-      
-      /* now we can find dos from final col */
-      for (int e = 0; e < energy_levels; e++) {
-	ln_dos[e] = -DBL_MAX;
-      }
-      for (int de = 0; de <= bet; de++) {
-	if (M[(emax-emin)*cols + bet-de] < 0) { 
-	  ln_dos[emax-de] = log(-M[(emax-emin)*cols + bet - de]); }
-	else {
-	  ln_dos[emax-de] = -DBL_MAX;
-	}
-      }
-      ln_dos[emax] = 0;
-      
-      printf("first dos column:\n");
-      for (int i=0; i<=emax-emin; i++) {
-        printf("%g ", ln_dos[emax-i]);
-      }
-      printf("\n");
-      /* make matrix diagonal, keep track of ops*/
-      for (int e = emax-1; e >= emin; e--){
-	/*leading index of row we will subtract from other rows */
-
-	assert(M[(e-emin)*cols + bet] != 0); // It is an ergodic system, so this shouldn't happen
-	// ln_dos[e] = ln_dos[e] - log(M[(e-emin)*cols+bet]);
-	for (int de = 1; de <= min (bet, e-emin); de++) { // WE ARE HERE!
-	  /* use info from up the column to modify solution*/
-	  //~ ln_dos[e-de] = ln_dos[e-de] - M[(e-emin-de)*cols + bet + de]*ln_dos[e];
-	  //  ln_dos[e-de] += log(1 - M[e-de]*exp(ln_dos[e] - ln_dos[e-de]));
-	  if (ln_dos[e-de] > -DBL_MAX/2){
-	    ln_dos[e-de] = ln_dos[e-de] + log(1-M[(e-emin)*cols + bet - de]*exp(ln_dos[e]-ln_dos[e-de]));
-	  } else {
-	    ln_dos[e-de] = log(-M[(e-emin)*cols + bet - de]) + ln_dos[e];
-	  }
-	}
-      }
-      ln_dos[emax] = 0;
-
-      printf("\n\n"); for(int e1 = 0; e1<energy_levels;e1++) {
-        if (ln_dos[e1] != -DBL_MAX) printf("%d: %g \n",e1,ln_dos[e1]);
-      }
-      printf("\n\n");
-
-      printf("trying to allocate memory...\n");
-      double * error = new double[energy_levels]();
-      printf("computing error\n");
-
-      for (int i = 0; i<energy_levels; i++){
-	error[i] = 0;
-	for (int j = 0; j<energy_levels; j++){
-	  if (transition_matrix(i,j) != 0){
-	    error[i] += transition_matrix(i,j)*exp(ln_dos[j]-ln_dos[i]);
-	  }
-	}
-      }
-      printf("errors:\n");
-      for(int e1 = 0; e1< energy_levels;e1++) { printf("%g ",error[e1]);} printf("\n\n");
-      delete [] error;
-      
-      /* double dos_min = 0;
-      for (int e = emin; e <= emax; e++) {
-        if (ln_dos[e] !=0){
-          if (dos_min == 0) {
-            dos_min = ln_dos[e];
-          } else if (ln_dos[e] != 0) {
-            dos_min = min(ln_dos[e], dos_min);
-          }
-        }
-	}
-      for (int i=0; i<energy_levels; i++) {
-        if (i < emin || i > emax) {
-          ln_dos[i] = dos_min;
-        }
-	}*/
-
-      //ln_dos_check(ln_dos);
-      printf("trying to delete M:\n");
-      delete[] M;
+    if (transitions == ln_dos_transitions) {
+      delete[] norm;
+      return ln_dos;
     }
-  } else if(dos_type == transition_dos) {
-    ln_dos[0] = 0;
-    for (int i=1; i<energy_levels; i++) {
-      ln_dos[i] = ln_dos[i-1];
-      double down_to_here = 0;
-      double up_from_here = 0;
-      for (int j=0; j<i; j++) {
-        const double tdown = transition_matrix(i, j);
-        if (tdown) {
-          // we are careful here not to take the exponential (which
-          // could give a NaN) unless we already know there is some
-          // probability of making this transition.
-          down_to_here += exp(ln_dos[j] - ln_dos[i])*tdown;
+    ln_dos_transitions = transitions;
+
+    for (int e = 0; e < energy_levels; e++) ln_dos[e] = -DBL_MAX;
+    if (emax > emin) {
+      // We only look at the energies we have been at, and treat
+      // attempts to move anywhere else as rejected moves.
+      const int n = emax - emin + 1;
+      double *band = new double[n*w]();
+      for (int e = emin; e <= emax; e++) {
+        if (!norm[e]) continue;
+        for (int de = max(-b, emin-e); de <= min(b, emax-e); de++) {
+          band[(e-emin)*w + b + de] = collection(e, de)/double(norm[e]);
         }
-        up_from_here += transition_matrix(j, i);
-      }
-      if (down_to_here > 0 && up_from_here > 0) {
-        ln_dos[i] += log(down_to_here/up_from_here);
       }
+      banded_ln_stationary(n, b, band, ln_dos + emin);
+      // We define the lowest energy to have ln_dos of zero.
+      const double ln_dos_emax = ln_dos[emax];
+      for (int e = emin; e <= emax; e++) ln_dos[e] -= ln_dos_emax;
+      delete[] band;
     }
-    ln_dos_check(ln_dos);
+    // Otherwise we have only ever explored one (or zero?) energies,
+    // so we know nothing about the density of states.
+    delete[] norm;
   } else {
     printf("We don't know what dos type we have!\n");
     exit(1);
@@ -736,8 +635,23 @@ double *sw_simulation::compute_walker_density_using_transitions(double *sample_r
   double *ln_dos = compute_ln_dos(transition_dos);
 
   const int energies_observed = min_energy_state+1;
+  const int b = biggest_energy_transition, w = 2*b + 1;
   double *TD_over_D = new double[energies_observed];
+  // change holds the (T*D)/D matrix elements from energy i to energy
+  // i+de, as a band stored by the row i+de.
+  double *change_band = new double[energies_observed*w]();
+  double *band = new double[energies_observed*w];
+  double *z = new double[energies_observed];
   double norm = 1, oldnorm = 0;
+  /* Whether we weight a transition depends on the walker density
+     itself, and the big steps of inverse iteration could flip this
+     back and forth forever.  So we hold the choice of weighted
+     transitions fixed (which makes the problem linear) until we
+     converge, and then check that it still agrees with the walker
+     density. */
+  bool *weighted = new bool[energies_observed*w]();
+  bool update_weighted = true;
+  int weighted_updates = 0;
 
   // initialize a flat density of states with unit norm
   for (int i = 0; i < energies_observed; i++) {
@@ -745,18 +659,48 @@ double *sw_simulation::compute_walker_density_using_transitions(double *sample_r
     TD_over_D[i] = 1.0/energies_observed;
   }
 
-  // now find the eigenvector of our transition matrix via the power iteration method
+  // now find the eigenvector of our transition matrix
   bool done = false;
   int iters = 0;
   while(!done){
     iters++;
-    // set D_n = T*D_{n-1}
+    /* Rather than the power iteration D_n = T*D_{n-1}, which can take
+       millions of iterations when walkers rarely escape, we take a
+       step of inverse iteration, solving (sigma - T)*D_n = D_{n-1}
+       with sigma a little above the largest eigenvalue of T.  This
+       converges to the same eigenvector in a handful of iterations.
+       We solve for z = D_n/D_{n-1}, which keeps the numbers sane.  By
+       the Collatz-Wielandt formula, the largest ratio (T*D)/D is no
+       smaller than the largest eigenvalue. */
+    bool inverted = false;
+    if (iters > 1 && max_entropy_state < energies_observed) {
+      const int n = energies_observed - max_entropy_state;
+      double sigma = 0;
+      for (int j = max_entropy_state; j < energies_observed; j++) {
+        sigma = max(sigma, norm*TD_over_D[j]);
+      }
+      sigma *= 1 + 1e-9;
+      for (int j = 0; j < n; j++) {
+        for (int k = 0; k < w; k++) {
+          band[j*w + k] = -change_band[(j+max_entropy_state)*w + k];
+        }
+        band[j*w + b] += sigma;
+        z[j] = 1;
+      }
+      inverted = sigma > 0 && banded_solve(n, b, band, z);
+      for (int j = 0; inverted && j < n; j++) inverted = z[j] > 0 && z[j] < 1e300;
+      if (inverted) {
+        for (int j = 0; j < n; j++) ln_downwalkers[j+max_entropy_state] += log(z[j]);
+      }
+    }
     double max_downwalker = -1e300;
     for (int i = 0; i < energies_observed; i++) {
-      if (TD_over_D[i] > 0) ln_downwalkers[i] += log(TD_over_D[i]);
+      // If the solve failed, we fall back on a step of the power method.
+      if (!inverted && TD_over_D[i] > 0) ln_downwalkers[i] += log(TD_over_D[i]);
       TD_over_D[i] = 0;
       if (ln_downwalkers[i] > max_downwalker) max_downwalker = ln_downwalkers[i];
     }
+    for (int i = 0; i < energies_observed*w; i++) change_band[i] = 0;
     // Set the maximum value of downwalkers to 1 (set max
     // ln_downwalkers to 0).  This is intended to reduce problems due
     // to roundoff error which could accumulate if the mean value of
@@ -778,7 +722,10 @@ double *sw_simulation::compute_walker_density_using_transitions(double *sample_r
       double norm = 0;
       for (int de = -biggest_energy_transition; de <= biggest_energy_transition; de++) {
         if (i+de < energy_levels && i+de >= 0) {
-          if (de < 0 && ln_downwalkers[i] > ln_downwalkers[i+de]) {
+          if (update_weighted) {
+            weighted[i*w + b + de] = de < 0 && ln_downwalkers[i] > ln_downwalkers[i+de];
+          }
+          if (weighted[i*w + b + de]) {
             norm += collection(i, de)*exp(ln_energy_weights[i] - ln_energy_weights[i+de]);
           } else {
             norm += collection(i, de);
@@ -790,7 +737,7 @@ double *sw_simulation::compute_walker_density_using_transitions(double *sample_r
              de <= min(energies_observed-i-1, biggest_energy_transition); de++) {
           if (collection(i,de)) {
             double change;
-            if (de < 0 && ln_downwalkers[i] > ln_downwalkers[i+de]) {
+            if (weighted[i*w + b + de]) {
               change = exp(ln_downwalkers[i] - ln_downwalkers[i+de]
                            + ln_energy_weights[i] - ln_energy_weights[i+de])
                 *collection(i,de)/norm;
@@ -809,11 +756,14 @@ double *sw_simulation::compute_walker_density_using_transitions(double *sample_r
               exit(1);
             }
             TD_over_D[i+de] += change;
+            change_band[(i+de)*w + b - de] = change;
           }
         }
       }
     }
 
+    update_weighted = false;
+
     /* The following deals with the fact that we will not have a
        normalized matrix since we eliminate transitions below the
        min_important_energy. */
@@ -861,12 +811,30 @@ double *sw_simulation::compute_walker_density_using_transitions(double *sample_r
         }
       }
     }
+    if (done && weighted_updates < 100) {
+      for (int i = max_entropy_state; i < min_important_energy; i++) {
+        for (int de = max(-i, -b); de < 0; de++) {
+          if (weighted[i*w + b + de] != (ln_downwalkers[i] > ln_downwalkers[i+de])) {
+            update_weighted = true;
+          }
+        }
+      }
+      if (update_weighted) {
+        weighted_updates++;
+        done = false;
+      }
+    }
     oldnorm = norm;
     if (iters > 1000000) {
       printf("Eventually giving up at %d iters to avoid infinite loop\n", iters);
       done = true;
     }
   }
+  delete[] TD_over_D;
+  delete[] change_band;
+  delete[] band;
+  delete[] z;
+  delete[] weighted;
   if (norm == 1) {
     printf("Found sample rate of infinity\n");
     if (sample_rate) *sample_rate = 1e100;
@@ -881,17 +849,22 @@ int sw_simulation::set_min_important_energy(){
 
   // We always use the transition matrix to estimate the
   // min_important_energy, since it is more robust at the outset.
-  double *ln_dos = compute_ln_dos(transition_dos);
+  const double *ln_dos = compute_ln_dos(transition_dos);
 
   min_important_energy = 0;
+  // ln_dos_above is ln_dos of the next higher energy, which we adjust
+  // as we go (see below).  We leave ln_dos itself alone, since it is
+  // reused until the transitions change.
+  double ln_dos_above = ln_dos[max_entropy_state];
   /* Look for a the highest significant energy at which the slope in ln_dos is 1/min_T */
   for (int i = max_entropy_state+1; i <= min_energy_state; i++) {
-    if (ln_dos[i-1] - ln_dos[i] < 1.0/min_T
-        && ln_dos[i] != ln_dos[i-1]) {
+    if (ln_dos_above - ln_dos[i] < 1.0/min_T
+        && ln_dos[i] != ln_dos_above) {
       // This is an important energy if the DOS is high enough, and we
       // have some decent statistics here.
       min_important_energy = i;
-    } else if (ln_dos[i-1] == ln_dos[i]) {
+      ln_dos_above = ln_dos[i];
+    } else if (ln_dos_above == ln_dos[i]) {
       // We have no information about this state, so let us keep
       // looking, in case there is a nice state at lower energy...
     } else {
@@ -900,7 +873,7 @@ int sw_simulation::set_min_important_energy(){
       // drop in the density of states followed by a peak that is
       // large enough to warrant considering the lower energy
       // important.
-      ln_dos[i] = ln_dos[i-1] - 1.0/min_T;
+      ln_dos_above = ln_dos_above - 1.0/min_T;
     }
   }
   /* If we never found a slope of 1/min_T, just use the lowest energy we've seen */
@@ -76,6 +76,9 @@ struct sw_simulation {
   double *ln_energy_weights;
   double *ln_dos;
   dos_types sim_dos_type;
+  // the number of transitions in the collection matrix when we last
+  // computed ln_dos from it, or -1 if ln_dos holds something else.
+  long ln_dos_transitions;
 
   /* The following keep track of how many times we have walked
      between the a given energy and the state of max entropy */
@@ -255,6 +258,7 @@ struct sw_simulation {
     max_time = 0;
     start_time = clock()/double(CLOCKS_PER_SEC);
     ln_dos = 0;
+    ln_dos_transitions = -1;
   };
 };
 
@@ -2,6 +2,9 @@
 #include <time.h>
 //#include "Monte-Carlo/monte-carlo.h"
 #include "monte-carlo.h"
+#include "Monte-Carlo/sphere-cells.h"
+#include "Monte-Carlo/event-chain.h"
+#include "Monte-Carlo/checkerboard.h"
 #include <cassert>
 #include <math.h>
 #include <stdlib.h>
@@ -12,7 +15,6 @@ using std::vector;
 long shell(Vector3d v, long div, double *radius, double *sections);
 double countOverLaps(Vector3d *spheres, long n, double R);
 double countOneOverLap(Vector3d *spheres, long n, long j, double R);
-bool overlap(Vector3d *spheres, Vector3d v, long n, double R, long s);
 Vector3d halfwayBetween(Vector3d w, Vector3d v, double oShell);
 
 bool has_x_wall = false;
@@ -36,6 +38,8 @@ Vector3d laty = Vector3d(0,leny,0);
 Vector3d latz = Vector3d(0,0,lenz);
 Vector3d lat[3] = {latx,laty,latz};
 bool flat_div = false; //the divisions will be equal and will divide from z wall to z wall
+double event_chain_length = 0; // if nonzero, move spheres by event chains of this length
+int checkerboard_threads = 0; // if nonzero, sweep over domains on this many threads
 
 bool periodic[3] = {false, false, false};
 const double dxmin = 0.1;
@@ -103,6 +107,12 @@ int main(int argc, char *argv[]){
       lenz = atof(argv[a+1]);
       periodic[2] = false;
       maxrad = max(maxrad, lenz);
+    } else if (strcmp(argv[a],"eventchain") == 0) {
+      event_chain_length = atof(argv[a+1]);
+      printf("Using event chains of length %g\n", event_chain_length);
+    } else if (strcmp(argv[a],"checkerboard") == 0) {
+      checkerboard_threads = atoi(argv[a+1]);
+      printf("Using checkerboard sweeps on %d threads\n", checkerboard_threads);
     } else if (strcmp(argv[a],"flatdiv") == 0) {
       flat_div = true; //otherwise will default to radial divisions
       a -= 1;
@@ -259,6 +269,28 @@ int main(int argc, char *argv[]){
     scale = 0.1;
   }
   printf("Using scale of %g\n", scale);
+  SphereGeometry geometry;
+  geometry.R = R;
+  geometry.len[0] = lenx;
+  geometry.len[1] = leny;
+  geometry.len[2] = lenz;
+  geometry.wall[0] = has_x_wall;
+  geometry.wall[1] = has_y_wall;
+  geometry.wall[2] = has_z_wall;
+  for (int k=0; k<3; k++) geometry.periodic[k] = periodic[k];
+  if (spherical_outer_wall) geometry.outer_radius = rad;
+  if (spherical_inner_wall) geometry.inner_radius = innerRad;
+  EventChain *event_chains = 0;
+  Checkerboard *checkerboard = 0;
+  SphereCells *cells = 0;
+  if (event_chain_length > 0) {
+    event_chains = new EventChain(geometry, spheres, N);
+  } else if (checkerboard_threads > 0) {
+    checkerboard = new Checkerboard(geometry, spheres, N, scale, checkerboard_threads);
+    printf("Using %ld checkerboard domains\n", checkerboard->num_domains());
+  } else {
+    cells = new SphereCells(geometry, spheres, N);
+  }
   long count = 0;
   // In the following we compute shells, which for
   // each element will give the number of spheres
@@ -303,6 +335,9 @@ int main(int argc, char *argv[]){
   clock_t output_period = CLOCKS_PER_SEC*60; // start at outputting every minute
   clock_t max_output_period = clock_t(CLOCKS_PER_SEC)*60*30; // top out at a half hour interval
   clock_t last_output = clock(); // when we last output data
+  // A checkerboard sweep stands in for N iterations, so j goes up by
+  // N at a time.
+  const long iterations_per_step = checkerboard ? N : 1;
   for (long j=0; j<iterations; j++){
 	  num_timed = num_timed + 1;
     if (num_timed > num_to_time) {
@@ -417,7 +452,7 @@ int main(int argc, char *argv[]){
 	
     // only write out the sphere positions after they've all had a
     // chance to move
-    if (workingmoves%N == 0) {
+    if (workingmoves%N == 0 || checkerboard) {
       for (long i=0;i<N;i++) {
         //printf("Sphere at %.1f %.1f %.1f\n", spheres[i][0], spheres[i][1], spheres[i][2]);
         shells[shell(spheres[i], div, radius, sections)]++;
@@ -519,7 +554,9 @@ int main(int argc, char *argv[]){
         }
       }
     }
-    if(j % (iterations/100)==0 && j != 0){
+    // Since j may go up by more than one, we report progress when j
+    // crosses a percent, rather than when it lands on one.
+    if(j != 0 && j/(iterations/100) != (j - iterations_per_step)/(iterations/100)){
       double secs_to_go = secs_per_iteration*(iterations - j);
       long mins_to_go = secs_to_go / 60;
       long hours_to_go = mins_to_go / 60;
@@ -545,9 +582,26 @@ int main(int argc, char *argv[]){
       delete[] debugname;
       fflush(stdout);
     }
+    if (event_chains) {
+      // An event chain is never rejected, so every one counts as a
+      // working move.
+      event_chains->chain(event_chain_length);
+      count++;
+      workingmoves++;
+      continue;
+    }
+    if (checkerboard) {
+      // A sweep makes N trial moves, so it stands in for the next N
+      // iterations.
+      workingmoves += checkerboard->sweep();
+      count += N;
+      j += iterations_per_step - 1;
+      num_timed += iterations_per_step - 1;
+      continue;
+    }
     Vector3d temp = move(spheres[j%N],scale);
     count++;
-    if(overlap(spheres, temp, N, R, j%N)){
+    if(cells->overlaps(temp, j%N)){
       if (scale > 0.001 && false) {
         scale = scale/sqrt(1.02);
         //printf("Reducing scale to %g\n", scale);
@@ -560,6 +614,7 @@ int main(int argc, char *argv[]){
     }
     move_counter[j%N] = 0;
     spheres[j%N] = temp;
+    cells->moved(j%N);
     workingmoves++;
     if (scale < 5 && false) {
       scale = scale*1.02;
@@ -783,74 +838,6 @@ double countOverLaps(Vector3d *spheres, long n, double R){
   return num;
 }
 
-bool overlap(Vector3d *spheres, Vector3d v, long n, double R, long s){
-  if (spherical_outer_wall){
-    if (distance(v,Vector3d(0,0,0)) > rad) return true;
-  }
-  if (spherical_inner_wall) {
-    if (distance(v,Vector3d(0,0,0)) < innerRad) return true;
-  }
-  if (has_x_wall){
-    if (v[0] > lenx/2 || v[0] < -lenx/2) return true;
-  }
-  if (has_y_wall){
-    if (v[1] > leny/2 || v[1] < -leny/2) return true;
-  }
-  if (has_z_wall){
-    if (v[2] > lenz/2 || v[2] < -lenz/2) return true;
-  }
-  bool amonborder[3] = {
-    fabs(v[0]) + 2*R >= lenx/2,
-    fabs(v[1]) + 2*R >= leny/2,
-    fabs(v[2]) + 2*R >= lenz/2
-  };
-  for(long i = 0; i < n; i++){
-    if (i!=s){
-      if(distance(spheres[i],v)<2*R){
-        return true;
-      }
-    }
-  }
-  for (long k=0; k<3; k++) {
-    if (periodic[k] && amonborder[k]) {
-      for(long i = 0; i < n; i++) {
-        if (i!=s){
-          if (distance(v,spheres[i]+lat[k]) < 2*R) return true;
-          if (distance(v,spheres[i]-lat[k]) < 2*R) return true;
-        }
-      }
-      for (long m=k+1; m<3; m++){
-        if (periodic[m] && amonborder[m]){
-          for(long i = 0; i < n; i++) {
-            if (i!=s){
-              if (distance(v,spheres[i]+lat[k]+lat[m]) < 2*R) return true;
-              if (distance(v,spheres[i]-lat[k]-lat[m]) < 2*R) return true;
-              if (distance(v,spheres[i]+lat[k]-lat[m]) < 2*R) return true;
-              if (distance(v,spheres[i]-lat[k]+lat[m]) < 2*R) return true;
-            }
-          }
-        }
-      }
-    }
-  }
-  if (periodic[0] && periodic[1] && periodic[2]
-      && amonborder[0] && amonborder[1] && amonborder[2]){
-    for(long i = 0; i < n; i++) {
-      if (i!=s){
-        if (distance(v,spheres[i]+latx+laty+latz) < 2*R) return true;
-        if (distance(v,spheres[i]+latx+laty-latz) < 2*R) return true;
-        if (distance(v,spheres[i]+latx-laty+latz) < 2*R) return true;
-        if (distance(v,spheres[i]-latx+laty+latz) < 2*R) return true;
-        if (distance(v,spheres[i]-latx-laty+latz) < 2*R) return true;
-        if (distance(v,spheres[i]-latx+laty-latz) < 2*R) return true;
-        if (distance(v,spheres[i]+latx-laty-latz) < 2*R) return true;
-        if (distance(v,spheres[i]-latx-laty-latz) < 2*R) return true;
-      }
-    }
-  }
-  return false;
-}
-
 inline Vector3d fixPeriodic(Vector3d newv){
   if (periodic[0] || has_x_wall){
     while (newv[0] > lenx/2){
@@ -0,0 +1,100 @@
+#include <math.h>
+#include "Monte-Carlo/move-scheduler.h"
+#include "vector3d.h" // for random::ran()
+
+// We adjust a step once we have this many attempts since the last
+// adjustment, so that the acceptance rate we go by is not too noisy.
+static const long adjust_every = 1000;
+
+MoveScheduler::MoveScheduler(double goal)
+  : acceptance_goal(goal), is_frozen(false) {
+}
+
+int MoveScheduler::add(const char *name, double step, double max_step, double share) {
+  kind k;
+  k.name = name;
+  k.step = (step < max_step) ? step : max_step;
+  k.max_step = max_step;
+  k.share = share;
+  k.probability = 0;
+  k.attempts = k.accepted = 0;
+  k.seconds = 0;
+  k.window_attempts = k.window_accepted = 0;
+  kinds.push_back(k);
+  update_probabilities();
+  return int(kinds.size()) - 1;
+}
+
+int MoveScheduler::choose() const {
+  double r = random::ran();
+  for (int m=0; m<num_kinds()-1; m++) {
+    if (r < kinds[m].probability) return m;
+    r -= kinds[m].probability;
+  }
+  return num_kinds() - 1;
+}
+
+void MoveScheduler::record(int m, long attempts, long accepted, double seconds) {
+  kind &k = kinds[m];
+  k.attempts += attempts;
+  k.accepted += accepted;
+  k.seconds += seconds;
+  if (is_frozen) return;
+  k.window_attempts += attempts;
+  k.window_accepted += accepted;
+  if (k.window_attempts >= adjust_every) {
+    // Moving the logarithm of the step in proportion to how far we are
+    // from the goal settles quickly without overshooting, since the
+    // acceptance rate falls monotonically as the step grows.
+    const double rate = double(k.window_accepted)/k.window_attempts;
+    k.step *= exp(2*(rate - acceptance_goal));
+    if (k.step > k.max_step) k.step = k.max_step;
+    k.window_attempts = k.window_accepted = 0;
+    update_probabilities();
+  }
+}
+
+void MoveScheduler::freeze() {
+  is_frozen = true;
+}
+
+double MoveScheduler::acceptance_rate(int m) const {
+  return kinds[m].attempts ? double(kinds[m].accepted)/kinds[m].attempts : 0;
+}
+
+double MoveScheduler::efficiency(int m) const {
+  const kind &k = kinds[m];
+  if (k.seconds <= 0) return 0;
+  return acceptance_rate(m)*k.step*k.step*k.attempts/k.seconds;
+}
+
+// To give each kind of move its share of the CPU time, we choose it
+// with a probability proportional to its share divided by the time
+// one of its moves takes.  Until we have timed every kind, we go by
+// the shares alone.
+void MoveScheduler::update_probabilities() {
+  bool timed = true;
+  for (int m=0; m<num_kinds(); m++) {
+    if (kinds[m].seconds <= 0 || kinds[m].attempts == 0) timed = false;
+  }
+  double total = 0;
+  for (int m=0; m<num_kinds(); m++) {
+    kinds[m].probability = kinds[m].share;
+    if (timed) kinds[m].probability *= kinds[m].attempts/kinds[m].seconds;
+    total += kinds[m].probability;
+  }
+  for (int m=0; m<num_kinds(); m++) kinds[m].probability /= total;
+}
+
+void MoveScheduler::print(FILE *f, const char *prefix) const {
+  for (int m=0; m<num_kinds(); m++) {
+    const kind &k = kinds[m];
+    fprintf(f, "%s%s: step %g, probability %g, acceptance rate %g (%ld of %ld)",
+            prefix, k.name, k.step, k.probability, acceptance_rate(m), k.accepted, k.attempts);
+    if (k.seconds > 0) {
+      fprintf(f, ", %g us per move, efficiency %g per second",
+              1e6*k.seconds/k.attempts, efficiency(m));
+    }
+    fprintf(f, "\n");
+  }
+}
@@ -0,0 +1,63 @@
+// -*- mode: C++; -*-
+
+#pragma once
+
+#include <stdio.h>
+#include <vector>
+
+// MoveScheduler decides which kind of Monte Carlo move to make next,
+// and how large a step it should take.  Each kind of move (say, a
+// translation or a rotation) has its own step size, which we adjust
+// as we go so that the fraction of its moves that are accepted
+// approaches acceptance_goal.  Adjusting the step based on what was
+// accepted breaks detailed balance, so once initialization is done
+// the caller must freeze() the scheduler before collecting data.
+//
+// We also keep track of the CPU time each kind of move takes.  Moves
+// are chosen so that each kind gets its share of the CPU time (rather
+// than of the number of moves), and print() reports how fast each
+// kind of move decorrelates the system per CPU second.
+//
+// Moves are recorded in batches, so that callers need only check the
+// clock once per sweep rather than once per move.
+class MoveScheduler {
+public:
+  explicit MoveScheduler(double acceptance_goal = 0.4);
+
+  // add creates a new kind of move, and returns its index.  Its step
+  // will never be adjusted above max_step.  share is the fraction of
+  // CPU time (relative to the other kinds) it should get.
+  int add(const char *name, double step, double max_step, double share = 1);
+  // choose picks a kind of move at random.
+  int choose() const;
+  double step(int m) const { return kinds[m].step; }
+  int num_kinds() const { return int(kinds.size()); }
+
+  // record notes that we made attempts moves of kind m, of which
+  // accepted were accepted, taking the given CPU seconds.
+  void record(int m, long attempts, long accepted, double seconds);
+  // freeze stops adjusting step sizes and choice probabilities.
+  void freeze();
+  bool frozen() const { return is_frozen; }
+
+  double acceptance_rate(int m) const;
+  // efficiency measures how far moves of kind m carry the system per
+  // CPU second: the acceptance rate times the square of the step,
+  // divided by the time one move takes.
+  double efficiency(int m) const;
+  void print(FILE *f, const char *prefix = "") const;
+
+private:
+  void update_probabilities();
+
+  struct kind {
+    const char *name;
+    double step, max_step, share, probability;
+    long attempts, accepted;
+    double seconds;
+    long window_attempts, window_accepted; // since we last adjusted step
+  };
+  std::vector<kind> kinds;
+  double acceptance_goal;
+  bool is_frozen;
+};
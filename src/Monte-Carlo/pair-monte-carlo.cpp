@@ -1,6 +1,8 @@
 #include <stdio.h>
 #include <time.h>
 #include "Monte-Carlo/monte-carlo.h"
+#include "Monte-Carlo/sphere-cells.h"
+#include "Monte-Carlo/event-chain.h"
 #include <cassert>
 #include <math.h>
 #include <stdlib.h>
@@ -11,7 +13,6 @@ using std::vector;
 
 double countOverLaps(Vector3d *spheres, long n, double R);
 double countOneOverLap(Vector3d *spheres, long n, long j, double R);
-bool overlap(Vector3d *spheres, Vector3d v, long n, double R, long s);
 double distXY(Vector3d a, Vector3d b);
 double distXYZ(Vector3d a, Vector3d b);
 inline void took(const char *name);
@@ -45,6 +46,7 @@ double leny = 20;
 double lenz = 20;
 double rad = 10;  //of outer spherical walls
 double innerRad = 3;  //of inner spherical "solute"
+double event_chain_length = 0; // if nonzero, move spheres by event chains of this length
 double R = 1;
 Vector3d latx = Vector3d(lenx,0,0);
 Vector3d laty = Vector3d(0,leny,0);
@@ -119,6 +121,9 @@ int main(int argc, char *argv[]){
       maxrad = max(maxrad, lenz);
     } else if (strcmp(argv[a],"path") == 0) {
       path = true;
+    } else if (strcmp(argv[a],"eventchain") == 0) {
+      event_chain_length = atof(argv[a+1]);
+      printf("Using event chains of length %g\n", event_chain_length);
     } else if (strcmp(argv[a],"flatdiv") == 0) {
       flat_div = true; //otherwise will default to radial divisions
       a -= 1;
@@ -302,6 +307,20 @@ int main(int argc, char *argv[]){
     scale = 0.1;
   }
   printf("Using scale of %g\n", scale);
+  SphereGeometry geometry;
+  geometry.R = R;
+  geometry.len[0] = lenx;
+  geometry.len[1] = leny;
+  geometry.len[2] = lenz;
+  geometry.wall[0] = has_x_wall;
+  geometry.wall[1] = has_y_wall;
+  geometry.wall[2] = has_z_wall;
+  for (int k=0; k<3; k++) geometry.periodic[k] = periodic[k];
+  if (spherical_outer_wall) geometry.outer_radius = rad;
+  if (spherical_inner_wall) geometry.inner_radius = innerRad;
+  SphereCells cells(geometry, spheres, N);
+  EventChain *event_chains = 0;
+  if (event_chain_length > 0) event_chains = new EventChain(geometry, spheres, N);
   long count = 0;
   long *shells = new long[div];
   for (long l=0; l<div; l++) shells[l] = 0;
@@ -620,7 +639,14 @@ int main(int argc, char *argv[]){
         }
       }
     }
-    if(overlap(spheres, temp, N, R, j%N)){
+    if (event_chains) {
+      // An event chain is never rejected, so every one counts as a
+      // working move.
+      event_chains->chain(event_chain_length);
+      workingmoves++;
+      continue;
+    }
+    if(cells.overlaps(temp, j%N)){
       if (scale > 0.001 && false) {
         scale = scale/sqrt(1.02);
         //printf("Reducing scale to %g\n", scale);
@@ -633,6 +659,7 @@ int main(int argc, char *argv[]){
     }
     move_counter[j%N] = 0;
     spheres[j%N] = temp;
+    cells.moved(j%N);
     workingmoves++;
   }
 
@@ -792,74 +819,6 @@ double countOverLaps(Vector3d *spheres, long n, double R){
   return num;
 }
 
-bool overlap(Vector3d *spheres, Vector3d v, long n, double R, long s){
-  if (spherical_outer_wall){
-    if (distance(v,Vector3d(0,0,0)) > rad) return true;
-  }
-  if (spherical_inner_wall) {
-    if (distance(v,Vector3d(0,0,0)) < innerRad) return true;
-  }
-  if (has_x_wall){
-    if (v[0] > lenx/2 || v[0] < -lenx/2) return true;
-  }
-  if (has_y_wall){
-    if (v[1] > leny/2 || v[1] < -leny/2) return true;
-  }
-  if (has_z_wall){
-    if (v[2] > lenz/2 || v[2] < -lenz/2) return true;
-  }
-  bool amonborder[3] = {
-    fabs(v[0]) + 2*R >= lenx/2,
-    fabs(v[1]) + 2*R >= leny/2,
-    fabs(v[2]) + 2*R >= lenz/2
-  };
-  for(long i = 0; i < n; i++){
-    if (i!=s){
-      if(distance(spheres[i],v)<2*R){
-        return true;
-      }
-    }
-  }
-  for (long k=0; k<3; k++) {
-    if (periodic[k] && amonborder[k]) {
-      for(long i = 0; i < n; i++) {
-        if (i!=s){
-          if (distance(v,spheres[i]+lat[k]) < 2*R) return true;
-          if (distance(v,spheres[i]-lat[k]) < 2*R) return true;
-        }
-      }
-      for (long m=k+1; m<3; m++){
-        if (periodic[m] && amonborder[m]){
-          for(long i = 0; i < n; i++) {
-            if (i!=s){
-              if (distance(v,spheres[i]+lat[k]+lat[m]) < 2*R) return true;
-              if (distance(v,spheres[i]-lat[k]-lat[m]) < 2*R) return true;
-              if (distance(v,spheres[i]+lat[k]-lat[m]) < 2*R) return true;
-              if (distance(v,spheres[i]-lat[k]+lat[m]) < 2*R) return true;
-            }
-          }
-        }
-      }
-    }
-  }
-  if (periodic[0] && periodic[1] && periodic[2]
-      && amonborder[0] && amonborder[1] && amonborder[2]){
-    for(long i = 0; i < n; i++) {
-      if (i!=s){
-        if (distance(v,spheres[i]+latx+laty+latz) < 2*R) return true;
-        if (distance(v,spheres[i]+latx+laty-latz) < 2*R) return true;
-        if (distance(v,spheres[i]+latx-laty+latz) < 2*R) return true;
-        if (distance(v,spheres[i]-latx+laty+latz) < 2*R) return true;
-        if (distance(v,spheres[i]-latx-laty+latz) < 2*R) return true;
-        if (distance(v,spheres[i]-latx+laty-latz) < 2*R) return true;
-        if (distance(v,spheres[i]+latx-laty-latz) < 2*R) return true;
-        if (distance(v,spheres[i]-latx-laty-latz) < 2*R) return true;
-      }
-    }
-  }
-  return false;
-}
-
 inline Vector3d fixPeriodic(Vector3d newv){
   if (periodic[0] || has_x_wall){
     while (newv[0] > lenx/2){
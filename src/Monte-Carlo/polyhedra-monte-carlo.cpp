@@ -7,6 +7,7 @@
 #include "handymath.h"
 #include "vector3d.h"
 #include "Monte-Carlo/polyhedra.h"
+#include "Monte-Carlo/move-scheduler.h"
 
 
 // -----------------------------------------------------------------------------
@@ -58,6 +59,13 @@ bool testcase = false;
 // States how long it's been since last took call.
 static void took(const char *name);
 
+// Either translates or rotates each polyhedron once, as chosen by the
+// scheduler, and tells the scheduler how that went.
+static counter sweep_polyhedra(MoveScheduler &scheduler, int translation,
+                               polyhedron *p, int N, const double periodic[3],
+                               const double walls[3], bool real_walls, double neighborR,
+                               int max_neighbors, double dr);
+
 // Saves the vertices of all polyhedra to a file.
 inline void save_locations(const polyhedron *p, int N, const char *fname,
                            const double len[3], const char *comment="");
@@ -117,6 +125,7 @@ int main(int argc, const char *argv[]) {
   // during the initialization so that we have a reasonable acceptance rate
   double scale = 0.05;
   double theta_scale = 0.05;
+  int separate_moves = false;
 
   poptContext optCon;
   // ---------------------------------------------------------------------------
@@ -171,6 +180,8 @@ of iterations", "period"},
      "Timing information will be displayed", "interval"},
     {"acceptance_goal", '\0', POPT_ARG_DOUBLE | POPT_ARGFLAG_SHOW_DEFAULT,
      &acceptance_goal, 0, "Goal to set the acceptance rate", "goal"},
+    {"separate_moves", '\0', POPT_ARG_NONE, &separate_moves, 0,
+     "Translate and rotate polyhedra in separate moves, each with its own scale", 0},
     {"structure", '\0', POPT_ARG_STRING | POPT_ARGFLAG_SHOW_DEFAULT, &structure, 0,
     "Structure to use for truncated tetrahedra. Does nothing for other shapes. \
 Can be one of [ice | arsenic]"},
@@ -539,18 +550,32 @@ periodicity/dimensions are not set by default and are required.\n");
 
   double dscale = .1;
 
+  // With separate moves, each sweep either translates or rotates every
+  // polyhedron, and the scheduler tunes the two scales independently.
+  // A translation need never be more than half the cell, and a
+  // rotation width much over one just means picking random orientations.
+  MoveScheduler scheduler(acceptance_goal);
+  const int translation_move =
+    scheduler.add("translation", scale, min(len[0], min(len[1], len[2]))/2);
+  const int rotation_move = scheduler.add("rotation", theta_scale, 1);
+
   for(long iteration=1; iteration<=initialize_iterations; iteration++) {
     // ---------------------------------------------------------------
     // Move each polyhedron once
     // ---------------------------------------------------------------
-    for(int i=0; i<N; i++) {
-      count += move_one_polyhedron(i, polyhedra, N, periodic, walls, real_walls,
-                                        neighborR, scale, theta_scale, max_neighbors, dr);
+    if (separate_moves) {
+      count += sweep_polyhedra(scheduler, translation_move, polyhedra, N, periodic, walls,
+                               real_walls, neighborR, max_neighbors, dr);
+    } else {
+      for(int i=0; i<N; i++) {
+        count += move_one_polyhedron(i, polyhedra, N, periodic, walls, real_walls,
+                                     neighborR, scale, theta_scale, max_neighbors, dr);
+      }
     }
     // ---------------------------------------------------------------
     // fine-tune scale so that the acceptance rate will reach the goal
     // ---------------------------------------------------------------
-    if (iteration % 1000 == 0) {
+    if (!separate_moves && iteration % 1000 == 0) {
       const double acceptance_rate =
         (double)(count.workingmoves-old_count.workingmoves)/(count.totalmoves-old_count.totalmoves);
       old_count = count;
@@ -580,6 +605,7 @@ periodicity/dimensions are not set by default and are required.\n");
              1000.0*count.updates/count.totalmoves,
              1000.0*count.informs/count.totalmoves,
              (double)count.informs/count.updates);
+      if (separate_moves) scheduler.print(stdout);
       const long checks_without_tables = count.totalmoves*N;
       int total_neighbors = 0;
       for(int i=0; i<N; i++) {
@@ -598,6 +624,15 @@ periodicity/dimensions are not set by default and are required.\n");
     }
   }
   took("Initialization");
+  if (separate_moves) {
+    // From here on the scales must stay put, so that we sample the
+    // right distribution.  We record them for the save file headers.
+    scheduler.freeze();
+    scale = scheduler.step(translation_move);
+    theta_scale = scheduler.step(rotation_move);
+    scheduler.print(stdout, "Tuned ");
+    fflush(stdout);
+  }
 
   // ---------------------------------------------------------------------------
   // Save the post-initialization configuration for troubleshooting
@@ -651,9 +686,14 @@ periodicity/dimensions are not set by default and are required.\n");
     // ---------------------------------------------------------------
     // Move each polyhedron once
     // ---------------------------------------------------------------
-    for(int i=0; i<N; i++) {
-      count += move_one_polyhedron(i, polyhedra, N, periodic, walls, real_walls,
-                                         neighborR, scale, theta_scale, max_neighbors, dr);
+    if (separate_moves) {
+      count += sweep_polyhedra(scheduler, translation_move, polyhedra, N, periodic, walls,
+                               real_walls, neighborR, max_neighbors, dr);
+    } else {
+      for(int i=0; i<N; i++) {
+        count += move_one_polyhedron(i, polyhedra, N, periodic, walls, real_walls,
+                                     neighborR, scale, theta_scale, max_neighbors, dr);
+      }
     }
     // ---------------------------------------------------------------
     // Add data to historams
@@ -915,6 +955,7 @@ periodicity/dimensions are not set by default and are required.\n");
              1000.0*count.updates/count.totalmoves,
              1000.0*count.informs/count.totalmoves,
              (double)count.informs/count.updates);
+      if (separate_moves) scheduler.print(stdout);
       const long checks_without_tables = count.totalmoves*N;
       int total_neighbors = 0;
       for(int i=0; i<N; i++) {
@@ -1062,6 +1103,24 @@ static void took(const char *name) {
   last_time = t;
 }
 
+static counter sweep_polyhedra(MoveScheduler &scheduler, int translation,
+                               polyhedron *p, int N, const double periodic[3],
+                               const double walls[3], bool real_walls, double neighborR,
+                               int max_neighbors, double dr) {
+  const int m = scheduler.choose();
+  const double dist = (m == translation) ? scheduler.step(m) : 0;
+  const double angwidth = (m == translation) ? 0 : scheduler.step(m);
+  counter sweep;
+  const clock_t start = clock();
+  for(int i=0; i<N; i++) {
+    sweep += move_one_polyhedron(i, p, N, periodic, walls, real_walls,
+                                 neighborR, dist, angwidth, max_neighbors, dr);
+  }
+  scheduler.record(m, sweep.totalmoves, sweep.workingmoves,
+                   (clock() - start)/double(CLOCKS_PER_SEC));
+  return sweep;
+}
+
 void save_locations(const polyhedron *p, int N, const char *fname, const double len[3], const char *comment) {
   FILE *out = fopen((const char *)fname, "w");
   fprintf(out, "# %s\n", comment);
@@ -90,131 +90,98 @@ vector3d periodic_diff(const vector3d &a, const vector3d  &b, const double perio
   return v;
 }
 
+void oriented_shape::orient(const poly_shape *s, const rotation &r) {
+  if (s->nvertices > max_poly_vertices || s->nfaces > max_poly_faces) {
+    printf("A %s has too many vertices or faces!\n", s->name);
+    exit(1);
+  }
+  shape = s;
+  rot = r;
+  for (int j=0; j<s->nvertices; j++) {
+    const vector3d v = r.rotate_vector(s->vertices[j]);
+    vx[j] = v.x;
+    vy[j] = v.y;
+    vz[j] = v.z;
+  }
+  for (int i=0; i<s->nfaces; i++) {
+    const vector3d f = r.rotate_vector(s->faces[i]);
+    fx[i] = f.x;
+    fy[i] = f.y;
+    fz[i] = f.z;
+  }
+}
+
+// project finds the extent of a polyhedron with oriented shape o and
+// radius R along the axis (ax, ay, az), when its center is at offset
+// along that axis.
+static inline void project(const oriented_shape &o, double R, double ax, double ay, double az,
+                           double offset, double *pmin, double *pmax) {
+  double lo = ax*o.vx[0] + ay*o.vy[0] + az*o.vz[0], hi = lo;
+  for (int j=1; j<o.shape->nvertices; j++) {
+    const double projection = ax*o.vx[j] + ay*o.vy[j] + az*o.vz[j];
+    lo = min(projection, lo);
+    hi = max(projection, hi);
+  }
+  *pmin = R*lo + offset;
+  *pmax = R*hi + offset;
+}
+
+// separated is true if any face of x separates x from y, when y is
+// displaced by xy from x.
+static inline bool separated(const oriented_shape &x, double xR, const oriented_shape &y,
+                             double yR, const vector3d &xy) {
+  for (int i=0; i<x.shape->nfaces; i++) {
+    const double ax = x.fx[i], ay = x.fy[i], az = x.fz[i];
+    double xmin, xmax, ymin, ymax;
+    project(x, xR, ax, ay, az, 0, &xmin, &xmax);
+    project(y, yR, ax, ay, az, ax*xy.x + ay*xy.y + az*xy.z, &ymin, &ymax);
+    if (xmin > ymax || ymin > xmax) return true;
+  }
+  return false;
+}
+
 bool overlap(const polyhedron &a, const polyhedron &b, const double periodic[3], double dr) {
   const vector3d ab = periodic_diff(a.pos, b.pos, periodic);
   if (ab.normsquared() > sqr(a.R + b.R + 2*dr))
     return false;
-  // construct axes from a
-  // project a and b to each axis
-  for (int i=0; i<a.mypoly->nfaces; i++) {
-    const vector3d axis = a.rot.rotate_vector(a.mypoly->faces[i]);
-    double projection = axis.dot(a.rot.rotate_vector((a.mypoly->vertices[0])*(a.R+dr)));
-    double mina = projection, maxa = projection;
-    for (int j=1; j<a.mypoly->nvertices; j++) {
-      projection = axis.dot(a.rot.rotate_vector(a.mypoly->vertices[j]*(a.R+dr)));
-      if (projection < mina) mina = projection;
-      else if (projection > maxa) maxa = projection;
-    }
-    projection = axis.dot(b.rot.rotate_vector(b.mypoly->vertices[0]*(b.R+dr)) + ab);
-    double minb = projection, maxb = projection;
-    for (int j=1; j<b.mypoly->nvertices; j++) {
-      projection = axis.dot(b.rot.rotate_vector(b.mypoly->vertices[j]*(b.R+dr)) + ab);
-      if (projection < minb) minb = projection;
-      else if (projection > maxb) maxb = projection;
-    }
-    if (mina > maxb || minb > maxa) {
-      return false;
-    }
-  }
-  // construct axes from b
-  // project a and b to each axis
-  for (int i=0; i<b.mypoly->nfaces; i++) {
-    const vector3d axis = b.rot.rotate_vector(b.mypoly->faces[i]);
-    double projection = axis.dot(a.rot.rotate_vector(a.mypoly->vertices[0]*(a.R+dr)));
-    double mina = projection, maxa = projection;
-    for (int j=1; j<a.mypoly->nvertices; j++) {
-      projection = axis.dot(a.rot.rotate_vector(a.mypoly->vertices[j]*(a.R+dr)));
-      if (projection < mina) mina = projection;
-      else if (projection > maxa) maxa = projection;
-    }
-    projection = axis.dot(b.rot.rotate_vector(b.mypoly->vertices[0]*(b.R+dr)) + ab);
-    double minb = projection, maxb = projection;
-    for (int j=1; j<b.mypoly->nvertices; j++) {
-      projection = axis.dot(b.rot.rotate_vector(b.mypoly->vertices[j]*(b.R+dr)) + ab);
-      if (projection < minb) minb = projection;
-      else if (projection > maxb) maxb = projection;
-    }
-    if (mina > maxb || minb > maxa) {
-      return false;
-    }
-  }
-  return true;
+  // project a and b onto the face normals of each
+  const oriented_shape &ao = a.oriented(), &bo = b.oriented();
+  return !separated(ao, a.R+dr, bo, b.R+dr, ab) && !separated(bo, b.R+dr, ao, a.R+dr, -ab);
 }
 
 
 int overlaps_with_any(const polyhedron &a, const polyhedron *bs,
                       const double periodic[3], bool count, double dr) {
-  // construct axes from a and a's projection onto them
-  vector3d *aaxes = new vector3d[a.mypoly->nfaces];
-  double amins[a.mypoly->nfaces], amaxes[a.mypoly->nfaces];
-  for (int i=0; i<a.mypoly->nfaces; i++) {
-    aaxes[i] = a.rot.rotate_vector(a.mypoly->faces[i]);
-    double projection = aaxes[i].dot(a.rot.rotate_vector(a.mypoly->vertices[0]*(a.R+dr)));
-    amins[i] = projection, amaxes[i] = projection;
-    for (int j=1; j< a.mypoly->nvertices; j++) {
-      projection = aaxes[i].dot(a.rot.rotate_vector(a.mypoly->vertices[j]*(a.R+dr)));
-      amins[i] = min(projection, amins[i]);
-      amaxes[i] = max(projection, amaxes[i]);
-    }
+  // a's extent along its own face normals is the same for every
+  // neighbor, so we find it just once.
+  const oriented_shape &ao = a.oriented();
+  const int nfaces = a.mypoly->nfaces;
+  double amins[max_poly_faces], amaxes[max_poly_faces];
+  for (int i=0; i<nfaces; i++) {
+    project(ao, a.R+dr, ao.fx[i], ao.fy[i], ao.fz[i], 0, &amins[i], &amaxes[i]);
   }
   int num_overlaps = 0;
   for (int l=0; l<a.num_neighbors; l++) {
     const int k = a.neighbors[l];
     const vector3d ab = periodic_diff(a.pos, bs[k].pos, periodic);
     if (ab.normsquared() < sqr(a.R + bs[k].R + 2*dr)) {
+      const oriented_shape &bo = bs[k].oriented();
       bool overlap = true; // assume overlap until we prove otherwise or fail to.
       // check projection of b against a's axes
-      for (int i=0; i<a.mypoly->nfaces; i++) {
-        double projection = aaxes[i].dot
-          (bs[k].rot.rotate_vector(bs[k].mypoly->vertices[0]*(bs[k].R+dr)) + ab);
-        double bmin = projection, bmax = projection;
-        for (int j=1; j<bs[k].mypoly->nvertices; j++) {
-          projection = aaxes[i].dot
-            (bs[k].rot.rotate_vector(bs[k].mypoly->vertices[j]*(bs[k].R+dr)) + ab);
-          bmin = min(projection, bmin);
-          bmax = max(projection, bmax);
-        }
-        if (amins[i] > bmax || bmin > amaxes[i]) {
-          overlap = false;
-          i = a.mypoly->nfaces; // no overlap, move on to next
-        }
-      }
-      if (overlap) { // still need to check against b's axes
-        for (int i=0; i<bs[k].mypoly->nfaces; i++) {
-          const vector3d axis = bs[k].rot.rotate_vector(bs[k].mypoly->faces[i]);
-          double projection = axis.dot(a.rot.rotate_vector(a.mypoly->vertices[0]*(a.R+dr)));
-          double amin = projection, amax = projection;
-          for (int j=1; j<a.mypoly->nvertices; j++) {
-            projection = axis.dot(a.rot.rotate_vector(a.mypoly->vertices[j]*(a.R+dr)));
-            amin = min(projection, amin);
-            amax = max(projection, amax);
-          }
-          projection = axis.dot
-            (bs[k].rot.rotate_vector(bs[k].mypoly->vertices[0]*(bs[k].R+dr)) + ab);
-          double bmin = projection, bmax = projection;
-          for (int j=1; j<bs[k].mypoly->nvertices; j++) {
-            projection = axis.dot
-              (bs[k].rot.rotate_vector(bs[k].mypoly->vertices[j]*(bs[k].R+dr)) + ab);
-            bmin = min(projection, bmin);
-            bmax = max(projection, bmax);
-
-          }
-          if (amin > bmax || bmin > amax) {
-            overlap = false;
-            i = bs[k].mypoly->nfaces; //no overlap, move on to next
-          }
-        }
+      for (int i=0; i<nfaces && overlap; i++) {
+        double bmin, bmax;
+        project(bo, bs[k].R+dr, ao.fx[i], ao.fy[i], ao.fz[i],
+                ao.fx[i]*ab.x + ao.fy[i]*ab.y + ao.fz[i]*ab.z, &bmin, &bmax);
+        if (amins[i] > bmax || bmin > amaxes[i]) overlap = false;
       }
+      // still need to check against b's axes
+      if (overlap && separated(bo, bs[k].R+dr, ao, a.R+dr, -ab)) overlap = false;
       if (overlap) {
-        if(!count) {
-          delete[] aaxes;
-          return 1;
-        }
+        if(!count) return 1;
         num_overlaps ++;
       }
     }
   }
-  delete[] aaxes;
   return num_overlaps;
 }
 
@@ -225,14 +192,14 @@ bool in_cell(const polyhedron &p, const double walls[3], bool real_walls, double
         if (p.pos[i] - p.R - dr > 0.0 && p.pos[i] + p.R + dr < walls[i]) {
           continue;
         }
-        double coord = (p.rot.rotate_vector(p.mypoly->vertices[0]*(p.R+dr)) + p.pos)[i];
-        double pmin = coord, pmax = coord;
+        const oriented_shape &o = p.oriented();
+        const double *coords = (i == 0) ? o.vx : (i == 1) ? o.vy : o.vz;
+        double lo = coords[0], hi = coords[0];
         for (int j=1; j<p.mypoly->nvertices; j++) {
-          coord = (p.rot.rotate_vector(p.mypoly->vertices[j]*(p.R+dr)) + p.pos)[i];
-          pmin = min(coord, pmin);
-          pmax = max(coord, pmax);
+          lo = min(coords[j], lo);
+          hi = max(coords[j], hi);
         }
-        if (pmin < 0.0 || pmax > walls[i])
+        if ((p.R+dr)*lo + p.pos[i] < 0.0 || (p.R+dr)*hi + p.pos[i] > walls[i])
           return false;
       }
     }
@@ -244,8 +211,10 @@ bool in_cell(const polyhedron &p, const double walls[3], bool real_walls, double
 polyhedron random_move(const polyhedron &original, double size,
                                     double angwidth, const double len[3]) {
   polyhedron temp = original;
-  temp.pos = fix_periodic(temp.pos + vector3d::ran(size), len);
-  temp.rot = rotation::ran(angwidth)*original.rot;
+  // A zero size or angwidth makes this a pure rotation or a pure
+  // translation, which we can do without drawing random numbers.
+  if (size > 0) temp.pos = fix_periodic(temp.pos + vector3d::ran(size), len);
+  if (angwidth > 0) temp.rot = rotation::ran(angwidth)*original.rot;
   return temp;
 }
 
@@ -500,6 +469,7 @@ polyhedron::polyhedron(const polyhedron &p) {
   neighbors = p.neighbors;
   num_neighbors = p.num_neighbors;
   neighbor_center = p.neighbor_center;
+  orientation = p.orientation;
 }
 
 polyhedron polyhedron::operator=(const polyhedron &p) {
@@ -510,5 +480,6 @@ polyhedron polyhedron::operator=(const polyhedron &p) {
   neighbors = p.neighbors;
   num_neighbors = p.num_neighbors;
   neighbor_center = p.neighbor_center;
+  orientation = p.orientation;
   return *this;
 }
@@ -34,6 +34,24 @@ private:
   DISALLOW_COPY_AND_ASSIGN(poly_shape);
 };
 
+// The most vertices and faces that any poly_shape has.
+const int max_poly_vertices = 12;
+const int max_poly_faces = 4;
+
+// An oriented_shape holds the vertices and face normals of a
+// poly_shape rotated into the lab frame (but neither scaled by R nor
+// moved to pos).  Each coordinate is in an array of its own, so that
+// projecting all the vertices onto an axis is one simple loop.
+struct oriented_shape {
+  const poly_shape *shape; // the shape and rotation these are for
+  rotation rot;
+  double vx[max_poly_vertices], vy[max_poly_vertices], vz[max_poly_vertices];
+  double fx[max_poly_faces], fy[max_poly_faces], fz[max_poly_faces];
+
+  oriented_shape() : shape(0) {}
+  void orient(const poly_shape *s, const rotation &r);
+};
+
 // Note: once assigned, the poly_shape of a polyhedron is never
 // cleared. It is expected that there are only a few poly_shapes with
 // many polyhedra pointing to each
@@ -50,6 +68,17 @@ struct polyhedron {
   polyhedron(const polyhedron &p);
 
   polyhedron operator=(const polyhedron &p);
+
+  // oriented gives our shape rotated by rot.  It only rotates the
+  // shape again when rot (or mypoly) has changed since it last did,
+  // so the overlap tests rotate each polyhedron once per accepted
+  // move, rather than once for every neighbor it is checked against.
+  const oriented_shape &oriented() const {
+    if (orientation.shape != mypoly || orientation.rot != rot) orientation.orient(mypoly, rot);
+    return orientation;
+  }
+private:
+  mutable oriented_shape orientation;
 };
 
 struct counter {
@@ -119,7 +148,8 @@ int overlaps_with_any(const polyhedron &a, const polyhedron *p, const double per
 bool in_cell(const polyhedron &p, const double walls[3], bool real_walls, double dr=0);
 
 // Move and rotate the polyhedron by a random amount, in a gaussian distribution with
-// respective standard deviations dist and angwidth
+// respective standard deviations dist and angwidth.  If either is zero, the
+// polyhedron is only rotated or only moved.
 polyhedron random_move(const polyhedron &original, double dist, double angwidth, const double len[3]);
 
 // Attempt to move polyhedron of id in p, while paying attention to
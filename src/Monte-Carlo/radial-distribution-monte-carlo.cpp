@@ -1,6 +1,8 @@
 #include <stdio.h>
 #include <time.h>
 #include "Monte-Carlo/monte-carlo.h"
+#include "Monte-Carlo/sphere-cells.h"
+#include "Monte-Carlo/event-chain.h"
 #include <cassert>
 #include <math.h>
 #include <stdlib.h>
@@ -9,7 +11,6 @@
 long shell(Vector3d v, long div, double *radius);
 double countOverLaps(Vector3d *spheres, long n, double R);
 double countOneOverLap(Vector3d *spheres, long n, long j, double R);
-bool overlap(Vector3d *spheres, Vector3d v, long n, double R, long s);
 
 const double lenx = 60;
 const double leny = 60;
@@ -22,8 +23,8 @@ const Vector3d latz = Vector3d(0,0,lenz);
 const Vector3d lat[3] = {latx,laty,latz};
 
 int main(int argc, char *argv[]){
-  if (argc != 5) {
-    printf("usage:  %s packing-fraction uncertainty_goal dr filename\n", argv[0]);
+  if (argc != 5 && argc != 6) {
+    printf("usage:  %s packing-fraction uncertainty_goal dr filename [event-chain-length]\n", argv[0]);
     return 1;
   }
   const char *outfilename = argv[4];
@@ -129,6 +130,22 @@ int main(int argc, char *argv[]){
     scale = 0.1;
   }
   printf("Using scale of %g\n", scale);
+  SphereGeometry geometry;
+  geometry.R = R;
+  geometry.len[0] = lenx;
+  geometry.len[1] = leny;
+  geometry.len[2] = lenz;
+  for (int k=0; k<3; k++) geometry.periodic[k] = true;
+  geometry.inner_radius = innerRad;
+  const double event_chain_length = (argc == 6) ? atof(argv[5]) : 0;
+  EventChain *event_chains = 0;
+  SphereCells *cells = 0;
+  if (event_chain_length > 0) {
+    printf("Using event chains of length %g\n", event_chain_length);
+    event_chains = new EventChain(geometry, spheres, N);
+  } else {
+    cells = new SphereCells(geometry, spheres, N);
+  }
   long count = 0;
   long *shells = new long[div];
   for (long l=0; l<div; l++) shells[l] = 0;
@@ -250,10 +267,17 @@ int main(int argc, char *argv[]){
       delete[] debugname;
       fflush(stdout);
     }
+    if (event_chains) {
+      event_chains->chain(event_chain_length);
+      count++;
+      workingmoves++;
+      continue;
+    }
     Vector3d temp = move(spheres[j%N],scale);
     count++;
-    if(!overlap(spheres, temp, N, R, j%N)){
+    if(!cells->overlaps(temp, j%N)){
       spheres[j%N] = temp;
+      cells->moved(j%N);
       workingmoves++;
     }
   }
@@ -356,59 +380,6 @@ double countOverLaps(Vector3d *spheres, long n, double R){
   return num;
 }
 
-bool overlap(Vector3d *spheres, Vector3d v, long n, double R, long s){
-  if (distance(v,Vector3d(0,0,0)) < innerRad) return true;
-  bool amonborder[3] = {
-    fabs(v[0]) + 2*R >= lenx/2,
-    fabs(v[1]) + 2*R >= leny/2,
-    fabs(v[2]) + 2*R >= lenz/2
-  };
-  for(long i = 0; i < n; i++){
-    if (i!=s){
-      if(distance(spheres[i],v)<2*R){
-        return true;
-      }
-    }
-  }
-  for (long k=0; k<3; k++) {
-    if (amonborder[k]) {
-      for(long i = 0; i < n; i++) {
-        if (i!=s){
-          if (distance(v,spheres[i]+lat[k]) < 2*R) return true;
-          if (distance(v,spheres[i]-lat[k]) < 2*R) return true;
-        }
-      }
-      for (long m=k+1; m<3; m++) {
-        if (amonborder[m]) {
-          for(long i = 0; i < n; i++) {
-            if (i!=s){
-              if (distance(v,spheres[i]+lat[k]+lat[m]) < 2*R) return true;
-              if (distance(v,spheres[i]-lat[k]-lat[m]) < 2*R) return true;
-              if (distance(v,spheres[i]+lat[k]-lat[m]) < 2*R) return true;
-              if (distance(v,spheres[i]-lat[k]+lat[m]) < 2*R) return true;
-            }
-          }
-        }
-      }
-    }
-  }
-  if (amonborder[0] && amonborder[1] && amonborder[2]){
-    for(long i = 0; i < n; i++) {
-      if (i!=s){
-        if (distance(v,spheres[i]+latx+laty+latz) < 2*R) return true;
-        if (distance(v,spheres[i]+latx+laty-latz) < 2*R) return true;
-        if (distance(v,spheres[i]+latx-laty+latz) < 2*R) return true;
-        if (distance(v,spheres[i]-latx+laty+latz) < 2*R) return true;
-        if (distance(v,spheres[i]-latx-laty+latz) < 2*R) return true;
-        if (distance(v,spheres[i]-latx+laty-latz) < 2*R) return true;
-        if (distance(v,spheres[i]+latx-laty-latz) < 2*R) return true;
-        if (distance(v,spheres[i]-latx-laty-latz) < 2*R) return true;
-      }
-    }
-  }
-  return false;
-}
-
 inline Vector3d fixPeriodic(Vector3d newv){
   while (newv[0] > lenx/2) newv[0] -= lenx;
   while (newv[0] < -lenx/2) newv[0] += lenx;
@@ -0,0 +1,351 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <atomic>
+#include <map>
+#include <thread>
+#include "Monte-Carlo/reweighting.h"
+#include "FieldFile.h"
+
+static int default_threads() {
+  int num = std::thread::hardware_concurrency();
+  return (num > 0) ? num : 1;
+}
+
+// LineReader hands out the lines of a text file, skipping comments and
+// blank lines.  The -g.dat lines are too long for a fixed buffer.
+class LineReader {
+public:
+  explicit LineReader(const char *fname) : f(fopen(fname, "r")), line(0), cap(0) {
+    if (!f) fprintf(stderr, "Unable to open file %s!\n", fname);
+  }
+  ~LineReader() {
+    if (f) fclose(f);
+    free(line);
+  }
+  bool ok() const { return f != 0; }
+  // next returns the next line of data, or null at the end of the
+  // file.  If comment is non-null, it gets each comment line we pass.
+  const char *next(void (*comment)(const char *, void *) = 0, void *data = 0) {
+    while (getline(&line, &cap, f) > 0) {
+      const char *p = line + strspn(line, " \t");
+      if (*p == '#') {
+        if (comment) comment(p, data);
+      } else if (*p != '\n' && *p != 0) {
+        return p;
+      }
+    }
+    return 0;
+  }
+private:
+  FILE *f;
+  char *line;
+  size_t cap;
+};
+
+Reweighting::Reweighting() : nobs(0), dr(0) {
+  set_threads(0);
+}
+
+void Reweighting::set_threads(int threads) {
+  num_threads = (threads > 0) ? threads : default_threads();
+}
+
+bool Reweighting::ReadDos(const char *fname) {
+  LineReader in(fname);
+  if (!in.ok()) return false;
+  E.clear();
+  lnD.clear();
+  A.clear();
+  nobs = 0;
+  dr = 0;
+  // The third column holds the pessimistic samples.  Energies at or
+  // above the max_entropy_state never get any, so we can't drop every
+  // row without them, only those below the lowest energy that has
+  // some.  There compute_ln_dos just carries on the last value it
+  // found, which would make the run look like it reached energies it
+  // never saw.
+  long lowest_sampled = -1;
+  while (const char *line = in.next()) {
+    int i;
+    double lndos;
+    long ps = 1;
+    if (sscanf(line, "%d %lg %ld", &i, &lndos, &ps) < 2) {
+      fprintf(stderr, "Error reading file %s!\n", fname);
+      return false;
+    }
+    if (std::isfinite(lndos)) {
+      E.push_back(-i);
+      lnD.push_back(lndos);
+      if (ps > 0) lowest_sampled = num_energies();
+    }
+  }
+  if (E.empty()) {
+    fprintf(stderr, "There is no density of states in %s!\n", fname);
+    return false;
+  }
+  if (lowest_sampled < 0) {
+    fprintf(stderr, "%s has no pessimistic samples, so we can't tell which energies were reached!\n",
+            fname);
+    return false;
+  }
+  E.resize(lowest_sampled);
+  lnD.resize(lowest_sampled);
+  return true;
+}
+
+// read_table reads the two-column energy files (-E.dat and -lnw.dat)
+// into a map from energy index to value.
+static bool read_table(const char *fname, std::map<int,double> *table) {
+  LineReader in(fname);
+  if (!in.ok()) return false;
+  while (const char *line = in.next()) {
+    int i;
+    double value;
+    if (sscanf(line, "%d %lg", &i, &value) != 2) {
+      fprintf(stderr, "Error reading file %s!\n", fname);
+      return false;
+    }
+    (*table)[i] = value;
+  }
+  return true;
+}
+
+bool Reweighting::ReadHistogram(const char *E_fname, const char *lnw_fname) {
+  std::map<int,double> hist, lnw;
+  if (!read_table(E_fname, &hist) || !read_table(lnw_fname, &lnw)) return false;
+  E.clear();
+  lnD.clear();
+  A.clear();
+  nobs = 0;
+  dr = 0;
+  for (std::map<int,double>::const_iterator h = hist.begin(); h != hist.end(); ++h) {
+    if (h->second <= 0) continue;
+    std::map<int,double>::const_iterator w = lnw.find(h->first);
+    if (w == lnw.end()) {
+      fprintf(stderr, "%s has no weight for energy %d!\n", lnw_fname, -h->first);
+      return false;
+    }
+    E.push_back(-h->first);
+    lnD.push_back(log(h->second) - w->second);
+  }
+  if (E.empty()) {
+    fprintf(stderr, "There is no energy histogram in %s!\n", E_fname);
+    return false;
+  }
+  return true;
+}
+
+struct GHeader {
+  int N;
+  double len[3], de_g;
+};
+
+static void read_g_comment(const char *line, void *data) {
+  GHeader *h = (GHeader *)data;
+  sscanf(line, "# N: %d", &h->N);
+  sscanf(line, "# cell dimensions: (%lg, %lg, %lg)", &h->len[0], &h->len[1], &h->len[2]);
+  sscanf(line, "# de_g: %lg", &h->de_g);
+}
+
+bool Reweighting::ReadG(const char *fname) {
+  if (E.empty()) {
+    fprintf(stderr, "We need the density of states before reading %s!\n", fname);
+    return false;
+  }
+  LineReader in(fname);
+  if (!in.ok()) return false;
+  GHeader h;
+  h.N = 0;
+  h.len[0] = h.len[1] = h.len[2] = h.de_g = 0;
+  // The first line of data holds the radii of the bins, after three
+  // zeros standing in for the energy, count and weight.
+  const char *line = in.next(read_g_comment, &h);
+  if (!line) {
+    fprintf(stderr, "There is no g(r) in %s!\n", fname);
+    return false;
+  }
+  if (h.N < 2 || h.len[0]*h.len[1]*h.len[2] <= 0 || h.de_g <= 0) {
+    fprintf(stderr, "The header of %s lacks N, the cell dimensions or de_g!\n", fname);
+    return false;
+  }
+  int bins = -3;
+  for (const char *p = line; *p; ) {
+    char *end;
+    strtod(p, &end);
+    if (end == p) break;
+    bins++;
+    p = end;
+  }
+  if (bins <= 0) {
+    fprintf(stderr, "Error reading the radii in %s!\n", fname);
+    return false;
+  }
+
+  // We turn the mean number of ordered pairs in each shell into g(r) by
+  // dividing by the number an ideal gas would have.
+  const double volume = h.len[0]*h.len[1]*h.len[2];
+  std::vector<double> ideal(bins);
+  for (int b=0; b<bins; b++) {
+    const double shell = 4*M_PI/3*h.de_g*h.de_g*h.de_g*(pow(b+1.0, 3) - pow(double(b), 3));
+    ideal[b] = h.N*(h.N - 1.0)/volume*shell;
+  }
+  std::map<int,long> index;
+  for (long i=0; i<num_energies(); i++) index[int(E[i])] = i;
+  std::vector<double> newE, newlnD, newA;
+  while ((line = in.next())) {
+    int e;
+    double counts, lnw;
+    int used;
+    if (sscanf(line, "%d %lg %lg%n", &e, &counts, &lnw, &used) != 3 || counts <= 0) {
+      fprintf(stderr, "Error reading file %s!\n", fname);
+      return false;
+    }
+    std::map<int,long>::const_iterator i = index.find(e);
+    if (i == index.end()) continue; // no density of states here
+    newE.push_back(E[i->second]);
+    newlnD.push_back(lnD[i->second]);
+    const char *p = line + used;
+    for (int b=0; b<bins; b++) {
+      char *end;
+      const double hist = strtod(p, &end);
+      if (end == p) {
+        fprintf(stderr, "There are not %d bins at energy %d in %s!\n", bins, e, fname);
+        return false;
+      }
+      newA.push_back(hist/counts/ideal[b]);
+      p = end;
+    }
+  }
+  if (newE.empty()) {
+    fprintf(stderr, "%s has no energies in common with the density of states!\n", fname);
+    return false;
+  }
+  E.swap(newE);
+  lnD.swap(newlnD);
+  A.swap(newA);
+  nobs = bins;
+  dr = h.de_g;
+  return true;
+}
+
+// The field file has a row for each energy, holding E, ln D(E) and then
+// the observables.
+bool Reweighting::Save(const char *fname) const {
+  FieldHeader h;
+  h.Nx = int(num_energies());
+  h.Ny = 2 + nobs;
+  h.Nz = 1;
+  h.set_parameter("reweighting", 1);
+  h.set_parameter("r_step", dr);
+  std::vector<double> data(h.size());
+  for (long i=0; i<num_energies(); i++) {
+    data[i*h.Ny] = E[i];
+    data[i*h.Ny + 1] = lnD[i];
+    for (int k=0; k<nobs; k++) data[i*h.Ny + 2 + k] = A[i*nobs + k];
+  }
+  return write_field_file(fname, h, data.data());
+}
+
+bool Reweighting::Load(const char *fname) {
+  FieldFile file;
+  if (!file.open(fname)) return false;
+  const FieldHeader &h = file.header();
+  double marker, r_step;
+  if (h.Nz != 1 || h.Ny < 2 || !h.get_parameter("reweighting", &marker)
+      || !h.get_parameter("r_step", &r_step)) {
+    fprintf(stderr, "Field file %s is not a reweighting table!\n", fname);
+    return false;
+  }
+  nobs = h.Ny - 2;
+  dr = r_step;
+  E.resize(h.Nx);
+  lnD.resize(h.Nx);
+  A.resize(long(h.Nx)*nobs);
+  for (long i=0; i<h.Nx; i++) {
+    E[i] = file(i, 0, 0);
+    lnD[i] = file(i, 1, 0);
+    for (int k=0; k<nobs; k++) A[i*nobs + k] = file(i, 2 + k, 0);
+  }
+  return true;
+}
+
+double Reweighting::weights(double T, double *w) const {
+  const long n = num_energies();
+  const double beta = 1/T;
+  const double *e = E.data(), *lndos = lnD.data();
+  double biggest = -HUGE_VAL;
+  for (long i=0; i<n; i++) {
+    w[i] = lndos[i] - beta*e[i];
+    if (w[i] > biggest) biggest = w[i];
+  }
+  for (long i=0; i<n; i++) w[i] = exp(w[i] - biggest);
+  return biggest;
+}
+
+// for_each_temperature calls f(j, w) for 0 <= j < nT, sharing the
+// temperatures out among the threads, each of which has its own
+// scratch array w for the weights.
+template<typename F>
+void Reweighting::for_each_temperature(long nT, const F &f) const {
+  std::atomic<long> next(0);
+  auto work = [&]() {
+    std::vector<double> w(num_energies());
+    for (long j = next++; j < nT; j = next++) f(j, &w[0]);
+  };
+  std::vector<std::thread> threads;
+  for (int t=1; t<num_threads && t<nT; t++) threads.push_back(std::thread(work));
+  work();
+  for (unsigned t=0; t<threads.size(); t++) threads[t].join();
+}
+
+void Reweighting::Thermodynamics(const double *T, long nT, double *U, double *CV,
+                                 double *S, double *F) const {
+  const long n = num_energies();
+  const double *e = E.data();
+  // At infinite temperature every state is equally likely, so the
+  // entropy there is ln Z(T = infinity).
+  double lnZ_inf = -HUGE_VAL;
+  for (long i=0; i<n; i++) if (lnD[i] > lnZ_inf) lnZ_inf = lnD[i];
+  double sum = 0;
+  for (long i=0; i<n; i++) sum += exp(lnD[i] - lnZ_inf);
+  lnZ_inf += log(sum);
+
+  for_each_temperature(nT, [&](long j, double *w) {
+      const double biggest = weights(T[j], w);
+      double Z = 0, ZE = 0;
+      for (long i=0; i<n; i++) {
+        Z += w[i];
+        ZE += w[i]*e[i];
+      }
+      const double u = ZE/Z;
+      // We find the variance about the mean, which loses fewer digits
+      // than <E^2> - <E>^2 does at low temperature.
+      double Zvar = 0;
+      for (long i=0; i<n; i++) Zvar += w[i]*(e[i] - u)*(e[i] - u);
+      const double s = biggest + log(Z) + u/T[j] - lnZ_inf;
+      if (U) U[j] = u;
+      if (CV) CV[j] = Zvar/Z/(T[j]*T[j]);
+      if (S) S[j] = s;
+      if (F) F[j] = u - T[j]*s;
+    });
+}
+
+void Reweighting::Observables(const double *T, long nT, double *out) const {
+  const long n = num_energies();
+  const int k = nobs;
+  const double *a = A.data();
+  for_each_temperature(nT, [&](long j, double *w) {
+      weights(T[j], w);
+      double *o = out + j*k;
+      for (int m=0; m<k; m++) o[m] = 0;
+      double Z = 0;
+      for (long i=0; i<n; i++) {
+        Z += w[i];
+        const double wi = w[i], *ai = a + i*k;
+        for (int m=0; m<k; m++) o[m] += wi*ai[m];
+      }
+      for (int m=0; m<k; m++) o[m] /= Z;
+    });
+}
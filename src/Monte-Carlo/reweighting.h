@@ -0,0 +1,80 @@
+// -*- mode: C++; -*-
+
+#pragma once
+
+#include <vector>
+
+// Reweighting turns the density of states D(E) found by a square-well
+// run into canonical averages at as many temperatures as we like,
+//
+//   <A>(T) = sum_E A(E) D(E) exp(-E/T) / sum_E D(E) exp(-E/T)
+//
+// where A(E) is an observable averaged over the states the run saw at
+// energy E, such as the g(r) in a -g.dat file.  Energies are in units
+// of the well depth (so E is minus the number of interactions), and
+// temperatures in units of the well depth over k_B.
+//
+// Each sum is taken relative to its largest term, so ln D(E) - E/T can
+// be as big as it likes without overflowing, and the low temperature
+// sums keep their digits.  The temperatures are shared out among the
+// threads, and the sums over energy run along contiguous arrays so
+// that the compiler can vectorize them.
+//
+// Reading the text files once and then saving the tables as a field
+// file (see FieldFile.h) makes later runs start up much faster.
+
+class Reweighting {
+public:
+  Reweighting();
+
+  // ReadDos reads ln D(E) from an -lndos.dat file (as written to the
+  // -movie directory), and ReadHistogram finds it from an -E.dat file
+  // and its -lnw.dat file as ln D(E) = ln H(E) - ln w(E), at each
+  // energy the run visited.  An -lndos.dat file has a row for every
+  // energy level, so ReadDos drops the rows below the lowest energy
+  // with pessimistic samples, which the run never reached.  They
+  // return false (printing why) if they cannot, and drop any
+  // observables read earlier.
+  bool ReadDos(const char *fname);
+  bool ReadHistogram(const char *E_fname, const char *lnw_fname);
+  // ReadG reads the pair histograms in a -g.dat file, and makes g(r)
+  // at each energy the observables.  Energies with no g(r) data are
+  // dropped, so the density of states must be read first.
+  bool ReadG(const char *fname);
+  // Save writes the tables to a field file, and Load reads one back,
+  // returning false (printing why) if it cannot.
+  bool Save(const char *fname) const;
+  bool Load(const char *fname);
+
+  long num_energies() const { return long(E.size()); }
+  int num_observables() const { return nobs; }
+  double energy(long i) const { return E[i]; }
+  double ln_dos(long i) const { return lnD[i]; }
+  // r_step is the width of the g(r) bins, and is zero if we have no
+  // g(r).  Observable k is g at r = (k + 1/2) r_step.
+  double r_step() const { return dr; }
+  int threads() const { return num_threads; }
+  // A num_threads of zero means one thread per core.
+  void set_threads(int num_threads);
+
+  // Thermodynamics finds the internal energy U, the heat capacity C_V
+  // (in units of k_B) and the entropy and free energy at each of the nT
+  // temperatures T.  Since we only know D(E) up to a constant factor,
+  // S is relative to its infinite temperature value, and F = U - T S
+  // with that same S.  Any of the outputs may be null.
+  void Thermodynamics(const double *T, long nT, double *U, double *CV,
+                      double *S, double *F) const;
+  // Observables puts the canonical average of observable k at T[j] in
+  // out[j*num_observables() + k].
+  void Observables(const double *T, long nT, double *out) const;
+
+private:
+  int nobs, num_threads;
+  double dr;
+  std::vector<double> E, lnD;
+  std::vector<double> A; // A[i*nobs + k] is observable k at energy E[i]
+  // weights sets w[i] = D(E[i]) exp(-E[i]/T) divided by the biggest of
+  // them, returning the log of that biggest one.
+  double weights(double T, double *w) const;
+  template<typename F> void for_each_temperature(long nT, const F &f) const;
+};
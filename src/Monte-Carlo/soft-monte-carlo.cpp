@@ -15,6 +15,7 @@ USING_PART_OF_NAMESPACE_EIGEN
 #include <string.h>
 
 #include "version-identifier.h"
+#include "Monte-Carlo/sphere-cells.h"
 
 double ran();
 Vector3d ran3();
@@ -61,6 +62,8 @@ const double sigma = R*pow(2,5.0/6.0);
 double sig_wall = R_T*pow(2,-1.0/6.0);
 
 bool periodic[3] = {false, false, false};
+SphereCells *cells = 0; // where overlap() looks for neighbors
+void make_cells(Vector3d *spheres, long N);
 inline double max(double a, double b) { return (a>b)? a : b; }
 
 int main(int argc, char *argv[]){
@@ -341,6 +344,7 @@ int main(int argc, char *argv[]){
     }
     fclose(out);
     fflush(stdout);
+    make_cells(spheres, N);
   } else {
     for(long i=0; i<N; i++) {
       spheres[i]=rad*ran3();
@@ -357,6 +361,7 @@ int main(int argc, char *argv[]){
     }
 
     for (int i=0;i<N;i++) spheres[i] = move(spheres[i], scale);
+    make_cells(spheres, N);
     {
       // First we'll run the simulation a while to get to a decent
       // starting point...
@@ -374,6 +379,7 @@ int main(int argc, char *argv[]){
             Vector3d temp = move(spheres[i],scale);
             if(!overlap(spheres, temp, N, R, i)){
               spheres[i]=temp;
+              cells->moved(i);
               successes_initializing++;
             }
             iters_initializing++;
@@ -657,6 +663,7 @@ int main(int argc, char *argv[]){
     count++;
     if(!overlap(spheres, temp, N, R, j%N)){
       spheres[j%N] = temp;
+      cells->moved(j%N);
       workingmoves++;
     }
     if (which_frame < N*num_frames) {
@@ -850,34 +857,27 @@ inline double soft_wall_potential(double z) {
   return 2*M_PI*rho*eps*((pow(z,3) - pow(R_T,3))/6 + 2*pow(sig_wall,12)*(1/pow(z,9)-1/pow(R_T,9))/45 + (R_T-z)*(R_T*R_T/2 + sig_wall*sig_wall*pow(sig_wall/R_T,4) - 2*sig_wall*sig_wall*pow(sig_wall/R_T,10)/5) + pow(sig_wall,6)*(1/pow(R_T,3)-1/pow(z,3))/3);
 }
 
+void make_cells(Vector3d *spheres, long N) {
+  SphereGeometry geometry;
+  geometry.R = R;
+  geometry.len[0] = lenx;
+  geometry.len[1] = leny;
+  geometry.len[2] = lenz;
+  geometry.wall[0] = has_x_wall;
+  geometry.wall[1] = has_y_wall;
+  geometry.wall[2] = has_z_wall;
+  for (int k=0; k<3; k++) geometry.periodic[k] = periodic[k];
+  if (spherical_outer_wall) geometry.outer_radius = rad;
+  if (spherical_inner_wall) geometry.inner_radius = innerRad;
+  cells = new SphereCells(geometry, spheres, N);
+}
+
+// The potential vanishes beyond 2R, so the only spheres that matter
+// are the ones cells finds near the old and new positions.
 bool overlap(Vector3d *spheres, Vector3d v, long n, double R, long s){
+  if (cells->geometry().outside(v)) return true;
   double energyNew = 0.0;
   double energyOld = 0.0;
-  if (spherical_outer_wall){
-    if (distance(v,Vector3d(0,0,0)) > rad) return true;
-  }
-  if (spherical_inner_wall) {
-    if (distance(v,Vector3d(0,0,0)) < innerRad) return true;
-  }
-  if (has_x_wall) {
-    if (v[0] > lenx/2 || v[0] < -lenx/2) return true;
-  }
-  if (has_y_wall) {
-    if (v[1] > leny/2 || v[1] < -leny/2) return true;
-  }
-  if (has_z_wall) {
-    if (v[2] > lenz/2 || v[2] < -lenz/2) return true;
-  }
-  bool amonborder[3] = {
-    fabs(v[0]) + 2*R >= lenx/2,
-    fabs(v[1]) + 2*R >= leny/2,
-    fabs(v[2]) + 2*R >= lenz/2
-  };
-  bool wasonborder[3] = {
-    fabs(spheres[s][0]) + 2*R >= lenx/2,
-    fabs(spheres[s][1]) + 2*R >= leny/2,
-    fabs(spheres[s][2]) + 2*R >= lenz/2
-  };
 
   // Energy before potential move
   if (testp){
@@ -885,94 +885,20 @@ bool overlap(Vector3d *spheres, Vector3d v, long n, double R, long s){
     energyOld += -(4*testp_eps*(pow(testp_sigma/r0,12) - pow(testp_sigma/r0,6)));
   }
   if (soft_wall) { energyOld += soft_wall_potential(spheres[s][2]); }
-  for(long i = 0; i < n; i++){
-    if (i != s) energyOld += potential(distance(spheres[i],spheres[s]));
-  }
-
-  for (long k=0; k<3; k++) {
-    if (periodic[k] && wasonborder[k]) {
-      for(long i = 0; i < n; i++) {
-        if (i != s) {
-          energyOld += potential(distance(spheres[s],spheres[i]+lat[k]));
-          energyOld += potential(distance(spheres[s],spheres[i]-lat[k]));
-        }
-      }
-      for (long m=k+1; m<3; m++){
-        if (periodic[m] && wasonborder[m]){
-          for(long i = 0; i < n; i++) {
-            if (i != s) {
-              energyOld += potential(distance(spheres[s],spheres[i]+lat[k]+lat[m]));
-              energyOld += potential(distance(spheres[s],spheres[i]-lat[k]-lat[m]));
-              energyOld += potential(distance(spheres[s],spheres[i]+lat[k]-lat[m]));
-              energyOld += potential(distance(spheres[s],spheres[i]-lat[k]+lat[m]));
-            }
-          }
-        }
-      }
-    }
-  }
-  if (periodic[0] && periodic[1] && periodic[2]
-      && wasonborder[0] && wasonborder[1] && wasonborder[2]){
-    for(long i = 0; i < n; i++) {
-      if (i != s) {
-        energyOld += potential(distance(spheres[s],spheres[i]+latx+laty+latz));
-        energyOld += potential(distance(spheres[s],spheres[i]+latx+laty-latz));
-        energyOld += potential(distance(spheres[s],spheres[i]+latx-laty+latz));
-        energyOld += potential(distance(spheres[s],spheres[i]-latx+laty+latz));
-        energyOld += potential(distance(spheres[s],spheres[i]-latx-laty+latz));
-        energyOld += potential(distance(spheres[s],spheres[i]-latx+laty-latz));
-        energyOld += potential(distance(spheres[s],spheres[i]+latx-laty-latz));
-        energyOld += potential(distance(spheres[s],spheres[i]-latx-laty-latz));
-      }
-    }
-  }
+  cells->for_each_near(spheres[s], s, [&energyOld](long, const Vector3d &r) {
+      energyOld += potential(r.norm());
+      return false;
+    });
   // Energy after potential move
   if (testp) {
     double r1 = spheres[s].norm();
     energyNew += -(4*testp_eps*(pow(testp_sigma/r1,12) - pow(testp_sigma/r1,6)));
   }
   if (soft_wall) { energyNew += soft_wall_potential(v[2]); }
-  for(long i = 0; i < n; i++) {
-    if (i != s) energyNew += potential(distance(spheres[i],v));
-  }
-
-  for (long k=0; k<3; k++) {
-    if (periodic[k] && amonborder[k]) {
-      for(long i = 0; i < n; i++) {
-        if (i != s) {
-          energyNew += potential(distance(v,spheres[i]+lat[k]));
-          energyNew += potential(distance(v,spheres[i]-lat[k]));
-        }
-      }
-      for (long m=k+1; m<3; m++){
-        if (periodic[m] && amonborder[m]){
-          for(long i = 0; i < n; i++) {
-            if (i != s) {
-              energyNew += potential(distance(v,spheres[i]+lat[k]+lat[m]));
-              energyNew += potential(distance(v,spheres[i]-lat[k]-lat[m]));
-              energyNew += potential(distance(v,spheres[i]+lat[k]-lat[m]));
-              energyNew += potential(distance(v,spheres[i]-lat[k]+lat[m]));
-            }
-          }
-        }
-      }
-    }
-  }
-  if (periodic[0] && periodic[1] && periodic[2]
-      && amonborder[0] && amonborder[1] && amonborder[2]){
-    for(long i = 0; i < n; i++) {
-      if (i != s) {
-        energyNew += potential(distance(v,spheres[i]+latx+laty+latz));
-        energyNew += potential(distance(v,spheres[i]+latx+laty-latz));
-        energyNew += potential(distance(v,spheres[i]+latx-laty+latz));
-        energyNew += potential(distance(v,spheres[i]-latx+laty+latz));
-        energyNew += potential(distance(v,spheres[i]-latx-laty+latz));
-        energyNew += potential(distance(v,spheres[i]-latx+laty-latz));
-        energyNew += potential(distance(v,spheres[i]+latx-laty-latz));
-        energyNew += potential(distance(v,spheres[i]-latx-laty-latz));
-      }
-    }
-  }
+  cells->for_each_near(v, s, [&energyNew](long, const Vector3d &r) {
+      energyNew += potential(r.norm());
+      return false;
+    });
   double probabilityOfChange = exp((energyNew-energyOld)/-kT);
   double doesItChange = ran();
   if (doesItChange <= probabilityOfChange) return false;
@@ -980,7 +906,6 @@ bool overlap(Vector3d *spheres, Vector3d v, long n, double R, long s){
   return false;
 }
 
-
 double potentialEnergy(Vector3d *spheres, long n, double R){
   double potEnergy = 0.0;
   if (testp){
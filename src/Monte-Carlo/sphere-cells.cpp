@@ -0,0 +1,89 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "Monte-Carlo/sphere-cells.h"
+
+SphereCells::SphereCells(const SphereGeometry &geometry, Vector3d *s, long n, double reach)
+  : g(geometry), spheres(s), N(n) {
+  // Two spheres we care about are at most 2R + reach apart, so if the
+  // cells are at least that wide we need only look in the neighboring
+  // ones.  In periodic directions that distance must also be no more
+  // than half the cell, so that only the nearest image can be close.
+  const double range = 2*g.R + reach;
+  long total = 1;
+  for (int k=0; k<3; k++) {
+    double extent = 0;
+    if (g.periodic[k] && g.len[k] < 2*range) {
+      printf("SphereCells: a periodic cell of length %g is too small for spheres of radius %g\n",
+             g.len[k], g.R);
+      exit(1);
+    }
+    if (g.periodic[k] || g.wall[k]) {
+      lo[k] = -g.len[k]/2;
+      extent = g.len[k];
+    } else if (g.outer_radius > 0) {
+      lo[k] = -g.outer_radius;
+      extent = 2*g.outer_radius;
+    } else {
+      lo[k] = 0; // an open direction gets just one cell
+    }
+    ncells[k] = long(extent/range);
+    if (ncells[k] < 1) ncells[k] = 1;
+    width[k] = extent/ncells[k];
+    total *= ncells[k];
+  }
+  cells.resize(total);
+  cell_of.resize(N);
+  slot_of.resize(N);
+  rebuild();
+}
+
+void SphereCells::rebuild() {
+  for (unsigned c=0; c<cells.size(); c++) cells[c].clear();
+  for (long i=0; i<N; i++) place(i);
+}
+
+// Spheres outside the cell (which can happen while a driver is still
+// settling them into it) go in the nearest cell, which still puts any
+// two spheres that touch in the same or neighboring cells.
+void SphereCells::cell_coords(const Vector3d &r, long c[3]) const {
+  for (int k=0; k<3; k++) {
+    c[k] = 0;
+    if (ncells[k] > 1) {
+      c[k] = long(floor((r[k] - lo[k])/width[k]));
+      if (c[k] < 0) c[k] = 0;
+      if (c[k] >= ncells[k]) c[k] = ncells[k] - 1;
+    }
+  }
+}
+
+void SphereCells::place(long i) {
+  long c[3];
+  cell_coords(spheres[i], c);
+  cell_of[i] = cell_index(c);
+  slot_of[i] = cells[cell_of[i]].size();
+  cells[cell_of[i]].push_back(i);
+}
+
+void SphereCells::unplace(long i) {
+  std::vector<long> &c = cells[cell_of[i]];
+  const long last = c.back();
+  c[slot_of[i]] = last;
+  slot_of[last] = slot_of[i];
+  c.pop_back();
+}
+
+void SphereCells::moved(long i) {
+  long c[3];
+  cell_coords(spheres[i], c);
+  if (cell_index(c) == cell_of[i]) return;
+  unplace(i);
+  place(i);
+}
+
+bool SphereCells::overlaps(const Vector3d &v, long s) const {
+  if (g.outside(v)) return true;
+  const double diameter2 = 4*g.R*g.R;
+  return for_each_near(v, s, [diameter2](long, const Vector3d &r) {
+      return r.squaredNorm() < diameter2;
+    });
+}
@@ -0,0 +1,136 @@
+// -*- mode: C++; -*-
+
+#pragma once
+
+#include <math.h>
+#include <vector>
+#include <Eigen/Core>
+USING_PART_OF_NAMESPACE_EIGEN
+
+// SphereGeometry describes the cell our hard-sphere drivers use.  Each
+// direction may be periodic with the cell running from -len/2 to
+// len/2, may have hard walls confining sphere centers to the same
+// range, or may be open.  On top of that there may be a spherical
+// outer wall confining the centers to |r| <= outer_radius, and a
+// spherical "solute" keeping them out of |r| < inner_radius.
+struct SphereGeometry {
+  SphereGeometry() : R(1), outer_radius(0), inner_radius(0) {
+    for (int k=0; k<3; k++) {
+      len[k] = 0;
+      periodic[k] = false;
+      wall[k] = false;
+    }
+  }
+  double R;
+  double len[3];
+  bool periodic[3], wall[3];
+  double outer_radius; // zero if there is no spherical outer wall
+  double inner_radius; // zero if there is no spherical inner wall
+
+  // outside is true if a sphere centered at v would be in a wall.
+  bool outside(const Vector3d &v) const {
+    for (int k=0; k<3; k++) {
+      if (wall[k] && (v[k] > len[k]/2 || v[k] < -len[k]/2)) return true;
+    }
+    if (outer_radius > 0 && v.squaredNorm() > outer_radius*outer_radius) return true;
+    if (inner_radius > 0 && v.squaredNorm() < inner_radius*inner_radius) return true;
+    return false;
+  }
+  // wrap moves r into the cell along the periodic directions.
+  Vector3d wrap(Vector3d r) const {
+    for (int k=0; k<3; k++) {
+      if (periodic[k]) {
+        while (r[k] > len[k]/2) r[k] -= len[k];
+        while (r[k] < -len[k]/2) r[k] += len[k];
+      }
+    }
+    return r;
+  }
+  // separation gives the vector from "from" to the nearest image of "to".
+  Vector3d separation(const Vector3d &from, const Vector3d &to) const {
+    Vector3d r = to - from;
+    for (int k=0; k<3; k++) {
+      if (periodic[k]) r[k] -= len[k]*floor(r[k]/len[k] + 0.5);
+    }
+    return r;
+  }
+};
+
+// SphereCells keeps a cell list of the spheres, so we can find the
+// spheres near a point by looking in just the 27 cells around it,
+// using the nearest image in periodic directions.  This makes an
+// overlap test take a time independent of the number of spheres.
+// The spheres belong to the caller, who must call moved(i) whenever
+// spheres[i] changes.
+class SphereCells {
+public:
+  // reach is how much further than 2R apart two spheres may be and
+  // still be found by for_each_near.
+  SphereCells(const SphereGeometry &g, Vector3d *spheres, long N, double reach = 0);
+
+  const SphereGeometry &geometry() const { return g; }
+  // overlaps is true if a sphere at v would be in a wall or would
+  // overlap any sphere other than sphere s (which may be -1).
+  bool overlaps(const Vector3d &v, long s) const;
+  // for_each_near calls f(j, r) for the spheres j other than s that
+  // could be within 2R + reach of v, where r is the separation from v
+  // to sphere j.  If f returns true we stop there, and return true.
+  template<typename F> bool for_each_near(const Vector3d &v, long s, const F &f) const;
+  void moved(long i);
+  // rebuild puts every sphere back in its cell, for when the caller
+  // has moved many of them.
+  void rebuild();
+
+private:
+  void cell_coords(const Vector3d &r, long c[3]) const;
+  long cell_index(const long c[3]) const {
+    return (c[0]*ncells[1] + c[1])*ncells[2] + c[2];
+  }
+  void place(long i);
+  void unplace(long i);
+
+  SphereGeometry g;
+  Vector3d *spheres;
+  long N;
+  double lo[3], width[3];
+  long ncells[3];
+  std::vector< std::vector<long> > cells;
+  std::vector<long> cell_of, slot_of;
+};
+
+template<typename F>
+bool SphereCells::for_each_near(const Vector3d &v, long s, const F &f) const {
+  long c[3];
+  cell_coords(v, c);
+  // With three or fewer cells in a direction we just look at all of
+  // them, so as not to look at any twice.
+  long nearby[3][3];
+  int num_nearby[3];
+  for (int k=0; k<3; k++) {
+    num_nearby[k] = 0;
+    if (ncells[k] <= 3) {
+      for (long m=0; m<ncells[k]; m++) nearby[k][num_nearby[k]++] = m;
+    } else {
+      for (long m=c[k]-1; m<=c[k]+1; m++) {
+        if (g.periodic[k]) {
+          nearby[k][num_nearby[k]++] = (m + ncells[k]) % ncells[k];
+        } else if (m >= 0 && m < ncells[k]) {
+          nearby[k][num_nearby[k]++] = m;
+        }
+      }
+    }
+  }
+  for (int a=0; a<num_nearby[0]; a++) {
+    for (int b=0; b<num_nearby[1]; b++) {
+      for (int e=0; e<num_nearby[2]; e++) {
+        const long here[3] = { nearby[0][a], nearby[1][b], nearby[2][e] };
+        const std::vector<long> &cell = cells[cell_index(here)];
+        for (unsigned n=0; n<cell.size(); n++) {
+          const long j = cell[n];
+          if (j != s && f(j, g.separation(v, spheres[j]))) return true;
+        }
+      }
+    }
+  }
+  return false;
+}
@@ -10,6 +10,7 @@
 #include "handymath.h"
 #include "vector3d.h"
 #include "Monte-Carlo/square-well.h"
+#include "Monte-Carlo/move-scheduler.h"
 
 #include "version-identifier.h"
 
@@ -101,6 +102,9 @@ int main(int argc, const char *argv[]) {
   int samc = false;
   int sad = false;
   int sad_fraction = 1;
+  int windows = 0;
+  double window_overlap = 0.5;
+  double event_chain = 0;
   int resume = false;
 
   char *transitions_input_filename = new char[1024];
@@ -165,8 +169,9 @@ int main(int argc, const char *argv[]) {
   double de_density = 0.1;
   double de_g = 0.05;
   double max_rdf_radius = 10;
-  // scale is not universally constant -- it is adjusted during initialization
-  //  so that we have a reasonable acceptance rate
+  // scale is not universally constant -- it may be adjusted during
+  //  initialization so that we have a reasonable acceptance rate
+  long tune_iterations = 0;
 
   poptContext optCon;
 
@@ -214,6 +219,9 @@ int main(int argc, const char *argv[]) {
      "relative to ball radius", "DOUBLE"},
     {"acceptance_goal", '\0', POPT_ARG_DOUBLE | POPT_ARGFLAG_SHOW_DEFAULT,
      &acceptance_goal, 0, "Goal to set the acceptance rate", "DOUBLE"},
+    {"tune_iterations", '\0', POPT_ARG_LONG | POPT_ARGFLAG_SHOW_DEFAULT,
+     &tune_iterations, 0, "Number of iterations to spend adjusting translation_scale "
+     "to reach the acceptance goal", "INT"},
 
     /*** PARAMETERS DETERMINING OUTPUT FILE DIRECTORY AND NAMES ***/
 
@@ -261,6 +269,13 @@ int main(int argc, const char *argv[]) {
      "Fraction for stochastic approximation monte carlo dynamical version", "INT"},
     {"vanilla_wang_landau", '\0', POPT_ARG_NONE, &vanilla_wang_landau, 0,
      "Use Wang-Landau histogram method with vanilla settings", "BOOLEAN"},
+    {"windows", '\0', POPT_ARG_INT, &windows, 0,
+     "Initialize SAMC, SAD, WL or WLTMMC in this many energy windows at once, "
+     "each on its own thread", "INT"},
+    {"window_overlap", '\0', POPT_ARG_DOUBLE | POPT_ARGFLAG_SHOW_DEFAULT, &window_overlap, 0,
+     "Fraction of each energy window shared with the next", "DOUBLE"},
+    {"event_chain", '\0', POPT_ARG_DOUBLE, &event_chain, 0,
+     "After initialization, move balls by event chains of this length", "DOUBLE"},
 
     {"transitions_input_filename", '\0', POPT_ARG_STRING | POPT_ARGFLAG_SHOW_DEFAULT,
      &transitions_input_filename, 0, "File from which to read in transition matrix, "
@@ -787,6 +802,32 @@ int main(int argc, const char *argv[]) {
     count_all_interactions(sw.balls, sw.N, sw.interaction_distance, sw.len,
                            sw.walls, sw.sticky_wall);
 
+  if (tune_iterations > 0) {
+    // We tune the translation scale before we have any weights, so it
+    // is hard-sphere overlaps that we are tuning the acceptance of.
+    // The scale is then frozen, since changing it later would break
+    // detailed balance.
+    MoveScheduler scheduler(acceptance_goal);
+    const int translation_move = scheduler.add("translation", sw.translation_scale,
+                                               min(min(sw.len[x], sw.len[y]), sw.len[z])/2);
+    for (long i = 0; i < tune_iterations; i++) {
+      sw.translation_scale = scheduler.step(translation_move);
+      const long total = sw.moves.total, working = sw.moves.working;
+      const clock_t start = clock();
+      for (int j = 0; j < sw.N; j++) sw.move_a_ball();
+      scheduler.record(translation_move, sw.moves.total - total, sw.moves.working - working,
+                       (clock() - start)/double(CLOCKS_PER_SEC));
+    }
+    scheduler.freeze();
+    sw.translation_scale = scheduler.step(translation_move);
+    scheduler.print(stdout, "Tuned ");
+    // The moves we made while tuning are not data.
+    for (int i = 0; i < sw.energy_levels*(2*sw.biggest_energy_transition+1); i++) {
+      sw.collection_matrix[i] = 0;
+    }
+    took("Tuning");
+  }
+
   sw.reset_histograms();
   sw.iteration = 0;
 
@@ -865,8 +906,33 @@ int main(int argc, const char *argv[]) {
     delete[] buffer;
   }
 
+  if (windows > 0 && !(wang_landau || vanilla_wang_landau || wltmmc || samc || sad)) {
+    printf("Energy windows only work with SAMC, SAD, WL or WLTMMC.\n");
+    return 1;
+  }
+  if (window_overlap < 0 || window_overlap >= 1) {
+    printf("The window overlap must be at least 0 and less than 1.\n");
+    return 1;
+  }
+
+  if (event_chain > 0 && (tmmc || sw.walls || sw.sticky_wall)) {
+    printf("Event chains do not work with TMMC, walls or a sticky wall.\n");
+    return 1;
+  }
+
   if (reading_in_transition_matrix){
     sw.initialize_transitions_file(transitions_input_filename);
+  } else if (windows > 0) {
+    if (wang_landau || vanilla_wang_landau) {
+      sw.wl_factor = wl_factor;
+      sw.use_wl = true;
+    } else if (wltmmc) {
+      sw.use_wltmmc = true;
+      sw.wl_factor = wl_factor;
+    } else if (sad) {
+      sw.use_sad = sad_fraction;
+    }
+    sw.initialize_windows(windows, window_overlap, wl_fmod, wl_threshold, wl_cutoff);
   } else if (fix_kT) {
     sw.initialize_canonical(fix_kT);
   } else if (wang_landau || vanilla_wang_landau) {
@@ -995,6 +1061,10 @@ int main(int argc, const char *argv[]) {
     }
   }
 
+  if (event_chain > 0) {
+    sprintf(headerinfo, "%s# event_chain: %g\n", headerinfo, event_chain);
+  }
+
   // ----------------------------------------------------------------------------
   // Print initialization info
   // ----------------------------------------------------------------------------
@@ -1040,7 +1110,11 @@ int main(int argc, const char *argv[]) {
   while (sw.iteration <= simulation_iterations
          || sw.pessimistic_samples[sw.min_important_energy] < simulation_round_trips) {
 
-    for(int i = 0; i < sw.N; i++) sw.move_a_ball();
+    if (event_chain > 0) {
+      for(int i = 0; i < sw.N; i++) sw.event_chain(event_chain);
+    } else {
+      for(int i = 0; i < sw.N; i++) sw.move_a_ball();
+    }
 
     if (sw.iteration % (sw.N*sw.N) == 0) {
       assert(sw.energy ==
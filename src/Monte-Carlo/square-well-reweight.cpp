@@ -0,0 +1,131 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <popt.h>
+#include <vector>
+#include "FieldFile.h"
+#include "Monte-Carlo/reweighting.h"
+
+// square-well-reweight reads the density of states (from an -lndos.dat
+// movie frame, or from the -E.dat and -lnw.dat files), and optionally
+// the energy resolved g(r), written by square-well-monte-carlo, and prints
+// U, C_V, S and F, and g(r), on a grid of temperatures.  This does the
+// same job as the t_u_cv_s of readandcompute.py, but quickly enough for
+// thousands of temperatures, and it can save what it read as a field
+// file for later runs to load.
+
+static FILE *open_output(const char *fname) {
+  if (!fname) return stdout;
+  FILE *f = fopen(fname, "w");
+  if (!f) {
+    printf("Unable to create file %s!\n", fname);
+    exit(1);
+  }
+  return f;
+}
+
+int main(int argc, const char *argv[]) {
+  char *dos_fname = 0, *E_fname = 0, *lnw_fname = 0, *g_fname = 0;
+  char *load_fname = 0, *save_fname = 0, *out_fname = 0, *g_out_fname = 0;
+  double min_T = 0, max_T = 1.4;
+  int num_T = 1000, threads = 0;
+
+  poptContext optCon;
+  struct poptOption optionsTable[] = {
+    {"dos", '\0', POPT_ARG_STRING, &dos_fname, 0,
+     "Read the density of states from this -lndos.dat file (in the -movie directory)",
+     "FILE"},
+    {"E", '\0', POPT_ARG_STRING, &E_fname, 0,
+     "Find the density of states from this -E.dat file (and --lnw)", "FILE"},
+    {"lnw", '\0', POPT_ARG_STRING, &lnw_fname, 0,
+     "The -lnw.dat file to go with --E", "FILE"},
+    {"g", '\0', POPT_ARG_STRING, &g_fname, 0,
+     "Reweight the g(r) in this -g.dat file", "FILE"},
+    {"load", '\0', POPT_ARG_STRING, &load_fname, 0,
+     "Load everything from a field file made with --save", "FILE"},
+    {"save", '\0', POPT_ARG_STRING, &save_fname, 0,
+     "Save what we read as a field file", "FILE"},
+    {"min_T", '\0', POPT_ARG_DOUBLE, &min_T, 0,
+     "Lowest temperature (default max_T/num_T)", "DOUBLE"},
+    {"max_T", '\0', POPT_ARG_DOUBLE | POPT_ARGFLAG_SHOW_DEFAULT, &max_T, 0,
+     "Highest temperature", "DOUBLE"},
+    {"num_T", '\0', POPT_ARG_INT | POPT_ARGFLAG_SHOW_DEFAULT, &num_T, 0,
+     "Number of temperatures", "INT"},
+    {"threads", '\0', POPT_ARG_INT, &threads, 0,
+     "Number of threads (default one per core)", "INT"},
+    {"out", '\0', POPT_ARG_STRING, &out_fname, 0,
+     "Write T, U, C_V, S and F here (default standard output)", "FILE"},
+    {"g_out", '\0', POPT_ARG_STRING, &g_out_fname, 0,
+     "Write g(r) at each temperature here", "FILE"},
+    POPT_AUTOHELP
+    POPT_TABLEEND
+  };
+  optCon = poptGetContext(NULL, argc, argv, optionsTable, 0);
+  poptSetOtherOptionHelp(optCon, "[OPTION...]\nRequired arguments: one of --dos, "
+                         "--E with --lnw, or --load.");
+  int c = 0;
+  while ((c = poptGetNextOpt(optCon)) >= 0);
+  if (c < -1) {
+    fprintf(stderr, "\n%s: %s\n", poptBadOption(optCon, 0), poptStrerror(c));
+    return 1;
+  }
+  poptFreeContext(optCon);
+
+  if (bool(dos_fname) + bool(E_fname) + bool(load_fname) != 1 || bool(E_fname) != bool(lnw_fname)) {
+    printf("Give exactly one of --dos, --E with --lnw, or --load.\n");
+    return 1;
+  }
+  if (num_T < 1 || max_T <= 0 || min_T < 0 || min_T > max_T) {
+    printf("We need 0 < min_T <= max_T and num_T >= 1.\n");
+    return 1;
+  }
+  if (min_T == 0) min_T = max_T/num_T;
+
+  Reweighting rw;
+  rw.set_threads(threads);
+  if (load_fname) {
+    if (!rw.Load(load_fname)) return 1;
+  } else if (dos_fname) {
+    if (!rw.ReadDos(dos_fname)) return 1;
+  } else if (!rw.ReadHistogram(E_fname, lnw_fname)) {
+    return 1;
+  }
+  if (g_fname && !rw.ReadG(g_fname)) return 1;
+  if (save_fname && !rw.Save(save_fname)) return 1;
+  if (g_out_fname && rw.num_observables() == 0) {
+    printf("We have no g(r) to write to %s!\n", g_out_fname);
+    return 1;
+  }
+
+  std::vector<double> T(num_T);
+  for (int j=0; j<num_T; j++) {
+    T[j] = (num_T > 1) ? min_T + (max_T - min_T)*j/(num_T - 1) : max_T;
+  }
+  std::vector<double> U(num_T), CV(num_T), S(num_T), F(num_T);
+  rw.Thermodynamics(&T[0], num_T, &U[0], &CV[0], &S[0], &F[0]);
+  FILE *out = open_output(out_fname);
+  fprintf(out, "# energies: %ld\n", rw.num_energies());
+  fprintf(out, "# S and F are relative to the entropy at infinite temperature\n");
+  fprintf(out, "# T\tU\tCV\tS\tF\n");
+  for (int j=0; j<num_T; j++) {
+    fprintf(out, "%.10g\t%.10g\t%.10g\t%.10g\t%.10g\n", T[j], U[j], CV[j], S[j], F[j]);
+  }
+  if (out != stdout) fclose(out);
+
+  if (g_out_fname) {
+    const int bins = rw.num_observables();
+    std::vector<double> g(long(num_T)*bins);
+    rw.Observables(&T[0], num_T, &g[0]);
+    FILE *g_out = open_output(g_out_fname);
+    // Like the -g.dat files, the first row holds the radii.
+    fprintf(g_out, "# T g(r=%g) g(r=%g) etc\n0\t", 0.5*rw.r_step(), 1.5*rw.r_step());
+    for (int b=0; b<bins; b++) fprintf(g_out, "%g ", (b + 0.5)*rw.r_step());
+    fprintf(g_out, "\n");
+    for (int j=0; j<num_T; j++) {
+      fprintf(g_out, "%.10g\t", T[j]);
+      for (int b=0; b<bins; b++) fprintf(g_out, "%g ", g[long(j)*bins + b]);
+      fprintf(g_out, "\n");
+    }
+    fclose(g_out);
+  }
+  return 0;
+}
@@ -3,6 +3,10 @@
 #include "Monte-Carlo/square-well.h"
 #include "handymath.h"
 #include <sys/stat.h> // for seeing if the movie data file already exists.
+#include <algorithm>
+#include <functional>
+#include <thread>
+#include <vector>
 
 #include "version-identifier.h"
 
@@ -262,7 +266,7 @@ void sw_simulation::reset_histograms(){
 }
 
 void sw_simulation::move_a_ball() {
-  int id = moves.total % N;
+  int id = ball_to_move();
   moves.total++;
   const int old_interaction_count =
     count_interactions(id, balls, interaction_distance, len, walls, sticky_wall);
@@ -314,11 +318,12 @@ void sw_simulation::move_a_ball() {
   const int energy_change = new_interaction_count - old_interaction_count;
   transitions(energy, energy_change) += 1; // update the transition histogram
   double Pmove = 1;
-  if ((use_wl||use_wltmmc)
+  if ((use_wl||use_wltmmc||confined)
       && (energy + energy_change > min_important_energy
           || energy+energy_change<max_entropy_state)) {
-      // This means we are using a WL method, and the system is trying
-      // to leave the energy range specified.  We cannot permit this!
+      // This means we are using a WL method (or are one window of
+      // several), and the system is trying to leave the energy range
+      // specified.  We cannot permit this!
       Pmove = 0;
   } else if (use_tmmc) {
     /* I note that Swendson 1999 uses essentially this method
@@ -388,6 +393,133 @@ void sw_simulation::move_a_ball() {
   end_move_updates();
 }
 
+// ln_weight is the log of the weight that move_a_ball gives to energy
+// e, or -HUGE_VAL where it will not go.
+static double ln_weight(const sw_simulation &sw, int e) {
+  if (e < 0 || e >= sw.energy_levels) return -HUGE_VAL;
+  if ((sw.use_wl || sw.use_wltmmc || sw.confined)
+      && (e > sw.min_important_energy || e < sw.max_entropy_state)) {
+    return -HUGE_VAL;
+  }
+  if (sw.use_sad && sw.too_high_energy >= 0) {
+    if (e < sw.too_high_energy) return sw.ln_energy_weights[sw.too_high_energy];
+    if (e > sw.too_low_energy) {
+      return sw.ln_energy_weights[sw.too_low_energy] + (e - sw.too_low_energy)/sw.min_T;
+    }
+  }
+  return sw.ln_energy_weights[e];
+}
+
+// refresh_neighbors recenters the neighbor table of ball id on where
+// it is now, as move_a_ball does when a ball has moved too far.
+static void refresh_neighbors(sw_simulation &sw, int id) {
+  ball temp = sw.balls[id];
+  temp.neighbors = new int[sw.max_neighbors];
+  update_neighbors(temp, id, sw.balls, sw.N, sw.neighbor_R, sw.len, sw.walls,
+                   sw.max_neighbors);
+  temp.neighbor_center = temp.pos;
+  inform_neighbors(temp, sw.balls[id], sw.balls, id, sw.max_neighbors);
+  delete[] sw.balls[id].neighbors;
+  sw.balls[id] = temp;
+  sw.moves.updates++;
+  sw.moves.informs++;
+}
+
+struct chain_event {
+  double distance; // how far the ball goes before this happens
+  int partner;
+  int energy_change; // zero if the balls touch
+  bool operator<(const chain_event &b) const { return distance < b.distance; }
+};
+
+void sw_simulation::event_chain(double length) {
+  assert(!walls && !sticky_wall && !use_tmmc);
+  moves.total++;
+  const int old_energy = energy;
+  int id = random::ran64() % N;
+  vector3d direction;
+  direction[random::ran64() % 3] = 1;
+  // A ball stopped by an event is left this far short of it, so that
+  // roundoff cannot put it on the far side of the edge.
+  const double gap = 1e-10*interaction_distance;
+  std::vector<chain_event> events;
+  while (length > 0) {
+    ball &a = balls[id];
+    // We may only go as far as the neighbor tables are good for,
+    // which is neighbor_R/2 from the center of our table.
+    const vector3d c = periodic_diff(a.neighbor_center, a.pos, len, walls);
+    const double cd = c.dot(direction);
+    double step = -cd + sqrt(max(0.0, cd*cd - c.normsquared() + sqr(neighbor_R/2)));
+    const bool leaving_table = step < length;
+    if (!leaving_table) step = length;
+
+    // We look for where we would touch a neighbor, or cross the edge
+    // of its well, moving along the direction.
+    events.clear();
+    for (int n = 0; n < a.num_neighbors; n++) {
+      const int k = a.neighbors[n];
+      const vector3d r = periodic_diff(a.pos, balls[k].pos, len, walls);
+      const double b = r.dot(direction), r2 = r.normsquared();
+      const double core = b*b - r2 + sqr(a.R + balls[k].R);
+      if (b > 0 && core >= 0 && b - sqrt(core) < step) {
+        const chain_event touch = { max(0.0, b - sqrt(core)), k, 0 };
+        events.push_back(touch);
+      }
+      const double well = b*b - r2 + sqr(interaction_distance);
+      if (well > 0) {
+        const double in = b - sqrt(well), out = b + sqrt(well);
+        if (r2 > sqr(interaction_distance) && in > 0 && in < step) {
+          const chain_event enter = { in, k, 1 };
+          events.push_back(enter);
+        }
+        if (out > 0 && out < step) {
+          const chain_event leave = { out, k, -1 };
+          events.push_back(leave);
+        }
+      }
+    }
+    std::sort(events.begin(), events.end());
+
+    // Each step in energy is accepted with the Metropolis probability
+    // of our weights.  If it is refused (or if we touch a ball), the
+    // ball we were heading for carries on the chain.  Since only that
+    // one pair changes there, this is the same lifting as for a pair
+    // potential, and the chain leaves the weighted ensemble unchanged.
+    int e = energy;
+    double distance = step;
+    int next = -1;
+    for (unsigned n = 0; n < events.size(); n++) {
+      const chain_event &ev = events[n];
+      if (ev.energy_change) {
+        const double lnP = ln_weight(*this, e + ev.energy_change) - ln_weight(*this, e);
+        if (lnP >= 0 || random::ran() < exp(lnP)) {
+          e += ev.energy_change;
+          continue;
+        }
+      }
+      distance = max(0.0, ev.distance - gap);
+      next = ev.partner;
+      break;
+    }
+    // We recount rather than trusting e, so that our energy always
+    // agrees with count_all_interactions.
+    const int old_interactions =
+      count_interactions(id, balls, interaction_distance, len, walls, sticky_wall);
+    a.pos = sw_fix_periodic(a.pos + distance*direction, len);
+    energy += count_interactions(id, balls, interaction_distance, len, walls, sticky_wall)
+      - old_interactions;
+    length -= distance;
+    if (next >= 0) {
+      id = next;
+    } else if (leaving_table) {
+      refresh_neighbors(*this, id);
+    }
+  }
+  moves.working++;
+  if (energy != old_energy) energy_change_updates(energy - old_energy);
+  end_move_updates();
+}
+
 void sw_simulation::end_move_updates(){
    // update iteration counter, energy histogram, and walker counters
   if (moves.total % N == 0) iteration++;
@@ -969,6 +1101,292 @@ void sw_simulation::initialize_samc(int am_sad) {
   initialize_canonical(min_T,min_important_energy);
 }
 
+// window_visited says whether a window's walker ever tried a move from
+// energy i.  WL-TMMC zeroes its histogram, so we go by its transitions.
+static bool window_visited(const sw_simulation &w, int i) {
+  for (int de=-w.biggest_energy_transition; de<=w.biggest_energy_transition; de++) {
+    if (w.transitions(i, de)) return true;
+  }
+  return false;
+}
+
+// run_window runs a single window's walker until it is done, with no
+// output besides that of the methods themselves, since
+// printing_allowed and the transitions files are not ours to share.
+static void run_window(sw_simulation &w, uint64_t seed, double wl_fmod,
+                       double wl_threshold, double wl_cutoff) {
+  random::seed_thread(seed);
+  if (w.use_wl) {
+    // This is initialize_wang_landau with a fixed energy range.
+    const int width = w.min_important_energy - w.max_entropy_state + 1;
+    while (w.wl_factor >= wl_cutoff && !w.reached_iteration_cap()) {
+      for (int i = 0; i < w.N*width && !w.reached_iteration_cap(); i++) w.move_a_ball();
+      long lowest_hist = w.energy_histogram[w.max_entropy_state], total_counts = 0;
+      for (int i = w.max_entropy_state; i <= w.min_important_energy; i++) {
+        total_counts += w.energy_histogram[i];
+        lowest_hist = min(lowest_hist, w.energy_histogram[i]);
+      }
+      if (lowest_hist >= wl_threshold*total_counts/double(width)) {
+        w.wl_factor /= wl_fmod;
+        w.flush_weight_array();
+        for (int i = 0; i < w.energy_levels; i++) {
+          if (w.energy_histogram[i] > 0) w.energy_histogram[i] = 1;
+        }
+      }
+    }
+    return;
+  }
+  int check_how_often = w.use_wltmmc ? w.N : w.N*w.N;
+  do {
+    for (int i = 0; i < check_how_often && !w.reached_iteration_cap(); i++) w.move_a_ball();
+    check_how_often += w.use_wltmmc ? w.N : w.N*w.N;
+    if (w.use_wltmmc) w.calculate_weights_using_wltmmc(wl_fmod, wl_threshold, wl_cutoff, false);
+  } while (!w.finished_initializing(false));
+}
+
+void sw_simulation::window_range(int k, int num_windows, double window_overlap,
+                                 int *first, int *last) const {
+  const int range = min_important_energy - max_entropy_state;
+  const double width = range/((num_windows - 1)*(1 - window_overlap) + 1);
+  *first = max_entropy_state + int(round(k*width*(1 - window_overlap)));
+  *last = (k == num_windows-1) ? min_important_energy : int(ceil(*first + width));
+  // Neighboring windows must share at least one energy.
+  const int next_first = max_entropy_state + int(round((k+1)*width*(1 - window_overlap)));
+  if (k < num_windows-1 && *last <= next_first) *last = next_first + 1;
+}
+
+void sw_simulation::initialize_windows(int num_windows, double window_overlap,
+                                       double wl_fmod, double wl_threshold,
+                                       double wl_cutoff) {
+  assert(use_wl || use_wltmmc || sa_t0 || use_sad);
+  assert(window_overlap >= 0 && window_overlap < 1);
+  if (end_condition == flat_histogram) {
+    printf("Energy windows cannot use a flat histogram end condition!\n");
+    exit(1);
+  }
+  // max_time is checked against clock(), which counts the CPU time of
+  // every thread, so with the windows running at once it would run out
+  // num_windows times too soon.
+  if (max_time > 0) {
+    printf("Energy windows cannot use a maximum time!\n");
+    exit(1);
+  }
+  const int matrix_size = energy_levels*(2*biggest_energy_transition+1);
+
+  // We let our walker cool down to min_T with canonical weights, to
+  // find the energy range (if we need to) and to pick up a
+  // configuration at each energy we pass through, from which to start
+  // the walkers of the windows.  None of our method's updates are
+  // made while cooling.
+  const double original_wl_factor = wl_factor, original_sa_t0 = sa_t0;
+  const int original_use_sad = use_sad;
+  const bool original_use_wl = use_wl, original_use_wltmmc = use_wltmmc;
+  wl_factor = sa_t0 = 0;
+  use_sad = 0;
+  use_wl = use_wltmmc = false;
+  for (int i = 0; i < energy_levels; i++) ln_energy_weights[i] = i/min_T;
+  std::vector< std::vector<vector3d> > snapshots(energy_levels);
+  const long start = moves.total;
+  long deepest_found = 0; // moves since start when we reached the deepest energy
+  int deepest = energy;
+  while (true) {
+    if (snapshots[energy].empty()) {
+      for (int i = 0; i < N; i++) snapshots[energy].push_back(balls[i].pos);
+    }
+    const long t = moves.total - start;
+    if (energy > deepest) {
+      deepest = energy;
+      deepest_found = t;
+    }
+    // We stop once we have gone as long without a new lowest energy as
+    // it took us to find the one we have.
+    if (t - deepest_found > max(deepest_found, long(N)*N)) break;
+    if (end_condition == init_iter_limit && iteration >= init_iters/2) break;
+    move_a_ball();
+  }
+  if (!min_important_energy) set_min_important_energy();
+  if (!max_entropy_state) set_max_entropy_energy();
+  printf("Cooling to find the energy range took %ld moves, reaching %d.\n",
+         moves.total - start, deepest);
+  wl_factor = original_wl_factor;
+  sa_t0 = original_sa_t0;
+  use_sad = original_use_sad;
+  use_wl = original_use_wl;
+  use_wltmmc = original_use_wltmmc;
+  for (int i = 0; i < energy_levels; i++) ln_energy_weights[i] = 0;
+  const long cooling_iterations = iteration;
+  reset_histograms();
+
+  const int range = min_important_energy - max_entropy_state;
+  if (range < 1) {
+    printf("There is no energy range %d -> %d to split into windows!\n",
+           max_entropy_state, min_important_energy);
+    exit(1);
+  }
+  if (range < 2*num_windows) {
+    num_windows = max(1, range/2);
+    printf("The energy range %d -> %d only has room for %d windows.\n",
+           max_entropy_state, min_important_energy, num_windows);
+  }
+  std::vector<sw_simulation> windows(num_windows, *this);
+  std::vector<uint64_t> seeds(num_windows);
+  for (int k = 0; k < num_windows; k++) {
+    sw_simulation &w = windows[k];
+    int first, last;
+    window_range(k, num_windows, window_overlap, &first, &last);
+    // We start from the configuration we saw closest to the middle of
+    // the window, widening the window if we saw none within it.
+    int start_energy = -1;
+    for (int i = 0; i < energy_levels; i++) {
+      if (!snapshots[i].empty()
+          && (start_energy < 0 || abs(2*i - first - last) < abs(2*start_energy - first - last))) {
+        start_energy = i;
+      }
+    }
+    first = min(first, start_energy);
+    last = max(last, start_energy);
+
+    w.balls = new ball[N];
+    for (int i = 0; i < N; i++) {
+      w.balls[i].R = balls[i].R;
+      w.balls[i].pos = snapshots[start_energy][i];
+    }
+    if (initialize_neighbor_tables(w.balls, N, neighbor_R, max_neighbors, len, walls) < 0) {
+      printf("The guess of %i max neighbors was too low for a window.\n", max_neighbors);
+      exit(1);
+    }
+    w.energy = count_all_interactions(w.balls, N, interaction_distance, len, walls, sticky_wall);
+    w.energy_histogram = new long[energy_levels]();
+    w.ln_energy_weights = new double[energy_levels]();
+    w.optimistic_samples = new long[energy_levels]();
+    w.pessimistic_samples = new long[energy_levels]();
+    w.pessimistic_observation = new bool[energy_levels]();
+    w.collection_matrix = new long[matrix_size]();
+    w.transitions_filename = 0;
+    w.transitions_movie_filename_format = 0;
+    w.dos_movie_filename_format = 0;
+    w.lnw_movie_filename_format = 0;
+    w.iteration = 0;
+    w.moves = move_info();
+    w.max_entropy_state = first;
+    w.min_important_energy = last;
+    w.confined = true;
+    if (end_condition == init_iter_limit) {
+      w.init_iters = max(1L, (init_iters - cooling_iterations)/num_windows);
+    }
+    seeds[k] = random::ran64();
+    printf("Window %d covers %d -> %d, starting at %d.\n", k, first, last, w.energy);
+  }
+  fflush(stdout);
+
+  std::vector<std::thread> threads;
+  for (int k = 0; k < num_windows; k++) {
+    threads.push_back(std::thread(run_window, std::ref(windows[k]), seeds[k],
+                                  wl_fmod, wl_threshold, wl_cutoff));
+  }
+  for (int k = 0; k < num_windows; k++) threads[k].join();
+
+  // The transitions each window counted do not depend on its weights,
+  // so together they give the density of states over the whole range,
+  // which we use to put the windows' own estimates on a common footing.
+  // The windows' round trips stand in for our pessimistic samples.
+  for (int k = 0; k < num_windows; k++) {
+    const sw_simulation &w = windows[k];
+    for (int i = 0; i < matrix_size; i++) collection_matrix[i] += w.collection_matrix[i];
+    for (int i = 0; i < energy_levels; i++) {
+      energy_histogram[i] += w.energy_histogram[i];
+      optimistic_samples[i] += w.optimistic_samples[i];
+      pessimistic_samples[i] += w.pessimistic_samples[i];
+    }
+    iteration += w.iteration;
+    moves.total += w.moves.total;
+    moves.working += w.moves.working;
+  }
+  if (use_wltmmc) {
+    // WL-TMMC refreshes its weights from the transitions whenever WL
+    // says to, so we do the same with all the windows' transitions.
+    update_weights_using_transitions(1, true);
+  } else {
+    double *ln_dos = compute_ln_dos(transition_dos);
+    std::vector<double> ln_dos_sum(energy_levels, 0.0);
+    std::vector<int> estimates(energy_levels, 0);
+    for (int k = 0; k < num_windows; k++) {
+      const sw_simulation &w = windows[k];
+      int first = w.max_entropy_state, last = w.min_important_energy;
+      if (w.use_sad && w.too_high_energy >= 0) {
+        // SAD only flattens between the energies it found most often.
+        first = max(first, w.too_high_energy);
+        last = min(last, w.too_low_energy);
+      }
+      double offset = 0;
+      int num = 0;
+      for (int i = first; i <= last; i++) {
+        if (window_visited(w, i)) {
+          offset += ln_dos[i] + w.ln_energy_weights[i];
+          num++;
+        }
+      }
+      if (num) offset /= num;
+      for (int i = first; i <= last; i++) {
+        if (window_visited(w, i)) {
+          ln_dos_sum[i] += offset - w.ln_energy_weights[i];
+          estimates[i]++;
+        }
+      }
+    }
+    for (int i = max_entropy_state; i <= min_important_energy; i++) {
+      if (estimates[i]) ln_dos[i] = ln_dos_sum[i]/estimates[i];
+      ln_energy_weights[i] = ln_dos[max_entropy_state] - ln_dos[i];
+    }
+    for (int i = 0; i < max_entropy_state; i++) ln_energy_weights[i] = 0;
+    delete[] ln_dos;
+  }
+
+  // Finally we pick up each method's own state where the windows left
+  // off.
+  if (use_wl || use_wltmmc) {
+    bool all_tmmc = true;
+    wl_factor = 0;
+    for (int k = 0; k < num_windows; k++) {
+      wl_factor = max(wl_factor, windows[k].wl_factor);
+      if (!windows[k].use_tmmc) all_tmmc = false;
+    }
+    if (use_wltmmc && all_tmmc) use_tmmc = true;
+  }
+  if (use_sad) {
+    too_high_energy = too_low_energy = -1;
+    for (int k = 0; k < num_windows; k++) {
+      const sw_simulation &w = windows[k];
+      if (w.too_high_energy < 0) continue;
+      if (too_high_energy < 0 || w.too_high_energy < too_high_energy) {
+        too_high_energy = w.too_high_energy;
+      }
+      too_low_energy = max(too_low_energy, w.too_low_energy);
+    }
+    highest_hist = 0;
+    num_sad_states = 0;
+    for (int i = 0; i < energy_levels; i++) {
+      highest_hist = max(highest_hist, energy_histogram[i]);
+      if (energy_histogram[i] && i >= too_high_energy && i <= too_low_energy) num_sad_states++;
+    }
+    time_L = moves.total;
+  }
+
+  for (int k = 0; k < num_windows; k++) {
+    sw_simulation &w = windows[k];
+    for (int i = 0; i < N; i++) delete[] w.balls[i].neighbors;
+    delete[] w.balls;
+    delete[] w.energy_histogram;
+    delete[] w.ln_energy_weights;
+    delete[] w.optimistic_samples;
+    delete[] w.pessimistic_samples;
+    delete[] w.pessimistic_observation;
+    delete[] w.collection_matrix;
+  }
+  write_transitions_file();
+  initialize_canonical(min_T,min_important_energy);
+}
+
 /* This method implements the optimized ensemble using the transition
    matrix information.  This should give a similar set of weights to
    the optimized_ensemble approach. */
@@ -116,6 +116,8 @@ struct sw_simulation {
                 // use.
   bool use_wl; // if true, we are using WL
   bool use_wltmmc; // if true, we are using WLTMMC
+  bool confined; // if true, reject moves leaving [max_entropy_state,
+                 // min_important_energy], as WL does (used by windows)
 
   /* The following define file names for periodic output files that
      are dumped every so often.  It should contain a single %d style format. */
@@ -175,6 +177,17 @@ struct sw_simulation {
 
   void reset_histograms();
   void move_a_ball(); // attempt to move one ball
+  int ball_to_move() const { // the ball that the next move_a_ball will try to move
+    return moves.total % N;
+  };
+  // event_chain moves balls by one straight event chain of the given
+  // total displacement, along x, y or z, in place of a move_a_ball.
+  // A ball slides until it touches another ball, or until the weights
+  // refuse a step into or out of another ball's well, and then that
+  // other ball carries on.  The chain counts as one (working) move,
+  // but is not added to the transition matrix, so it cannot be used
+  // with TMMC, walls or a sticky wall.
+  void event_chain(double length);
   void end_move_updates(); // updates to run at the end of every move
   void energy_change_updates(int energy_change); // updates to run if we've changed energy
 
@@ -197,6 +210,23 @@ struct sw_simulation {
                               double wl_threshold, double wl_cutoff,
                               bool fixed_energy_range);
 
+  // initialize_windows does the same job as initialize_samc,
+  // initialize_wang_landau or initialize_wltmmc (whichever our flags
+  // say we are doing), but splits [max_entropy_state,
+  // min_important_energy] into num_windows energy windows that overlap
+  // by a fraction window_overlap of their width.  Each window gets its
+  // own walker on its own thread, which is confined to the window, and
+  // the windows are then stitched together using the transitions they
+  // all counted.  If either end of the range is zero, we first find it
+  // by letting our walker cool to min_T.
+  void initialize_windows(int num_windows, double window_overlap, double wl_fmod,
+                          double wl_threshold, double wl_cutoff);
+  // window_range gives the energies [*first, *last] that window k of
+  // num_windows covers in initialize_windows, before it is widened (if
+  // need be) to take in its starting configuration.
+  void window_range(int k, int num_windows, double window_overlap,
+                    int *first, int *last) const;
+
   void initialize_tmi(int version=1);
   void initialize_toe(int version=1);
   void initialize_transitions();
@@ -284,6 +314,7 @@ struct sw_simulation {
     use_tmmc = false; // default to not using TMMC for accepting moves.
     use_wl = false; // default to not using WL.
     use_wltmmc = false; // default to not using WLTMMC.
+    confined = false;
     time_L = 1;
     highest_hist = 0;
     too_low_energy = -1;
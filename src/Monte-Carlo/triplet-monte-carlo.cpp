@@ -1,17 +1,19 @@
 #include <stdio.h>
 #include <time.h>
 #include "Monte-Carlo/monte-carlo.h"
+#include "Monte-Carlo/sphere-cells.h"
+#include "Monte-Carlo/event-chain.h"
 #include <cassert>
 #include <math.h>
 #include <stdlib.h>
 #include <string.h>
 #include <vector>
+#include <thread>
 #include "utilities.h"
 using std::vector;
 
 inline double countOverLaps(Vector3d *spheres, long n, double R);
 inline double countOneOverLap(Vector3d *spheres, long n, long j, double R);
-inline bool overlap(Vector3d *spheres, Vector3d v, long n, double R, long s);
 inline double distXY(Vector3d a, Vector3d b);
 inline double distXYZ(Vector3d a, Vector3d b);
 inline Vector3d periodicDiff(Vector3d a, Vector3d b);
@@ -54,6 +56,7 @@ double leny = 20;
 double lenz = 20;
 double rad = 10;  //of outer spherical walls
 double innerRad = 3;  //of inner spherical "solute"
+double event_chain_length = 0; // if nonzero, move spheres by event chains of this length
 
 Vector3d latx = Vector3d(lenx,0,0);
 Vector3d laty = Vector3d(0,leny,0);
@@ -66,12 +69,53 @@ const double dxmin = 0.1;
 inline double max(double a, double b) { return (a>b)? a : b; }
 inline double min(double a, double b) { return (a<b)? a : b; }
 
+// TripletBins holds the number of bins in each of the histograms,
+// which depend on the cell size and on whether we only want paths.
+struct TripletBins {
+  int zbins, xbins, z2bins;
+  int a1_zbins, a1_rbins;
+  int path_zbins, path_thetabins, path_xbins, path_bins;
+  int path2_zbins, path2_thetabins, path2_xbins, path2_bins;
+};
+
+// TripletHistograms holds the histograms that the triplet pass
+// accumulates.  Each thread has its own set, which we add into the
+// first set only when we are about to save data.
+struct TripletHistograms {
+  long *histogram, *da_dz_histogram, *path_histogram, *path2_histogram;
+};
+
+// A CellList sorts the spheres into boxes, so that we can find the
+// spheres near a point without looking at every one of them.
+struct CellList {
+  double lo[3], width[3];
+  int n[3];
+  vector<long> first; // spheres in cell c are members[first[c]] to members[first[c+1]-1]
+  vector<long> members;
+  void build(const Vector3d *spheres, long N, double cell_width);
+  int cell_of(double x, int dim) const;
+  // near appends to out every sphere in a cell that could be within
+  // radius of v (and some that are farther away).
+  void near(const Vector3d &v, double radius, vector<long> *out) const;
+};
+
+// accumulate_triplets adds to h the triplet histograms for each
+// sphere l = first_l, first_l + l_step, ... which makes it easy to
+// split the work between threads.
+static void accumulate_triplets(const Vector3d *spheres, long N, const CellList *cells,
+                                const TripletBins *b, long first_l, long l_step,
+                                TripletHistograms *h);
+static void accumulate_triplets_in_threads(const Vector3d *spheres, long N, const TripletBins &b,
+                                           vector<TripletHistograms> &h);
+static void merge_triplet_histograms(vector<TripletHistograms> &h, const TripletBins &b);
+
 int main(int argc, char *argv[]){
   if (argc < 5) {
     printf("usage:  %s Nspheres iterations*N uncertainty_goal filename a1_filename\n there will be more!\n", argv[0]);
     return 1;
   }
   double maxrad = 0;
+  int num_threads = 0; // zero means use every core
   for (int a=6; a<argc; a+=2){
     printf("Checking a = %d which is %s\n", a, argv[a]);
     if (strcmp(argv[a],"outerSphere") == 0) {
@@ -130,9 +174,14 @@ int main(int argc, char *argv[]){
     } else if (strcmp(argv[a],"path") == 0) {
       path = true;
       a -= 1;
+    } else if (strcmp(argv[a],"eventchain") == 0) {
+      event_chain_length = atof(argv[a+1]);
+      printf("Using event chains of length %g\n", event_chain_length);
     } else if (strcmp(argv[a],"flatdiv") == 0) {
       flat_div = true; //otherwise will default to radial divisions
       a -= 1;
+    } else if (strcmp(argv[a],"threads") == 0) {
+      num_threads = atoi(argv[a+1]);
     } else {
       printf("Bad argument:  %s\n", argv[a]);
       return 1;
@@ -181,6 +230,26 @@ int main(int argc, char *argv[]){
   long *path_histogram = new long[path_bins]();
   long *path2_histogram = new long[path2_bins]();
   long numinhistogram = 0;
+
+  // The first thread accumulates straight into the above histograms,
+  // while the others get their own, which we add in when we save.
+  if (num_threads <= 0) num_threads = std::thread::hardware_concurrency();
+  if (num_threads <= 0) num_threads = 1;
+  printf("Accumulating triplets in %d threads.\n", num_threads);
+  const TripletBins bins = { zbins, xbins, z2bins, a1_zbins, a1_rbins,
+                             path_zbins, path_thetabins, path_xbins, path_bins,
+                             path2_zbins, path2_thetabins, path2_xbins, path2_bins };
+  vector<TripletHistograms> thread_histograms(num_threads);
+  thread_histograms[0].histogram = histogram;
+  thread_histograms[0].da_dz_histogram = da_dz_histogram;
+  thread_histograms[0].path_histogram = path_histogram;
+  thread_histograms[0].path2_histogram = path2_histogram;
+  for (int t=1; t<num_threads; t++) {
+    thread_histograms[t].histogram = new long[zbins*xbins*z2bins]();
+    thread_histograms[t].da_dz_histogram = new long[a1_rbins*a1_zbins]();
+    thread_histograms[t].path_histogram = new long[path_bins]();
+    thread_histograms[t].path2_histogram = new long[path2_bins]();
+  }
   if (uncertainty_goal < 1e-12 || uncertainty_goal > 1.0) {
     printf("Crazy uncertainty goal:  %s\n", argv[1]);
     return 1;
@@ -316,6 +385,20 @@ int main(int argc, char *argv[]){
     scale = 0.1;
   }
   printf("Using scale of %g\n", scale);
+  SphereGeometry geometry;
+  geometry.R = R;
+  geometry.len[0] = lenx;
+  geometry.len[1] = leny;
+  geometry.len[2] = lenz;
+  geometry.wall[0] = has_x_wall;
+  geometry.wall[1] = has_y_wall;
+  geometry.wall[2] = has_z_wall;
+  for (int k=0; k<3; k++) geometry.periodic[k] = periodic[k];
+  if (spherical_outer_wall) geometry.outer_radius = rad;
+  if (spherical_inner_wall) geometry.inner_radius = innerRad;
+  SphereCells cells(geometry, spheres, N);
+  EventChain *event_chains = 0;
+  if (event_chain_length > 0) event_chains = new EventChain(geometry, spheres, N);
   long count = 0;
   long *shells = new long[div];
   for (long l=0; l<div; l++) shells[l] = 0;
@@ -359,6 +442,7 @@ int main(int argc, char *argv[]){
       start = now;
       if ((now - last_output > output_period) || j==(iterations-1)) {
         last_output = now;
+        merge_triplet_histograms(thread_histograms, bins);
         if (output_period < max_output_period/2) {
           output_period *= 2;
         } else if (output_period < max_output_period) {
@@ -634,87 +718,16 @@ int main(int argc, char *argv[]){
     // appropriate locations
     if (count%N == 0) {
       numinhistogram++;
-      for (int l=0; l<N; l++) {
-        for (int i=0; i<N; i++) {
-          if (i != l) {
-            const Vector3d r01 = periodicDiff(spheres[i], spheres[l]);
-            const double z1 = r01.norm();
-            int which_path = -1; // -1 if no path, 0 if touching path, 1 if path between
-            if (z1 > path_minrad && z1 < path_maxrad)
-              which_path = 0;
-            else if (z1 > 2*path_minrad && z1 < 2*path_maxrad)
-              which_path = 1;
-            if(!path || which_path > -1) {
-              const Vector3d zhat = r01.normalized();
-              const int z1_i = path ? which_path : int(z1/dz);
-              const int a1_z1_i = int(z1/a1_dz);
-              //printf("Sphere at %.1f %.1f %.1f\n", spheres[i][0], spheres[i][1], spheres[i][2]);
-              for (int k=0; k<N; k++) {
-                if (k != i && k != l) { // don't look at a sphere in relation to itself
-                  const Vector3d r02 = periodicDiff(spheres[k], spheres[l]);
-                  const double z2 = r02.dot(zhat);
-                  const int z2_i = floor(z2/dz);
-                  const double x2 = (r02 - z2*zhat).norm();
-                  const int x2_i = int(x2/dx);
-
-                  const Vector3d r12_v = periodicDiff(spheres[k], spheres[i]);
-                  const double r12 = r12_v.norm();
-                  const int a1_r12_i = path ? which_path : int((r12-2.0)/a1_dr);
-
-                  if (z1_i < zbins && x2_i < xbins && z2_i >= 0
-                      && z2_i < z2bins && r02.norm() < lenx/2.0)
-                    histogram[z1_i*xbins*z2bins + x2_i*z2bins + z2_i] ++;
-
-                  if (a1_r12_i < a1_rbins && a1_z1_i < a1_zbins)
-                    da_dz_histogram[a1_r12_i*a1_zbins + a1_z1_i] ++;
-
-                  const double z_cent = z1/2.0;
-                  const double theta = acos(r12_v.dot(zhat)/r12);
-                  const double xmin = path_radius/2.0*sqrt(3.0);
-                  if (which_path == 0 && z2 > z_cent) {
-                    if (z2 < lenx/2.0 && x2 < path_cyl_dr && z2 > z1 + path_minrad) {
-                      const int index = path_zbins - ceil((z2-z1-path_minrad)/path_width);
-                      if (index < 0 || index >= path_zbins)
-                        fprintf(stderr,"Index out of bounds: %i, z1: %.2f, z2: %.2f, x2: %.2f\n",index,z1,z2,x2);
-                      path_histogram[index] ++;
-                    } if (r12 > path_minrad && r12 < path_maxrad && theta < 2.0/3.0*M_PI) {
-                      const int index = path_zbins + theta/path_dtheta;
-                      if (index < path_zbins || index >= path_zbins + path_thetabins)
-                        fprintf(stderr,"Index out of bounds: %i, z1: %.2f, z2: %.2f, x2: %.2f\n",index,z1,z2,x2);
-                      path_histogram[index] ++;
-                    } if (z2-z_cent < path_width && x2 < lenx/2.0 && x2 > xmin) {
-                        const int index = path_zbins + path_thetabins + int((x2 - xmin)/path_width);
-                        if (index < path_zbins+path_thetabins || index >= path_bins)
-                          fprintf(stderr,"Index out of bounds: %i, z1: %.2f, z2: %.2f, x2: %.2f\n",index,z1,z2,x2);
-                      path_histogram[index] ++;
-                    }
-                  }
-                  else if (which_path == 1 && z2 > z_cent) {
-                    if (z2 < lenx/2.0 && x2 < path_cyl_dr && z2 > z1 + path_minrad) {
-                      const int index = path2_zbins - ceil((z2-z1-path_minrad)/path_width);
-                      if (index < 0 || index >= path_zbins)
-                        fprintf(stderr,"Index2 out of bounds: %i, z1: %.2f, z2: %.2f, x2: %.2f\n",index,z1,z2,x2);
-                      path2_histogram[index] ++;
-                    } if (r12 > path_minrad && r12 < path_maxrad) {
-                      const int index = path2_zbins + theta/path_dtheta;
-                      if (index < path2_zbins || index >= path2_zbins + path2_thetabins)
-                        fprintf(stderr,"Index2 out of bounds: %i, z1: %.2f, z2: %.2f, x2: %.2f\n",index,z1,z2,x2);
-                      path2_histogram[index] ++;
-                    } if (z2-z_cent <  path_width && x2 < lenx/2.0) {
-                      const int index = path2_zbins + path2_thetabins + int(x2/path_width);
-                      if (index < path2_zbins+path2_thetabins || index >= path2_bins)
-                        fprintf(stderr,"Index2 out of bounds: %i, z1: %.2f, z2: %.2f, x2: %.2f\n",index,z1,z2,x2);
-                      path2_histogram[index] ++;
-                    }
-                  }
-                }
-              }
-            }
-          }
-        }
-      }
+      accumulate_triplets_in_threads(spheres, N, bins, thread_histograms);
     }
-    if(overlap(spheres, temp, N, R, j%N)){
+    if (event_chains) {
+      // An event chain is never rejected, so every one counts as a
+      // working move.
+      event_chains->chain(event_chain_length);
+      workingmoves++;
+      continue;
+    }
+    if(cells.overlaps(temp, j%N)){
       if (scale > 0.001 && false) {
         scale = scale/sqrt(1.02);
         //printf("Reducing scale to %g\n", scale);
@@ -727,6 +740,7 @@ int main(int argc, char *argv[]){
     }
     move_counter[j%N] = 0;
     spheres[j%N] = temp;
+    cells.moved(j%N);
     workingmoves++;
     }
 
@@ -764,10 +778,273 @@ int main(int argc, char *argv[]){
   delete[] histogram;
   delete[] da_dz_histogram;
   delete[] path_histogram;
+  delete[] path2_histogram;
+  for (int t=1; t<num_threads; t++) {
+    delete[] thread_histograms[t].histogram;
+    delete[] thread_histograms[t].da_dz_histogram;
+    delete[] thread_histograms[t].path_histogram;
+    delete[] thread_histograms[t].path2_histogram;
+  }
   fflush(stdout);
   fclose(countout);
 }
 
+int CellList::cell_of(double x, int dim) const {
+  const int c = int(floor((x - lo[dim])/width[dim]));
+  if (c < 0) return 0;
+  if (c >= n[dim]) return n[dim] - 1;
+  return c;
+}
+
+void CellList::build(const Vector3d *spheres, long N, double cell_width) {
+  const double len[3] = { lenx, leny, lenz };
+  double hi[3];
+  for (int d=0; d<3; d++) {
+    if (periodic[d]) {
+      lo[d] = -len[d]/2;
+      hi[d] = len[d]/2;
+    } else {
+      lo[d] = hi[d] = spheres[0][d];
+      for (long i=1; i<N; i++) {
+        lo[d] = min(lo[d], spheres[i][d]);
+        hi[d] = max(hi[d], spheres[i][d]);
+      }
+    }
+  }
+  // There is no point in having many more cells than spheres, since
+  // then we would spend our time looking at empty cells.
+  do {
+    for (int d=0; d<3; d++) {
+      n[d] = int((hi[d] - lo[d])/cell_width);
+      if (n[d] < 1) n[d] = 1;
+      width[d] = max((hi[d] - lo[d])/n[d], 1e-10);
+    }
+    cell_width *= 1.25;
+  } while (long(n[0])*n[1]*n[2] > N);
+  // A counting sort puts the spheres in order of their cells.
+  vector<int> cell(N);
+  first.assign(n[0]*n[1]*n[2] + 1, 0);
+  for (long i=0; i<N; i++) {
+    cell[i] = (cell_of(spheres[i][0], 0)*n[1] + cell_of(spheres[i][1], 1))*n[2]
+      + cell_of(spheres[i][2], 2);
+    first[cell[i]+1]++;
+  }
+  for (unsigned c=1; c<first.size(); c++) first[c] += first[c-1];
+  members.resize(N);
+  vector<long> next(first.begin(), first.end() - 1);
+  for (long i=0; i<N; i++) members[next[cell[i]]++] = i;
+}
+
+void CellList::near(const Vector3d &v, double radius, vector<long> *out) const {
+  int from[3], to[3];
+  for (int d=0; d<3; d++) {
+    const int span = int(ceil(radius/width[d]));
+    const int c = cell_of(v[d], d);
+    if (periodic[d] && 2*span + 1 >= n[d]) {
+      from[d] = 0;
+      to[d] = n[d] - 1;
+    } else if (periodic[d]) {
+      from[d] = c - span;
+      to[d] = c + span;
+    } else {
+      from[d] = c - span < 0 ? 0 : c - span;
+      to[d] = c + span >= n[d] ? n[d] - 1 : c + span;
+    }
+  }
+  for (int cx=from[0]; cx<=to[0]; cx++) {
+    const int x = (cx + n[0]) % n[0];
+    for (int cy=from[1]; cy<=to[1]; cy++) {
+      const int y = (cy + n[1]) % n[1];
+      for (int cz=from[2]; cz<=to[2]; cz++) {
+        const int c = (x*n[1] + y)*n[2] + (cz + n[2]) % n[2];
+        for (long m=first[c]; m<first[c+1]; m++) out->push_back(members[m]);
+      }
+    }
+  }
+}
+
+// The radii beyond which a triplet can't land in any histogram (see
+// add_triplet for the conditions).  z1 is the distance from l to i;
+// then k can only matter if it is within triplet_l_radius of l or
+// within triplet_i_radius of i.  We add a little margin, since these
+// are only used to skip triplets, and add_triplet does the real test.
+static double triplet_z1_radius(const TripletBins &b) {
+  if (path) return 2*path_maxrad + 1e-6;
+  return max(max(b.zbins*dz, b.a1_zbins*a1_dz), 2*path_maxrad) + 1e-6;
+}
+static double triplet_l_radius() {
+  const double dz_path = max(path_cyl_dr, path_maxrad + path_width);
+  return sqrt(lenx*lenx/4 + dz_path*dz_path) + 1e-6;
+}
+static double triplet_i_radius(const TripletBins &b) {
+  if (path) return path_maxrad + 1e-6;
+  return max(2*R + b.a1_rbins*a1_dr, path_maxrad) + 1e-6;
+}
+
+// add_triplet bins the triplet of spheres l, i and k, given the
+// vectors r01 (from l to i), r02 (from l to k) and r12_v (from i to
+// k).  This is the body of what used to be a loop over every triple.
+static inline void add_triplet(double z1, int which_path, const Vector3d &zhat,
+                               const Vector3d &r02, const Vector3d &r12_v,
+                               const TripletBins &b, TripletHistograms *h) {
+  const int z1_i = path ? which_path : int(z1/dz);
+  const int a1_z1_i = int(z1/a1_dz);
+  const double z2 = r02.dot(zhat);
+  const int z2_i = floor(z2/dz);
+  const double x2 = (r02 - z2*zhat).norm();
+  const int x2_i = int(x2/dx);
+
+  const double r12 = r12_v.norm();
+
+  if (z1_i < b.zbins && x2_i < b.xbins && z2_i >= 0
+      && z2_i < b.z2bins && r02.norm() < lenx/2.0)
+    h->histogram[z1_i*b.xbins*b.z2bins + x2_i*b.z2bins + z2_i] ++;
+
+  // We only save da_dz when we aren't looking at paths.
+  if (!path) {
+    const int a1_r12_i = int((r12-2.0)/a1_dr);
+    if (a1_r12_i < b.a1_rbins && a1_z1_i < b.a1_zbins)
+      h->da_dz_histogram[a1_r12_i*b.a1_zbins + a1_z1_i] ++;
+  }
+
+  const double z_cent = z1/2.0;
+  const double xmin = path_radius/2.0*sqrt(3.0);
+  // We only need the angle theta = acos(r12_v.dot(zhat)/r12) to bin
+  // triplets on the arc, so elsewhere we compare cosines instead.
+  const double cos_theta = r12_v.dot(zhat)/r12;
+  if (which_path == 0 && z2 > z_cent) {
+    if (z2 < lenx/2.0 && x2 < path_cyl_dr && z2 > z1 + path_minrad) {
+      const int index = b.path_zbins - ceil((z2-z1-path_minrad)/path_width);
+      if (index < 0 || index >= b.path_zbins)
+        fprintf(stderr,"Index out of bounds: %i, z1: %.2f, z2: %.2f, x2: %.2f\n",index,z1,z2,x2);
+      h->path_histogram[index] ++;
+    } if (r12 > path_minrad && r12 < path_maxrad && cos_theta > -0.5) { // theta < 2pi/3
+      const int index = b.path_zbins + acos(cos_theta)/path_dtheta;
+      if (index < b.path_zbins || index >= b.path_zbins + b.path_thetabins)
+        fprintf(stderr,"Index out of bounds: %i, z1: %.2f, z2: %.2f, x2: %.2f\n",index,z1,z2,x2);
+      h->path_histogram[index] ++;
+    } if (z2-z_cent < path_width && x2 < lenx/2.0 && x2 > xmin) {
+      const int index = b.path_zbins + b.path_thetabins + int((x2 - xmin)/path_width);
+      if (index < b.path_zbins+b.path_thetabins || index >= b.path_bins)
+        fprintf(stderr,"Index out of bounds: %i, z1: %.2f, z2: %.2f, x2: %.2f\n",index,z1,z2,x2);
+      h->path_histogram[index] ++;
+    }
+  }
+  else if (which_path == 1 && z2 > z_cent) {
+    if (z2 < lenx/2.0 && x2 < path_cyl_dr && z2 > z1 + path_minrad) {
+      const int index = b.path2_zbins - ceil((z2-z1-path_minrad)/path_width);
+      if (index < 0 || index >= b.path_zbins)
+        fprintf(stderr,"Index2 out of bounds: %i, z1: %.2f, z2: %.2f, x2: %.2f\n",index,z1,z2,x2);
+      h->path2_histogram[index] ++;
+    } if (r12 > path_minrad && r12 < path_maxrad) {
+      const int index = b.path2_zbins + acos(cos_theta)/path_dtheta;
+      if (index < b.path2_zbins || index >= b.path2_zbins + b.path2_thetabins)
+        fprintf(stderr,"Index2 out of bounds: %i, z1: %.2f, z2: %.2f, x2: %.2f\n",index,z1,z2,x2);
+      h->path2_histogram[index] ++;
+    } if (z2-z_cent <  path_width && x2 < lenx/2.0) {
+      const int index = b.path2_zbins + b.path2_thetabins + int(x2/path_width);
+      if (index < b.path2_zbins+b.path2_thetabins || index >= b.path2_bins)
+        fprintf(stderr,"Index2 out of bounds: %i, z1: %.2f, z2: %.2f, x2: %.2f\n",index,z1,z2,x2);
+      h->path2_histogram[index] ++;
+    }
+  }
+}
+
+static void accumulate_triplets(const Vector3d *spheres, long N, const CellList *cells,
+                                const TripletBins *b, long first_l, long l_step,
+                                TripletHistograms *h) {
+  const double z1_radius = triplet_z1_radius(*b);
+  const double l_radius = triplet_l_radius(), i_radius = triplet_i_radius(*b);
+  vector<long> candidates, near_l;
+  vector<Vector3d> r02_near_l;
+  vector<long> near_i;
+  for (long l=first_l; l<N; l+=l_step) {
+    bool have_near_l = false;
+    near_i.clear();
+    cells->near(spheres[l], z1_radius, &near_i);
+    for (unsigned mi=0; mi<near_i.size(); mi++) {
+      const long i = near_i[mi];
+      if (i == l) continue;
+      const Vector3d r01 = periodicDiff(spheres[i], spheres[l]);
+      const double z1 = r01.norm();
+      if (z1 >= z1_radius) continue;
+      int which_path = -1; // -1 if no path, 0 if touching path, 1 if path between
+      if (z1 > path_minrad && z1 < path_maxrad)
+        which_path = 0;
+      else if (z1 > 2*path_minrad && z1 < 2*path_maxrad)
+        which_path = 1;
+      if (path && which_path < 0) continue;
+      if (!have_near_l) {
+        // We find every sphere within l_radius of l just once, and
+        // reuse the list for each i.
+        candidates.clear();
+        cells->near(spheres[l], l_radius, &candidates);
+        near_l.clear();
+        r02_near_l.clear();
+        for (unsigned m=0; m<candidates.size(); m++) {
+          const long k = candidates[m];
+          const Vector3d r02 = periodicDiff(spheres[k], spheres[l]);
+          if (k != l && r02.squaredNorm() < l_radius*l_radius) {
+            near_l.push_back(k);
+            r02_near_l.push_back(r02);
+          }
+        }
+        have_near_l = true;
+      }
+      const Vector3d zhat = r01.normalized();
+      for (unsigned m=0; m<near_l.size(); m++) {
+        const long k = near_l[m];
+        if (k != i) {
+          add_triplet(z1, which_path, zhat, r02_near_l[m],
+                      periodicDiff(spheres[k], spheres[i]), *b, h);
+        }
+      }
+      // Then the spheres close to i that weren't close to l.
+      candidates.clear();
+      cells->near(spheres[i], i_radius, &candidates);
+      for (unsigned m=0; m<candidates.size(); m++) {
+        const long k = candidates[m];
+        if (k == i || k == l) continue;
+        const Vector3d r12_v = periodicDiff(spheres[k], spheres[i]);
+        if (r12_v.squaredNorm() >= i_radius*i_radius) continue;
+        const Vector3d r02 = periodicDiff(spheres[k], spheres[l]);
+        if (r02.squaredNorm() < l_radius*l_radius) continue; // already counted above
+        add_triplet(z1, which_path, zhat, r02, r12_v, *b, h);
+      }
+    }
+  }
+}
+
+static void accumulate_triplets_in_threads(const Vector3d *spheres, long N, const TripletBins &b,
+                                           vector<TripletHistograms> &h) {
+  CellList cells;
+  cells.build(spheres, N, max(triplet_i_radius(b)/2, R));
+  const long num_threads = h.size();
+  vector<std::thread> threads;
+  for (long t=1; t<num_threads; t++) {
+    threads.push_back(std::thread(accumulate_triplets, spheres, N, &cells, &b,
+                                  t, num_threads, &h[t]));
+  }
+  accumulate_triplets(spheres, N, &cells, &b, 0, num_threads, &h[0]);
+  for (unsigned t=0; t<threads.size(); t++) threads[t].join();
+}
+
+static void add_and_zero(long *total, long *part, long num) {
+  for (long i=0; i<num; i++) {
+    total[i] += part[i];
+    part[i] = 0;
+  }
+}
+
+static void merge_triplet_histograms(vector<TripletHistograms> &h, const TripletBins &b) {
+  for (unsigned t=1; t<h.size(); t++) {
+    add_and_zero(h[0].histogram, h[t].histogram, b.zbins*b.xbins*b.z2bins);
+    add_and_zero(h[0].da_dz_histogram, h[t].da_dz_histogram, b.a1_rbins*b.a1_zbins);
+    add_and_zero(h[0].path_histogram, h[t].path_histogram, b.path_bins);
+    add_and_zero(h[0].path2_histogram, h[t].path2_histogram, b.path2_bins);
+  }
+}
+
 inline double countOneOverLap(Vector3d *spheres, long n, long j, double R){
   double num = 0;
   for(long i = 0; i < n; i++){
@@ -872,74 +1149,6 @@ inline double countOverLaps(Vector3d *spheres, long n, double R){
   return num;
 }
 
-inline bool overlap(Vector3d *spheres, Vector3d v, long n, double R, long s){
-  if (spherical_outer_wall){
-    if (distance(v,Vector3d(0,0,0)) > rad) return true;
-  }
-  if (spherical_inner_wall) {
-    if (distance(v,Vector3d(0,0,0)) < innerRad) return true;
-  }
-  if (has_x_wall){
-    if (v[0] > lenx/2 || v[0] < -lenx/2) return true;
-  }
-  if (has_y_wall){
-    if (v[1] > leny/2 || v[1] < -leny/2) return true;
-  }
-  if (has_z_wall){
-    if (v[2] > lenz/2 || v[2] < -lenz/2) return true;
-  }
-  bool amonborder[3] = {
-    fabs(v[0]) + 2*R >= lenx/2,
-    fabs(v[1]) + 2*R >= leny/2,
-    fabs(v[2]) + 2*R >= lenz/2
-  };
-  for(long i = 0; i < n; i++){
-    if (i!=s){
-      if(distance(spheres[i],v)<2*R){
-        return true;
-      }
-    }
-  }
-  for (long k=0; k<3; k++) {
-    if (periodic[k] && amonborder[k]) {
-      for(long i = 0; i < n; i++) {
-        if (i!=s){
-          if (distance(v,spheres[i]+lat[k]) < 2*R) return true;
-          if (distance(v,spheres[i]-lat[k]) < 2*R) return true;
-        }
-      }
-      for (long m=k+1; m<3; m++){
-        if (periodic[m] && amonborder[m]){
-          for(long i = 0; i < n; i++) {
-            if (i!=s){
-              if (distance(v,spheres[i]+lat[k]+lat[m]) < 2*R) return true;
-              if (distance(v,spheres[i]-lat[k]-lat[m]) < 2*R) return true;
-              if (distance(v,spheres[i]+lat[k]-lat[m]) < 2*R) return true;
-              if (distance(v,spheres[i]-lat[k]+lat[m]) < 2*R) return true;
-            }
-          }
-        }
-      }
-    }
-  }
-  if (periodic[0] && periodic[1] && periodic[2]
-      && amonborder[0] && amonborder[1] && amonborder[2]){
-    for(long i = 0; i < n; i++) {
-      if (i!=s){
-        if (distance(v,spheres[i]+latx+laty+latz) < 2*R) return true;
-        if (distance(v,spheres[i]+latx+laty-latz) < 2*R) return true;
-        if (distance(v,spheres[i]+latx-laty+latz) < 2*R) return true;
-        if (distance(v,spheres[i]-latx+laty+latz) < 2*R) return true;
-        if (distance(v,spheres[i]-latx-laty+latz) < 2*R) return true;
-        if (distance(v,spheres[i]-latx+laty-latz) < 2*R) return true;
-        if (distance(v,spheres[i]+latx-laty-latz) < 2*R) return true;
-        if (distance(v,spheres[i]-latx-laty-latz) < 2*R) return true;
-      }
-    }
-  }
-  return false;
-}
-
 inline Vector3d fixPeriodic(Vector3d newv){
   if (periodic[0] || has_x_wall){
     while (newv[0] > lenx/2){
@@ -50,6 +50,17 @@ public:
     for (int p=1; p < n; p++) v *= x;
     return v;
   }
+  VectorXd transform_batch(const VectorXd &, const VectorXd &x) const {
+    VectorXd out(VectorXd::Ones(x.rows()));
+    for (int p=0; p < n; p++) out = out.cwise()*x;
+    return out;
+  }
+  VectorXd derive_batch(const VectorXd &, const VectorXd &x) const {
+    if (n < 1) return VectorXd::Zero(x.rows());
+    VectorXd out(n*VectorXd::Ones(x.rows()));
+    for (int p=1; p < n; p++) out = out.cwise()*x;
+    return out;
+  }
   double d_by_dT(double, double) const {
     return 0;
   }
@@ -100,7 +111,7 @@ public:
   }
 
   VectorXd transform(const GridDescription &, double, const VectorXd &data) const {
-    VectorXd out(data.cwise().sqrt());
+    VectorXd out(vector_sqrt(data));
     if (n < 0) {
       for (int p=0; p > n; p--) out = out.cwise() / data;
     } else {
@@ -126,6 +137,24 @@ public:
     }
     return out;
   }
+  VectorXd transform_batch(const VectorXd &, const VectorXd &x) const {
+    VectorXd out(vector_sqrt(x));
+    if (n < 0) {
+      for (int p=0; p > n; p--) out = out.cwise() / x;
+    } else {
+      for (int p=0; p < n; p++) out = out.cwise() * x;
+    }
+    return out;
+  }
+  VectorXd derive_batch(const VectorXd &, const VectorXd &x) const {
+    VectorXd out((n+0.5)*vector_sqrt(x).cwise().inverse());
+    if (n < 0) {
+      for (int p=0; p > n; p--) out = out.cwise() / x;
+    } else {
+      for (int p=0; p < n; p++) out = out.cwise() * x;
+    }
+    return out;
+  }
   double d_by_dT(double, double) const {
     return 0;
   }
@@ -0,0 +1,216 @@
+// Deft is a density functional package developed by the research
+// group of Professor David Roundy
+//
+// Copyright 2010 The Deft Authors
+//
+// Deft is free software; you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// You should have received a copy of the GNU General Public License
+// along with deft; if not, write to the Free Software Foundation,
+// Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+//
+// Please see the file AUTHORS for a list of authors.
+
+#include "Profiler.h"
+#include "utilities.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <cxxabi.h>
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+std::atomic<long> profile_fft_count(0);
+
+struct ProfileTotals {
+  ProfileTotals() : calls(0), seconds(0), ffts(0), allocated(0), peak(0) {}
+  long calls;
+  double seconds;
+  long ffts, allocated, peak;
+};
+
+struct ProfileEvent {
+  std::string term;
+  const char *kind;
+  double start, seconds;
+  long ffts, allocated, peak;
+  int thread;
+};
+
+// We stop recording trace events after this many, so that a long run
+// can't fill up memory with them.
+static const long max_trace_events = 1000000;
+
+struct ProfileData {
+  std::mutex lock;
+  std::string report_fname, trace_fname;
+  std::map<std::pair<std::string, std::string>, ProfileTotals> totals;
+  std::vector<ProfileEvent> events;
+  long dropped_events;
+  std::map<std::thread::id, int> threads;
+  ProfileData() : dropped_events(0) {}
+};
+
+static ProfileData &profile_data() {
+  static ProfileData *data = new ProfileData(); // never destroyed, since we write at exit
+  return *data;
+}
+
+static double profile_clock() {
+  static const std::chrono::steady_clock::time_point t0 = std::chrono::steady_clock::now();
+  return std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+}
+
+static bool start_from_environment() {
+  const char *report = getenv("DEFT_PROFILE");
+  if (!report || !*report) return false;
+  profile_start(report, getenv("DEFT_PROFILE_TRACE"));
+  return true;
+}
+
+bool profile_enabled = start_from_environment();
+
+static void write_at_exit() {
+  profile_write();
+}
+
+void profile_start(const char *report_fname, const char *trace_fname) {
+  ProfileData &d = profile_data();
+  {
+    std::lock_guard<std::mutex> guard(d.lock);
+    d.report_fname = report_fname;
+    d.trace_fname = trace_fname ? trace_fname : "";
+  }
+  profile_clock(); // times are measured from here
+  static bool registered = false;
+  if (!registered) atexit(write_at_exit);
+  registered = true;
+  profile_enabled = true;
+}
+
+std::string ProfileScope::type_name(const std::type_info &t) {
+  int status;
+  char *name = abi::__cxa_demangle(t.name(), 0, 0, &status);
+  if (!name) return t.name();
+  std::string out(name);
+  free(name);
+  return out;
+}
+
+void ProfileScope::start(const std::string &t, const char *k) {
+  term = t.size() ? t : "unnamed";
+  kind = k;
+  start_ffts = profile_fft_count;
+  start_allocated = field_allocator_total_allocated();
+  start_in_use = field_allocator_memory_in_use();
+  // We measure our own peak from scratch, and then put back the peak
+  // of whatever call we are nested in when we are done.
+  outer_peak = field_allocator_peak_memory();
+  field_allocator_set_peak_memory(0);
+  start_time = profile_clock();
+}
+
+void ProfileScope::stop() {
+  const double now = profile_clock();
+  const long ffts = profile_fft_count - start_ffts;
+  const long allocated = field_allocator_total_allocated() - start_allocated;
+  const long peak = field_allocator_peak_memory();
+  field_allocator_set_peak_memory(peak > outer_peak ? peak : outer_peak);
+
+  ProfileData &d = profile_data();
+  std::lock_guard<std::mutex> guard(d.lock);
+  ProfileTotals &t = d.totals[std::make_pair(term, std::string(kind))];
+  t.calls++;
+  t.seconds += now - start_time;
+  t.ffts += ffts;
+  t.allocated += allocated;
+  if (peak - start_in_use > t.peak) t.peak = peak - start_in_use;
+  if (d.trace_fname.size()) {
+    if (long(d.events.size()) >= max_trace_events) {
+      d.dropped_events++;
+      return;
+    }
+    ProfileEvent e;
+    e.term = term;
+    e.kind = kind;
+    e.start = start_time;
+    e.seconds = now - start_time;
+    e.ffts = ffts;
+    e.allocated = allocated;
+    e.peak = peak - start_in_use;
+    std::map<std::thread::id, int>::iterator i = d.threads.find(std::this_thread::get_id());
+    if (i == d.threads.end()) {
+      const int n = d.threads.size();
+      d.threads[std::this_thread::get_id()] = n;
+      e.thread = n;
+    } else {
+      e.thread = i->second;
+    }
+    d.events.push_back(e);
+  }
+}
+
+// json_string writes s as a JSON string.
+static void json_string(FILE *f, const std::string &s) {
+  fputc('"', f);
+  for (unsigned i=0; i<s.size(); i++) {
+    const unsigned char c = s[i];
+    if (c == '"' || c == '\\') fprintf(f, "\\%c", c);
+    else if (c < 0x20) fprintf(f, "\\u%04x", c);
+    else fputc(c, f);
+  }
+  fputc('"', f);
+}
+
+void profile_write() {
+  ProfileData &d = profile_data();
+  std::lock_guard<std::mutex> guard(d.lock);
+  if (d.report_fname.size()) {
+    FILE *f = fopen(d.report_fname.c_str(), "w");
+    if (!f) {
+      printf("Unable to create profile report %s!\n", d.report_fname.c_str());
+    } else {
+      fprintf(f, "{\n  \"total_ffts\": %ld,\n  \"terms\": [", long(profile_fft_count));
+      bool first = true;
+      for (std::map<std::pair<std::string, std::string>, ProfileTotals>::iterator i = d.totals.begin();
+           i != d.totals.end(); ++i) {
+        const ProfileTotals &t = i->second;
+        fprintf(f, "%s\n    {\"term\": ", first ? "" : ",");
+        json_string(f, i->first.first);
+        fprintf(f, ", \"call\": ");
+        json_string(f, i->first.second);
+        fprintf(f, ", \"calls\": %ld, \"seconds\": %.6g, \"seconds_per_call\": %.6g,"
+                " \"ffts\": %ld, \"bytes_allocated\": %ld, \"peak_bytes\": %ld}",
+                t.calls, t.seconds, t.seconds/t.calls, t.ffts, t.allocated, t.peak);
+        first = false;
+      }
+      fprintf(f, "\n  ]\n}\n");
+      fclose(f);
+    }
+  }
+  if (d.trace_fname.size()) {
+    FILE *f = fopen(d.trace_fname.c_str(), "w");
+    if (!f) {
+      printf("Unable to create profile trace %s!\n", d.trace_fname.c_str());
+      return;
+    }
+    fprintf(f, "{\"traceEvents\": [");
+    for (unsigned i=0; i<d.events.size(); i++) {
+      const ProfileEvent &e = d.events[i];
+      fprintf(f, "%s\n  {\"name\": ", i ? "," : "");
+      json_string(f, e.term);
+      fprintf(f, ", \"cat\": \"%s\", \"ph\": \"X\", \"ts\": %.3f, \"dur\": %.3f,"
+              " \"pid\": 0, \"tid\": %d, \"args\": {\"ffts\": %ld, \"bytes_allocated\": %ld,"
+              " \"peak_bytes\": %ld}}",
+              e.kind, 1e6*e.start, 1e6*e.seconds, e.thread, e.ffts, e.allocated, e.peak);
+    }
+    fprintf(f, "\n], \"otherData\": {\"dropped_events\": %ld}}\n", d.dropped_events);
+    fclose(f);
+  }
+}
@@ -0,0 +1,68 @@
+// -*- mode: C++; -*-
+
+#pragma once
+
+#include <atomic>
+#include <string>
+#include <typeinfo>
+
+// The profiler records, for each term of a functional and each kind
+// of call (integral, grad, pgrad, or the energy and gradient of a
+// NewFunctional), how many calls were made and how much wall time,
+// how many FFTs, how many bytes of field_malloc allocations, and how
+// much extra live memory (the peak above what was in use when the call
+// started) they took.  This is what you want for finding out which
+// term of a SAFT functional dominates at a given grid size.
+//
+// It is off unless the environment variable DEFT_PROFILE names a file
+// for the JSON report, or profile_start is called.  If
+// DEFT_PROFILE_TRACE is also set, every call is also written to that
+// file in the Chrome trace format (load it with chrome://tracing or
+// https://ui.perfetto.dev).  Both are written when the program exits.
+//
+// Times are inclusive, so a term whose calls nest inside another
+// term's is counted in both.  The memory peaks assume that profiled
+// calls are made from one thread at a time (the calls themselves may
+// of course use threads).
+
+extern bool profile_enabled;
+// profile_fft_count counts every FFT we do, whether or not we are
+// profiling, so don't use it for anything else.
+extern std::atomic<long> profile_fft_count;
+
+inline void profile_fft() { profile_fft_count++; }
+
+// profile_start turns on the profiler, writing the report (and the
+// trace, if trace_fname is not null) at exit.
+void profile_start(const char *report_fname, const char *trace_fname = 0);
+// profile_write writes the report and trace now, which you might do
+// partway through a long run.
+void profile_write();
+
+// A ProfileScope records everything from its creation to its
+// destruction as one call of the given kind to the given term.
+class ProfileScope {
+public:
+  ProfileScope(const std::string &term, const char *kind) : active(profile_enabled) {
+    if (active) start(term, kind);
+  }
+  // This names the term by its type, which is what we do for a
+  // NewFunctional, since it has no name of its own.
+  ProfileScope(const std::type_info &type, const char *kind) : active(profile_enabled) {
+    if (active) start(type_name(type), kind);
+  }
+  ~ProfileScope() {
+    if (active) stop();
+  }
+private:
+  static std::string type_name(const std::type_info &type);
+  void start(const std::string &term, const char *kind);
+  void stop();
+  bool active;
+  std::string term;
+  const char *kind;
+  double start_time;
+  long start_ffts, start_allocated, start_in_use, outer_peak;
+  ProfileScope(const ProfileScope &); // not copyable
+  void operator=(const ProfileScope &);
+};
@@ -0,0 +1,134 @@
+// Deft is a density functional package developed by the research
+// group of Professor David Roundy
+//
+// Copyright 2010 The Deft Authors
+//
+// Deft is free software; you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// You should have received a copy of the GNU General Public License
+// along with deft; if not, write to the Free Software Foundation,
+// Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+//
+// Please see the file AUTHORS for a list of authors.
+
+#include "RadialDistributionTable.h"
+#include "FieldFile.h"
+#include "Reduction.h"
+
+#include <stdio.h>
+#include <math.h>
+
+RadialDistributionTable::RadialDistributionTable()
+  : neta(0), nr(0), deta(0), dr(0), rmax(0) {
+}
+
+bool RadialDistributionTable::ReadMonteCarlo(const char *prefix, int num_eta,
+                                             double eta_step, int num_r) {
+  char fname[4096];
+  // We get the spacing in r from the first two lines of the first
+  // file, which are half a step apart.
+  snprintf(fname, sizeof fname, "%s-%2.2f.dat", prefix, eta_step);
+  FILE *in = fopen(fname, "r");
+  if (!in) {
+    fprintf(stderr, "Unable to open file %s!\n", fname);
+    return false;
+  }
+  double r0, r1;
+  if (fscanf(in, " %lg %*g %lg", &r0, &r1) != 2) {
+    fprintf(stderr, "Error reading file %s!\n", fname);
+    fclose(in);
+    return false;
+  }
+  fclose(in);
+
+  neta = num_eta;
+  nr = num_r;
+  deta = eta_step;
+  dr = 2*(r1 - r0);
+  set_rmax();
+  g.assign(long(neta + 1)*nr, 1.0);
+  for (int ieta = 1; ieta <= neta; ieta++) {
+    const double eta = ieta*eta_step;
+    snprintf(fname, sizeof fname, "%s-%2.2f.dat", prefix, eta);
+    in = fopen(fname, "r");
+    if (!in) {
+      fprintf(stderr, "Unable to open file %s!\n", fname);
+      return false;
+    }
+    // The files hold eta*g(r).
+    int i = 0;
+    double value;
+    while (i < nr && fscanf(in, " %*g %lg", &value) == 1) g[long(ieta)*nr + i++] = value/eta;
+    const bool extra = fscanf(in, " %*g %lg", &value) == 1;
+    fclose(in);
+    if (i != nr || extra) {
+      fprintf(stderr, "There are not %d lines in %s!\n", nr, fname);
+      return false;
+    }
+  }
+  return true;
+}
+
+bool RadialDistributionTable::Save(const char *fname) const {
+  FieldHeader h;
+  h.Nx = neta + 1;
+  h.Ny = nr;
+  h.Nz = 1;
+  h.set_parameter("eta_step", deta);
+  h.set_parameter("r_step", dr);
+  return write_field_file(fname, h, &g[0]);
+}
+
+bool RadialDistributionTable::Load(const char *fname) {
+  FieldFile file;
+  if (!file.open(fname)) return false;
+  const FieldHeader &h = file.header();
+  double eta_step, r_step;
+  if (h.Nz != 1 || !h.get_parameter("eta_step", &eta_step) || !h.get_parameter("r_step", &r_step)) {
+    fprintf(stderr, "Field file %s is not a radial distribution table!\n", fname);
+    return false;
+  }
+  neta = h.Nx - 1;
+  nr = h.Ny;
+  deta = eta_step;
+  dr = r_step;
+  set_rmax();
+  g.assign(file.data(), file.data() + h.size());
+  return true;
+}
+
+double RadialDistributionTable::operator()(double eta, double r) const {
+  if (r < 2) return 0;
+  const int ieta = int(floor(eta/deta));
+  if (ieta < 0 || ieta + 1 > neta) return NAN;
+  if (r > rmax) return 1.0;
+  // The first point is only half a step from the second.
+  int j;
+  double fac;
+  if (r < 2 + 0.5*dr) {
+    j = 0;
+    fac = (r - 2.0)/(0.5*dr);
+  } else {
+    j = int(floor((r - 2.0 + 0.5*dr)/dr));
+    fac = (r - (2 + (j - 0.5)*dr))/dr;
+    if (j > nr - 2) { // r is right at the end of the table
+      j = nr - 2;
+      fac = 1;
+    }
+  }
+  const double *low = &g[long(ieta)*nr + j], *high = low + nr;
+  const double g_low = (1-fac)*low[0] + fac*low[1];
+  const double g_high = (1-fac)*high[0] + fac*high[1];
+  const double eta_fac = (eta - ieta*deta)/deta;
+  return (1-eta_fac)*g_low + eta_fac*g_high;
+}
+
+void RadialDistributionTable::Evaluate(const double *eta, const double *r, long n,
+                                       double *out) const {
+  grid_parallel_for(n, [this, eta, r, out](long start, long end) {
+      for (long i=start; i<end; i++) out[i] = (*this)(eta[i], r[i]);
+    });
+}
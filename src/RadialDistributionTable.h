@@ -0,0 +1,52 @@
+// -*- mode: C++; -*-
+
+#pragma once
+
+#include <vector>
+
+// A RadialDistributionTable holds the radial distribution function
+// g(r) of the homogeneous hard-sphere fluid (with spheres of radius 1)
+// on a grid of packing fractions eta and radii r, and interpolates it
+// bilinearly.  A lookup costs the same however big the table is, and
+// since it only reads the table, any number of threads can look things
+// up at once.
+//
+// The radii are those of our Monte-Carlo g(r) files: the first point is
+// at contact (r = 2), and point j > 0 is at r = 2 + (j - 1/2) r_step.
+// g is zero inside contact and one beyond the end of the table.  The
+// packing fractions are 0, eta_step, ..., num_eta*eta_step, where g is
+// one at eta = 0, and a lookup at a packing fraction beyond the table
+// gives NaN.
+//
+// Reading the text files once and then saving the table as a field
+// file (see FieldFile.h) makes later runs start up much faster.
+
+class RadialDistributionTable {
+public:
+  RadialDistributionTable();
+
+  // ReadMonteCarlo reads the tables prefix-0.05.dat (and so on)
+  // written by our Monte-Carlo code, each of which must have num_r
+  // lines.  It returns false (printing why) if it cannot.
+  bool ReadMonteCarlo(const char *prefix, int num_eta, double eta_step, int num_r);
+  // Save writes the table to a field file, and Load reads one back,
+  // returning false (printing why) if it cannot.
+  bool Save(const char *fname) const;
+  bool Load(const char *fname);
+
+  double operator()(double eta, double r) const;
+  // Evaluate looks up g(eta[i], r[i]) for the n points, splitting them
+  // among the threads of the grid thread pool.
+  void Evaluate(const double *eta, const double *r, long n, double *g) const;
+
+  int num_eta() const { return neta; }
+  double eta_step() const { return deta; }
+  int num_r() const { return nr; }
+  double r_step() const { return dr; }
+
+private:
+  int neta, nr;
+  double deta, dr, rmax;
+  std::vector<double> g; // g[ieta*nr + ir]
+  void set_rmax() { rmax = 2 + (nr - 1.5)*dr; }
+};
@@ -1,4 +1,5 @@
 #include "ReciprocalGrid.h"
+#include "Profiler.h"
 #include <fftw3.h>
 
 complex ReciprocalGrid::operator()(const RelativeReciprocal &r) const {
@@ -53,6 +54,7 @@ Grid ifft(const GridDescription &gd, VectorXcd *rg) {
   Grid out(gd);
   const complex *mydata = rg->data();
   fftw_plan p = fftw_plan_dft_c2r_3d(gd.Nx, gd.Ny, gd.Nz, (fftw_complex *)mydata, out.data(), FFTW_MEASURE);
+  profile_fft();
   fftw_execute(p);
   // FFTW overwrites the input on a c2r transform, so let's throw it
   // away so we don't accidentally try to reuse an invalid array! An
@@ -0,0 +1,74 @@
+// -*- mode: C++; -*-
+
+#pragma once
+
+#include <functional>
+#include <vector>
+
+// This is the thread pool behind GridParallel.h, along with the sums
+// over grids that both the old and the new code use for integrals.
+// It doesn't need Eigen, so the new code can use it too.  The pool
+// itself is in GridParallel.cpp.
+//
+// grid_parallel_for splits 0 <= i < n into chunks of grid_chunk_size
+// points, which is small enough that each chunk of its operands stays
+// in cache, and shares them out among a pool of threads.  Grids
+// smaller than a few chunks are done on the calling thread, since
+// waking the pool would cost more than it saves.  The pool has one
+// thread per core, or DEFT_GRID_THREADS threads if that is set.  A
+// grid_parallel_for called from inside another one (or from a second
+// thread while the pool is busy) just runs on its own thread, so it is
+// always safe to call these.
+//
+// grid_sum_of(n, term) adds up term(i) for 0 <= i < n.  It sums each
+// chunk pairwise (with four interleaved partial sums at the bottom,
+// which the compiler can keep in one vector register), and then sums
+// the chunk sums pairwise.  The order of every addition depends only
+// on n, so the result is bit for bit the same however many threads we
+// have, and the rounding error grows only as log(n) rather than as n.
+// This matters, since the minimizers compare energies that differ
+// only in their last few digits.
+
+static const long grid_chunk_size = 1 << 14;
+
+// grid_parallel_for calls f(start, end) for consecutive chunks that
+// together cover 0 <= i < n, and returns when they are all done.
+void grid_parallel_for(long n, const std::function<void(long start, long end)> &f);
+// grid_threads returns the number of threads used (including the
+// caller), and grid_set_threads changes it, which is handy for
+// testing and benchmarking.
+int grid_threads();
+void grid_set_threads(int num_threads);
+
+// pairwise_sum_of adds up term(i) for start <= i < start + n.
+template<typename F>
+inline double pairwise_sum_of(const F &term, long start, long n) {
+  if (n <= 64) {
+    double s0 = 0, s1 = 0, s2 = 0, s3 = 0;
+    long i = start;
+    for (; i + 4 <= start + n; i += 4) {
+      s0 += term(i);
+      s1 += term(i+1);
+      s2 += term(i+2);
+      s3 += term(i+3);
+    }
+    for (; i < start + n; i++) s0 += term(i);
+    return (s0 + s1) + (s2 + s3);
+  }
+  const long half = n/2;
+  return pairwise_sum_of(term, start, half) + pairwise_sum_of(term, start + half, n - half);
+}
+
+template<typename F>
+double grid_sum_of(long n, const F &term) {
+  std::vector<double> chunk_sums((n + grid_chunk_size - 1)/grid_chunk_size);
+  grid_parallel_for(n, [&term, &chunk_sums](long start, long end) {
+      chunk_sums[start/grid_chunk_size] = pairwise_sum_of(term, start, end - start);
+    });
+  const double *sums = chunk_sums.data();
+  return pairwise_sum_of([sums](long i) { return sums[i]; }, 0, chunk_sums.size());
+}
+
+inline double grid_sum(const double *x, long n) {
+  return grid_sum_of(n, [x](long i) { return x[i]; });
+}
@@ -0,0 +1,198 @@
+// Deft is a density functional package developed by the research
+// group of Professor David Roundy
+//
+// Copyright 2010 The Deft Authors
+//
+// Deft is free software; you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// You should have received a copy of the GNU General Public License
+// along with deft; if not, write to the Free Software Foundation,
+// Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+//
+// Please see the file AUTHORS for a list of authors.
+
+#include "VectorMath.h"
+#include <atomic>
+
+#if defined(__x86_64__) || defined(__i386__)
+#define VM_X86
+#include <immintrin.h>
+#endif
+
+// We compile VectorMathKernels.h once per instruction set, using
+// gcc's vector extensions so that the same source serves for every
+// vector width.  Each namespace ends up with a set of array functions
+// that we choose between at run time.
+
+// apply runs a kernel over an array, one vector at a time, padding
+// the last partial vector with ones (which are harmless for every
+// kernel).
+#define VM_ARRAY_FUNCTIONS                                              \
+  template <vd (*kernel)(vd)>                                           \
+  static void apply(const double *x, double *out, long n) {            \
+    const long W = sizeof(vd)/sizeof(double);                           \
+    long i = 0;                                                         \
+    for (; i + W <= n; i += W) {                                        \
+      vd v;                                                             \
+      memcpy(&v, x + i, sizeof(vd));                                    \
+      v = kernel(v);                                                    \
+      memcpy(out + i, &v, sizeof(vd));                                  \
+    }                                                                   \
+    if (i < n) {                                                        \
+      vd v = splat(1.0);                                                \
+      memcpy(&v, x + i, (n - i)*sizeof(double));                       \
+      v = kernel(v);                                                    \
+      memcpy(out + i, &v, (n - i)*sizeof(double));                      \
+    }                                                                   \
+  }                                                                     \
+  static inline vd sqrt_kernel(vd x) { return vsqrt(x); }               \
+  static void exp_array(const double *x, double *out, long n) {         \
+    apply<exp_kernel>(x, out, n);                                       \
+  }                                                                     \
+  static void log_array(const double *x, double *out, long n) {         \
+    apply<log_kernel>(x, out, n);                                       \
+  }                                                                     \
+  static void sqrt_array(const double *x, double *out, long n) {        \
+    apply<sqrt_kernel>(x, out, n);                                      \
+  }                                                                     \
+  static void erf_array(const double *x, double *out, long n) {         \
+    apply<erf_kernel>(x, out, n);                                       \
+  }                                                                     \
+  static void pow_array(const double *x, double y, double *out, long n) { \
+    const vd vy = splat(y);                                             \
+    const long W = sizeof(vd)/sizeof(double);                           \
+    long i = 0;                                                         \
+    for (; i + W <= n; i += W) {                                        \
+      vd v;                                                             \
+      memcpy(&v, x + i, sizeof(vd));                                    \
+      v = pow_kernel(v, vy);                                            \
+      memcpy(out + i, &v, sizeof(vd));                                  \
+    }                                                                   \
+    if (i < n) {                                                        \
+      vd v = splat(1.0);                                                \
+      memcpy(&v, x + i, (n - i)*sizeof(double));                       \
+      v = pow_kernel(v, vy);                                            \
+      memcpy(out + i, &v, (n - i)*sizeof(double));                      \
+    }                                                                   \
+  }
+
+// The helpers that every instantiation of VectorMathKernels.h needs,
+// for a vector of W doubles.
+#define VM_VECTOR_HELPERS(W)                                            \
+  typedef double vd __attribute__((vector_size(8*W)));                  \
+  typedef int64_t vi __attribute__((vector_size(8*W)));                 \
+  typedef vi bool_or_mask;                                              \
+  static inline vi as_bits(vd x) { return (vi)x; }                      \
+  static inline vd from_bits(vi i) { return (vd)i; }                    \
+  static inline vd splat(double x) { vd v = {}; return v + x; }         \
+  static inline vi splati(int64_t x) { vi v = {}; return v + x; }       \
+  static inline vd select(vi m, vd a, vd b) { return m ? a : b; }       \
+  static inline vi select(vi m, vi a, vi b) { return m ? a : b; }       \
+  static inline bool any(vi m) {                                        \
+    for (int i=0; i<W; i++) if (m[i]) return true;                      \
+    return false;                                                       \
+  }
+
+namespace vm_generic {
+  VM_VECTOR_HELPERS(2)
+#ifdef VM_X86
+  static inline vd vsqrt(vd x) { return _mm_sqrt_pd(x); }
+#else
+  static inline vd vsqrt(vd x) {
+    for (int i=0; i<2; i++) x[i] = sqrt(x[i]);
+    return x;
+  }
+#endif
+#include "VectorMathKernels.h"
+  VM_ARRAY_FUNCTIONS
+}
+
+#ifdef VM_X86
+#pragma GCC push_options
+#pragma GCC target("avx2,fma")
+namespace vm_avx2 {
+  VM_VECTOR_HELPERS(4)
+  static inline vd vsqrt(vd x) { return _mm256_sqrt_pd(x); }
+#include "VectorMathKernels.h"
+  VM_ARRAY_FUNCTIONS
+}
+#pragma GCC pop_options
+
+#pragma GCC push_options
+#pragma GCC target("avx512f")
+namespace vm_avx512 {
+  VM_VECTOR_HELPERS(8)
+  // The masked form sidesteps a bogus "uninitialized" warning in gcc 12.
+  static inline vd vsqrt(vd x) { return _mm512_mask_sqrt_pd(x, 0xff, x); }
+#include "VectorMathKernels.h"
+  VM_ARRAY_FUNCTIONS
+}
+#pragma GCC pop_options
+#endif
+
+struct VectorMathSet {
+  const char *name;
+  void (*exp)(const double *, double *, long);
+  void (*log)(const double *, double *, long);
+  void (*sqrt)(const double *, double *, long);
+  void (*erf)(const double *, double *, long);
+  void (*pow)(const double *, double, double *, long);
+};
+
+#define VM_SET(name, ns) { name, ns::exp_array, ns::log_array, ns::sqrt_array, \
+                           ns::erf_array, ns::pow_array }
+
+static const VectorMathSet generic_set = VM_SET("generic", vm_generic);
+#ifdef VM_X86
+static const VectorMathSet avx2_set = VM_SET("avx2", vm_avx2);
+static const VectorMathSet avx512_set = VM_SET("avx512", vm_avx512);
+#endif
+
+static const VectorMathSet *best_set() {
+#ifdef VM_X86
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx512f")) return &avx512_set;
+  if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) return &avx2_set;
+#endif
+  return &generic_set;
+}
+
+// current_set starts out as the best set this processor supports.
+// Being a local static, it is initialized exactly once even if several
+// threads make their first call at once, and being atomic, it may be
+// changed by vm_use_instruction_set while other threads are using it.
+static std::atomic<const VectorMathSet *> &current_set() {
+  static std::atomic<const VectorMathSet *> set(best_set());
+  return set;
+}
+
+static const VectorMathSet &vm() {
+  return *current_set().load();
+}
+
+void vm_exp(const double *x, double *out, long n) { vm().exp(x, out, n); }
+void vm_log(const double *x, double *out, long n) { vm().log(x, out, n); }
+void vm_sqrt(const double *x, double *out, long n) { vm().sqrt(x, out, n); }
+void vm_erf(const double *x, double *out, long n) { vm().erf(x, out, n); }
+void vm_pow(const double *x, double y, double *out, long n) { vm().pow(x, y, out, n); }
+
+const char *vm_instruction_set() {
+  return vm().name;
+}
+
+bool vm_use_instruction_set(const char *name) {
+  const VectorMathSet *wanted = 0;
+  if (strcmp(name, "generic") == 0) wanted = &generic_set;
+#ifdef VM_X86
+  __builtin_cpu_init();
+  if (strcmp(name, "avx2") == 0 && __builtin_cpu_supports("avx2") &&
+      __builtin_cpu_supports("fma")) wanted = &avx2_set;
+  if (strcmp(name, "avx512") == 0 && __builtin_cpu_supports("avx512f")) wanted = &avx512_set;
+#endif
+  if (!wanted) return false;
+  current_set().store(wanted);
+  return true;
+}
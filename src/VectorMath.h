@@ -0,0 +1,63 @@
+// -*- mode: C++; -*-
+
+#pragma once
+
+#include <math.h>
+#include <stdint.h>
+#include <string.h>
+#include <complex>
+
+// VectorMath provides log, exp, pow, sqrt and erf for whole arrays
+// of doubles, using AVX-512 or AVX2 when the processor supports them
+// (checked once at run time), and portable code otherwise.  The
+// array functions are what the pointwise Functional nodes use.
+//
+// The vm_exp, vm_log, vm_pow and vm_erf functions taking a single
+// double use the very same algorithms, inline and without branches,
+// so that the compiler is free to vectorize loops that call them
+// (which it cannot do with a call into libm).  This is what the
+// generated code uses.
+//
+// exp, log and erf are accurate to within a few ulps over their whole
+// range (tests/vector-math.cpp checks this against libm), and sqrt is
+// exact.  pow is computed as exp(y*log(x)), so see the comment on
+// pow_kernel for its accuracy.
+
+namespace vm_scalar {
+  typedef double vd;
+  typedef int64_t vi;
+  typedef bool bool_or_mask;
+  inline vi as_bits(vd x) { vi i; memcpy(&i, &x, sizeof(i)); return i; }
+  inline vd from_bits(vi i) { vd x; memcpy(&x, &i, sizeof(x)); return x; }
+  inline vd splat(double x) { return x; }
+  inline vi splati(int64_t i) { return i; }
+  template <typename M, typename T> inline T select(M m, T a, T b) { return m ? a : b; }
+  inline bool any(bool m) { return m; }
+#include "VectorMathKernels.h"
+}
+
+inline double vm_exp(double x) { return vm_scalar::exp_kernel(x); }
+inline double vm_log(double x) { return vm_scalar::log_kernel(x); }
+inline double vm_pow(double x, double y) { return vm_scalar::pow_kernel(x, y); }
+inline double vm_erf(double x) { return vm_scalar::erf_kernel(x); }
+
+// The generated reciprocal-space code works with complex temporaries,
+// for which we simply use the standard library.
+inline std::complex<double> vm_exp(std::complex<double> x) { return std::exp(x); }
+inline std::complex<double> vm_log(std::complex<double> x) { return std::log(x); }
+
+// The array versions set out[i] = f(x[i]) for 0 <= i < n.  It is fine
+// for out to be the same array as x.
+void vm_exp(const double *x, double *out, long n);
+void vm_log(const double *x, double *out, long n);
+void vm_pow(const double *x, double y, double *out, long n);
+void vm_sqrt(const double *x, double *out, long n);
+void vm_erf(const double *x, double *out, long n);
+
+// vm_instruction_set returns the name of the instruction set that the
+// array functions are using: "avx512", "avx2" or "generic".
+const char *vm_instruction_set();
+// vm_use_instruction_set switches to the named instruction set, which
+// is handy for testing and benchmarking.  It returns false (and
+// changes nothing) if this processor does not support it.
+bool vm_use_instruction_set(const char *name);
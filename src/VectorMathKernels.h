@@ -0,0 +1,162 @@
+// -*- mode: C++; -*-
+
+// This file holds the actual algorithms of VectorMath.h.  It is
+// deliberately *not* protected by #pragma once, since it is included
+// several times: once for plain doubles (giving the inline scalar
+// functions in VectorMath.h), and once for each instruction set in
+// VectorMath.cpp.  Before including it you must define, inside a
+// namespace of your own, the types vd (a double or a vector of
+// doubles) and vi (the matching 64-bit integer type), along with
+// as_bits, from_bits, splat, select, any and vsqrt.
+//
+// Everything is written without branches on the data (except for
+// "any", which only skips work that no lane needs), so that the same
+// code gives the same answer whether it is run on one double or on
+// eight.
+
+// exp_kernel uses the usual reduction x = n*ln2 + r with |r| <= ln2/2
+// and a Taylor series for exp(r), which is accurate to about an ulp.
+static inline vd exp_kernel(vd x) {
+  const double log2e = 1.4426950408889634;
+  // ln2_hi has its low bits zeroed, so n*ln2_hi is exact.
+  const double ln2_hi = 6.93147180369123816490e-01;
+  const double ln2_lo = 1.90821492927058770002e-10;
+  const double shift = 6755399441055744.0; // 1.5*2^52, to round to an integer
+  // Beyond these limits exp is either infinite or zero, and clamping
+  // keeps n from overflowing the exponent below.
+  x = select(x > 710.0, splat(710.0), x);
+  x = select(x < -746.0, splat(-746.0), x);
+
+  vd kd = x*log2e + shift;
+  const vi n = as_bits(kd) - as_bits(splat(shift));
+  kd = kd - shift;
+  const vd r = (x - kd*ln2_hi) - kd*ln2_lo;
+
+  vd p = splat(1.0/6227020800.0); // 1/13!
+  p = p*r + 1.0/479001600.0;
+  p = p*r + 1.0/39916800.0;
+  p = p*r + 1.0/3628800.0;
+  p = p*r + 1.0/362880.0;
+  p = p*r + 1.0/40320.0;
+  p = p*r + 1.0/5040.0;
+  p = p*r + 1.0/720.0;
+  p = p*r + 1.0/120.0;
+  p = p*r + 1.0/24.0;
+  p = p*r + 1.0/6.0;
+  p = p*r + 0.5;
+  p = p*r + 1.0;
+  p = p*r + 1.0;
+
+  // We scale by 2^n in two halves, so that results that are
+  // subnormal (or infinite) come out right.
+  const vi n1 = n >> 1;
+  const vi n2 = n - n1;
+  return (p*from_bits((n1 + 1023) << 52))*from_bits((n2 + 1023) << 52);
+}
+
+// log_kernel writes x = 2^e*(1+f) with sqrt(1/2) <= 1+f < sqrt(2),
+// and then sums the series for log(1+f) = 2*atanh(f/(2+f)), in the
+// same arrangement as fdlibm.
+static inline vd log_kernel(vd x) {
+  const double ln2_hi = 6.93147180369123816490e-01;
+  const double ln2_lo = 1.90821492927058770002e-10;
+  const double two54 = 18014398509481984.0;
+  const double huge = HUGE_VAL;
+
+  // Subnormals need to be scaled up before we can read off the
+  // exponent.
+  const bool_or_mask tiny = x < 2.2250738585072014e-308;
+  const vd xs = select(tiny, x*two54, x);
+  const vi ix = as_bits(xs);
+  vi e = ((ix >> 52) & 0x7ff) - select(tiny, splati(1023 + 54), splati(1023));
+  vd m = from_bits((ix & 0x000fffffffffffffLL) | 0x3ff0000000000000LL);
+  const bool_or_mask big = m > 1.4142135623730951;
+  m = select(big, m*0.5, m);
+  e = select(big, e + 1, e);
+  // This converts e to a double using only integer operations, which
+  // is possible because |e| is small.
+  const vd dk = from_bits(e + (0x4330000000000000LL + 2048)) - (4503599627370496.0 + 2048);
+
+  const vd f = m - 1.0;
+  const vd s = f/(2.0 + f);
+  const vd z = s*s;
+  vd R = splat(2.0/21);
+  R = R*z + 2.0/19;
+  R = R*z + 2.0/17;
+  R = R*z + 2.0/15;
+  R = R*z + 2.0/13;
+  R = R*z + 2.0/11;
+  R = R*z + 2.0/9;
+  R = R*z + 2.0/7;
+  R = R*z + 2.0/5;
+  R = R*z + 2.0/3;
+  R = R*z;
+  const vd hfsq = 0.5*f*f;
+  vd out = dk*ln2_hi - ((hfsq - (s*(hfsq + R) + dk*ln2_lo)) - f);
+
+  out = select(x == 0.0, splat(-huge), out);
+  out = select(x == huge, splat(huge), out);
+  out = select(x < 0.0, splat(NAN), out);
+  return select(x != x, x, out);
+}
+
+// pow_kernel computes exp(y*log(x)) for x >= 0, so its relative error
+// grows like |y*log(x)| ulps.  That is fine for the modest powers
+// that show up in our functionals, but it is not a replacement for
+// pow with huge exponents or negative x.
+static inline vd pow_kernel(vd x, vd y) {
+  const vd out = exp_kernel(y*log_kernel(x));
+  return select((y == 0.0) | (x == 1.0), splat(1.0), out);
+}
+
+// chebyshev sums the Chebyshev series c[0]/2 + sum_j c[j]*T_j(s)
+// using Clenshaw's recurrence.
+static inline vd chebyshev(const double *c, int n, vd s) {
+  vd b1 = splat(0.0), b2 = splat(0.0);
+  const vd twos = 2.0*s;
+  for (int j=n-1; j>0; j--) {
+    const vd b0 = twos*b1 - b2 + c[j];
+    b2 = b1;
+    b1 = b0;
+  }
+  return s*b1 - b2 + 0.5*c[0];
+}
+
+// erf_kernel uses two Chebyshev fits: erf(x)/x as a function of x^2
+// for |x| < 1, and erfc(x)*exp(x^2) as a function of
+// t = (x - 1.5)/(x + 1.5) for 1 <= |x| <= 6.  Beyond 6, erf(x) is 1 to
+// double precision.  The coefficients were computed with 90-digit
+// arithmetic, and each series is truncated well below an ulp.
+static inline vd erf_kernel(vd x) {
+  static const double small_coeffs[] = {
+    1.9509538787653082, -0.14226120510371365, 0.010035582187599796,
+    -0.0005768764699767485, 2.741993125219606e-05, -1.1043175507344507e-06,
+    3.8488755420345036e-08, -1.1808582533875466e-09, 3.2334215826050907e-11,
+    -7.991015947004483e-13, 1.799072511348477e-14, -3.718635162421382e-16,
+    7.101507363020076e-18
+  };
+  static const double big_coeffs[] = {
+    0.4913719275884076, -0.16703515688433437, 0.014545989038479255,
+    -0.0003705808964696264, -5.229422386631322e-05, 2.2383418234940896e-06,
+    4.175528433968392e-07, -4.529712916028805e-09, -4.216136307608378e-09,
+    -2.1426740050640705e-10, 3.257629835725707e-11, 5.392723875591651e-12,
+    8.098095711512747e-14, -6.623070544054385e-14, -8.545516957722814e-15,
+    -1.3087974949011652e-17, 1.329566793433813e-16, 1.8123354111993542e-17
+  };
+  const bool_or_mask negative = x < 0.0;
+  const vd ax = select(negative, -x, x);
+  const bool_or_mask small = ax < 1.0;
+  vd out = splat(1.0);
+  if (any(small)) {
+    const vd z = ax*ax;
+    out = ax*chebyshev(small_coeffs, sizeof(small_coeffs)/sizeof(double), 2.0*z - 1.0);
+  }
+  if (any(ax >= 1.0)) {
+    const vd axc = select(ax > 6.0, splat(6.0), ax);
+    const vd t = (axc - 1.5)/(axc + 1.5); // between -0.2 and 0.6
+    const vd erfcx = chebyshev(big_coeffs, sizeof(big_coeffs)/sizeof(double), 2.5*t - 0.5);
+    out = select(small, out, 1.0 - exp_kernel(-axc*axc)*erfcx);
+  }
+  out = select(negative, -out, out);
+  return select(x != x, x, out);
+}
@@ -3,6 +3,7 @@
 #include "MinimalFunctionals.h"
 #include "utilities.h"
 #include "handymath.h"
+#include "VectorMath.h"
 
 
 class WaterSaft_type : public FunctionalInterface {
@@ -44,7 +45,7 @@ double integral(const GridDescription &gd, double kT, const VectorXd &x) const {
 		const RelativeReciprocal rvec((xa>gd.Nx/2) ? xa - gd.Nx : xa, (y>gd.Ny/2) ? y - gd.Ny : y, z);
 		const Reciprocal k_i = gd.Lat.toReciprocal(rvec);
 		const complex t1 = sqrt(k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0]);
-		ktemp1[i] = ktemp0[i]*(25.132741228718345*R*sin(2.0*R*t1)*exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1*t1)/t1);
+		ktemp1[i] = ktemp0[i]*(25.132741228718345*R*sin(2.0*R*t1)*vm_exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1*t1)/t1);
 	}
 
 	VectorXd rtemp2(gd.NxNyNz);
@@ -65,7 +66,7 @@ double integral(const GridDescription &gd, double kT, const VectorXd &x) const {
 		const int xa = (n-y)/gd.Ny;
 		const RelativeReciprocal rvec((xa>gd.Nx/2) ? xa - gd.Nx : xa, (y>gd.Ny/2) ? y - gd.Ny : y, z);
 		const Reciprocal k_i = gd.Lat.toReciprocal(rvec);
-		ktemp3[i] = ktemp0[i]*exp(-4.0*R*R*lambda_dispersion*lambda_dispersion*length_scaling*length_scaling*(0.5*k_i[2]*k_i[2] + 0.5*k_i[1]*k_i[1] + 0.5*k_i[0]*k_i[0]));
+		ktemp3[i] = ktemp0[i]*vm_exp(-4.0*R*R*lambda_dispersion*lambda_dispersion*length_scaling*length_scaling*(0.5*k_i[2]*k_i[2] + 0.5*k_i[1]*k_i[1] + 0.5*k_i[0]*k_i[0]));
 	}
 
 	VectorXd rtemp4(gd.NxNyNz);
@@ -87,7 +88,7 @@ double integral(const GridDescription &gd, double kT, const VectorXd &x) const {
 		const RelativeReciprocal rvec((xa>gd.Nx/2) ? xa - gd.Nx : xa, (y>gd.Ny/2) ? y - gd.Ny : y, z);
 		const Reciprocal k_i = gd.Lat.toReciprocal(rvec);
 		const complex t1 = sqrt(k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0]);
-		ktemp5[i] = ktemp0[i]*(25.132741228718345*R*sin(2.0*R*t1)*exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1*t1)/t1);
+		ktemp5[i] = ktemp0[i]*(25.132741228718345*R*sin(2.0*R*t1)*vm_exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1*t1)/t1);
 	}
 
 	VectorXd rtemp6(gd.NxNyNz);
@@ -109,7 +110,7 @@ double integral(const GridDescription &gd, double kT, const VectorXd &x) const {
 		const RelativeReciprocal rvec((xa>gd.Nx/2) ? xa - gd.Nx : xa, (y>gd.Ny/2) ? y - gd.Ny : y, z);
 		const Reciprocal k_i = gd.Lat.toReciprocal(rvec);
 		const complex t1 = sqrt(k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0]);
-		ktemp7[i] = ktemp0[i]*(12.566370614359172*R*sin(R*t1)*exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1*t1)/t1);
+		ktemp7[i] = ktemp0[i]*(12.566370614359172*R*sin(R*t1)*vm_exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1*t1)/t1);
 	}
 
 	VectorXd rtemp8(gd.NxNyNz);
@@ -132,7 +133,7 @@ double integral(const GridDescription &gd, double kT, const VectorXd &x) const {
 		const Reciprocal k_i = gd.Lat.toReciprocal(rvec);
 		const complex t1 = k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0];
 		const complex t2 = R*sqrt(t1);
-		ktemp9[i] = ktemp0[i]*(12.566370614359172*exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1)*(-1.0*t2*cos(t2) + sin(t2))/(sqrt(t1)*t1));
+		ktemp9[i] = ktemp0[i]*(12.566370614359172*vm_exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1)*(-1.0*t2*cos(t2) + sin(t2))/(sqrt(t1)*t1));
 	}
 
 	VectorXd rtemp10(gd.NxNyNz);
@@ -158,7 +159,7 @@ double integral(const GridDescription &gd, double kT, const VectorXd &x) const {
 		const Reciprocal k_i = gd.Lat.toReciprocal(rvec);
 		const complex t1 = k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0];
 		const complex t2 = R*sqrt(t1);
-		ktemp13[i] = ktemp0[i]*(12.566370614359172*complex(0,1)*k_i[0]*exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1)*(-1.0*sin(t2)/(sqrt(t1)) + R*cos(t2))/t1);
+		ktemp13[i] = ktemp0[i]*(12.566370614359172*complex(0,1)*k_i[0]*vm_exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1)*(-1.0*sin(t2)/(sqrt(t1)) + R*cos(t2))/t1);
 	}
 
 	VectorXd rtemp14(gd.NxNyNz);
@@ -185,7 +186,7 @@ double integral(const GridDescription &gd, double kT, const VectorXd &x) const {
 		const Reciprocal k_i = gd.Lat.toReciprocal(rvec);
 		const complex t1 = k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0];
 		const complex t2 = R*sqrt(t1);
-		ktemp17[i] = ktemp0[i]*(12.566370614359172*complex(0,1)*k_i[1]*exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1)*(-1.0*sin(t2)/(sqrt(t1)) + R*cos(t2))/t1);
+		ktemp17[i] = ktemp0[i]*(12.566370614359172*complex(0,1)*k_i[1]*vm_exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1)*(-1.0*sin(t2)/(sqrt(t1)) + R*cos(t2))/t1);
 	}
 
 	VectorXd rtemp18(gd.NxNyNz);
@@ -211,7 +212,7 @@ double integral(const GridDescription &gd, double kT, const VectorXd &x) const {
 		const Reciprocal k_i = gd.Lat.toReciprocal(rvec);
 		const complex t1 = k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0];
 		const complex t2 = R*sqrt(t1);
-		ktemp0[i] = ktemp0[i]*(12.566370614359172*complex(0,1)*k_i[2]*exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1)*(-1.0*sin(t2)/(sqrt(t1)) + R*cos(t2))/t1);
+		ktemp0[i] = ktemp0[i]*(12.566370614359172*complex(0,1)*k_i[2]*vm_exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1)*(-1.0*sin(t2)/(sqrt(t1)) + R*cos(t2))/t1);
 	}
 
 	VectorXd rtemp22(gd.NxNyNz);
@@ -229,7 +230,7 @@ double integral(const GridDescription &gd, double kT, const VectorXd &x) const {
 	rtemp23.resize(0); // Realspace
 	VectorXd rtemp25(gd.NxNyNz);
 	for (int i=0; i<gd.NxNyNz; i++) {
-		rtemp25[i] = -1.0*log(1 + -1.0*rtemp10[i]);
+		rtemp25[i] = -1.0*vm_log(1 + -1.0*rtemp10[i]);
 	}
 
 	VectorXcd ktemp26(gd.NxNyNzOver2);
@@ -243,7 +244,7 @@ double integral(const GridDescription &gd, double kT, const VectorXd &x) const {
 		const double t5 = rtemp8[i]*rtemp8[i];
 		const double t6 = 1/t1;
 		const double t7 = 1/rtemp10[i];
-		rtemp25[i] = t7*t7*rtemp11[i]*(t5 + -3.0*t4 + -3.0*t3 + -3.0*t2)*(t6*((-1.768388256576615e-2*t7 + 1.768388256576615e-2*t6)*(log(t1)/(t6*t6) + rtemp10[i]) + 8.841941282883075e-3) + -8.841941282883075e-3*1 + 1.768388256576615e-2*rtemp25[i]) + t6*(t6*(7.957747154594767e-2*t5 + -7.957747154594767e-2*t4 + -7.957747154594767e-2*t3 + -7.957747154594767e-2*t2) + 7.957747154594767e-2*rtemp8[i]/R)/R;
+		rtemp25[i] = t7*t7*rtemp11[i]*(t5 + -3.0*t4 + -3.0*t3 + -3.0*t2)*(t6*((-1.768388256576615e-2*t7 + 1.768388256576615e-2*t6)*(vm_log(t1)/(t6*t6) + rtemp10[i]) + 8.841941282883075e-3) + -8.841941282883075e-3*1 + 1.768388256576615e-2*rtemp25[i]) + t6*(t6*(7.957747154594767e-2*t5 + -7.957747154594767e-2*t4 + -7.957747154594767e-2*t3 + -7.957747154594767e-2*t2) + 7.957747154594767e-2*rtemp8[i]/R)/R;
 	}
 
 	VectorXcd ktemp28(gd.NxNyNzOver2);
@@ -253,7 +254,7 @@ double integral(const GridDescription &gd, double kT, const VectorXd &x) const {
 	VectorXd rtemp29(gd.NxNyNz);
 	for (int i=0; i<gd.NxNyNz; i++) {
 		const double t1 = 1 + -1.0*rtemp10[i];
-		rtemp29[i] = ((t1*t1*log(t1) + rtemp10[i])*(2.6525823848649224e-2*rtemp8[i]*rtemp8[i] + -2.6525823848649224e-2*rtemp22[i]*rtemp22[i] + -2.6525823848649224e-2*rtemp18[i]*rtemp18[i] + -2.6525823848649224e-2*rtemp14[i]*rtemp14[i])/(t1*rtemp10[i]*rtemp10[i]) + 7.957747154594767e-2*rtemp8[i]/R)/t1;
+		rtemp29[i] = ((t1*t1*vm_log(t1) + rtemp10[i])*(2.6525823848649224e-2*rtemp8[i]*rtemp8[i] + -2.6525823848649224e-2*rtemp22[i]*rtemp22[i] + -2.6525823848649224e-2*rtemp18[i]*rtemp18[i] + -2.6525823848649224e-2*rtemp14[i]*rtemp14[i])/(t1*rtemp10[i]*rtemp10[i]) + 7.957747154594767e-2*rtemp8[i]/R)/t1;
 	}
 
 	VectorXcd ktemp30(gd.NxNyNzOver2);
@@ -274,7 +275,7 @@ double integral(const GridDescription &gd, double kT, const VectorXd &x) const {
 		const RelativeReciprocal rvec((xa>gd.Nx/2) ? xa - gd.Nx : xa, (y>gd.Ny/2) ? y - gd.Ny : y, z);
 		const Reciprocal k_i = gd.Lat.toReciprocal(rvec);
 		const complex t1 = sin(R*sqrt(k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0]));
-		const complex t2 = exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*(k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0]));
+		const complex t2 = vm_exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*(k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0]));
 		const complex t3 = 1/(sqrt(k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0]));
 		const complex t4 = t1*t3;
 		ktemp30[i] = -1.0*ktemp30[i]*(12.566370614359172*t2*(-1.0*R*cos(R/t3) + -1.0*t4)) + ktemp28[i]*(12.566370614359172*R*t2*t4);
@@ -284,7 +285,7 @@ double integral(const GridDescription &gd, double kT, const VectorXd &x) const {
 	VectorXd rtemp32(gd.NxNyNz);
 	for (int i=0; i<gd.NxNyNz; i++) {
 		const double t1 = 1 + -1.0*rtemp10[i];
-		rtemp32[i] = rtemp14[i]*(-5.305164769729845e-2*rtemp11[i]*(t1*t1*log(t1) + rtemp10[i])/(rtemp10[i]*rtemp10[i]) + -7.957747154594767e-2*1/R)/t1;
+		rtemp32[i] = rtemp14[i]*(-5.305164769729845e-2*rtemp11[i]*(t1*t1*vm_log(t1) + rtemp10[i])/(rtemp10[i]*rtemp10[i]) + -7.957747154594767e-2*1/R)/t1;
 	}
 
 	VectorXcd ktemp33(gd.NxNyNzOver2);
@@ -305,14 +306,14 @@ double integral(const GridDescription &gd, double kT, const VectorXd &x) const {
 		const RelativeReciprocal rvec((xa>gd.Nx/2) ? xa - gd.Nx : xa, (y>gd.Ny/2) ? y - gd.Ny : y, z);
 		const Reciprocal k_i = gd.Lat.toReciprocal(rvec);
 		const complex t1 = sqrt(k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0]);
-		ktemp33[i] = ktemp33[i]*(12.566370614359172*R*complex(0,1)*k_i[0]*sin(R*t1)*exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1*t1)/t1) + ktemp30[i];
+		ktemp33[i] = ktemp33[i]*(12.566370614359172*R*complex(0,1)*k_i[0]*sin(R*t1)*vm_exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1*t1)/t1) + ktemp30[i];
 	}
 
 	ktemp30.resize(0); // KSpace
 	VectorXd rtemp35(gd.NxNyNz);
 	for (int i=0; i<gd.NxNyNz; i++) {
 		const double t1 = 1 + -1.0*rtemp10[i];
-		rtemp35[i] = rtemp18[i]*(-5.305164769729845e-2*rtemp11[i]*(t1*t1*log(t1) + rtemp10[i])/(rtemp10[i]*rtemp10[i]) + -7.957747154594767e-2*1/R)/t1;
+		rtemp35[i] = rtemp18[i]*(-5.305164769729845e-2*rtemp11[i]*(t1*t1*vm_log(t1) + rtemp10[i])/(rtemp10[i]*rtemp10[i]) + -7.957747154594767e-2*1/R)/t1;
 	}
 
 	VectorXcd ktemp36(gd.NxNyNzOver2);
@@ -333,13 +334,13 @@ double integral(const GridDescription &gd, double kT, const VectorXd &x) const {
 		const RelativeReciprocal rvec((xa>gd.Nx/2) ? xa - gd.Nx : xa, (y>gd.Ny/2) ? y - gd.Ny : y, z);
 		const Reciprocal k_i = gd.Lat.toReciprocal(rvec);
 		const complex t1 = sqrt(k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0]);
-		ktemp36[i] = ktemp36[i]*(12.566370614359172*R*complex(0,1)*k_i[1]*sin(R*t1)*exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1*t1)/t1) + ktemp33[i];
+		ktemp36[i] = ktemp36[i]*(12.566370614359172*R*complex(0,1)*k_i[1]*sin(R*t1)*vm_exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1*t1)/t1) + ktemp33[i];
 	}
 
 	ktemp33.resize(0); // KSpace
 	for (int i=0; i<gd.NxNyNz; i++) {
 		const double t1 = 1 + -1.0*rtemp10[i];
-		rtemp11[i] = rtemp22[i]*(-5.305164769729845e-2*rtemp11[i]*(t1*t1*log(t1) + rtemp10[i])/(rtemp10[i]*rtemp10[i]) + -7.957747154594767e-2*1/R)/t1;
+		rtemp11[i] = rtemp22[i]*(-5.305164769729845e-2*rtemp11[i]*(t1*t1*vm_log(t1) + rtemp10[i])/(rtemp10[i]*rtemp10[i]) + -7.957747154594767e-2*1/R)/t1;
 	}
 
 	VectorXcd ktemp39(gd.NxNyNzOver2);
@@ -360,7 +361,7 @@ double integral(const GridDescription &gd, double kT, const VectorXd &x) const {
 		const RelativeReciprocal rvec((xa>gd.Nx/2) ? xa - gd.Nx : xa, (y>gd.Ny/2) ? y - gd.Ny : y, z);
 		const Reciprocal k_i = gd.Lat.toReciprocal(rvec);
 		const complex t1 = sqrt(k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0]);
-		ktemp39[i] = ktemp39[i]*(12.566370614359172*R*complex(0,1)*k_i[2]*sin(R*t1)*exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1*t1)/t1) + ktemp36[i];
+		ktemp39[i] = ktemp39[i]*(12.566370614359172*R*complex(0,1)*k_i[2]*sin(R*t1)*vm_exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1*t1)/t1) + ktemp36[i];
 	}
 
 	ktemp36.resize(0); // KSpace
@@ -377,8 +378,8 @@ double integral(const GridDescription &gd, double kT, const VectorXd &x) const {
 		const int xa = (n-y)/gd.Ny;
 		const RelativeReciprocal rvec((xa>gd.Nx/2) ? xa - gd.Nx : xa, (y>gd.Ny/2) ? y - gd.Ny : y, z);
 		const Reciprocal k_i = gd.Lat.toReciprocal(rvec);
-		const complex t1 = 12.566370614359172*R*sin(R*sqrt(k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0]))*exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*(k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0]))/(sqrt(k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0]));
-		const complex t2 = exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*(k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0]));
+		const complex t1 = 12.566370614359172*R*sin(R*sqrt(k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0]))*vm_exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*(k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0]))/(sqrt(k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0]));
+		const complex t2 = vm_exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*(k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0]));
 		const complex t3 = -1.0*sin(R*sqrt(k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0]))/(sqrt(k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0])) + R*cos(R*sqrt(k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0]));
 		const complex t4 = k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0];
 		const complex t5 = 12.566370614359172*t2*(-1.0*sin(R*sqrt(t4))/(sqrt(t4)) + -1.0*R*cos(R*sqrt(t4)));
@@ -400,32 +401,28 @@ double integral(const GridDescription &gd, double kT, const VectorXd &x) const {
 	}
 
 	rtemp6.resize(0); // Realspace
-	double 	s44 = 0;
-	for (int i=0; i<gd.NxNyNz; i++) {
-		s44 += gd.dvolume*kT*x[i]*(-6.283185307179586*R*R*(sqrt(0.15915494309189535*kappa_association*rtemp2[i]*(0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp4[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -0.5*lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp4[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(4.1887902047863905*rtemp4[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + R*R*R*rtemp4[i]*rtemp4[i]*(73.49635953848843*R*R*R*rtemp4[i]*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -2.0943951023931953*rtemp4[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp4[i]*rtemp4[i]*(73.49635953848843*R*R*R*rtemp4[i]*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)))/kT + rtemp42[i])*(-1.0*1 + exp(epsilon_association/kT))/(R*R) + 1) + -1.0)/(kappa_association*rtemp2[i]*(0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp4[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -0.5*lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp4[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(4.1887902047863905*rtemp4[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + R*R*R*rtemp4[i]*rtemp4[i]*(73.49635953848843*R*R*R*rtemp4[i]*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -2.0943951023931953*rtemp4[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp4[i]*rtemp4[i]*(73.49635953848843*R*R*R*rtemp4[i]*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)))/kT + rtemp42[i])*(-1.0*1 + exp(epsilon_association/kT))) + 0.5*1 + log(12.566370614359172*R*R*(sqrt(0.15915494309189535*kappa_association*rtemp2[i]*(0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp4[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -0.5*lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp4[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(4.1887902047863905*rtemp4[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + R*R*R*rtemp4[i]*rtemp4[i]*(73.49635953848843*R*R*R*rtemp4[i]*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -2.0943951023931953*rtemp4[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp4[i]*rtemp4[i]*(73.49635953848843*R*R*R*rtemp4[i]*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)))/kT + rtemp42[i])*(-1.0*1 + exp(epsilon_association/kT))/(R*R) + 1) + -1.0)/(kappa_association*rtemp2[i]*(0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp4[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -0.5*lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp4[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(4.1887902047863905*rtemp4[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + R*R*R*rtemp4[i]*rtemp4[i]*(73.49635953848843*R*R*R*rtemp4[i]*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -2.0943951023931953*rtemp4[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp4[i]*rtemp4[i]*(73.49635953848843*R*R*R*rtemp4[i]*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)))/kT + rtemp42[i])*(-1.0*1 + exp(epsilon_association/kT)))));
-	}
+	double 	s44 = grid_sum_of(gd.NxNyNz, [&](long i) {
+		return gd.dvolume*kT*x[i]*(-6.283185307179586*R*R*(sqrt(0.15915494309189535*kappa_association*rtemp2[i]*(0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp4[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -0.5*lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp4[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(4.1887902047863905*rtemp4[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + R*R*R*rtemp4[i]*rtemp4[i]*(73.49635953848843*R*R*R*rtemp4[i]*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -2.0943951023931953*rtemp4[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp4[i]*rtemp4[i]*(73.49635953848843*R*R*R*rtemp4[i]*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)))/kT + rtemp42[i])*(-1.0*1 + vm_exp(epsilon_association/kT))/(R*R) + 1) + -1.0)/(kappa_association*rtemp2[i]*(0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp4[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -0.5*lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp4[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(4.1887902047863905*rtemp4[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + R*R*R*rtemp4[i]*rtemp4[i]*(73.49635953848843*R*R*R*rtemp4[i]*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -2.0943951023931953*rtemp4[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp4[i]*rtemp4[i]*(73.49635953848843*R*R*R*rtemp4[i]*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)))/kT + rtemp42[i])*(-1.0*1 + vm_exp(epsilon_association/kT))) + 0.5*1 + vm_log(12.566370614359172*R*R*(sqrt(0.15915494309189535*kappa_association*rtemp2[i]*(0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp4[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -0.5*lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp4[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(4.1887902047863905*rtemp4[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + R*R*R*rtemp4[i]*rtemp4[i]*(73.49635953848843*R*R*R*rtemp4[i]*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -2.0943951023931953*rtemp4[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp4[i]*rtemp4[i]*(73.49635953848843*R*R*R*rtemp4[i]*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)))/kT + rtemp42[i])*(-1.0*1 + vm_exp(epsilon_association/kT))/(R*R) + 1) + -1.0)/(kappa_association*rtemp2[i]*(0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp4[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -0.5*lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp4[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(4.1887902047863905*rtemp4[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + R*R*R*rtemp4[i]*rtemp4[i]*(73.49635953848843*R*R*R*rtemp4[i]*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -2.0943951023931953*rtemp4[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp4[i]*rtemp4[i]*(73.49635953848843*R*R*R*rtemp4[i]*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)))/kT + rtemp42[i])*(-1.0*1 + vm_exp(epsilon_association/kT)))));
+	});
 
 	rtemp42.resize(0); // Realspace
 	rtemp2.resize(0); // Realspace
 	Fassoc = 4.0*s44;
-	double 	s45 = 0;
-	for (int i=0; i<gd.NxNyNz; i++) {
-		s45 += R*R*R*epsilon_dispersion*gd.dvolume*rtemp4[i]*x[i]*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(-2.0943951023931953*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)/((-4.1887902047863905*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1));
-	}
+	double 	s45 = grid_sum_of(gd.NxNyNz, [&](long i) {
+		return R*R*R*epsilon_dispersion*gd.dvolume*rtemp4[i]*x[i]*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(-2.0943951023931953*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)/((-4.1887902047863905*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1));
+	});
 
 	a1integrated = -4.1887902047863905*s45;
-	double 	s46 = 0;
-	for (int i=0; i<gd.NxNyNz; i++) {
-		s46 += R*R*R*epsilon_dispersion*epsilon_dispersion*gd.dvolume*rtemp4[i]*x[i]*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp4[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -0.5*lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp4[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)*((-4.1887902047863905*R*R*R*rtemp4[i] + 1)*(-4.1887902047863905*R*R*R*rtemp4[i] + 1))*((-4.1887902047863905*R*R*R*rtemp4[i] + 1)*(-4.1887902047863905*R*R*R*rtemp4[i] + 1))/(kT*(4.0*(4.1887902047863905*R*R*R*rtemp4[i])*(4.1887902047863905*R*R*R*rtemp4[i]) + 16.755160819145562*R*R*R*rtemp4[i] + 1)*(-4.1887902047863905*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1));
-	}
+	double 	s46 = grid_sum_of(gd.NxNyNz, [&](long i) {
+		return R*R*R*epsilon_dispersion*epsilon_dispersion*gd.dvolume*rtemp4[i]*x[i]*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp4[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -0.5*lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp4[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)*((-4.1887902047863905*R*R*R*rtemp4[i] + 1)*(-4.1887902047863905*R*R*R*rtemp4[i] + 1))*((-4.1887902047863905*R*R*R*rtemp4[i] + 1)*(-4.1887902047863905*R*R*R*rtemp4[i] + 1))/(kT*(4.0*(4.1887902047863905*R*R*R*rtemp4[i])*(4.1887902047863905*R*R*R*rtemp4[i]) + 16.755160819145562*R*R*R*rtemp4[i] + 1)*(-4.1887902047863905*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1));
+	});
 
 	rtemp4.resize(0); // Realspace
 	a2integrated = 2.0943951023931953*s46;
 	Fdisp = a2integrated + a1integrated;
-	double 	s47 = 0;
-	for (int i=0; i<gd.NxNyNz; i++) {
-		s47 += gd.dvolume*kT*x[i]*(-1.0*1 + log(2.6464769766182683e-6*x[i]/(sqrt(kT)*kT)));
-	}
+	double 	s47 = grid_sum_of(gd.NxNyNz, [&](long i) {
+		return gd.dvolume*kT*x[i]*(-1.0*1 + vm_log(2.6464769766182683e-6*x[i]/(sqrt(kT)*kT)));
+	});
 
 	Fideal = s47;
 	for (int i=0; i<gd.NxNyNz; i++) {
@@ -438,19 +435,17 @@ double integral(const GridDescription &gd, double kT, const VectorXd &x) const {
 	}
 
 	rtemp22.resize(0); // Realspace
-	double 	s50 = 0;
-	for (int i=0; i<gd.NxNyNz; i++) {
-		s50 += gd.dvolume*kT*(8.841941282883075e-3*rtemp8[i]*(log(1 + -1.0*rtemp10[i])*(1 + -1.0*rtemp10[i])*(1 + -1.0*rtemp10[i]) + rtemp10[i])*(rtemp8[i]*rtemp8[i] + 37.69911184307752*rtemp18[i])/(rtemp10[i]*rtemp10[i]*(1 + -1.0*rtemp10[i])*(1 + -1.0*rtemp10[i])) + ((7.957747154594767e-2*rtemp8[i]*rtemp8[i] + rtemp18[i])/(1 + -1.0*rtemp10[i]) + -7.957747154594767e-2*rtemp8[i]*log(1 + -1.0*rtemp10[i])/R)/R);
-	}
+	double 	s50 = grid_sum_of(gd.NxNyNz, [&](long i) {
+		return gd.dvolume*kT*(8.841941282883075e-3*rtemp8[i]*(vm_log(1 + -1.0*rtemp10[i])*(1 + -1.0*rtemp10[i])*(1 + -1.0*rtemp10[i]) + rtemp10[i])*(rtemp8[i]*rtemp8[i] + 37.69911184307752*rtemp18[i])/(rtemp10[i]*rtemp10[i]*(1 + -1.0*rtemp10[i])*(1 + -1.0*rtemp10[i])) + ((7.957747154594767e-2*rtemp8[i]*rtemp8[i] + rtemp18[i])/(1 + -1.0*rtemp10[i]) + -7.957747154594767e-2*rtemp8[i]*vm_log(1 + -1.0*rtemp10[i])/R)/R);
+	});
 
 	rtemp18.resize(0); // Realspace
 	rtemp10.resize(0); // Realspace
 	rtemp8.resize(0); // Realspace
 	whitebear = s50;
-	double 	s51 = 0;
-	for (int i=0; i<gd.NxNyNz; i++) {
-		s51 += gd.dvolume*mu*x[i];
-	}
+	double 	s51 = grid_sum_of(gd.NxNyNz, [&](long i) {
+		return gd.dvolume*mu*x[i];
+	});
 
 	FSAFT = whitebear + s51 + Fideal + Fdisp + Fassoc;
 	output = FSAFT;
@@ -471,7 +466,7 @@ double transform(double kT, double x) const {
 	}
 	double output = 0;
 		double 	n = x;
-	double 	boltz = -1.0*1 + exp(epsilon_association/kT);
+	double 	boltz = -1.0*1 + vm_exp(epsilon_association/kT);
 	double 	deltak = 12.566370614359172*R*R;
 	double 	n1 = 7.957747154594767e-2*deltak*n/R;
 	double 	step = 4.188790204786391*R*R*R;
@@ -485,22 +480,22 @@ double transform(double kT, double x) const {
 	double 	deltaz = 0;
 	double 	n2vz = deltaz*n;
 	double 	n2vsqr = n2vz*n2vz + n2vy*n2vy + n2vx*n2vx;
-	double 	dphi3_by_dn2 = (n2vsqr*((log(1 + -1.0*n3)*(-2.6525823848649224e-2*1/n3 + 5.305164769729845e-2) + -2.6525823848649224e-2)/n3 + -2.6525823848649224e-2*log(1 + -1.0*n3)) + n2*n2*((log(1 + -1.0*n3)*(2.6525823848649224e-2*1/n3 + -5.305164769729845e-2) + 2.6525823848649224e-2)/n3 + 2.6525823848649224e-2*log(1 + -1.0*n3)))/((1 + -1.0*n3)*(1 + -1.0*n3));
+	double 	dphi3_by_dn2 = (n2vsqr*((vm_log(1 + -1.0*n3)*(-2.6525823848649224e-2*1/n3 + 5.305164769729845e-2) + -2.6525823848649224e-2)/n3 + -2.6525823848649224e-2*vm_log(1 + -1.0*n3)) + n2*n2*((vm_log(1 + -1.0*n3)*(2.6525823848649224e-2*1/n3 + -5.305164769729845e-2) + 2.6525823848649224e-2)/n3 + 2.6525823848649224e-2*vm_log(1 + -1.0*n3)))/((1 + -1.0*n3)*(1 + -1.0*n3));
 	double 	dphitot_by_dn2 = dphi3_by_dn2 + dphi2_by_dn2;
 	double 	dn1v_dot_n2v_by_dn2vx = 7.957747154594767e-2*deltax*n/R;
 	double 	dphi2_by_dn2vx = -1.0*dn1v_dot_n2v_by_dn2vx/(1 + -1.0*n3);
 	double 	dn2vsqr_by_dn2vx = 2.0*n2vx;
-	double 	dphi3_by_dn2vx = dn2vsqr_by_dn2vx*n2*((log(1 + -1.0*n3)*(-2.6525823848649224e-2*1/n3 + 5.305164769729845e-2) + -2.6525823848649224e-2)/n3 + -2.6525823848649224e-2*log(1 + -1.0*n3))/((1 + -1.0*n3)*(1 + -1.0*n3));
+	double 	dphi3_by_dn2vx = dn2vsqr_by_dn2vx*n2*((vm_log(1 + -1.0*n3)*(-2.6525823848649224e-2*1/n3 + 5.305164769729845e-2) + -2.6525823848649224e-2)/n3 + -2.6525823848649224e-2*vm_log(1 + -1.0*n3))/((1 + -1.0*n3)*(1 + -1.0*n3));
 	double 	dphitot_by_dn2vx = dphi3_by_dn2vx + dphi2_by_dn2vx;
 	double 	dn1v_dot_n2v_by_dn2vy = 7.957747154594767e-2*deltay*n/R;
 	double 	dphi2_by_dn2vy = -1.0*dn1v_dot_n2v_by_dn2vy/(1 + -1.0*n3);
 	double 	dn2vsqr_by_dn2vy = 2.0*n2vy;
-	double 	dphi3_by_dn2vy = dn2vsqr_by_dn2vy*n2*((log(1 + -1.0*n3)*(-2.6525823848649224e-2*1/n3 + 5.305164769729845e-2) + -2.6525823848649224e-2)/n3 + -2.6525823848649224e-2*log(1 + -1.0*n3))/((1 + -1.0*n3)*(1 + -1.0*n3));
+	double 	dphi3_by_dn2vy = dn2vsqr_by_dn2vy*n2*((vm_log(1 + -1.0*n3)*(-2.6525823848649224e-2*1/n3 + 5.305164769729845e-2) + -2.6525823848649224e-2)/n3 + -2.6525823848649224e-2*vm_log(1 + -1.0*n3))/((1 + -1.0*n3)*(1 + -1.0*n3));
 	double 	dphitot_by_dn2vy = dphi3_by_dn2vy + dphi2_by_dn2vy;
 	double 	dn1v_dot_n2v_by_dn2vz = 7.957747154594767e-2*deltaz*n/R;
 	double 	dphi2_by_dn2vz = -1.0*dn1v_dot_n2v_by_dn2vz/(1 + -1.0*n3);
 	double 	dn2vsqr_by_dn2vz = 2.0*n2vz;
-	double 	dphi3_by_dn2vz = dn2vsqr_by_dn2vz*n2*((log(1 + -1.0*n3)*(-2.6525823848649224e-2*1/n3 + 5.305164769729845e-2) + -2.6525823848649224e-2)/n3 + -2.6525823848649224e-2*log(1 + -1.0*n3))/((1 + -1.0*n3)*(1 + -1.0*n3));
+	double 	dphi3_by_dn2vz = dn2vsqr_by_dn2vz*n2*((vm_log(1 + -1.0*n3)*(-2.6525823848649224e-2*1/n3 + 5.305164769729845e-2) + -2.6525823848649224e-2)/n3 + -2.6525823848649224e-2*vm_log(1 + -1.0*n3))/((1 + -1.0*n3)*(1 + -1.0*n3));
 	double 	dphitot_by_dn2vz = dphi3_by_dn2vz + dphi2_by_dn2vz;
 	double 	n0 = 7.957747154594767e-2*deltak*n/(R*R);
 	double 	dphi1_by_dn3 = n0/(1 + -1.0*n3);
@@ -509,9 +504,9 @@ double transform(double kT, double x) const {
 	double 	n1vz = 7.957747154594767e-2*deltaz*n/R;
 	double 	n1v_dot_n2v = n1vz*n2vz + n1vy*n2vy + n1vx*n2vx;
 	double 	dphi2_by_dn3 = (n1*n2 + -1.0*n1v_dot_n2v)/((1 + -1.0*n3)*(1 + -1.0*n3));
-	double 	dphi3_by_dn3 = n2*(n2vsqr*(-5.305164769729845e-2*log(1 + -1.0*n3)/((1 + -1.0*n3)*(1 + -1.0*n3)) + ((-5.305164769729845e-2*1/(1 + -1.0*n3) + log(1 + -1.0*n3)*(0.1061032953945969*1/(1 + -1.0*n3) + 5.305164769729845e-2))/(1 + -1.0*n3) + (2.6525823848649224e-2*1/(1 + -1.0*n3) + log(1 + -1.0*n3)*((-5.305164769729845e-2*1/(1 + -1.0*n3) + 5.305164769729845e-2*1/n3 + -0.1061032953945969)/(1 + -1.0*n3) + 5.305164769729845e-2) + 2.6525823848649224e-2)/n3)/n3) + n2*n2*(1.768388256576615e-2*log(1 + -1.0*n3)/((1 + -1.0*n3)*(1 + -1.0*n3)) + ((1.768388256576615e-2*1/(1 + -1.0*n3) + log(1 + -1.0*n3)*(-3.53677651315323e-2*1/(1 + -1.0*n3) + -1.768388256576615e-2))/(1 + -1.0*n3) + (-8.841941282883075e-3*1/(1 + -1.0*n3) + log(1 + -1.0*n3)*((1.768388256576615e-2*1/(1 + -1.0*n3) + -1.768388256576615e-2*1/n3 + 3.53677651315323e-2)/(1 + -1.0*n3) + -1.768388256576615e-2) + -8.841941282883075e-3)/n3)/n3))/(1 + -1.0*n3);
+	double 	dphi3_by_dn3 = n2*(n2vsqr*(-5.305164769729845e-2*vm_log(1 + -1.0*n3)/((1 + -1.0*n3)*(1 + -1.0*n3)) + ((-5.305164769729845e-2*1/(1 + -1.0*n3) + vm_log(1 + -1.0*n3)*(0.1061032953945969*1/(1 + -1.0*n3) + 5.305164769729845e-2))/(1 + -1.0*n3) + (2.6525823848649224e-2*1/(1 + -1.0*n3) + vm_log(1 + -1.0*n3)*((-5.305164769729845e-2*1/(1 + -1.0*n3) + 5.305164769729845e-2*1/n3 + -0.1061032953945969)/(1 + -1.0*n3) + 5.305164769729845e-2) + 2.6525823848649224e-2)/n3)/n3) + n2*n2*(1.768388256576615e-2*vm_log(1 + -1.0*n3)/((1 + -1.0*n3)*(1 + -1.0*n3)) + ((1.768388256576615e-2*1/(1 + -1.0*n3) + vm_log(1 + -1.0*n3)*(-3.53677651315323e-2*1/(1 + -1.0*n3) + -1.768388256576615e-2))/(1 + -1.0*n3) + (-8.841941282883075e-3*1/(1 + -1.0*n3) + vm_log(1 + -1.0*n3)*((1.768388256576615e-2*1/(1 + -1.0*n3) + -1.768388256576615e-2*1/n3 + 3.53677651315323e-2)/(1 + -1.0*n3) + -1.768388256576615e-2) + -8.841941282883075e-3)/n3)/n3))/(1 + -1.0*n3);
 	double 	dphitot_by_dn3 = dphi3_by_dn3 + dphi2_by_dn3 + dphi1_by_dn3;
-	double 	dphitot_by_dn0 = -1.0*log(1 + -1.0*n3);
+	double 	dphitot_by_dn0 = -1.0*vm_log(1 + -1.0*n3);
 	double 	dphitot_by_dn1 = n2/(1 + -1.0*n3);
 	double 	dn1v_dot_n2v_by_dn1vx = n2vx;
 	double 	dphitot_by_dn1vx = -1.0*dn1v_dot_n2v_by_dn1vx/(1 + -1.0*n3);
@@ -546,7 +541,7 @@ double transform(double kT, double x) const {
 	double 	delta2k = 50.26548245743669*R*R;
 	double 	nA = 1.9894367886486918e-2*delta2k*n/(R*R);
 	double 	X = (0.25*sqrt(8.0*deltasaft*nA + 1) + -0.25)/(deltasaft*nA);
-	double 	Fassoc = kT*n*(2.0*1 + 4.0*log(X) + -2.0*X);
+	double 	Fassoc = kT*n*(2.0*1 + 4.0*vm_log(X) + -2.0*X);
 	double 	a1 = epsilon_dispersion*eta_d*ghs*(-4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + 4.0);
 	double 	a1integrated = a1*n;
 	double 	KHS = (eta_d*(eta_d*(eta_d*(-4.0*1 + eta_d) + 6.0) + -4.0) + 1)/(eta_d*(4.0*1 + 4.0*eta_d) + 1);
@@ -555,10 +550,10 @@ double transform(double kT, double x) const {
 	double 	Fdisp = a2integrated + a1integrated;
 	double 	gpermol = 1822.8885;
 	double 	mH2O = 18.01528*gpermol;
-	double 	Fideal = kT*n*(-1.0*1 + log(15.74960994572242*n/(sqrt(kT)*kT*sqrt(mH2O)*mH2O)));
-	double 	phi1 = -1.0*n0*log(1 + -1.0*n3);
+	double 	Fideal = kT*n*(-1.0*1 + vm_log(15.74960994572242*n/(sqrt(kT)*kT*sqrt(mH2O)*mH2O)));
+	double 	phi1 = -1.0*n0*vm_log(1 + -1.0*n3);
 	double 	phi2 = (n1*n2 + -1.0*n1v_dot_n2v)/(1 + -1.0*n3);
-	double 	phi3 = n2*(n2vsqr*((log(1 + -1.0*n3)*(-2.6525823848649224e-2*1/n3 + 5.305164769729845e-2) + -2.6525823848649224e-2)/n3 + -2.6525823848649224e-2*log(1 + -1.0*n3)) + n2*n2*((log(1 + -1.0*n3)*(8.841941282883075e-3*1/n3 + -1.768388256576615e-2) + 8.841941282883075e-3)/n3 + 8.841941282883075e-3*log(1 + -1.0*n3)))/((1 + -1.0*n3)*(1 + -1.0*n3));
+	double 	phi3 = n2*(n2vsqr*((vm_log(1 + -1.0*n3)*(-2.6525823848649224e-2*1/n3 + 5.305164769729845e-2) + -2.6525823848649224e-2)/n3 + -2.6525823848649224e-2*vm_log(1 + -1.0*n3)) + n2*n2*((vm_log(1 + -1.0*n3)*(8.841941282883075e-3*1/n3 + -1.768388256576615e-2) + 8.841941282883075e-3)/n3 + 8.841941282883075e-3*vm_log(1 + -1.0*n3)))/((1 + -1.0*n3)*(1 + -1.0*n3));
 	double 	whitebear = kT*(phi3 + phi2 + phi1);
 	double 	FSAFT = mu*n + whitebear + Fideal + Fdisp + Fassoc;
 	output = FSAFT;
@@ -576,7 +571,7 @@ double derive(double kT, double x) const {
 
 	}
 	double output = 0;
-	double 	boltz = -1.0*1 + exp(epsilon_association/kT);
+	double 	boltz = -1.0*1 + vm_exp(epsilon_association/kT);
 	double 	n = x;
 	double 	deltak = 12.566370614359172*R*R;
 	double 	n1 = 7.957747154594767e-2*deltak*n/R;
@@ -591,22 +586,22 @@ double derive(double kT, double x) const {
 	double 	deltaz = 0;
 	double 	n2vz = deltaz*n;
 	double 	n2vsqr = n2vz*n2vz + n2vy*n2vy + n2vx*n2vx;
-	double 	dphi3_by_dn2 = (n2vsqr*((log(1 + -1.0*n3)*(-2.6525823848649224e-2*1/n3 + 5.305164769729845e-2) + -2.6525823848649224e-2)/n3 + -2.6525823848649224e-2*log(1 + -1.0*n3)) + n2*n2*((log(1 + -1.0*n3)*(2.6525823848649224e-2*1/n3 + -5.305164769729845e-2) + 2.6525823848649224e-2)/n3 + 2.6525823848649224e-2*log(1 + -1.0*n3)))/((1 + -1.0*n3)*(1 + -1.0*n3));
+	double 	dphi3_by_dn2 = (n2vsqr*((vm_log(1 + -1.0*n3)*(-2.6525823848649224e-2*1/n3 + 5.305164769729845e-2) + -2.6525823848649224e-2)/n3 + -2.6525823848649224e-2*vm_log(1 + -1.0*n3)) + n2*n2*((vm_log(1 + -1.0*n3)*(2.6525823848649224e-2*1/n3 + -5.305164769729845e-2) + 2.6525823848649224e-2)/n3 + 2.6525823848649224e-2*vm_log(1 + -1.0*n3)))/((1 + -1.0*n3)*(1 + -1.0*n3));
 	double 	dphitot_by_dn2 = dphi3_by_dn2 + dphi2_by_dn2;
 	double 	dn1v_dot_n2v_by_dn2vx = 7.957747154594767e-2*deltax*n/R;
 	double 	dphi2_by_dn2vx = -1.0*dn1v_dot_n2v_by_dn2vx/(1 + -1.0*n3);
 	double 	dn2vsqr_by_dn2vx = 2.0*n2vx;
-	double 	dphi3_by_dn2vx = dn2vsqr_by_dn2vx*n2*((log(1 + -1.0*n3)*(-2.6525823848649224e-2*1/n3 + 5.305164769729845e-2) + -2.6525823848649224e-2)/n3 + -2.6525823848649224e-2*log(1 + -1.0*n3))/((1 + -1.0*n3)*(1 + -1.0*n3));
+	double 	dphi3_by_dn2vx = dn2vsqr_by_dn2vx*n2*((vm_log(1 + -1.0*n3)*(-2.6525823848649224e-2*1/n3 + 5.305164769729845e-2) + -2.6525823848649224e-2)/n3 + -2.6525823848649224e-2*vm_log(1 + -1.0*n3))/((1 + -1.0*n3)*(1 + -1.0*n3));
 	double 	dphitot_by_dn2vx = dphi3_by_dn2vx + dphi2_by_dn2vx;
 	double 	dn1v_dot_n2v_by_dn2vy = 7.957747154594767e-2*deltay*n/R;
 	double 	dphi2_by_dn2vy = -1.0*dn1v_dot_n2v_by_dn2vy/(1 + -1.0*n3);
 	double 	dn2vsqr_by_dn2vy = 2.0*n2vy;
-	double 	dphi3_by_dn2vy = dn2vsqr_by_dn2vy*n2*((log(1 + -1.0*n3)*(-2.6525823848649224e-2*1/n3 + 5.305164769729845e-2) + -2.6525823848649224e-2)/n3 + -2.6525823848649224e-2*log(1 + -1.0*n3))/((1 + -1.0*n3)*(1 + -1.0*n3));
+	double 	dphi3_by_dn2vy = dn2vsqr_by_dn2vy*n2*((vm_log(1 + -1.0*n3)*(-2.6525823848649224e-2*1/n3 + 5.305164769729845e-2) + -2.6525823848649224e-2)/n3 + -2.6525823848649224e-2*vm_log(1 + -1.0*n3))/((1 + -1.0*n3)*(1 + -1.0*n3));
 	double 	dphitot_by_dn2vy = dphi3_by_dn2vy + dphi2_by_dn2vy;
 	double 	dn1v_dot_n2v_by_dn2vz = 7.957747154594767e-2*deltaz*n/R;
 	double 	dphi2_by_dn2vz = -1.0*dn1v_dot_n2v_by_dn2vz/(1 + -1.0*n3);
 	double 	dn2vsqr_by_dn2vz = 2.0*n2vz;
-	double 	dphi3_by_dn2vz = dn2vsqr_by_dn2vz*n2*((log(1 + -1.0*n3)*(-2.6525823848649224e-2*1/n3 + 5.305164769729845e-2) + -2.6525823848649224e-2)/n3 + -2.6525823848649224e-2*log(1 + -1.0*n3))/((1 + -1.0*n3)*(1 + -1.0*n3));
+	double 	dphi3_by_dn2vz = dn2vsqr_by_dn2vz*n2*((vm_log(1 + -1.0*n3)*(-2.6525823848649224e-2*1/n3 + 5.305164769729845e-2) + -2.6525823848649224e-2)/n3 + -2.6525823848649224e-2*vm_log(1 + -1.0*n3))/((1 + -1.0*n3)*(1 + -1.0*n3));
 	double 	dphitot_by_dn2vz = dphi3_by_dn2vz + dphi2_by_dn2vz;
 	double 	n0 = 7.957747154594767e-2*deltak*n/(R*R);
 	double 	dphi1_by_dn3 = n0/(1 + -1.0*n3);
@@ -615,9 +610,9 @@ double derive(double kT, double x) const {
 	double 	n1vz = 7.957747154594767e-2*deltaz*n/R;
 	double 	n1v_dot_n2v = n1vz*n2vz + n1vy*n2vy + n1vx*n2vx;
 	double 	dphi2_by_dn3 = (n1*n2 + -1.0*n1v_dot_n2v)/((1 + -1.0*n3)*(1 + -1.0*n3));
-	double 	dphi3_by_dn3 = n2*(n2vsqr*(-5.305164769729845e-2*log(1 + -1.0*n3)/((1 + -1.0*n3)*(1 + -1.0*n3)) + ((-5.305164769729845e-2*1/(1 + -1.0*n3) + log(1 + -1.0*n3)*(0.1061032953945969*1/(1 + -1.0*n3) + 5.305164769729845e-2))/(1 + -1.0*n3) + (2.6525823848649224e-2*1/(1 + -1.0*n3) + log(1 + -1.0*n3)*((-5.305164769729845e-2*1/(1 + -1.0*n3) + 5.305164769729845e-2*1/n3 + -0.1061032953945969)/(1 + -1.0*n3) + 5.305164769729845e-2) + 2.6525823848649224e-2)/n3)/n3) + n2*n2*(1.768388256576615e-2*log(1 + -1.0*n3)/((1 + -1.0*n3)*(1 + -1.0*n3)) + ((1.768388256576615e-2*1/(1 + -1.0*n3) + log(1 + -1.0*n3)*(-3.53677651315323e-2*1/(1 + -1.0*n3) + -1.768388256576615e-2))/(1 + -1.0*n3) + (-8.841941282883075e-3*1/(1 + -1.0*n3) + log(1 + -1.0*n3)*((1.768388256576615e-2*1/(1 + -1.0*n3) + -1.768388256576615e-2*1/n3 + 3.53677651315323e-2)/(1 + -1.0*n3) + -1.768388256576615e-2) + -8.841941282883075e-3)/n3)/n3))/(1 + -1.0*n3);
+	double 	dphi3_by_dn3 = n2*(n2vsqr*(-5.305164769729845e-2*vm_log(1 + -1.0*n3)/((1 + -1.0*n3)*(1 + -1.0*n3)) + ((-5.305164769729845e-2*1/(1 + -1.0*n3) + vm_log(1 + -1.0*n3)*(0.1061032953945969*1/(1 + -1.0*n3) + 5.305164769729845e-2))/(1 + -1.0*n3) + (2.6525823848649224e-2*1/(1 + -1.0*n3) + vm_log(1 + -1.0*n3)*((-5.305164769729845e-2*1/(1 + -1.0*n3) + 5.305164769729845e-2*1/n3 + -0.1061032953945969)/(1 + -1.0*n3) + 5.305164769729845e-2) + 2.6525823848649224e-2)/n3)/n3) + n2*n2*(1.768388256576615e-2*vm_log(1 + -1.0*n3)/((1 + -1.0*n3)*(1 + -1.0*n3)) + ((1.768388256576615e-2*1/(1 + -1.0*n3) + vm_log(1 + -1.0*n3)*(-3.53677651315323e-2*1/(1 + -1.0*n3) + -1.768388256576615e-2))/(1 + -1.0*n3) + (-8.841941282883075e-3*1/(1 + -1.0*n3) + vm_log(1 + -1.0*n3)*((1.768388256576615e-2*1/(1 + -1.0*n3) + -1.768388256576615e-2*1/n3 + 3.53677651315323e-2)/(1 + -1.0*n3) + -1.768388256576615e-2) + -8.841941282883075e-3)/n3)/n3))/(1 + -1.0*n3);
 	double 	dphitot_by_dn3 = dphi3_by_dn3 + dphi2_by_dn3 + dphi1_by_dn3;
-	double 	dphitot_by_dn0 = -1.0*log(1 + -1.0*n3);
+	double 	dphitot_by_dn0 = -1.0*vm_log(1 + -1.0*n3);
 	double 	dphitot_by_dn1 = n2/(1 + -1.0*n3);
 	double 	dn1v_dot_n2v_by_dn1vx = n2vx;
 	double 	dphitot_by_dn1vx = -1.0*dn1v_dot_n2v_by_dn1vx/(1 + -1.0*n3);
@@ -668,22 +663,22 @@ double derive(double kT, double x) const {
 	double 	dn2vy_by_dx = deltay;
 	double 	dn2vz_by_dx = deltaz;
 	double 	dn2vsqr_by_dx = 2.0*dn2vz_by_dx*n2vz + 2.0*dn2vy_by_dx*n2vy + 2.0*dn2vx_by_dx*n2vx;
-	double 	ddphi3_by_dn2_by_dx = 2.0*dn3_by_dx*(n2vsqr*((log(1 + -1.0*n3)*(-2.6525823848649224e-2*1/n3 + 5.305164769729845e-2) + -2.6525823848649224e-2)/n3 + -2.6525823848649224e-2*log(1 + -1.0*n3)) + n2*n2*((log(1 + -1.0*n3)*(2.6525823848649224e-2*1/n3 + -5.305164769729845e-2) + 2.6525823848649224e-2)/n3 + 2.6525823848649224e-2*log(1 + -1.0*n3)))/((1 + -1.0*n3)*(1 + -1.0*n3)*(1 + -1.0*n3)) + 2.6525823848649224e-2*dn3_by_dx*n2vsqr/((1 + -1.0*n3)*(1 + -1.0*n3)*(1 + -1.0*n3)) + -1.0*dn3_by_dx*n2vsqr*(-2.6525823848649224e-2*1/n3 + 5.305164769729845e-2)/(n3*(1 + -1.0*n3)*(1 + -1.0*n3)*(1 + -1.0*n3)) + -1.0*dn3_by_dx*n2vsqr*(log(1 + -1.0*n3)*(-2.6525823848649224e-2*1/n3 + 5.305164769729845e-2) + -2.6525823848649224e-2)/(n3*n3*(1 + -1.0*n3)*(1 + -1.0*n3)) + 2.6525823848649224e-2*dn3_by_dx*n2vsqr*log(1 + -1.0*n3)/(n3*n3*n3*(1 + -1.0*n3)*(1 + -1.0*n3)) + -2.6525823848649224e-2*dn3_by_dx*n2*n2/((1 + -1.0*n3)*(1 + -1.0*n3)*(1 + -1.0*n3)) + -1.0*dn3_by_dx*n2*n2*(2.6525823848649224e-2*1/n3 + -5.305164769729845e-2)/(n3*(1 + -1.0*n3)*(1 + -1.0*n3)*(1 + -1.0*n3)) + -1.0*dn3_by_dx*n2*n2*(log(1 + -1.0*n3)*(2.6525823848649224e-2*1/n3 + -5.305164769729845e-2) + 2.6525823848649224e-2)/(n3*n3*(1 + -1.0*n3)*(1 + -1.0*n3)) + -2.6525823848649224e-2*dn3_by_dx*n2*n2*log(1 + -1.0*n3)/(n3*n3*n3*(1 + -1.0*n3)*(1 + -1.0*n3)) + dn2vsqr_by_dx*((log(1 + -1.0*n3)*(-2.6525823848649224e-2*1/n3 + 5.305164769729845e-2) + -2.6525823848649224e-2)/n3 + -2.6525823848649224e-2*log(1 + -1.0*n3))/((1 + -1.0*n3)*(1 + -1.0*n3)) + 2.0*dn2_by_dx*n2*((log(1 + -1.0*n3)*(2.6525823848649224e-2*1/n3 + -5.305164769729845e-2) + 2.6525823848649224e-2)/n3 + 2.6525823848649224e-2*log(1 + -1.0*n3))/((1 + -1.0*n3)*(1 + -1.0*n3));
+	double 	ddphi3_by_dn2_by_dx = 2.0*dn3_by_dx*(n2vsqr*((vm_log(1 + -1.0*n3)*(-2.6525823848649224e-2*1/n3 + 5.305164769729845e-2) + -2.6525823848649224e-2)/n3 + -2.6525823848649224e-2*vm_log(1 + -1.0*n3)) + n2*n2*((vm_log(1 + -1.0*n3)*(2.6525823848649224e-2*1/n3 + -5.305164769729845e-2) + 2.6525823848649224e-2)/n3 + 2.6525823848649224e-2*vm_log(1 + -1.0*n3)))/((1 + -1.0*n3)*(1 + -1.0*n3)*(1 + -1.0*n3)) + 2.6525823848649224e-2*dn3_by_dx*n2vsqr/((1 + -1.0*n3)*(1 + -1.0*n3)*(1 + -1.0*n3)) + -1.0*dn3_by_dx*n2vsqr*(-2.6525823848649224e-2*1/n3 + 5.305164769729845e-2)/(n3*(1 + -1.0*n3)*(1 + -1.0*n3)*(1 + -1.0*n3)) + -1.0*dn3_by_dx*n2vsqr*(vm_log(1 + -1.0*n3)*(-2.6525823848649224e-2*1/n3 + 5.305164769729845e-2) + -2.6525823848649224e-2)/(n3*n3*(1 + -1.0*n3)*(1 + -1.0*n3)) + 2.6525823848649224e-2*dn3_by_dx*n2vsqr*vm_log(1 + -1.0*n3)/(n3*n3*n3*(1 + -1.0*n3)*(1 + -1.0*n3)) + -2.6525823848649224e-2*dn3_by_dx*n2*n2/((1 + -1.0*n3)*(1 + -1.0*n3)*(1 + -1.0*n3)) + -1.0*dn3_by_dx*n2*n2*(2.6525823848649224e-2*1/n3 + -5.305164769729845e-2)/(n3*(1 + -1.0*n3)*(1 + -1.0*n3)*(1 + -1.0*n3)) + -1.0*dn3_by_dx*n2*n2*(vm_log(1 + -1.0*n3)*(2.6525823848649224e-2*1/n3 + -5.305164769729845e-2) + 2.6525823848649224e-2)/(n3*n3*(1 + -1.0*n3)*(1 + -1.0*n3)) + -2.6525823848649224e-2*dn3_by_dx*n2*n2*vm_log(1 + -1.0*n3)/(n3*n3*n3*(1 + -1.0*n3)*(1 + -1.0*n3)) + dn2vsqr_by_dx*((vm_log(1 + -1.0*n3)*(-2.6525823848649224e-2*1/n3 + 5.305164769729845e-2) + -2.6525823848649224e-2)/n3 + -2.6525823848649224e-2*vm_log(1 + -1.0*n3))/((1 + -1.0*n3)*(1 + -1.0*n3)) + 2.0*dn2_by_dx*n2*((vm_log(1 + -1.0*n3)*(2.6525823848649224e-2*1/n3 + -5.305164769729845e-2) + 2.6525823848649224e-2)/n3 + 2.6525823848649224e-2*vm_log(1 + -1.0*n3))/((1 + -1.0*n3)*(1 + -1.0*n3));
 	double 	ddphitot_by_dn2_by_dx = ddphi3_by_dn2_by_dx + ddphi2_by_dn2_by_dx;
 	double 	ddn1v_dot_n2v_by_dn2vx_by_dx = 7.957747154594767e-2*deltax/R;
 	double 	ddphi2_by_dn2vx_by_dx = -1.0*dn1v_dot_n2v_by_dn2vx*dn3_by_dx/((1 + -1.0*n3)*(1 + -1.0*n3)) + -1.0*ddn1v_dot_n2v_by_dn2vx_by_dx/(1 + -1.0*n3);
 	double 	ddn2vsqr_by_dn2vx_by_dx = 2.0*dn2vx_by_dx;
-	double 	ddphi3_by_dn2vx_by_dx = 2.0*dn2vsqr_by_dn2vx*dn3_by_dx*n2*((log(1 + -1.0*n3)*(-2.6525823848649224e-2*1/n3 + 5.305164769729845e-2) + -2.6525823848649224e-2)/n3 + -2.6525823848649224e-2*log(1 + -1.0*n3))/((1 + -1.0*n3)*(1 + -1.0*n3)*(1 + -1.0*n3)) + 2.6525823848649224e-2*dn2vsqr_by_dn2vx*dn3_by_dx*n2/((1 + -1.0*n3)*(1 + -1.0*n3)*(1 + -1.0*n3)) + -1.0*dn2vsqr_by_dn2vx*dn3_by_dx*n2*(-2.6525823848649224e-2*1/n3 + 5.305164769729845e-2)/(n3*(1 + -1.0*n3)*(1 + -1.0*n3)*(1 + -1.0*n3)) + -1.0*dn2vsqr_by_dn2vx*dn3_by_dx*n2*(log(1 + -1.0*n3)*(-2.6525823848649224e-2*1/n3 + 5.305164769729845e-2) + -2.6525823848649224e-2)/(n3*n3*(1 + -1.0*n3)*(1 + -1.0*n3)) + 2.6525823848649224e-2*dn2vsqr_by_dn2vx*dn3_by_dx*n2*log(1 + -1.0*n3)/(n3*n3*n3*(1 + -1.0*n3)*(1 + -1.0*n3)) + dn2_by_dx*dn2vsqr_by_dn2vx*((log(1 + -1.0*n3)*(-2.6525823848649224e-2*1/n3 + 5.305164769729845e-2) + -2.6525823848649224e-2)/n3 + -2.6525823848649224e-2*log(1 + -1.0*n3))/((1 + -1.0*n3)*(1 + -1.0*n3)) + ddn2vsqr_by_dn2vx_by_dx*n2*((log(1 + -1.0*n3)*(-2.6525823848649224e-2*1/n3 + 5.305164769729845e-2) + -2.6525823848649224e-2)/n3 + -2.6525823848649224e-2*log(1 + -1.0*n3))/((1 + -1.0*n3)*(1 + -1.0*n3));
+	double 	ddphi3_by_dn2vx_by_dx = 2.0*dn2vsqr_by_dn2vx*dn3_by_dx*n2*((vm_log(1 + -1.0*n3)*(-2.6525823848649224e-2*1/n3 + 5.305164769729845e-2) + -2.6525823848649224e-2)/n3 + -2.6525823848649224e-2*vm_log(1 + -1.0*n3))/((1 + -1.0*n3)*(1 + -1.0*n3)*(1 + -1.0*n3)) + 2.6525823848649224e-2*dn2vsqr_by_dn2vx*dn3_by_dx*n2/((1 + -1.0*n3)*(1 + -1.0*n3)*(1 + -1.0*n3)) + -1.0*dn2vsqr_by_dn2vx*dn3_by_dx*n2*(-2.6525823848649224e-2*1/n3 + 5.305164769729845e-2)/(n3*(1 + -1.0*n3)*(1 + -1.0*n3)*(1 + -1.0*n3)) + -1.0*dn2vsqr_by_dn2vx*dn3_by_dx*n2*(vm_log(1 + -1.0*n3)*(-2.6525823848649224e-2*1/n3 + 5.305164769729845e-2) + -2.6525823848649224e-2)/(n3*n3*(1 + -1.0*n3)*(1 + -1.0*n3)) + 2.6525823848649224e-2*dn2vsqr_by_dn2vx*dn3_by_dx*n2*vm_log(1 + -1.0*n3)/(n3*n3*n3*(1 + -1.0*n3)*(1 + -1.0*n3)) + dn2_by_dx*dn2vsqr_by_dn2vx*((vm_log(1 + -1.0*n3)*(-2.6525823848649224e-2*1/n3 + 5.305164769729845e-2) + -2.6525823848649224e-2)/n3 + -2.6525823848649224e-2*vm_log(1 + -1.0*n3))/((1 + -1.0*n3)*(1 + -1.0*n3)) + ddn2vsqr_by_dn2vx_by_dx*n2*((vm_log(1 + -1.0*n3)*(-2.6525823848649224e-2*1/n3 + 5.305164769729845e-2) + -2.6525823848649224e-2)/n3 + -2.6525823848649224e-2*vm_log(1 + -1.0*n3))/((1 + -1.0*n3)*(1 + -1.0*n3));
 	double 	ddphitot_by_dn2vx_by_dx = ddphi3_by_dn2vx_by_dx + ddphi2_by_dn2vx_by_dx;
 	double 	ddn1v_dot_n2v_by_dn2vy_by_dx = 7.957747154594767e-2*deltay/R;
 	double 	ddphi2_by_dn2vy_by_dx = -1.0*dn1v_dot_n2v_by_dn2vy*dn3_by_dx/((1 + -1.0*n3)*(1 + -1.0*n3)) + -1.0*ddn1v_dot_n2v_by_dn2vy_by_dx/(1 + -1.0*n3);
 	double 	ddn2vsqr_by_dn2vy_by_dx = 2.0*dn2vy_by_dx;
-	double 	ddphi3_by_dn2vy_by_dx = 2.0*dn2vsqr_by_dn2vy*dn3_by_dx*n2*((log(1 + -1.0*n3)*(-2.6525823848649224e-2*1/n3 + 5.305164769729845e-2) + -2.6525823848649224e-2)/n3 + -2.6525823848649224e-2*log(1 + -1.0*n3))/((1 + -1.0*n3)*(1 + -1.0*n3)*(1 + -1.0*n3)) + 2.6525823848649224e-2*dn2vsqr_by_dn2vy*dn3_by_dx*n2/((1 + -1.0*n3)*(1 + -1.0*n3)*(1 + -1.0*n3)) + -1.0*dn2vsqr_by_dn2vy*dn3_by_dx*n2*(-2.6525823848649224e-2*1/n3 + 5.305164769729845e-2)/(n3*(1 + -1.0*n3)*(1 + -1.0*n3)*(1 + -1.0*n3)) + -1.0*dn2vsqr_by_dn2vy*dn3_by_dx*n2*(log(1 + -1.0*n3)*(-2.6525823848649224e-2*1/n3 + 5.305164769729845e-2) + -2.6525823848649224e-2)/(n3*n3*(1 + -1.0*n3)*(1 + -1.0*n3)) + 2.6525823848649224e-2*dn2vsqr_by_dn2vy*dn3_by_dx*n2*log(1 + -1.0*n3)/(n3*n3*n3*(1 + -1.0*n3)*(1 + -1.0*n3)) + dn2_by_dx*dn2vsqr_by_dn2vy*((log(1 + -1.0*n3)*(-2.6525823848649224e-2*1/n3 + 5.305164769729845e-2) + -2.6525823848649224e-2)/n3 + -2.6525823848649224e-2*log(1 + -1.0*n3))/((1 + -1.0*n3)*(1 + -1.0*n3)) + ddn2vsqr_by_dn2vy_by_dx*n2*((log(1 + -1.0*n3)*(-2.6525823848649224e-2*1/n3 + 5.305164769729845e-2) + -2.6525823848649224e-2)/n3 + -2.6525823848649224e-2*log(1 + -1.0*n3))/((1 + -1.0*n3)*(1 + -1.0*n3));
+	double 	ddphi3_by_dn2vy_by_dx = 2.0*dn2vsqr_by_dn2vy*dn3_by_dx*n2*((vm_log(1 + -1.0*n3)*(-2.6525823848649224e-2*1/n3 + 5.305164769729845e-2) + -2.6525823848649224e-2)/n3 + -2.6525823848649224e-2*vm_log(1 + -1.0*n3))/((1 + -1.0*n3)*(1 + -1.0*n3)*(1 + -1.0*n3)) + 2.6525823848649224e-2*dn2vsqr_by_dn2vy*dn3_by_dx*n2/((1 + -1.0*n3)*(1 + -1.0*n3)*(1 + -1.0*n3)) + -1.0*dn2vsqr_by_dn2vy*dn3_by_dx*n2*(-2.6525823848649224e-2*1/n3 + 5.305164769729845e-2)/(n3*(1 + -1.0*n3)*(1 + -1.0*n3)*(1 + -1.0*n3)) + -1.0*dn2vsqr_by_dn2vy*dn3_by_dx*n2*(vm_log(1 + -1.0*n3)*(-2.6525823848649224e-2*1/n3 + 5.305164769729845e-2) + -2.6525823848649224e-2)/(n3*n3*(1 + -1.0*n3)*(1 + -1.0*n3)) + 2.6525823848649224e-2*dn2vsqr_by_dn2vy*dn3_by_dx*n2*vm_log(1 + -1.0*n3)/(n3*n3*n3*(1 + -1.0*n3)*(1 + -1.0*n3)) + dn2_by_dx*dn2vsqr_by_dn2vy*((vm_log(1 + -1.0*n3)*(-2.6525823848649224e-2*1/n3 + 5.305164769729845e-2) + -2.6525823848649224e-2)/n3 + -2.6525823848649224e-2*vm_log(1 + -1.0*n3))/((1 + -1.0*n3)*(1 + -1.0*n3)) + ddn2vsqr_by_dn2vy_by_dx*n2*((vm_log(1 + -1.0*n3)*(-2.6525823848649224e-2*1/n3 + 5.305164769729845e-2) + -2.6525823848649224e-2)/n3 + -2.6525823848649224e-2*vm_log(1 + -1.0*n3))/((1 + -1.0*n3)*(1 + -1.0*n3));
 	double 	ddphitot_by_dn2vy_by_dx = ddphi3_by_dn2vy_by_dx + ddphi2_by_dn2vy_by_dx;
 	double 	ddn1v_dot_n2v_by_dn2vz_by_dx = 7.957747154594767e-2*deltaz/R;
 	double 	ddphi2_by_dn2vz_by_dx = -1.0*dn1v_dot_n2v_by_dn2vz*dn3_by_dx/((1 + -1.0*n3)*(1 + -1.0*n3)) + -1.0*ddn1v_dot_n2v_by_dn2vz_by_dx/(1 + -1.0*n3);
 	double 	ddn2vsqr_by_dn2vz_by_dx = 2.0*dn2vz_by_dx;
-	double 	ddphi3_by_dn2vz_by_dx = 2.0*dn2vsqr_by_dn2vz*dn3_by_dx*n2*((log(1 + -1.0*n3)*(-2.6525823848649224e-2*1/n3 + 5.305164769729845e-2) + -2.6525823848649224e-2)/n3 + -2.6525823848649224e-2*log(1 + -1.0*n3))/((1 + -1.0*n3)*(1 + -1.0*n3)*(1 + -1.0*n3)) + 2.6525823848649224e-2*dn2vsqr_by_dn2vz*dn3_by_dx*n2/((1 + -1.0*n3)*(1 + -1.0*n3)*(1 + -1.0*n3)) + -1.0*dn2vsqr_by_dn2vz*dn3_by_dx*n2*(-2.6525823848649224e-2*1/n3 + 5.305164769729845e-2)/(n3*(1 + -1.0*n3)*(1 + -1.0*n3)*(1 + -1.0*n3)) + -1.0*dn2vsqr_by_dn2vz*dn3_by_dx*n2*(log(1 + -1.0*n3)*(-2.6525823848649224e-2*1/n3 + 5.305164769729845e-2) + -2.6525823848649224e-2)/(n3*n3*(1 + -1.0*n3)*(1 + -1.0*n3)) + 2.6525823848649224e-2*dn2vsqr_by_dn2vz*dn3_by_dx*n2*log(1 + -1.0*n3)/(n3*n3*n3*(1 + -1.0*n3)*(1 + -1.0*n3)) + dn2_by_dx*dn2vsqr_by_dn2vz*((log(1 + -1.0*n3)*(-2.6525823848649224e-2*1/n3 + 5.305164769729845e-2) + -2.6525823848649224e-2)/n3 + -2.6525823848649224e-2*log(1 + -1.0*n3))/((1 + -1.0*n3)*(1 + -1.0*n3)) + ddn2vsqr_by_dn2vz_by_dx*n2*((log(1 + -1.0*n3)*(-2.6525823848649224e-2*1/n3 + 5.305164769729845e-2) + -2.6525823848649224e-2)/n3 + -2.6525823848649224e-2*log(1 + -1.0*n3))/((1 + -1.0*n3)*(1 + -1.0*n3));
+	double 	ddphi3_by_dn2vz_by_dx = 2.0*dn2vsqr_by_dn2vz*dn3_by_dx*n2*((vm_log(1 + -1.0*n3)*(-2.6525823848649224e-2*1/n3 + 5.305164769729845e-2) + -2.6525823848649224e-2)/n3 + -2.6525823848649224e-2*vm_log(1 + -1.0*n3))/((1 + -1.0*n3)*(1 + -1.0*n3)*(1 + -1.0*n3)) + 2.6525823848649224e-2*dn2vsqr_by_dn2vz*dn3_by_dx*n2/((1 + -1.0*n3)*(1 + -1.0*n3)*(1 + -1.0*n3)) + -1.0*dn2vsqr_by_dn2vz*dn3_by_dx*n2*(-2.6525823848649224e-2*1/n3 + 5.305164769729845e-2)/(n3*(1 + -1.0*n3)*(1 + -1.0*n3)*(1 + -1.0*n3)) + -1.0*dn2vsqr_by_dn2vz*dn3_by_dx*n2*(vm_log(1 + -1.0*n3)*(-2.6525823848649224e-2*1/n3 + 5.305164769729845e-2) + -2.6525823848649224e-2)/(n3*n3*(1 + -1.0*n3)*(1 + -1.0*n3)) + 2.6525823848649224e-2*dn2vsqr_by_dn2vz*dn3_by_dx*n2*vm_log(1 + -1.0*n3)/(n3*n3*n3*(1 + -1.0*n3)*(1 + -1.0*n3)) + dn2_by_dx*dn2vsqr_by_dn2vz*((vm_log(1 + -1.0*n3)*(-2.6525823848649224e-2*1/n3 + 5.305164769729845e-2) + -2.6525823848649224e-2)/n3 + -2.6525823848649224e-2*vm_log(1 + -1.0*n3))/((1 + -1.0*n3)*(1 + -1.0*n3)) + ddn2vsqr_by_dn2vz_by_dx*n2*((vm_log(1 + -1.0*n3)*(-2.6525823848649224e-2*1/n3 + 5.305164769729845e-2) + -2.6525823848649224e-2)/n3 + -2.6525823848649224e-2*vm_log(1 + -1.0*n3))/((1 + -1.0*n3)*(1 + -1.0*n3));
 	double 	ddphitot_by_dn2vz_by_dx = ddphi3_by_dn2vz_by_dx + ddphi2_by_dn2vz_by_dx;
 	double 	dn0_by_dx = 7.957747154594767e-2*deltak/(R*R);
 	double 	ddphi1_by_dn3_by_dx = dn3_by_dx*n0/((1 + -1.0*n3)*(1 + -1.0*n3)) + dn0_by_dx/(1 + -1.0*n3);
@@ -692,7 +687,7 @@ double derive(double kT, double x) const {
 	double 	dn1vz_by_dx = 7.957747154594767e-2*deltaz/R;
 	double 	dn1v_dot_n2v_by_dx = dn2vz_by_dx*n1vz + dn2vy_by_dx*n1vy + dn2vx_by_dx*n1vx + dn1vz_by_dx*n2vz + dn1vy_by_dx*n2vy + dn1vx_by_dx*n2vx;
 	double 	ddphi2_by_dn3_by_dx = 2.0*dn3_by_dx*(n1*n2 + -1.0*n1v_dot_n2v)/((1 + -1.0*n3)*(1 + -1.0*n3)*(1 + -1.0*n3)) + dn2_by_dx*n1/((1 + -1.0*n3)*(1 + -1.0*n3)) + -1.0*dn1v_dot_n2v_by_dx/((1 + -1.0*n3)*(1 + -1.0*n3)) + dn1_by_dx*n2/((1 + -1.0*n3)*(1 + -1.0*n3));
-	double 	ddphi3_by_dn3_by_dx = -1.768388256576615e-2*dn3_by_dx*n2*n2*n2/(((1 + -1.0*n3)*(1 + -1.0*n3))*((1 + -1.0*n3)*(1 + -1.0*n3))) + 3.53677651315323e-2*dn3_by_dx*n2*n2*n2*log(1 + -1.0*n3)/(((1 + -1.0*n3)*(1 + -1.0*n3))*((1 + -1.0*n3)*(1 + -1.0*n3))) + dn3_by_dx*n2*n2*n2*(1.768388256576615e-2*1/(1 + -1.0*n3) + log(1 + -1.0*n3)*(-3.53677651315323e-2*1/(1 + -1.0*n3) + -1.768388256576615e-2))/(n3*(1 + -1.0*n3)*(1 + -1.0*n3)*(1 + -1.0*n3)) + -1.0*dn3_by_dx*n2*n2*n2*(-3.53677651315323e-2*1/(1 + -1.0*n3) + -1.768388256576615e-2)/(n3*(1 + -1.0*n3)*(1 + -1.0*n3)*(1 + -1.0*n3)) + 1.768388256576615e-2*dn3_by_dx*n2*n2*n2/(n3*((1 + -1.0*n3)*(1 + -1.0*n3))*((1 + -1.0*n3)*(1 + -1.0*n3))) + -3.53677651315323e-2*dn3_by_dx*n2*n2*n2*log(1 + -1.0*n3)/(n3*((1 + -1.0*n3)*(1 + -1.0*n3))*((1 + -1.0*n3)*(1 + -1.0*n3))) + -1.0*dn3_by_dx*n2*n2*n2*((1.768388256576615e-2*1/(1 + -1.0*n3) + log(1 + -1.0*n3)*(-3.53677651315323e-2*1/(1 + -1.0*n3) + -1.768388256576615e-2))/(1 + -1.0*n3) + (-8.841941282883075e-3*1/(1 + -1.0*n3) + log(1 + -1.0*n3)*((1.768388256576615e-2*1/(1 + -1.0*n3) + -1.768388256576615e-2*1/n3 + 3.53677651315323e-2)/(1 + -1.0*n3) + -1.768388256576615e-2) + -8.841941282883075e-3)/n3)/(n3*n3*(1 + -1.0*n3)) + -1.0*dn3_by_dx*n2*n2*n2*((1.768388256576615e-2*1/(1 + -1.0*n3) + -1.768388256576615e-2*1/n3 + 3.53677651315323e-2)/(1 + -1.0*n3) + -1.768388256576615e-2)/(n3*n3*(1 + -1.0*n3)*(1 + -1.0*n3)) + -8.841941282883075e-3*dn3_by_dx*n2*n2*n2/(n3*n3*(1 + -1.0*n3)*(1 + -1.0*n3)*(1 + -1.0*n3)) + dn3_by_dx*n2*n2*n2*log(1 + -1.0*n3)*(1.768388256576615e-2*1/(1 + -1.0*n3) + -1.768388256576615e-2*1/n3 + 3.53677651315323e-2)/(n3*n3*(1 + -1.0*n3)*(1 + -1.0*n3)*(1 + -1.0*n3)) + 1.768388256576615e-2*dn3_by_dx*n2*n2*n2*log(1 + -1.0*n3)/(n3*n3*((1 + -1.0*n3)*(1 + -1.0*n3))*((1 + -1.0*n3)*(1 + -1.0*n3))) + -1.0*dn3_by_dx*n2*n2*n2*(-8.841941282883075e-3*1/(1 + -1.0*n3) + log(1 + -1.0*n3)*((1.768388256576615e-2*1/(1 + -1.0*n3) + -1.768388256576615e-2*1/n3 + 3.53677651315323e-2)/(1 + -1.0*n3) + -1.768388256576615e-2) + -8.841941282883075e-3)/(n3*n3*n3*(1 + -1.0*n3)) + 1.768388256576615e-2*dn3_by_dx*n2*n2*n2*log(1 + -1.0*n3)/((n3*n3)*(n3*n3)*(1 + -1.0*n3)*(1 + -1.0*n3)) + dn3_by_dx*n2*(n2vsqr*(-5.305164769729845e-2*log(1 + -1.0*n3)/((1 + -1.0*n3)*(1 + -1.0*n3)) + ((-5.305164769729845e-2*1/(1 + -1.0*n3) + log(1 + -1.0*n3)*(0.1061032953945969*1/(1 + -1.0*n3) + 5.305164769729845e-2))/(1 + -1.0*n3) + (2.6525823848649224e-2*1/(1 + -1.0*n3) + log(1 + -1.0*n3)*((-5.305164769729845e-2*1/(1 + -1.0*n3) + 5.305164769729845e-2*1/n3 + -0.1061032953945969)/(1 + -1.0*n3) + 5.305164769729845e-2) + 2.6525823848649224e-2)/n3)/n3) + n2*n2*(1.768388256576615e-2*log(1 + -1.0*n3)/((1 + -1.0*n3)*(1 + -1.0*n3)) + ((1.768388256576615e-2*1/(1 + -1.0*n3) + log(1 + -1.0*n3)*(-3.53677651315323e-2*1/(1 + -1.0*n3) + -1.768388256576615e-2))/(1 + -1.0*n3) + (-8.841941282883075e-3*1/(1 + -1.0*n3) + log(1 + -1.0*n3)*((1.768388256576615e-2*1/(1 + -1.0*n3) + -1.768388256576615e-2*1/n3 + 3.53677651315323e-2)/(1 + -1.0*n3) + -1.768388256576615e-2) + -8.841941282883075e-3)/n3)/n3))/((1 + -1.0*n3)*(1 + -1.0*n3)) + 5.305164769729845e-2*dn3_by_dx*n2*n2vsqr/(((1 + -1.0*n3)*(1 + -1.0*n3))*((1 + -1.0*n3)*(1 + -1.0*n3))) + -0.1061032953945969*dn3_by_dx*n2*n2vsqr*log(1 + -1.0*n3)/(((1 + -1.0*n3)*(1 + -1.0*n3))*((1 + -1.0*n3)*(1 + -1.0*n3))) + dn3_by_dx*n2*n2vsqr*(-5.305164769729845e-2*1/(1 + -1.0*n3) + log(1 + -1.0*n3)*(0.1061032953945969*1/(1 + -1.0*n3) + 5.305164769729845e-2))/(n3*(1 + -1.0*n3)*(1 + -1.0*n3)*(1 + -1.0*n3)) + -1.0*dn3_by_dx*n2*n2vsqr*(0.1061032953945969*1/(1 + -1.0*n3) + 5.305164769729845e-2)/(n3*(1 + -1.0*n3)*(1 + -1.0*n3)*(1 + -1.0*n3)) + -5.305164769729845e-2*dn3_by_dx*n2*n2vsqr/(n3*((1 + -1.0*n3)*(1 + -1.0*n3))*((1 + -1.0*n3)*(1 + -1.0*n3))) + 0.1061032953945969*dn3_by_dx*n2*n2vsqr*log(1 + -1.0*n3)/(n3*((1 + -1.0*n3)*(1 + -1.0*n3))*((1 + -1.0*n3)*(1 + -1.0*n3))) + -1.0*dn3_by_dx*n2*n2vsqr*((-5.305164769729845e-2*1/(1 + -1.0*n3) + log(1 + -1.0*n3)*(0.1061032953945969*1/(1 + -1.0*n3) + 5.305164769729845e-2))/(1 + -1.0*n3) + (2.6525823848649224e-2*1/(1 + -1.0*n3) + log(1 + -1.0*n3)*((-5.305164769729845e-2*1/(1 + -1.0*n3) + 5.305164769729845e-2*1/n3 + -0.1061032953945969)/(1 + -1.0*n3) + 5.305164769729845e-2) + 2.6525823848649224e-2)/n3)/(n3*n3*(1 + -1.0*n3)) + -1.0*dn3_by_dx*n2*n2vsqr*((-5.305164769729845e-2*1/(1 + -1.0*n3) + 5.305164769729845e-2*1/n3 + -0.1061032953945969)/(1 + -1.0*n3) + 5.305164769729845e-2)/(n3*n3*(1 + -1.0*n3)*(1 + -1.0*n3)) + 2.6525823848649224e-2*dn3_by_dx*n2*n2vsqr/(n3*n3*(1 + -1.0*n3)*(1 + -1.0*n3)*(1 + -1.0*n3)) + dn3_by_dx*n2*n2vsqr*log(1 + -1.0*n3)*(-5.305164769729845e-2*1/(1 + -1.0*n3) + 5.305164769729845e-2*1/n3 + -0.1061032953945969)/(n3*n3*(1 + -1.0*n3)*(1 + -1.0*n3)*(1 + -1.0*n3)) + -5.305164769729845e-2*dn3_by_dx*n2*n2vsqr*log(1 + -1.0*n3)/(n3*n3*((1 + -1.0*n3)*(1 + -1.0*n3))*((1 + -1.0*n3)*(1 + -1.0*n3))) + -1.0*dn3_by_dx*n2*n2vsqr*(2.6525823848649224e-2*1/(1 + -1.0*n3) + log(1 + -1.0*n3)*((-5.305164769729845e-2*1/(1 + -1.0*n3) + 5.305164769729845e-2*1/n3 + -0.1061032953945969)/(1 + -1.0*n3) + 5.305164769729845e-2) + 2.6525823848649224e-2)/(n3*n3*n3*(1 + -1.0*n3)) + -5.305164769729845e-2*dn3_by_dx*n2*n2vsqr*log(1 + -1.0*n3)/((n3*n3)*(n3*n3)*(1 + -1.0*n3)*(1 + -1.0*n3)) + dn2vsqr_by_dx*n2*(-5.305164769729845e-2*log(1 + -1.0*n3)/((1 + -1.0*n3)*(1 + -1.0*n3)) + ((-5.305164769729845e-2*1/(1 + -1.0*n3) + log(1 + -1.0*n3)*(0.1061032953945969*1/(1 + -1.0*n3) + 5.305164769729845e-2))/(1 + -1.0*n3) + (2.6525823848649224e-2*1/(1 + -1.0*n3) + log(1 + -1.0*n3)*((-5.305164769729845e-2*1/(1 + -1.0*n3) + 5.305164769729845e-2*1/n3 + -0.1061032953945969)/(1 + -1.0*n3) + 5.305164769729845e-2) + 2.6525823848649224e-2)/n3)/n3)/(1 + -1.0*n3) + dn2_by_dx*(n2vsqr*(-5.305164769729845e-2*log(1 + -1.0*n3)/((1 + -1.0*n3)*(1 + -1.0*n3)) + ((-5.305164769729845e-2*1/(1 + -1.0*n3) + log(1 + -1.0*n3)*(0.1061032953945969*1/(1 + -1.0*n3) + 5.305164769729845e-2))/(1 + -1.0*n3) + (2.6525823848649224e-2*1/(1 + -1.0*n3) + log(1 + -1.0*n3)*((-5.305164769729845e-2*1/(1 + -1.0*n3) + 5.305164769729845e-2*1/n3 + -0.1061032953945969)/(1 + -1.0*n3) + 5.305164769729845e-2) + 2.6525823848649224e-2)/n3)/n3) + n2*n2*(1.768388256576615e-2*log(1 + -1.0*n3)/((1 + -1.0*n3)*(1 + -1.0*n3)) + ((1.768388256576615e-2*1/(1 + -1.0*n3) + log(1 + -1.0*n3)*(-3.53677651315323e-2*1/(1 + -1.0*n3) + -1.768388256576615e-2))/(1 + -1.0*n3) + (-8.841941282883075e-3*1/(1 + -1.0*n3) + log(1 + -1.0*n3)*((1.768388256576615e-2*1/(1 + -1.0*n3) + -1.768388256576615e-2*1/n3 + 3.53677651315323e-2)/(1 + -1.0*n3) + -1.768388256576615e-2) + -8.841941282883075e-3)/n3)/n3))/(1 + -1.0*n3) + 2.0*dn2_by_dx*n2*n2*(1.768388256576615e-2*log(1 + -1.0*n3)/((1 + -1.0*n3)*(1 + -1.0*n3)) + ((1.768388256576615e-2*1/(1 + -1.0*n3) + log(1 + -1.0*n3)*(-3.53677651315323e-2*1/(1 + -1.0*n3) + -1.768388256576615e-2))/(1 + -1.0*n3) + (-8.841941282883075e-3*1/(1 + -1.0*n3) + log(1 + -1.0*n3)*((1.768388256576615e-2*1/(1 + -1.0*n3) + -1.768388256576615e-2*1/n3 + 3.53677651315323e-2)/(1 + -1.0*n3) + -1.768388256576615e-2) + -8.841941282883075e-3)/n3)/n3)/(1 + -1.0*n3);
+	double 	ddphi3_by_dn3_by_dx = -1.768388256576615e-2*dn3_by_dx*n2*n2*n2/(((1 + -1.0*n3)*(1 + -1.0*n3))*((1 + -1.0*n3)*(1 + -1.0*n3))) + 3.53677651315323e-2*dn3_by_dx*n2*n2*n2*vm_log(1 + -1.0*n3)/(((1 + -1.0*n3)*(1 + -1.0*n3))*((1 + -1.0*n3)*(1 + -1.0*n3))) + dn3_by_dx*n2*n2*n2*(1.768388256576615e-2*1/(1 + -1.0*n3) + vm_log(1 + -1.0*n3)*(-3.53677651315323e-2*1/(1 + -1.0*n3) + -1.768388256576615e-2))/(n3*(1 + -1.0*n3)*(1 + -1.0*n3)*(1 + -1.0*n3)) + -1.0*dn3_by_dx*n2*n2*n2*(-3.53677651315323e-2*1/(1 + -1.0*n3) + -1.768388256576615e-2)/(n3*(1 + -1.0*n3)*(1 + -1.0*n3)*(1 + -1.0*n3)) + 1.768388256576615e-2*dn3_by_dx*n2*n2*n2/(n3*((1 + -1.0*n3)*(1 + -1.0*n3))*((1 + -1.0*n3)*(1 + -1.0*n3))) + -3.53677651315323e-2*dn3_by_dx*n2*n2*n2*vm_log(1 + -1.0*n3)/(n3*((1 + -1.0*n3)*(1 + -1.0*n3))*((1 + -1.0*n3)*(1 + -1.0*n3))) + -1.0*dn3_by_dx*n2*n2*n2*((1.768388256576615e-2*1/(1 + -1.0*n3) + vm_log(1 + -1.0*n3)*(-3.53677651315323e-2*1/(1 + -1.0*n3) + -1.768388256576615e-2))/(1 + -1.0*n3) + (-8.841941282883075e-3*1/(1 + -1.0*n3) + vm_log(1 + -1.0*n3)*((1.768388256576615e-2*1/(1 + -1.0*n3) + -1.768388256576615e-2*1/n3 + 3.53677651315323e-2)/(1 + -1.0*n3) + -1.768388256576615e-2) + -8.841941282883075e-3)/n3)/(n3*n3*(1 + -1.0*n3)) + -1.0*dn3_by_dx*n2*n2*n2*((1.768388256576615e-2*1/(1 + -1.0*n3) + -1.768388256576615e-2*1/n3 + 3.53677651315323e-2)/(1 + -1.0*n3) + -1.768388256576615e-2)/(n3*n3*(1 + -1.0*n3)*(1 + -1.0*n3)) + -8.841941282883075e-3*dn3_by_dx*n2*n2*n2/(n3*n3*(1 + -1.0*n3)*(1 + -1.0*n3)*(1 + -1.0*n3)) + dn3_by_dx*n2*n2*n2*vm_log(1 + -1.0*n3)*(1.768388256576615e-2*1/(1 + -1.0*n3) + -1.768388256576615e-2*1/n3 + 3.53677651315323e-2)/(n3*n3*(1 + -1.0*n3)*(1 + -1.0*n3)*(1 + -1.0*n3)) + 1.768388256576615e-2*dn3_by_dx*n2*n2*n2*vm_log(1 + -1.0*n3)/(n3*n3*((1 + -1.0*n3)*(1 + -1.0*n3))*((1 + -1.0*n3)*(1 + -1.0*n3))) + -1.0*dn3_by_dx*n2*n2*n2*(-8.841941282883075e-3*1/(1 + -1.0*n3) + vm_log(1 + -1.0*n3)*((1.768388256576615e-2*1/(1 + -1.0*n3) + -1.768388256576615e-2*1/n3 + 3.53677651315323e-2)/(1 + -1.0*n3) + -1.768388256576615e-2) + -8.841941282883075e-3)/(n3*n3*n3*(1 + -1.0*n3)) + 1.768388256576615e-2*dn3_by_dx*n2*n2*n2*vm_log(1 + -1.0*n3)/((n3*n3)*(n3*n3)*(1 + -1.0*n3)*(1 + -1.0*n3)) + dn3_by_dx*n2*(n2vsqr*(-5.305164769729845e-2*vm_log(1 + -1.0*n3)/((1 + -1.0*n3)*(1 + -1.0*n3)) + ((-5.305164769729845e-2*1/(1 + -1.0*n3) + vm_log(1 + -1.0*n3)*(0.1061032953945969*1/(1 + -1.0*n3) + 5.305164769729845e-2))/(1 + -1.0*n3) + (2.6525823848649224e-2*1/(1 + -1.0*n3) + vm_log(1 + -1.0*n3)*((-5.305164769729845e-2*1/(1 + -1.0*n3) + 5.305164769729845e-2*1/n3 + -0.1061032953945969)/(1 + -1.0*n3) + 5.305164769729845e-2) + 2.6525823848649224e-2)/n3)/n3) + n2*n2*(1.768388256576615e-2*vm_log(1 + -1.0*n3)/((1 + -1.0*n3)*(1 + -1.0*n3)) + ((1.768388256576615e-2*1/(1 + -1.0*n3) + vm_log(1 + -1.0*n3)*(-3.53677651315323e-2*1/(1 + -1.0*n3) + -1.768388256576615e-2))/(1 + -1.0*n3) + (-8.841941282883075e-3*1/(1 + -1.0*n3) + vm_log(1 + -1.0*n3)*((1.768388256576615e-2*1/(1 + -1.0*n3) + -1.768388256576615e-2*1/n3 + 3.53677651315323e-2)/(1 + -1.0*n3) + -1.768388256576615e-2) + -8.841941282883075e-3)/n3)/n3))/((1 + -1.0*n3)*(1 + -1.0*n3)) + 5.305164769729845e-2*dn3_by_dx*n2*n2vsqr/(((1 + -1.0*n3)*(1 + -1.0*n3))*((1 + -1.0*n3)*(1 + -1.0*n3))) + -0.1061032953945969*dn3_by_dx*n2*n2vsqr*vm_log(1 + -1.0*n3)/(((1 + -1.0*n3)*(1 + -1.0*n3))*((1 + -1.0*n3)*(1 + -1.0*n3))) + dn3_by_dx*n2*n2vsqr*(-5.305164769729845e-2*1/(1 + -1.0*n3) + vm_log(1 + -1.0*n3)*(0.1061032953945969*1/(1 + -1.0*n3) + 5.305164769729845e-2))/(n3*(1 + -1.0*n3)*(1 + -1.0*n3)*(1 + -1.0*n3)) + -1.0*dn3_by_dx*n2*n2vsqr*(0.1061032953945969*1/(1 + -1.0*n3) + 5.305164769729845e-2)/(n3*(1 + -1.0*n3)*(1 + -1.0*n3)*(1 + -1.0*n3)) + -5.305164769729845e-2*dn3_by_dx*n2*n2vsqr/(n3*((1 + -1.0*n3)*(1 + -1.0*n3))*((1 + -1.0*n3)*(1 + -1.0*n3))) + 0.1061032953945969*dn3_by_dx*n2*n2vsqr*vm_log(1 + -1.0*n3)/(n3*((1 + -1.0*n3)*(1 + -1.0*n3))*((1 + -1.0*n3)*(1 + -1.0*n3))) + -1.0*dn3_by_dx*n2*n2vsqr*((-5.305164769729845e-2*1/(1 + -1.0*n3) + vm_log(1 + -1.0*n3)*(0.1061032953945969*1/(1 + -1.0*n3) + 5.305164769729845e-2))/(1 + -1.0*n3) + (2.6525823848649224e-2*1/(1 + -1.0*n3) + vm_log(1 + -1.0*n3)*((-5.305164769729845e-2*1/(1 + -1.0*n3) + 5.305164769729845e-2*1/n3 + -0.1061032953945969)/(1 + -1.0*n3) + 5.305164769729845e-2) + 2.6525823848649224e-2)/n3)/(n3*n3*(1 + -1.0*n3)) + -1.0*dn3_by_dx*n2*n2vsqr*((-5.305164769729845e-2*1/(1 + -1.0*n3) + 5.305164769729845e-2*1/n3 + -0.1061032953945969)/(1 + -1.0*n3) + 5.305164769729845e-2)/(n3*n3*(1 + -1.0*n3)*(1 + -1.0*n3)) + 2.6525823848649224e-2*dn3_by_dx*n2*n2vsqr/(n3*n3*(1 + -1.0*n3)*(1 + -1.0*n3)*(1 + -1.0*n3)) + dn3_by_dx*n2*n2vsqr*vm_log(1 + -1.0*n3)*(-5.305164769729845e-2*1/(1 + -1.0*n3) + 5.305164769729845e-2*1/n3 + -0.1061032953945969)/(n3*n3*(1 + -1.0*n3)*(1 + -1.0*n3)*(1 + -1.0*n3)) + -5.305164769729845e-2*dn3_by_dx*n2*n2vsqr*vm_log(1 + -1.0*n3)/(n3*n3*((1 + -1.0*n3)*(1 + -1.0*n3))*((1 + -1.0*n3)*(1 + -1.0*n3))) + -1.0*dn3_by_dx*n2*n2vsqr*(2.6525823848649224e-2*1/(1 + -1.0*n3) + vm_log(1 + -1.0*n3)*((-5.305164769729845e-2*1/(1 + -1.0*n3) + 5.305164769729845e-2*1/n3 + -0.1061032953945969)/(1 + -1.0*n3) + 5.305164769729845e-2) + 2.6525823848649224e-2)/(n3*n3*n3*(1 + -1.0*n3)) + -5.305164769729845e-2*dn3_by_dx*n2*n2vsqr*vm_log(1 + -1.0*n3)/((n3*n3)*(n3*n3)*(1 + -1.0*n3)*(1 + -1.0*n3)) + dn2vsqr_by_dx*n2*(-5.305164769729845e-2*vm_log(1 + -1.0*n3)/((1 + -1.0*n3)*(1 + -1.0*n3)) + ((-5.305164769729845e-2*1/(1 + -1.0*n3) + vm_log(1 + -1.0*n3)*(0.1061032953945969*1/(1 + -1.0*n3) + 5.305164769729845e-2))/(1 + -1.0*n3) + (2.6525823848649224e-2*1/(1 + -1.0*n3) + vm_log(1 + -1.0*n3)*((-5.305164769729845e-2*1/(1 + -1.0*n3) + 5.305164769729845e-2*1/n3 + -0.1061032953945969)/(1 + -1.0*n3) + 5.305164769729845e-2) + 2.6525823848649224e-2)/n3)/n3)/(1 + -1.0*n3) + dn2_by_dx*(n2vsqr*(-5.305164769729845e-2*vm_log(1 + -1.0*n3)/((1 + -1.0*n3)*(1 + -1.0*n3)) + ((-5.305164769729845e-2*1/(1 + -1.0*n3) + vm_log(1 + -1.0*n3)*(0.1061032953945969*1/(1 + -1.0*n3) + 5.305164769729845e-2))/(1 + -1.0*n3) + (2.6525823848649224e-2*1/(1 + -1.0*n3) + vm_log(1 + -1.0*n3)*((-5.305164769729845e-2*1/(1 + -1.0*n3) + 5.305164769729845e-2*1/n3 + -0.1061032953945969)/(1 + -1.0*n3) + 5.305164769729845e-2) + 2.6525823848649224e-2)/n3)/n3) + n2*n2*(1.768388256576615e-2*vm_log(1 + -1.0*n3)/((1 + -1.0*n3)*(1 + -1.0*n3)) + ((1.768388256576615e-2*1/(1 + -1.0*n3) + vm_log(1 + -1.0*n3)*(-3.53677651315323e-2*1/(1 + -1.0*n3) + -1.768388256576615e-2))/(1 + -1.0*n3) + (-8.841941282883075e-3*1/(1 + -1.0*n3) + vm_log(1 + -1.0*n3)*((1.768388256576615e-2*1/(1 + -1.0*n3) + -1.768388256576615e-2*1/n3 + 3.53677651315323e-2)/(1 + -1.0*n3) + -1.768388256576615e-2) + -8.841941282883075e-3)/n3)/n3))/(1 + -1.0*n3) + 2.0*dn2_by_dx*n2*n2*(1.768388256576615e-2*vm_log(1 + -1.0*n3)/((1 + -1.0*n3)*(1 + -1.0*n3)) + ((1.768388256576615e-2*1/(1 + -1.0*n3) + vm_log(1 + -1.0*n3)*(-3.53677651315323e-2*1/(1 + -1.0*n3) + -1.768388256576615e-2))/(1 + -1.0*n3) + (-8.841941282883075e-3*1/(1 + -1.0*n3) + vm_log(1 + -1.0*n3)*((1.768388256576615e-2*1/(1 + -1.0*n3) + -1.768388256576615e-2*1/n3 + 3.53677651315323e-2)/(1 + -1.0*n3) + -1.768388256576615e-2) + -8.841941282883075e-3)/n3)/n3)/(1 + -1.0*n3);
 	double 	ddphitot_by_dn3_by_dx = ddphi3_by_dn3_by_dx + ddphi2_by_dn3_by_dx + ddphi1_by_dn3_by_dx;
 	double 	ddAdR_by_dx = kT*(deltaprimez*dphitot_by_dn2vz + deltaprimey*dphitot_by_dn2vy + deltaprimex*dphitot_by_dn2vx + -1.0*deltaprime*dphitot_by_dn2 + deltak*dphitot_by_dn3 + (dphitot_by_dn1vz*(7.957747154594767e-2*deltaz/R + 7.957747154594767e-2*deltaprimez) + dphitot_by_dn1vy*(7.957747154594767e-2*deltay/R + 7.957747154594767e-2*deltaprimey) + dphitot_by_dn1vx*(7.957747154594767e-2*deltax/R + 7.957747154594767e-2*deltaprimex) + dphitot_by_dn1*(-7.957747154594767e-2*deltak/R + -7.957747154594767e-2*deltaprime) + dphitot_by_dn0*(-0.15915494309189535*deltak/R + -7.957747154594767e-2*deltaprime)/R)/R) + ddphitot_by_dn3_by_dx*deltak*kT*n + ddphitot_by_dn2vz_by_dx*deltaprimez*kT*n + ddphitot_by_dn2vy_by_dx*deltaprimey*kT*n + ddphitot_by_dn2vx_by_dx*deltaprimex*kT*n + -1.0*ddphitot_by_dn2_by_dx*deltaprime*kT*n + ddphitot_by_dn1vz_by_dx*kT*n*(7.957747154594767e-2*deltaz/R + 7.957747154594767e-2*deltaprimez)/R + ddphitot_by_dn1vy_by_dx*kT*n*(7.957747154594767e-2*deltay/R + 7.957747154594767e-2*deltaprimey)/R + ddphitot_by_dn1vx_by_dx*kT*n*(7.957747154594767e-2*deltax/R + 7.957747154594767e-2*deltaprimex)/R + ddphitot_by_dn1_by_dx*kT*n*(-7.957747154594767e-2*deltak/R + -7.957747154594767e-2*deltaprime)/R + ddphitot_by_dn0_by_dx*kT*n*(-0.15915494309189535*deltak/R + -7.957747154594767e-2*deltaprime)/(R*R);
 	double 	dgSigmaA_by_dx = ddAdR_by_dx/(deltak2*kT*n*n) + -2.0*dAdR/(deltak2*kT*n*n*n);
@@ -709,7 +704,7 @@ double derive(double kT, double x) const {
 	double 	ddeltasaft_by_dx = boltz*dgSW_by_dx*kappa_association;
 	double 	dnA_by_dx = 1.9894367886486918e-2*delta2k/(R*R);
 	double 	dX_by_dx = dnA_by_dx/(nA*sqrt(8.0*deltasaft*nA + 1)) + -1.0*dnA_by_dx*(0.25*sqrt(8.0*deltasaft*nA + 1) + -0.25)/(deltasaft*nA*nA) + ddeltasaft_by_dx/(deltasaft*sqrt(8.0*deltasaft*nA + 1)) + -1.0*ddeltasaft_by_dx*(0.25*sqrt(8.0*deltasaft*nA + 1) + -0.25)/(deltasaft*deltasaft*nA);
-	double 	dFassoc_by_dx = kT*(2.0*1 + 4.0*log(X) + -2.0*X) + -2.0*dX_by_dx*kT*n + 4.0*dX_by_dx*kT*n/X;
+	double 	dFassoc_by_dx = kT*(2.0*1 + 4.0*vm_log(X) + -2.0*X) + -2.0*dX_by_dx*kT*n + 4.0*dX_by_dx*kT*n/X;
 	double 	a1 = epsilon_dispersion*eta_d*ghs*(-4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + 4.0);
 	double 	da1_by_dx = dghs_by_dx*epsilon_dispersion*eta_d*(-4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + 4.0) + deta_d_by_dx*epsilon_dispersion*ghs*(-4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + 4.0);
 	double 	da1integrated_by_dx = da1_by_dx*n + a1;
@@ -721,10 +716,10 @@ double derive(double kT, double x) const {
 	double 	dFdisp_by_dx = da2integrated_by_dx + da1integrated_by_dx;
 	double 	gpermol = 1822.8885;
 	double 	mH2O = 18.01528*gpermol;
-	double 	dFideal_by_dx = kT*(-1.0*1 + log(15.74960994572242*n/(sqrt(kT)*kT*sqrt(mH2O)*mH2O))) + kT;
-	double 	dphi1_by_dx = dn3_by_dx*n0/(1 + -1.0*n3) + -1.0*dn0_by_dx*log(1 + -1.0*n3);
+	double 	dFideal_by_dx = kT*(-1.0*1 + vm_log(15.74960994572242*n/(sqrt(kT)*kT*sqrt(mH2O)*mH2O))) + kT;
+	double 	dphi1_by_dx = dn3_by_dx*n0/(1 + -1.0*n3) + -1.0*dn0_by_dx*vm_log(1 + -1.0*n3);
 	double 	dphi2_by_dx = dn3_by_dx*(n1*n2 + -1.0*n1v_dot_n2v)/((1 + -1.0*n3)*(1 + -1.0*n3)) + dn2_by_dx*n1/(1 + -1.0*n3) + -1.0*dn1v_dot_n2v_by_dx/(1 + -1.0*n3) + dn1_by_dx*n2/(1 + -1.0*n3);
-	double 	dphi3_by_dx = -8.841941282883075e-3*dn3_by_dx*n2*n2*n2/((1 + -1.0*n3)*(1 + -1.0*n3)*(1 + -1.0*n3)) + -1.0*dn3_by_dx*n2*n2*n2*(8.841941282883075e-3*1/n3 + -1.768388256576615e-2)/(n3*(1 + -1.0*n3)*(1 + -1.0*n3)*(1 + -1.0*n3)) + -1.0*dn3_by_dx*n2*n2*n2*(log(1 + -1.0*n3)*(8.841941282883075e-3*1/n3 + -1.768388256576615e-2) + 8.841941282883075e-3)/(n3*n3*(1 + -1.0*n3)*(1 + -1.0*n3)) + -8.841941282883075e-3*dn3_by_dx*n2*n2*n2*log(1 + -1.0*n3)/(n3*n3*n3*(1 + -1.0*n3)*(1 + -1.0*n3)) + 2.0*dn3_by_dx*n2*(n2vsqr*((log(1 + -1.0*n3)*(-2.6525823848649224e-2*1/n3 + 5.305164769729845e-2) + -2.6525823848649224e-2)/n3 + -2.6525823848649224e-2*log(1 + -1.0*n3)) + n2*n2*((log(1 + -1.0*n3)*(8.841941282883075e-3*1/n3 + -1.768388256576615e-2) + 8.841941282883075e-3)/n3 + 8.841941282883075e-3*log(1 + -1.0*n3)))/((1 + -1.0*n3)*(1 + -1.0*n3)*(1 + -1.0*n3)) + 2.6525823848649224e-2*dn3_by_dx*n2*n2vsqr/((1 + -1.0*n3)*(1 + -1.0*n3)*(1 + -1.0*n3)) + -1.0*dn3_by_dx*n2*n2vsqr*(-2.6525823848649224e-2*1/n3 + 5.305164769729845e-2)/(n3*(1 + -1.0*n3)*(1 + -1.0*n3)*(1 + -1.0*n3)) + -1.0*dn3_by_dx*n2*n2vsqr*(log(1 + -1.0*n3)*(-2.6525823848649224e-2*1/n3 + 5.305164769729845e-2) + -2.6525823848649224e-2)/(n3*n3*(1 + -1.0*n3)*(1 + -1.0*n3)) + 2.6525823848649224e-2*dn3_by_dx*n2*n2vsqr*log(1 + -1.0*n3)/(n3*n3*n3*(1 + -1.0*n3)*(1 + -1.0*n3)) + dn2vsqr_by_dx*n2*((log(1 + -1.0*n3)*(-2.6525823848649224e-2*1/n3 + 5.305164769729845e-2) + -2.6525823848649224e-2)/n3 + -2.6525823848649224e-2*log(1 + -1.0*n3))/((1 + -1.0*n3)*(1 + -1.0*n3)) + dn2_by_dx*(n2vsqr*((log(1 + -1.0*n3)*(-2.6525823848649224e-2*1/n3 + 5.305164769729845e-2) + -2.6525823848649224e-2)/n3 + -2.6525823848649224e-2*log(1 + -1.0*n3)) + n2*n2*((log(1 + -1.0*n3)*(8.841941282883075e-3*1/n3 + -1.768388256576615e-2) + 8.841941282883075e-3)/n3 + 8.841941282883075e-3*log(1 + -1.0*n3)))/((1 + -1.0*n3)*(1 + -1.0*n3)) + 2.0*dn2_by_dx*n2*n2*((log(1 + -1.0*n3)*(8.841941282883075e-3*1/n3 + -1.768388256576615e-2) + 8.841941282883075e-3)/n3 + 8.841941282883075e-3*log(1 + -1.0*n3))/((1 + -1.0*n3)*(1 + -1.0*n3));
+	double 	dphi3_by_dx = -8.841941282883075e-3*dn3_by_dx*n2*n2*n2/((1 + -1.0*n3)*(1 + -1.0*n3)*(1 + -1.0*n3)) + -1.0*dn3_by_dx*n2*n2*n2*(8.841941282883075e-3*1/n3 + -1.768388256576615e-2)/(n3*(1 + -1.0*n3)*(1 + -1.0*n3)*(1 + -1.0*n3)) + -1.0*dn3_by_dx*n2*n2*n2*(vm_log(1 + -1.0*n3)*(8.841941282883075e-3*1/n3 + -1.768388256576615e-2) + 8.841941282883075e-3)/(n3*n3*(1 + -1.0*n3)*(1 + -1.0*n3)) + -8.841941282883075e-3*dn3_by_dx*n2*n2*n2*vm_log(1 + -1.0*n3)/(n3*n3*n3*(1 + -1.0*n3)*(1 + -1.0*n3)) + 2.0*dn3_by_dx*n2*(n2vsqr*((vm_log(1 + -1.0*n3)*(-2.6525823848649224e-2*1/n3 + 5.305164769729845e-2) + -2.6525823848649224e-2)/n3 + -2.6525823848649224e-2*vm_log(1 + -1.0*n3)) + n2*n2*((vm_log(1 + -1.0*n3)*(8.841941282883075e-3*1/n3 + -1.768388256576615e-2) + 8.841941282883075e-3)/n3 + 8.841941282883075e-3*vm_log(1 + -1.0*n3)))/((1 + -1.0*n3)*(1 + -1.0*n3)*(1 + -1.0*n3)) + 2.6525823848649224e-2*dn3_by_dx*n2*n2vsqr/((1 + -1.0*n3)*(1 + -1.0*n3)*(1 + -1.0*n3)) + -1.0*dn3_by_dx*n2*n2vsqr*(-2.6525823848649224e-2*1/n3 + 5.305164769729845e-2)/(n3*(1 + -1.0*n3)*(1 + -1.0*n3)*(1 + -1.0*n3)) + -1.0*dn3_by_dx*n2*n2vsqr*(vm_log(1 + -1.0*n3)*(-2.6525823848649224e-2*1/n3 + 5.305164769729845e-2) + -2.6525823848649224e-2)/(n3*n3*(1 + -1.0*n3)*(1 + -1.0*n3)) + 2.6525823848649224e-2*dn3_by_dx*n2*n2vsqr*vm_log(1 + -1.0*n3)/(n3*n3*n3*(1 + -1.0*n3)*(1 + -1.0*n3)) + dn2vsqr_by_dx*n2*((vm_log(1 + -1.0*n3)*(-2.6525823848649224e-2*1/n3 + 5.305164769729845e-2) + -2.6525823848649224e-2)/n3 + -2.6525823848649224e-2*vm_log(1 + -1.0*n3))/((1 + -1.0*n3)*(1 + -1.0*n3)) + dn2_by_dx*(n2vsqr*((vm_log(1 + -1.0*n3)*(-2.6525823848649224e-2*1/n3 + 5.305164769729845e-2) + -2.6525823848649224e-2)/n3 + -2.6525823848649224e-2*vm_log(1 + -1.0*n3)) + n2*n2*((vm_log(1 + -1.0*n3)*(8.841941282883075e-3*1/n3 + -1.768388256576615e-2) + 8.841941282883075e-3)/n3 + 8.841941282883075e-3*vm_log(1 + -1.0*n3)))/((1 + -1.0*n3)*(1 + -1.0*n3)) + 2.0*dn2_by_dx*n2*n2*((vm_log(1 + -1.0*n3)*(8.841941282883075e-3*1/n3 + -1.768388256576615e-2) + 8.841941282883075e-3)/n3 + 8.841941282883075e-3*vm_log(1 + -1.0*n3))/((1 + -1.0*n3)*(1 + -1.0*n3));
 	double 	dwhitebear_by_dx = dphi3_by_dx*kT + dphi2_by_dx*kT + dphi1_by_dx*kT;
 	double 	dFSAFT_by_dx = mu + dwhitebear_by_dx + dFideal_by_dx + dFdisp_by_dx + dFassoc_by_dx;
 	output = dFSAFT_by_dx;
@@ -768,7 +763,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 		const RelativeReciprocal rvec((xa>gd.Nx/2) ? xa - gd.Nx : xa, (y>gd.Ny/2) ? y - gd.Ny : y, z);
 		const Reciprocal k_i = gd.Lat.toReciprocal(rvec);
 		const complex t1 = sqrt(k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0]);
-		ktemp1[i] = ktemp0[i]*(12.566370614359172*R*sin(R*t1)*exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1*t1)/t1);
+		ktemp1[i] = ktemp0[i]*(12.566370614359172*R*sin(R*t1)*vm_exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1*t1)/t1);
 	}
 
 	VectorXd rtemp2(gd.NxNyNz);
@@ -785,7 +780,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 		const Reciprocal k_i = gd.Lat.toReciprocal(rvec);
 		const complex t1 = k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0];
 		const complex t2 = R*sqrt(t1);
-		ktemp3[i] = ktemp0[i]*(12.566370614359172*complex(0,1)*k_i[0]*exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1)*(-1.0*sin(t2)/(sqrt(t1)) + R*cos(t2))/t1);
+		ktemp3[i] = ktemp0[i]*(12.566370614359172*complex(0,1)*k_i[0]*vm_exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1)*(-1.0*sin(t2)/(sqrt(t1)) + R*cos(t2))/t1);
 	}
 
 	VectorXd rtemp4(gd.NxNyNz);
@@ -807,7 +802,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 		const Reciprocal k_i = gd.Lat.toReciprocal(rvec);
 		const complex t1 = k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0];
 		const complex t2 = R*sqrt(t1);
-		ktemp5[i] = ktemp0[i]*(12.566370614359172*exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1)*(-1.0*t2*cos(t2) + sin(t2))/(sqrt(t1)*t1));
+		ktemp5[i] = ktemp0[i]*(12.566370614359172*vm_exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1)*(-1.0*t2*cos(t2) + sin(t2))/(sqrt(t1)*t1));
 	}
 
 	VectorXd rtemp6(gd.NxNyNz);
@@ -837,7 +832,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 		const RelativeReciprocal rvec((xa>gd.Nx/2) ? xa - gd.Nx : xa, (y>gd.Ny/2) ? y - gd.Ny : y, z);
 		const Reciprocal k_i = gd.Lat.toReciprocal(rvec);
 		const complex t1 = sqrt(k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0]);
-		ktemp9[i] = ktemp0[i]*(25.132741228718345*R*sin(2.0*R*t1)*exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1*t1)/t1);
+		ktemp9[i] = ktemp0[i]*(25.132741228718345*R*sin(2.0*R*t1)*vm_exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1*t1)/t1);
 	}
 
 	VectorXd rtemp10(gd.NxNyNz);
@@ -859,7 +854,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 		const RelativeReciprocal rvec((xa>gd.Nx/2) ? xa - gd.Nx : xa, (y>gd.Ny/2) ? y - gd.Ny : y, z);
 		const Reciprocal k_i = gd.Lat.toReciprocal(rvec);
 		const complex t1 = sqrt(k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0]);
-		ktemp11[i] = ktemp0[i]*(25.132741228718345*R*sin(2.0*R*t1)*exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1*t1)/t1);
+		ktemp11[i] = ktemp0[i]*(25.132741228718345*R*sin(2.0*R*t1)*vm_exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1*t1)/t1);
 	}
 
 	VectorXd rtemp12(gd.NxNyNz);
@@ -880,7 +875,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 		const int xa = (n-y)/gd.Ny;
 		const RelativeReciprocal rvec((xa>gd.Nx/2) ? xa - gd.Nx : xa, (y>gd.Ny/2) ? y - gd.Ny : y, z);
 		const Reciprocal k_i = gd.Lat.toReciprocal(rvec);
-		ktemp13[i] = ktemp0[i]*exp(-4.0*R*R*lambda_dispersion*lambda_dispersion*length_scaling*length_scaling*(0.5*k_i[2]*k_i[2] + 0.5*k_i[1]*k_i[1] + 0.5*k_i[0]*k_i[0]));
+		ktemp13[i] = ktemp0[i]*vm_exp(-4.0*R*R*lambda_dispersion*lambda_dispersion*length_scaling*length_scaling*(0.5*k_i[2]*k_i[2] + 0.5*k_i[1]*k_i[1] + 0.5*k_i[0]*k_i[0]));
 	}
 
 	VectorXd rtemp14(gd.NxNyNz);
@@ -907,7 +902,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 		const Reciprocal k_i = gd.Lat.toReciprocal(rvec);
 		const complex t1 = k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0];
 		const complex t2 = R*sqrt(t1);
-		ktemp17[i] = ktemp0[i]*(12.566370614359172*complex(0,1)*k_i[1]*exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1)*(-1.0*sin(t2)/(sqrt(t1)) + R*cos(t2))/t1);
+		ktemp17[i] = ktemp0[i]*(12.566370614359172*complex(0,1)*k_i[1]*vm_exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1)*(-1.0*sin(t2)/(sqrt(t1)) + R*cos(t2))/t1);
 	}
 
 	VectorXd rtemp18(gd.NxNyNz);
@@ -932,7 +927,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 		const Reciprocal k_i = gd.Lat.toReciprocal(rvec);
 		const complex t1 = k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0];
 		const complex t2 = R*sqrt(t1);
-		ktemp0[i] = ktemp0[i]*(12.566370614359172*complex(0,1)*k_i[2]*exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1)*(-1.0*sin(t2)/(sqrt(t1)) + R*cos(t2))/t1);
+		ktemp0[i] = ktemp0[i]*(12.566370614359172*complex(0,1)*k_i[2]*vm_exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1)*(-1.0*sin(t2)/(sqrt(t1)) + R*cos(t2))/t1);
 	}
 
 	VectorXd rtemp22(gd.NxNyNz);
@@ -949,7 +944,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 	rtemp23.resize(0); // Realspace
 	VectorXd rtemp25(gd.NxNyNz);
 	for (int i=0; i<gd.NxNyNz; i++) {
-		rtemp25[i] = -1.0*log(1 + -1.0*rtemp6[i]);
+		rtemp25[i] = -1.0*vm_log(1 + -1.0*rtemp6[i]);
 	}
 
 	VectorXcd ktemp26(gd.NxNyNzOver2);
@@ -964,7 +959,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 		const double t5 = rtemp4[i]*rtemp4[i];
 		const double t6 = 1/t1;
 		const double t7 = 1/rtemp6[i];
-		rtemp27[i] = t7*t7*rtemp7[i]*(-3.0*t5 + t4 + -3.0*t3 + -3.0*t2)*(t6*((-1.768388256576615e-2*t7 + 1.768388256576615e-2*t6)*(log(t1)/(t6*t6) + rtemp6[i]) + 8.841941282883075e-3) + -8.841941282883075e-3*1 + 1.768388256576615e-2*rtemp25[i]) + t6*(t6*(-7.957747154594767e-2*t5 + 7.957747154594767e-2*t4 + -7.957747154594767e-2*t3 + -7.957747154594767e-2*t2) + 7.957747154594767e-2*rtemp2[i]/R)/R;
+		rtemp27[i] = t7*t7*rtemp7[i]*(-3.0*t5 + t4 + -3.0*t3 + -3.0*t2)*(t6*((-1.768388256576615e-2*t7 + 1.768388256576615e-2*t6)*(vm_log(t1)/(t6*t6) + rtemp6[i]) + 8.841941282883075e-3) + -8.841941282883075e-3*1 + 1.768388256576615e-2*rtemp25[i]) + t6*(t6*(-7.957747154594767e-2*t5 + 7.957747154594767e-2*t4 + -7.957747154594767e-2*t3 + -7.957747154594767e-2*t2) + 7.957747154594767e-2*rtemp2[i]/R)/R;
 	}
 
 	VectorXcd ktemp28(gd.NxNyNzOver2);
@@ -974,7 +969,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 	VectorXd rtemp29(gd.NxNyNz);
 	for (int i=0; i<gd.NxNyNz; i++) {
 		const double t1 = 1 + -1.0*rtemp6[i];
-		rtemp29[i] = ((t1*t1*log(t1) + rtemp6[i])*(-2.6525823848649224e-2*rtemp4[i]*rtemp4[i] + 2.6525823848649224e-2*rtemp2[i]*rtemp2[i] + -2.6525823848649224e-2*rtemp22[i]*rtemp22[i] + -2.6525823848649224e-2*rtemp18[i]*rtemp18[i])/(t1*rtemp6[i]*rtemp6[i]) + 7.957747154594767e-2*rtemp2[i]/R)/t1;
+		rtemp29[i] = ((t1*t1*vm_log(t1) + rtemp6[i])*(-2.6525823848649224e-2*rtemp4[i]*rtemp4[i] + 2.6525823848649224e-2*rtemp2[i]*rtemp2[i] + -2.6525823848649224e-2*rtemp22[i]*rtemp22[i] + -2.6525823848649224e-2*rtemp18[i]*rtemp18[i])/(t1*rtemp6[i]*rtemp6[i]) + 7.957747154594767e-2*rtemp2[i]/R)/t1;
 	}
 
 	VectorXcd ktemp30(gd.NxNyNzOver2);
@@ -995,7 +990,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 		const RelativeReciprocal rvec((xa>gd.Nx/2) ? xa - gd.Nx : xa, (y>gd.Ny/2) ? y - gd.Ny : y, z);
 		const Reciprocal k_i = gd.Lat.toReciprocal(rvec);
 		const complex t1 = sin(R*sqrt(k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0]));
-		const complex t2 = exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*(k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0]));
+		const complex t2 = vm_exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*(k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0]));
 		const complex t3 = 1/(sqrt(k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0]));
 		const complex t4 = t1*t3;
 		ktemp30[i] = -1.0*ktemp30[i]*(12.566370614359172*t2*(-1.0*R*cos(R/t3) + -1.0*t4)) + ktemp28[i]*(12.566370614359172*R*t2*t4);
@@ -1005,7 +1000,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 	VectorXd rtemp32(gd.NxNyNz);
 	for (int i=0; i<gd.NxNyNz; i++) {
 		const double t1 = 1 + -1.0*rtemp6[i];
-		rtemp32[i] = rtemp4[i]*(-5.305164769729845e-2*rtemp7[i]*(t1*t1*log(t1) + rtemp6[i])/(rtemp6[i]*rtemp6[i]) + -7.957747154594767e-2*1/R)/t1;
+		rtemp32[i] = rtemp4[i]*(-5.305164769729845e-2*rtemp7[i]*(t1*t1*vm_log(t1) + rtemp6[i])/(rtemp6[i]*rtemp6[i]) + -7.957747154594767e-2*1/R)/t1;
 	}
 
 	VectorXcd ktemp33(gd.NxNyNzOver2);
@@ -1026,14 +1021,14 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 		const RelativeReciprocal rvec((xa>gd.Nx/2) ? xa - gd.Nx : xa, (y>gd.Ny/2) ? y - gd.Ny : y, z);
 		const Reciprocal k_i = gd.Lat.toReciprocal(rvec);
 		const complex t1 = sqrt(k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0]);
-		ktemp33[i] = ktemp33[i]*(12.566370614359172*R*complex(0,1)*k_i[0]*sin(R*t1)*exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1*t1)/t1) + ktemp30[i];
+		ktemp33[i] = ktemp33[i]*(12.566370614359172*R*complex(0,1)*k_i[0]*sin(R*t1)*vm_exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1*t1)/t1) + ktemp30[i];
 	}
 
 	ktemp30.resize(0); // KSpace
 	VectorXd rtemp35(gd.NxNyNz);
 	for (int i=0; i<gd.NxNyNz; i++) {
 		const double t1 = 1 + -1.0*rtemp6[i];
-		rtemp35[i] = rtemp18[i]*(-5.305164769729845e-2*rtemp7[i]*(t1*t1*log(t1) + rtemp6[i])/(rtemp6[i]*rtemp6[i]) + -7.957747154594767e-2*1/R)/t1;
+		rtemp35[i] = rtemp18[i]*(-5.305164769729845e-2*rtemp7[i]*(t1*t1*vm_log(t1) + rtemp6[i])/(rtemp6[i]*rtemp6[i]) + -7.957747154594767e-2*1/R)/t1;
 	}
 
 	VectorXcd ktemp36(gd.NxNyNzOver2);
@@ -1054,14 +1049,14 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 		const RelativeReciprocal rvec((xa>gd.Nx/2) ? xa - gd.Nx : xa, (y>gd.Ny/2) ? y - gd.Ny : y, z);
 		const Reciprocal k_i = gd.Lat.toReciprocal(rvec);
 		const complex t1 = sqrt(k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0]);
-		ktemp36[i] = ktemp36[i]*(12.566370614359172*R*complex(0,1)*k_i[1]*sin(R*t1)*exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1*t1)/t1) + ktemp33[i];
+		ktemp36[i] = ktemp36[i]*(12.566370614359172*R*complex(0,1)*k_i[1]*sin(R*t1)*vm_exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1*t1)/t1) + ktemp33[i];
 	}
 
 	ktemp33.resize(0); // KSpace
 	VectorXd rtemp38(gd.NxNyNz);
 	for (int i=0; i<gd.NxNyNz; i++) {
 		const double t1 = 1 + -1.0*rtemp6[i];
-		rtemp38[i] = rtemp22[i]*(-5.305164769729845e-2*rtemp7[i]*(t1*t1*log(t1) + rtemp6[i])/(rtemp6[i]*rtemp6[i]) + -7.957747154594767e-2*1/R)/t1;
+		rtemp38[i] = rtemp22[i]*(-5.305164769729845e-2*rtemp7[i]*(t1*t1*vm_log(t1) + rtemp6[i])/(rtemp6[i]*rtemp6[i]) + -7.957747154594767e-2*1/R)/t1;
 	}
 
 	VectorXcd ktemp39(gd.NxNyNzOver2);
@@ -1082,7 +1077,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 		const RelativeReciprocal rvec((xa>gd.Nx/2) ? xa - gd.Nx : xa, (y>gd.Ny/2) ? y - gd.Ny : y, z);
 		const Reciprocal k_i = gd.Lat.toReciprocal(rvec);
 		const complex t1 = sqrt(k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0]);
-		ktemp39[i] = ktemp39[i]*(12.566370614359172*R*complex(0,1)*k_i[2]*sin(R*t1)*exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1*t1)/t1) + ktemp36[i];
+		ktemp39[i] = ktemp39[i]*(12.566370614359172*R*complex(0,1)*k_i[2]*sin(R*t1)*vm_exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1*t1)/t1) + ktemp36[i];
 	}
 
 	ktemp36.resize(0); // KSpace
@@ -1099,7 +1094,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 		const int xa = (n-y)/gd.Ny;
 		const RelativeReciprocal rvec((xa>gd.Nx/2) ? xa - gd.Nx : xa, (y>gd.Ny/2) ? y - gd.Ny : y, z);
 		const Reciprocal k_i = gd.Lat.toReciprocal(rvec);
-		const complex t1 = exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*(k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0]));
+		const complex t1 = vm_exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*(k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0]));
 		const complex t2 = -1.0*sin(R*sqrt(k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0]))/(sqrt(k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0])) + R*cos(R*sqrt(k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0]));
 		const complex t3 = k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0];
 		const complex t4 = 12.566370614359172*t1*(-1.0*sin(R*sqrt(t3))/(sqrt(t3)) + -1.0*R*cos(R*sqrt(t3)));
@@ -1119,7 +1114,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 	ktemp39.resize(0); // KSpace
 	VectorXd rtemp43(gd.NxNyNz);
 	for (int i=0; i<gd.NxNyNz; i++) {
-		const double t1 = -1.0*1 + exp(epsilon_association/kT);
+		const double t1 = -1.0*1 + vm_exp(epsilon_association/kT);
 		const double t2 = 1/(sqrt(0.15915494309189535*kappa_association*t1*rtemp10[i]*(rtemp42[i]/rtemp12[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp14[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -0.5*lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp14[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(4.1887902047863905*rtemp14[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + R*R*R*rtemp14[i]*rtemp14[i]*(73.49635953848843*R*R*R*rtemp14[i]*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -2.0943951023931953*rtemp14[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp14[i]*rtemp14[i]*(73.49635953848843*R*R*R*rtemp14[i]*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)))/kT)/(R*R) + 1) + -1.0);
 		const double t3 = 1/(sqrt(0.15915494309189535*kappa_association*t1*rtemp10[i]*(rtemp42[i]/rtemp12[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp14[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -0.5*lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp14[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(4.1887902047863905*rtemp14[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + R*R*R*rtemp14[i]*rtemp14[i]*(73.49635953848843*R*R*R*rtemp14[i]*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -2.0943951023931953*rtemp14[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp14[i]*rtemp14[i]*(73.49635953848843*R*R*R*rtemp14[i]*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)))/kT)/(R*R) + 1));
 		const double t4 = 1/(rtemp42[i]/rtemp12[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp14[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -0.5*lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp14[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(4.1887902047863905*rtemp14[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + R*R*R*rtemp14[i]*rtemp14[i]*(73.49635953848843*R*R*R*rtemp14[i]*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -2.0943951023931953*rtemp14[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp14[i]*rtemp14[i]*(73.49635953848843*R*R*R*rtemp14[i]*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)))/kT);
@@ -1144,7 +1139,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 		const RelativeReciprocal rvec((xa>gd.Nx/2) ? xa - gd.Nx : xa, (y>gd.Ny/2) ? y - gd.Ny : y, z);
 		const Reciprocal k_i = gd.Lat.toReciprocal(rvec);
 		const complex t1 = sqrt(k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0]);
-		ktemp44[i] = ktemp44[i]*sin(R*t1)*exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1*t1)/t1;
+		ktemp44[i] = ktemp44[i]*sin(R*t1)*vm_exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1*t1)/t1;
 	}
 
 	VectorXd rtemp46(gd.NxNyNz);
@@ -1153,7 +1148,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 	ktemp44.resize(0); // KSpace
 	VectorXd rtemp47(gd.NxNyNz);
 	for (int i=0; i<gd.NxNyNz; i++) {
-		const double t1 = -1.0*1 + exp(epsilon_association/kT);
+		const double t1 = -1.0*1 + vm_exp(epsilon_association/kT);
 		const double t2 = 1/(sqrt(0.15915494309189535*kappa_association*t1*rtemp10[i]*(rtemp42[i]/rtemp12[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp14[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -0.5*lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp14[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(4.1887902047863905*rtemp14[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + R*R*R*rtemp14[i]*rtemp14[i]*(73.49635953848843*R*R*R*rtemp14[i]*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -2.0943951023931953*rtemp14[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp14[i]*rtemp14[i]*(73.49635953848843*R*R*R*rtemp14[i]*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)))/kT)/(R*R) + 1) + -1.0);
 		const double t3 = 1/(sqrt(0.15915494309189535*kappa_association*t1*rtemp10[i]*(rtemp42[i]/rtemp12[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp14[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -0.5*lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp14[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(4.1887902047863905*rtemp14[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + R*R*R*rtemp14[i]*rtemp14[i]*(73.49635953848843*R*R*R*rtemp14[i]*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -2.0943951023931953*rtemp14[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp14[i]*rtemp14[i]*(73.49635953848843*R*R*R*rtemp14[i]*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)))/kT)/(R*R) + 1));
 		const double t4 = 1/(rtemp42[i]/rtemp12[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp14[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -0.5*lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp14[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(4.1887902047863905*rtemp14[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + R*R*R*rtemp14[i]*rtemp14[i]*(73.49635953848843*R*R*R*rtemp14[i]*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -2.0943951023931953*rtemp14[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp14[i]*rtemp14[i]*(73.49635953848843*R*R*R*rtemp14[i]*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)))/kT);
@@ -1174,7 +1169,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 		const RelativeReciprocal rvec((xa>gd.Nx/2) ? xa - gd.Nx : xa, (y>gd.Ny/2) ? y - gd.Ny : y, z);
 		const Reciprocal k_i = gd.Lat.toReciprocal(rvec);
 		const complex t1 = sqrt(k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0]);
-		ktemp49[i] = ktemp48[i]*complex(0,1)*k_i[0]*sin(R*t1)*exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1*t1)/t1;
+		ktemp49[i] = ktemp48[i]*complex(0,1)*k_i[0]*sin(R*t1)*vm_exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1*t1)/t1;
 	}
 
 	VectorXd rtemp50(gd.NxNyNz);
@@ -1184,7 +1179,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 	VectorXd rtemp51(gd.NxNyNz);
 	for (int i=0; i<gd.NxNyNz; i++) {
 		const double t1 = rtemp42[i]/rtemp12[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp14[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -0.5*lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp14[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(4.1887902047863905*rtemp14[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + R*R*R*rtemp14[i]*rtemp14[i]*(73.49635953848843*R*R*R*rtemp14[i]*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -2.0943951023931953*rtemp14[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp14[i]*rtemp14[i]*(73.49635953848843*R*R*R*rtemp14[i]*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)))/kT;
-		rtemp51[i] = kT*x[i]/(t1*rtemp12[i]*sqrt(0.15915494309189535*kappa_association*t1*rtemp10[i]*(-1.0*1 + exp(epsilon_association/kT))/(R*R) + 1));
+		rtemp51[i] = kT*x[i]/(t1*rtemp12[i]*sqrt(0.15915494309189535*kappa_association*t1*rtemp10[i]*(-1.0*1 + vm_exp(epsilon_association/kT))/(R*R) + 1));
 	}
 
 	VectorXcd ktemp52(gd.NxNyNzOver2);
@@ -1205,7 +1200,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 		const Reciprocal k_i = gd.Lat.toReciprocal(rvec);
 		const complex t1 = k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0];
 		const complex t2 = R*sqrt(t1);
-		ktemp52[i] = ktemp52[i]*exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1)*(-1.0*sin(t2)/(sqrt(t1)) + -1.0*R*cos(t2));
+		ktemp52[i] = ktemp52[i]*vm_exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1)*(-1.0*sin(t2)/(sqrt(t1)) + -1.0*R*cos(t2));
 	}
 
 	VectorXd rtemp54(gd.NxNyNz);
@@ -1214,7 +1209,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 	ktemp52.resize(0); // KSpace
 	VectorXd rtemp55(gd.NxNyNz);
 	for (int i=0; i<gd.NxNyNz; i++) {
-		const double t1 = -1.0*1 + exp(epsilon_association/kT);
+		const double t1 = -1.0*1 + vm_exp(epsilon_association/kT);
 		const double t2 = sqrt(0.15915494309189535*kappa_association*t1*rtemp10[i]*(rtemp42[i]/rtemp12[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp14[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -0.5*lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp14[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(4.1887902047863905*rtemp14[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + R*R*R*rtemp14[i]*rtemp14[i]*(73.49635953848843*R*R*R*rtemp14[i]*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -2.0943951023931953*rtemp14[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp14[i]*rtemp14[i]*(73.49635953848843*R*R*R*rtemp14[i]*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)))/kT)/(R*R) + 1);
 		rtemp55[i] = 7.957747154594767e-2*kT*kappa_association*t1*rtemp10[i]*x[i]/(R*R*t2*rtemp12[i]*(-1.0*1 + t2));
 	}
@@ -1238,7 +1233,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 		const Reciprocal k_i = gd.Lat.toReciprocal(rvec);
 		const complex t1 = k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0];
 		const complex t2 = R*sqrt(t1);
-		ktemp56[i] = ktemp56[i]*exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1)*(-1.0*sin(t2)/(sqrt(t1)) + -1.0*R*cos(t2));
+		ktemp56[i] = ktemp56[i]*vm_exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1)*(-1.0*sin(t2)/(sqrt(t1)) + -1.0*R*cos(t2));
 	}
 
 	VectorXd rtemp58(gd.NxNyNz);
@@ -1252,7 +1247,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 	rtemp54.resize(0); // Realspace
 	VectorXd rtemp60(gd.NxNyNz);
 	for (int i=0; i<gd.NxNyNz; i++) {
-		const double t1 = 1/(-1.0*1 + exp(epsilon_association/kT));
+		const double t1 = 1/(-1.0*1 + vm_exp(epsilon_association/kT));
 		const double t2 = rtemp42[i]/rtemp12[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp14[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -0.5*lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp14[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(4.1887902047863905*rtemp14[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + R*R*R*rtemp14[i]*rtemp14[i]*(73.49635953848843*R*R*R*rtemp14[i]*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -2.0943951023931953*rtemp14[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp14[i]*rtemp14[i]*(73.49635953848843*R*R*R*rtemp14[i]*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)))/kT;
 		rtemp60[i] = 50.26548245743669*R*R*kT*t1*x[i]*(sqrt(0.15915494309189535*kappa_association*t2*rtemp10[i]/(R*R*t1) + 1) + -1.0)/(kappa_association*t2*t2*rtemp10[i]*rtemp12[i]);
 	}
@@ -1276,7 +1271,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 		const Reciprocal k_i = gd.Lat.toReciprocal(rvec);
 		const complex t1 = k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0];
 		const complex t2 = R*sqrt(t1);
-		ktemp61[i] = ktemp61[i]*exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1)*(-1.0*sin(t2)/(sqrt(t1)) + -1.0*R*cos(t2));
+		ktemp61[i] = ktemp61[i]*vm_exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1)*(-1.0*sin(t2)/(sqrt(t1)) + -1.0*R*cos(t2));
 	}
 
 	VectorXd rtemp63(gd.NxNyNz);
@@ -1320,7 +1315,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 		const Reciprocal k_i = gd.Lat.toReciprocal(rvec);
 		const complex t1 = k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0];
 		const complex t2 = R*sqrt(t1);
-		ktemp66[i] = ktemp66[i]*exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1)*(-1.0*sin(t2)/(sqrt(t1)) + -1.0*R*cos(t2));
+		ktemp66[i] = ktemp66[i]*vm_exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1)*(-1.0*sin(t2)/(sqrt(t1)) + -1.0*R*cos(t2));
 	}
 
 	VectorXd rtemp68(gd.NxNyNz);
@@ -1334,7 +1329,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 	rtemp63.resize(0); // Realspace
 	VectorXd rtemp70(gd.NxNyNz);
 	for (int i=0; i<gd.NxNyNz; i++) {
-		const double t1 = -1.0*1 + exp(epsilon_association/kT);
+		const double t1 = -1.0*1 + vm_exp(epsilon_association/kT);
 		const double t2 = 1/(sqrt(0.15915494309189535*kappa_association*t1*rtemp10[i]*(rtemp42[i]/rtemp12[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp14[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -0.5*lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp14[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(4.1887902047863905*rtemp14[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + R*R*R*rtemp14[i]*rtemp14[i]*(73.49635953848843*R*R*R*rtemp14[i]*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -2.0943951023931953*rtemp14[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp14[i]*rtemp14[i]*(73.49635953848843*R*R*R*rtemp14[i]*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)))/kT)/(R*R) + 1) + -1.0);
 		const double t3 = 1/(sqrt(0.15915494309189535*kappa_association*t1*rtemp10[i]*(rtemp42[i]/rtemp12[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp14[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -0.5*lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp14[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(4.1887902047863905*rtemp14[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + R*R*R*rtemp14[i]*rtemp14[i]*(73.49635953848843*R*R*R*rtemp14[i]*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -2.0943951023931953*rtemp14[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp14[i]*rtemp14[i]*(73.49635953848843*R*R*R*rtemp14[i]*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)))/kT)/(R*R) + 1));
 		const double t4 = 1/(rtemp42[i]/rtemp12[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp14[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -0.5*lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp14[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(4.1887902047863905*rtemp14[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + R*R*R*rtemp14[i]*rtemp14[i]*(73.49635953848843*R*R*R*rtemp14[i]*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -2.0943951023931953*rtemp14[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp14[i]*rtemp14[i]*(73.49635953848843*R*R*R*rtemp14[i]*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)))/kT);
@@ -1359,7 +1354,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 		const RelativeReciprocal rvec((xa>gd.Nx/2) ? xa - gd.Nx : xa, (y>gd.Ny/2) ? y - gd.Ny : y, z);
 		const Reciprocal k_i = gd.Lat.toReciprocal(rvec);
 		const complex t1 = sqrt(k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0]);
-		ktemp71[i] = ktemp71[i]*sin(R*t1)*exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1*t1)/t1;
+		ktemp71[i] = ktemp71[i]*sin(R*t1)*vm_exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1*t1)/t1;
 	}
 
 	VectorXd rtemp73(gd.NxNyNz);
@@ -1367,7 +1362,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 
 	VectorXd rtemp74(gd.NxNyNz);
 	for (int i=0; i<gd.NxNyNz; i++) {
-		const double t1 = -1.0*1 + exp(epsilon_association/kT);
+		const double t1 = -1.0*1 + vm_exp(epsilon_association/kT);
 		const double t2 = 1/(sqrt(0.15915494309189535*kappa_association*t1*rtemp10[i]*(rtemp42[i]/rtemp12[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp14[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -0.5*lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp14[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(4.1887902047863905*rtemp14[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + R*R*R*rtemp14[i]*rtemp14[i]*(73.49635953848843*R*R*R*rtemp14[i]*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -2.0943951023931953*rtemp14[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp14[i]*rtemp14[i]*(73.49635953848843*R*R*R*rtemp14[i]*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)))/kT)/(R*R) + 1) + -1.0);
 		const double t3 = 1/(sqrt(0.15915494309189535*kappa_association*t1*rtemp10[i]*(rtemp42[i]/rtemp12[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp14[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -0.5*lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp14[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(4.1887902047863905*rtemp14[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + R*R*R*rtemp14[i]*rtemp14[i]*(73.49635953848843*R*R*R*rtemp14[i]*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -2.0943951023931953*rtemp14[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp14[i]*rtemp14[i]*(73.49635953848843*R*R*R*rtemp14[i]*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)))/kT)/(R*R) + 1));
 		const double t4 = 1/(rtemp42[i]/rtemp12[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp14[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -0.5*lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp14[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(4.1887902047863905*rtemp14[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + R*R*R*rtemp14[i]*rtemp14[i]*(73.49635953848843*R*R*R*rtemp14[i]*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -2.0943951023931953*rtemp14[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp14[i]*rtemp14[i]*(73.49635953848843*R*R*R*rtemp14[i]*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)))/kT);
@@ -1394,7 +1389,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 		const Reciprocal k_i = gd.Lat.toReciprocal(rvec);
 		const complex t1 = k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0];
 		const complex t2 = R*sqrt(t1);
-		ktemp76[i] = ktemp75[i]*exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1)*(-1.0*sin(t2)/(sqrt(t1)) + -1.0*R*cos(t2)) + 2.0*kT*ktemp1[i];
+		ktemp76[i] = ktemp75[i]*vm_exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1)*(-1.0*sin(t2)/(sqrt(t1)) + -1.0*R*cos(t2)) + 2.0*kT*ktemp1[i];
 	}
 
 	VectorXd rtemp77(gd.NxNyNz);
@@ -1403,7 +1398,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 	ktemp76.resize(0); // KSpace
 	VectorXd rtemp78(gd.NxNyNz);
 	for (int i=0; i<gd.NxNyNz; i++) {
-		const double t1 = -1.0*1 + exp(epsilon_association/kT);
+		const double t1 = -1.0*1 + vm_exp(epsilon_association/kT);
 		const double t2 = 1/(sqrt(0.15915494309189535*kappa_association*t1*rtemp10[i]*(rtemp42[i]/rtemp12[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp14[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -0.5*lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp14[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(4.1887902047863905*rtemp14[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + R*R*R*rtemp14[i]*rtemp14[i]*(73.49635953848843*R*R*R*rtemp14[i]*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -2.0943951023931953*rtemp14[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp14[i]*rtemp14[i]*(73.49635953848843*R*R*R*rtemp14[i]*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)))/kT)/(R*R) + 1) + -1.0);
 		const double t3 = 1/(sqrt(0.15915494309189535*kappa_association*t1*rtemp10[i]*(rtemp42[i]/rtemp12[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp14[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -0.5*lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp14[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(4.1887902047863905*rtemp14[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + R*R*R*rtemp14[i]*rtemp14[i]*(73.49635953848843*R*R*R*rtemp14[i]*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -2.0943951023931953*rtemp14[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp14[i]*rtemp14[i]*(73.49635953848843*R*R*R*rtemp14[i]*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)))/kT)/(R*R) + 1));
 		const double t4 = 1/(rtemp42[i]/rtemp12[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp14[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -0.5*lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp14[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(4.1887902047863905*rtemp14[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + R*R*R*rtemp14[i]*rtemp14[i]*(73.49635953848843*R*R*R*rtemp14[i]*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -2.0943951023931953*rtemp14[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp14[i]*rtemp14[i]*(73.49635953848843*R*R*R*rtemp14[i]*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)))/kT);
@@ -1430,7 +1425,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 		const complex t1 = k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0];
 		const complex t2 = R*sqrt(t1);
 		const complex t3 = sin(t2)/(sqrt(t1));
-		ktemp3[i] = complex(0,1)*k_i[0]*exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1)*(t3*ktemp75[i] + ktemp79[i]*(R*cos(t2) + -1.0*t3)/t1) + 2.0*kT*ktemp3[i]/R;
+		ktemp3[i] = complex(0,1)*k_i[0]*vm_exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1)*(t3*ktemp75[i] + ktemp79[i]*(R*cos(t2) + -1.0*t3)/t1) + 2.0*kT*ktemp3[i]/R;
 	}
 
 	VectorXd rtemp81(gd.NxNyNz);
@@ -1439,7 +1434,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 	ktemp3.resize(0); // KSpace
 	for (int i=0; i<gd.NxNyNz; i++) {
 		const double t1 = 1 + -1.0*rtemp6[i];
-		const double t2 = t1*t1*log(t1) + rtemp6[i];
+		const double t2 = t1*t1*vm_log(t1) + rtemp6[i];
 		const double t3 = 1/t1;
 		const double t4 = 1/rtemp6[i];
 		rtemp81[i] = rtemp4[i]*(t3*t3*rtemp73[i] + t2*t3*t3*t4*t4*rtemp68[i]) + rtemp2[i]*(t3*t4*t4*rtemp4[i]*(rtemp46[i]*(t3*(t2*(-1.768388256576615e-2*t4 + 1.768388256576615e-2*t3) + 8.841941282883075e-3) + -8.841941282883075e-3*1 + 1.768388256576615e-2*rtemp25[i]) + 0.6666666666666667*kT*t2*t3) + t2*t3*t3*t4*t4*rtemp50[i]) + t3*rtemp81[i];
@@ -1459,7 +1454,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 		const RelativeReciprocal rvec((xa>gd.Nx/2) ? xa - gd.Nx : xa, (y>gd.Ny/2) ? y - gd.Ny : y, z);
 		const Reciprocal k_i = gd.Lat.toReciprocal(rvec);
 		const complex t1 = sqrt(k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0]);
-		ktemp84[i] = ktemp48[i]*complex(0,1)*k_i[1]*sin(R*t1)*exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1*t1)/t1;
+		ktemp84[i] = ktemp48[i]*complex(0,1)*k_i[1]*sin(R*t1)*vm_exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1*t1)/t1;
 	}
 
 	VectorXd rtemp85(gd.NxNyNz);
@@ -1482,7 +1477,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 		const complex t1 = k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0];
 		const complex t2 = R*sqrt(t1);
 		const complex t3 = sin(t2)/(sqrt(t1));
-		ktemp17[i] = complex(0,1)*k_i[1]*exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1)*(t3*ktemp75[i] + ktemp79[i]*(R*cos(t2) + -1.0*t3)/t1) + 2.0*kT*ktemp17[i]/R;
+		ktemp17[i] = complex(0,1)*k_i[1]*vm_exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1)*(t3*ktemp75[i] + ktemp79[i]*(R*cos(t2) + -1.0*t3)/t1) + 2.0*kT*ktemp17[i]/R;
 	}
 
 	VectorXd rtemp87(gd.NxNyNz);
@@ -1491,7 +1486,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 	ktemp17.resize(0); // KSpace
 	for (int i=0; i<gd.NxNyNz; i++) {
 		const double t1 = 1 + -1.0*rtemp6[i];
-		const double t2 = t1*t1*log(t1) + rtemp6[i];
+		const double t2 = t1*t1*vm_log(t1) + rtemp6[i];
 		const double t3 = 1/t1;
 		const double t4 = 1/rtemp6[i];
 		rtemp87[i] = rtemp2[i]*(t3*t4*t4*rtemp18[i]*(rtemp46[i]*(t3*(t2*(-1.768388256576615e-2*t4 + 1.768388256576615e-2*t3) + 8.841941282883075e-3) + -8.841941282883075e-3*1 + 1.768388256576615e-2*rtemp25[i]) + 0.6666666666666667*kT*t2*t3) + t2*t3*t3*t4*t4*rtemp85[i]) + rtemp18[i]*(t3*t3*rtemp73[i] + t2*t3*t3*t4*t4*rtemp68[i]) + t3*rtemp87[i];
@@ -1522,7 +1517,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 		const RelativeReciprocal rvec((xa>gd.Nx/2) ? xa - gd.Nx : xa, (y>gd.Ny/2) ? y - gd.Ny : y, z);
 		const Reciprocal k_i = gd.Lat.toReciprocal(rvec);
 		const complex t1 = sqrt(k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0]);
-		ktemp48[i] = ktemp48[i]*complex(0,1)*k_i[2]*sin(R*t1)*exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1*t1)/t1;
+		ktemp48[i] = ktemp48[i]*complex(0,1)*k_i[2]*sin(R*t1)*vm_exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1*t1)/t1;
 	}
 
 	VectorXd rtemp92(gd.NxNyNz);
@@ -1545,7 +1540,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 		const complex t1 = k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0];
 		const complex t2 = R*sqrt(t1);
 		const complex t3 = sin(t2)/(sqrt(t1));
-		ktemp75[i] = complex(0,1)*k_i[2]*exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1)*(t3*ktemp75[i] + ktemp79[i]*(R*cos(t2) + -1.0*t3)/t1) + 2.0*kT*ktemp0[i]/R;
+		ktemp75[i] = complex(0,1)*k_i[2]*vm_exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1)*(t3*ktemp75[i] + ktemp79[i]*(R*cos(t2) + -1.0*t3)/t1) + 2.0*kT*ktemp0[i]/R;
 	}
 
 	ktemp0.resize(0); // KSpace
@@ -1555,7 +1550,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 	ktemp75.resize(0); // KSpace
 	for (int i=0; i<gd.NxNyNz; i++) {
 		const double t1 = 1 + -1.0*rtemp6[i];
-		const double t2 = t1*t1*log(t1) + rtemp6[i];
+		const double t2 = t1*t1*vm_log(t1) + rtemp6[i];
 		const double t3 = 1/t1;
 		const double t4 = 1/rtemp6[i];
 		rtemp94[i] = rtemp2[i]*(t3*t4*t4*rtemp22[i]*(rtemp46[i]*(t3*(t2*(-1.768388256576615e-2*t4 + 1.768388256576615e-2*t3) + 8.841941282883075e-3) + -8.841941282883075e-3*1 + 1.768388256576615e-2*rtemp25[i]) + 0.6666666666666667*kT*t2*t3) + t2*t3*t3*t4*t4*rtemp92[i]) + rtemp22[i]*(t3*t3*rtemp73[i] + t2*t3*t3*t4*t4*rtemp68[i]) + t3*rtemp94[i];
@@ -1586,7 +1581,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 	ktemp89.resize(0); // KSpace
 	VectorXd rtemp98(gd.NxNyNz);
 	for (int i=0; i<gd.NxNyNz; i++) {
-		const double t1 = -1.0*1 + exp(epsilon_association/kT);
+		const double t1 = -1.0*1 + vm_exp(epsilon_association/kT);
 		const double t2 = 1/(sqrt(0.15915494309189535*kappa_association*t1*rtemp10[i]*(rtemp42[i]/rtemp12[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp14[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -0.5*lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp14[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(4.1887902047863905*rtemp14[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + R*R*R*rtemp14[i]*rtemp14[i]*(73.49635953848843*R*R*R*rtemp14[i]*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -2.0943951023931953*rtemp14[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp14[i]*rtemp14[i]*(73.49635953848843*R*R*R*rtemp14[i]*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)))/kT)/(R*R) + 1) + -1.0);
 		const double t3 = -4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1;
 		const double t4 = 1/(sqrt(0.15915494309189535*kappa_association*t1*rtemp10[i]*(rtemp42[i]/rtemp12[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp14[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/t3 + -0.5*lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp14[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/(t3*t3*t3) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(-2.0943951023931953*rtemp14[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + 3.0*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(4.1887902047863905*rtemp14[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + R*R*R*rtemp14[i]*rtemp14[i]*(73.49635953848843*R*R*R*rtemp14[i]*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion))/t3 + -0.5*R*R*R*rtemp14[i]*rtemp14[i]*(73.49635953848843*R*R*R*rtemp14[i]*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion)))/(t3*t3*t3))/kT)/(R*R) + 1));
@@ -1658,13 +1653,13 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 		const Reciprocal k_i = gd.Lat.toReciprocal(rvec);
 		const complex t1 = k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0];
 		const complex t2 = R*sqrt(t1);
-		ktemp99[i] = ktemp99[i]*exp(-2.0*lambda_dispersion*lambda_dispersion*length_scaling*length_scaling*t2*t2) + ktemp96[i]*complex(0,1)*exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1)*(-1.0*sin(t2)/(sqrt(t1)) + R*cos(t2))/t1;
+		ktemp99[i] = ktemp99[i]*vm_exp(-2.0*lambda_dispersion*lambda_dispersion*length_scaling*length_scaling*t2*t2) + ktemp96[i]*complex(0,1)*vm_exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1)*(-1.0*sin(t2)/(sqrt(t1)) + R*cos(t2))/t1;
 	}
 
 	ktemp96.resize(0); // KSpace
 	VectorXd rtemp101(gd.NxNyNz);
 	for (int i=0; i<gd.NxNyNz; i++) {
-		const double t1 = -1.0*1 + exp(epsilon_association/kT);
+		const double t1 = -1.0*1 + vm_exp(epsilon_association/kT);
 		const double t2 = 1/(sqrt(0.15915494309189535*kappa_association*t1*rtemp10[i]*(rtemp42[i]/rtemp12[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp14[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -0.5*lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp14[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(4.1887902047863905*rtemp14[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + R*R*R*rtemp14[i]*rtemp14[i]*(73.49635953848843*R*R*R*rtemp14[i]*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -2.0943951023931953*rtemp14[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp14[i]*rtemp14[i]*(73.49635953848843*R*R*R*rtemp14[i]*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)))/kT)/(R*R) + 1) + -1.0);
 		const double t3 = 1/(sqrt(0.15915494309189535*kappa_association*t1*rtemp10[i]*(rtemp42[i]/rtemp12[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp14[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -0.5*lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp14[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(4.1887902047863905*rtemp14[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + R*R*R*rtemp14[i]*rtemp14[i]*(73.49635953848843*R*R*R*rtemp14[i]*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -2.0943951023931953*rtemp14[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp14[i]*rtemp14[i]*(73.49635953848843*R*R*R*rtemp14[i]*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)))/kT)/(R*R) + 1));
 		const double t4 = rtemp42[i]/rtemp12[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp14[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -0.5*lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp14[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(4.1887902047863905*rtemp14[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + R*R*R*rtemp14[i]*rtemp14[i]*(73.49635953848843*R*R*R*rtemp14[i]*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -2.0943951023931953*rtemp14[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp14[i]*rtemp14[i]*(73.49635953848843*R*R*R*rtemp14[i]*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)))/kT;
@@ -1680,7 +1675,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 	rtemp101.resize(0); // Realspace
 	VectorXd rtemp103(gd.NxNyNz);
 	for (int i=0; i<gd.NxNyNz; i++) {
-		const double t1 = 1/(-1.0*1 + exp(epsilon_association/kT));
+		const double t1 = 1/(-1.0*1 + vm_exp(epsilon_association/kT));
 		const double t2 = sqrt(0.15915494309189535*kappa_association*rtemp10[i]*(rtemp42[i]/rtemp12[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp14[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -0.5*lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp14[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(4.1887902047863905*rtemp14[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + R*R*R*rtemp14[i]*rtemp14[i]*(73.49635953848843*R*R*R*rtemp14[i]*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -2.0943951023931953*rtemp14[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp14[i]*rtemp14[i]*(73.49635953848843*R*R*R*rtemp14[i]*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)))/kT)/(R*R*t1) + 1) + -1.0;
 		const double t3 = 1/(rtemp42[i]/rtemp12[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp14[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -0.5*lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp14[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(4.1887902047863905*rtemp14[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + R*R*R*rtemp14[i]*rtemp14[i]*(73.49635953848843*R*R*R*rtemp14[i]*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -2.0943951023931953*rtemp14[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp14[i]*rtemp14[i]*(73.49635953848843*R*R*R*rtemp14[i]*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)))/kT);
 		const double t4 = 1/(sqrt(0.15915494309189535*kappa_association*rtemp10[i]/(R*R*t1*t3) + 1));
@@ -1705,7 +1700,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 		const RelativeReciprocal rvec((xa>gd.Nx/2) ? xa - gd.Nx : xa, (y>gd.Ny/2) ? y - gd.Ny : y, z);
 		const Reciprocal k_i = gd.Lat.toReciprocal(rvec);
 		const complex t1 = sqrt(k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0]);
-		ktemp104[i] = ktemp104[i]*sin(R*t1)*exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1*t1)/t1;
+		ktemp104[i] = ktemp104[i]*sin(R*t1)*vm_exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1*t1)/t1;
 	}
 
 	VectorXd rtemp106(gd.NxNyNz);
@@ -1714,7 +1709,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 	ktemp104.resize(0); // KSpace
 	VectorXd rtemp107(gd.NxNyNz);
 	for (int i=0; i<gd.NxNyNz; i++) {
-		const double t1 = 1/(-1.0*1 + exp(epsilon_association/kT));
+		const double t1 = 1/(-1.0*1 + vm_exp(epsilon_association/kT));
 		const double t2 = sqrt(0.15915494309189535*kappa_association*rtemp10[i]*(rtemp42[i]/rtemp12[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp14[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -0.5*lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp14[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(4.1887902047863905*rtemp14[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + R*R*R*rtemp14[i]*rtemp14[i]*(73.49635953848843*R*R*R*rtemp14[i]*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -2.0943951023931953*rtemp14[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp14[i]*rtemp14[i]*(73.49635953848843*R*R*R*rtemp14[i]*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)))/kT)/(R*R*t1) + 1) + -1.0;
 		const double t3 = 1/(rtemp42[i]/rtemp12[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp14[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -0.5*lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp14[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(4.1887902047863905*rtemp14[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + R*R*R*rtemp14[i]*rtemp14[i]*(73.49635953848843*R*R*R*rtemp14[i]*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -2.0943951023931953*rtemp14[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp14[i]*rtemp14[i]*(73.49635953848843*R*R*R*rtemp14[i]*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)))/kT);
 		const double t4 = 1/(sqrt(0.15915494309189535*kappa_association*rtemp10[i]/(R*R*t1*t3) + 1));
@@ -1735,7 +1730,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 		const RelativeReciprocal rvec((xa>gd.Nx/2) ? xa - gd.Nx : xa, (y>gd.Ny/2) ? y - gd.Ny : y, z);
 		const Reciprocal k_i = gd.Lat.toReciprocal(rvec);
 		const complex t1 = sqrt(k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0]);
-		ktemp109[i] = ktemp108[i]*complex(0,1)*k_i[1]*sin(R*t1)*exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1*t1)/t1;
+		ktemp109[i] = ktemp108[i]*complex(0,1)*k_i[1]*sin(R*t1)*vm_exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1*t1)/t1;
 	}
 
 	VectorXd rtemp110(gd.NxNyNz);
@@ -1752,7 +1747,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 		const RelativeReciprocal rvec((xa>gd.Nx/2) ? xa - gd.Nx : xa, (y>gd.Ny/2) ? y - gd.Ny : y, z);
 		const Reciprocal k_i = gd.Lat.toReciprocal(rvec);
 		const complex t1 = sqrt(k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0]);
-		ktemp111[i] = ktemp108[i]*complex(0,1)*k_i[2]*sin(R*t1)*exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1*t1)/t1;
+		ktemp111[i] = ktemp108[i]*complex(0,1)*k_i[2]*sin(R*t1)*vm_exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1*t1)/t1;
 	}
 
 	VectorXd rtemp112(gd.NxNyNz);
@@ -1768,7 +1763,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 		const RelativeReciprocal rvec((xa>gd.Nx/2) ? xa - gd.Nx : xa, (y>gd.Ny/2) ? y - gd.Ny : y, z);
 		const Reciprocal k_i = gd.Lat.toReciprocal(rvec);
 		const complex t1 = sqrt(k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0]);
-		ktemp108[i] = ktemp108[i]*complex(0,1)*k_i[0]*sin(R*t1)*exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1*t1)/t1;
+		ktemp108[i] = ktemp108[i]*complex(0,1)*k_i[0]*sin(R*t1)*vm_exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1*t1)/t1;
 	}
 
 	VectorXd rtemp114(gd.NxNyNz);
@@ -1777,7 +1772,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 	ktemp108.resize(0); // KSpace
 	VectorXd rtemp115(gd.NxNyNz);
 	for (int i=0; i<gd.NxNyNz; i++) {
-		const double t1 = 1/(-1.0*1 + exp(epsilon_association/kT));
+		const double t1 = 1/(-1.0*1 + vm_exp(epsilon_association/kT));
 		const double t2 = sqrt(0.15915494309189535*kappa_association*rtemp10[i]*(rtemp42[i]/rtemp12[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp14[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -0.5*lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp14[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(4.1887902047863905*rtemp14[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + R*R*R*rtemp14[i]*rtemp14[i]*(73.49635953848843*R*R*R*rtemp14[i]*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -2.0943951023931953*rtemp14[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp14[i]*rtemp14[i]*(73.49635953848843*R*R*R*rtemp14[i]*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)))/kT)/(R*R*t1) + 1) + -1.0;
 		const double t3 = 1/(rtemp42[i]/rtemp12[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp14[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -0.5*lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp14[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(4.1887902047863905*rtemp14[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + R*R*R*rtemp14[i]*rtemp14[i]*(73.49635953848843*R*R*R*rtemp14[i]*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -2.0943951023931953*rtemp14[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp14[i]*rtemp14[i]*(73.49635953848843*R*R*R*rtemp14[i]*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)))/kT);
 		const double t4 = 1/(sqrt(0.15915494309189535*kappa_association*rtemp10[i]/(R*R*t1*t3) + 1));
@@ -1802,7 +1797,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 		const RelativeReciprocal rvec((xa>gd.Nx/2) ? xa - gd.Nx : xa, (y>gd.Ny/2) ? y - gd.Ny : y, z);
 		const Reciprocal k_i = gd.Lat.toReciprocal(rvec);
 		const complex t1 = sqrt(k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0]);
-		ktemp116[i] = ktemp116[i]*sin(R*t1)*exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1*t1)/t1;
+		ktemp116[i] = ktemp116[i]*sin(R*t1)*vm_exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1*t1)/t1;
 	}
 
 	VectorXd rtemp118(gd.NxNyNz);
@@ -1811,7 +1806,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 	ktemp116.resize(0); // KSpace
 	VectorXd rtemp119(gd.NxNyNz);
 	for (int i=0; i<gd.NxNyNz; i++) {
-		const double t1 = -1.0*1 + exp(epsilon_association/kT);
+		const double t1 = -1.0*1 + vm_exp(epsilon_association/kT);
 		const double t2 = 1/(sqrt(0.15915494309189535*kappa_association*t1*rtemp10[i]*(rtemp42[i]/rtemp12[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp14[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -0.5*lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp14[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(4.1887902047863905*rtemp14[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + R*R*R*rtemp14[i]*rtemp14[i]*(73.49635953848843*R*R*R*rtemp14[i]*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -2.0943951023931953*rtemp14[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp14[i]*rtemp14[i]*(73.49635953848843*R*R*R*rtemp14[i]*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)))/kT)/(R*R) + 1) + -1.0);
 		const double t3 = 1/(sqrt(0.15915494309189535*kappa_association*t1*rtemp10[i]*(rtemp42[i]/rtemp12[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp14[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -0.5*lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp14[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(4.1887902047863905*rtemp14[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + R*R*R*rtemp14[i]*rtemp14[i]*(73.49635953848843*R*R*R*rtemp14[i]*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -2.0943951023931953*rtemp14[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp14[i]*rtemp14[i]*(73.49635953848843*R*R*R*rtemp14[i]*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)))/kT)/(R*R) + 1));
 		const double t4 = 1/(rtemp42[i]/rtemp12[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp14[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -0.5*lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp14[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(4.1887902047863905*rtemp14[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + R*R*R*rtemp14[i]*rtemp14[i]*(73.49635953848843*R*R*R*rtemp14[i]*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -2.0943951023931953*rtemp14[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp14[i]*rtemp14[i]*(73.49635953848843*R*R*R*rtemp14[i]*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)))/kT);
@@ -1836,7 +1831,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 		const RelativeReciprocal rvec((xa>gd.Nx/2) ? xa - gd.Nx : xa, (y>gd.Ny/2) ? y - gd.Ny : y, z);
 		const Reciprocal k_i = gd.Lat.toReciprocal(rvec);
 		const complex t1 = sqrt(k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0]);
-		ktemp120[i] = ktemp120[i]*sin(R*t1)*exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1*t1)/t1;
+		ktemp120[i] = ktemp120[i]*sin(R*t1)*vm_exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1*t1)/t1;
 	}
 
 	VectorXd rtemp122(gd.NxNyNz);
@@ -1844,7 +1839,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 
 	ktemp120.resize(0); // KSpace
 	for (int i=0; i<gd.NxNyNz; i++) {
-		const double t1 = log(1 + -1.0*rtemp6[i]);
+		const double t1 = vm_log(1 + -1.0*rtemp6[i]);
 		const double t2 = 1 + -1.0*rtemp6[i];
 		const double t3 = t1*t2*t2 + rtemp6[i];
 		const double t4 = rtemp18[i]*rtemp18[i];
@@ -1886,7 +1881,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 	ktemp102.resize(0); // KSpace
 	VectorXd rtemp126(gd.NxNyNz);
 	for (int i=0; i<gd.NxNyNz; i++) {
-		const double t1 = -1.0*1 + exp(epsilon_association/kT);
+		const double t1 = -1.0*1 + vm_exp(epsilon_association/kT);
 		const double t2 = 1/(sqrt(0.15915494309189535*kappa_association*t1*rtemp10[i]*(rtemp42[i]/rtemp12[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp14[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -0.5*lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp14[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(4.1887902047863905*rtemp14[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + R*R*R*rtemp14[i]*rtemp14[i]*(73.49635953848843*R*R*R*rtemp14[i]*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -2.0943951023931953*rtemp14[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp14[i]*rtemp14[i]*(73.49635953848843*R*R*R*rtemp14[i]*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)))/kT)/(R*R) + 1) + -1.0);
 		const double t3 = 1/(sqrt(0.15915494309189535*kappa_association*t1*rtemp10[i]*(rtemp42[i]/rtemp12[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp14[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -0.5*lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp14[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(4.1887902047863905*rtemp14[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + R*R*R*rtemp14[i]*rtemp14[i]*(73.49635953848843*R*R*R*rtemp14[i]*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -2.0943951023931953*rtemp14[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp14[i]*rtemp14[i]*(73.49635953848843*R*R*R*rtemp14[i]*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)))/kT)/(R*R) + 1));
 		const double t4 = 1/(rtemp42[i]/rtemp12[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp14[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -0.5*lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp14[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(4.1887902047863905*rtemp14[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + R*R*R*rtemp14[i]*rtemp14[i]*(73.49635953848843*R*R*R*rtemp14[i]*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -2.0943951023931953*rtemp14[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp14[i]*rtemp14[i]*(73.49635953848843*R*R*R*rtemp14[i]*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)))/kT);
@@ -1911,7 +1906,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 		const RelativeReciprocal rvec((xa>gd.Nx/2) ? xa - gd.Nx : xa, (y>gd.Ny/2) ? y - gd.Ny : y, z);
 		const Reciprocal k_i = gd.Lat.toReciprocal(rvec);
 		const complex t1 = sqrt(k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0]);
-		ktemp127[i] = ktemp127[i]*sin(R*t1)*exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1*t1)/t1;
+		ktemp127[i] = ktemp127[i]*sin(R*t1)*vm_exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1*t1)/t1;
 	}
 
 	VectorXd rtemp129(gd.NxNyNz);
@@ -1954,7 +1949,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 		const Reciprocal k_i = gd.Lat.toReciprocal(rvec);
 		const complex t1 = k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0];
 		const complex t2 = R*sqrt(t1);
-		ktemp134[i] = ktemp133[i]*complex(0,1)*k_i[1]*exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1)*(-1.0*sin(t2)/(sqrt(t1)) + R*cos(t2))/t1;
+		ktemp134[i] = ktemp133[i]*complex(0,1)*k_i[1]*vm_exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1)*(-1.0*sin(t2)/(sqrt(t1)) + R*cos(t2))/t1;
 	}
 
 	VectorXd rtemp135(gd.NxNyNz);
@@ -1968,7 +1963,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 	rtemp131.resize(0); // Realspace
 	VectorXd rtemp137(gd.NxNyNz);
 	for (int i=0; i<gd.NxNyNz; i++) {
-		const double t1 = -1.0*1 + exp(epsilon_association/kT);
+		const double t1 = -1.0*1 + vm_exp(epsilon_association/kT);
 		const double t2 = sqrt(0.15915494309189535*kappa_association*t1*rtemp10[i]*(rtemp42[i]/rtemp12[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp14[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -0.5*lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp14[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(4.1887902047863905*rtemp14[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + R*R*R*rtemp14[i]*rtemp14[i]*(73.49635953848843*R*R*R*rtemp14[i]*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -2.0943951023931953*rtemp14[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp14[i]*rtemp14[i]*(73.49635953848843*R*R*R*rtemp14[i]*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)))/kT)/(R*R) + 1);
 		rtemp137[i] = 7.957747154594767e-2*kT*kappa_association*t1*rtemp10[i]*x[i]/((R*R)*(R*R)*t2*rtemp12[i]*(-1.0*1 + t2));
 	}
@@ -1988,7 +1983,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 		const Reciprocal k_i = gd.Lat.toReciprocal(rvec);
 		const complex t1 = k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0];
 		const complex t2 = R*sqrt(t1);
-		ktemp139[i] = ktemp138[i]*complex(0,1)*k_i[1]*exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1)*(-1.0*sin(t2)/(sqrt(t1)) + R*cos(t2))/t1;
+		ktemp139[i] = ktemp138[i]*complex(0,1)*k_i[1]*vm_exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1)*(-1.0*sin(t2)/(sqrt(t1)) + R*cos(t2))/t1;
 	}
 
 	VectorXd rtemp140(gd.NxNyNz);
@@ -2028,7 +2023,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 		const Reciprocal k_i = gd.Lat.toReciprocal(rvec);
 		const complex t1 = k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0];
 		const complex t2 = R*sqrt(t1);
-		ktemp144[i] = ktemp143[i]*complex(0,1)*k_i[1]*exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1)*(-1.0*sin(t2)/(sqrt(t1)) + R*cos(t2))/t1;
+		ktemp144[i] = ktemp143[i]*complex(0,1)*k_i[1]*vm_exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1)*(-1.0*sin(t2)/(sqrt(t1)) + R*cos(t2))/t1;
 	}
 
 	VectorXd rtemp145(gd.NxNyNz);
@@ -2042,7 +2037,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 	rtemp140.resize(0); // Realspace
 	VectorXd rtemp147(gd.NxNyNz);
 	for (int i=0; i<gd.NxNyNz; i++) {
-		const double t1 = 1/(-1.0*1 + exp(epsilon_association/kT));
+		const double t1 = 1/(-1.0*1 + vm_exp(epsilon_association/kT));
 		const double t2 = rtemp42[i]/rtemp12[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp14[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -0.5*lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp14[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(4.1887902047863905*rtemp14[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + R*R*R*rtemp14[i]*rtemp14[i]*(73.49635953848843*R*R*R*rtemp14[i]*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -2.0943951023931953*rtemp14[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp14[i]*rtemp14[i]*(73.49635953848843*R*R*R*rtemp14[i]*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)))/kT;
 		rtemp147[i] = 50.26548245743669*kT*t1*x[i]*(sqrt(0.15915494309189535*kappa_association*t2*rtemp10[i]/(R*R*t1) + 1) + -1.0)/(kappa_association*t2*t2*rtemp10[i]*rtemp12[i]);
 	}
@@ -2061,7 +2056,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 		const Reciprocal k_i = gd.Lat.toReciprocal(rvec);
 		const complex t1 = k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0];
 		const complex t2 = R*sqrt(t1);
-		ktemp149[i] = ktemp148[i]*complex(0,1)*k_i[1]*exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1)*(-1.0*sin(t2)/(sqrt(t1)) + R*cos(t2))/t1;
+		ktemp149[i] = ktemp148[i]*complex(0,1)*k_i[1]*vm_exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1)*(-1.0*sin(t2)/(sqrt(t1)) + R*cos(t2))/t1;
 	}
 
 	VectorXd rtemp150(gd.NxNyNz);
@@ -2084,7 +2079,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 		const Reciprocal k_i = gd.Lat.toReciprocal(rvec);
 		const complex t1 = k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0];
 		const complex t2 = R*sqrt(t1);
-		ktemp152[i] = ktemp133[i]*complex(0,1)*k_i[2]*exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1)*(-1.0*sin(t2)/(sqrt(t1)) + R*cos(t2))/t1;
+		ktemp152[i] = ktemp133[i]*complex(0,1)*k_i[2]*vm_exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1)*(-1.0*sin(t2)/(sqrt(t1)) + R*cos(t2))/t1;
 	}
 
 	VectorXd rtemp153(gd.NxNyNz);
@@ -2102,7 +2097,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 		const Reciprocal k_i = gd.Lat.toReciprocal(rvec);
 		const complex t1 = k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0];
 		const complex t2 = R*sqrt(t1);
-		ktemp154[i] = ktemp138[i]*complex(0,1)*k_i[2]*exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1)*(-1.0*sin(t2)/(sqrt(t1)) + R*cos(t2))/t1;
+		ktemp154[i] = ktemp138[i]*complex(0,1)*k_i[2]*vm_exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1)*(-1.0*sin(t2)/(sqrt(t1)) + R*cos(t2))/t1;
 	}
 
 	VectorXd rtemp155(gd.NxNyNz);
@@ -2125,7 +2120,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 		const Reciprocal k_i = gd.Lat.toReciprocal(rvec);
 		const complex t1 = k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0];
 		const complex t2 = R*sqrt(t1);
-		ktemp157[i] = ktemp143[i]*complex(0,1)*k_i[2]*exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1)*(-1.0*sin(t2)/(sqrt(t1)) + R*cos(t2))/t1;
+		ktemp157[i] = ktemp143[i]*complex(0,1)*k_i[2]*vm_exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1)*(-1.0*sin(t2)/(sqrt(t1)) + R*cos(t2))/t1;
 	}
 
 	VectorXd rtemp158(gd.NxNyNz);
@@ -2148,7 +2143,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 		const Reciprocal k_i = gd.Lat.toReciprocal(rvec);
 		const complex t1 = k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0];
 		const complex t2 = R*sqrt(t1);
-		ktemp160[i] = ktemp148[i]*complex(0,1)*k_i[2]*exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1)*(-1.0*sin(t2)/(sqrt(t1)) + R*cos(t2))/t1;
+		ktemp160[i] = ktemp148[i]*complex(0,1)*k_i[2]*vm_exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1)*(-1.0*sin(t2)/(sqrt(t1)) + R*cos(t2))/t1;
 	}
 
 	VectorXd rtemp161(gd.NxNyNz);
@@ -2183,7 +2178,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 	rtemp161.resize(0); // Realspace
 	VectorXd rtemp166(gd.NxNyNz);
 	for (int i=0; i<gd.NxNyNz; i++) {
-		const double t1 = -1.0*1 + exp(epsilon_association/kT);
+		const double t1 = -1.0*1 + vm_exp(epsilon_association/kT);
 		const double t2 = 1/(sqrt(0.15915494309189535*kappa_association*t1*rtemp10[i]*(rtemp42[i]/rtemp12[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp14[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -0.5*lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp14[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(4.1887902047863905*rtemp14[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + R*R*R*rtemp14[i]*rtemp14[i]*(73.49635953848843*R*R*R*rtemp14[i]*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -2.0943951023931953*rtemp14[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp14[i]*rtemp14[i]*(73.49635953848843*R*R*R*rtemp14[i]*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)))/kT)/(R*R) + 1) + -1.0);
 		const double t3 = 1/(sqrt(0.15915494309189535*kappa_association*t1*rtemp10[i]*(rtemp42[i]/rtemp12[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp14[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -0.5*lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp14[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(4.1887902047863905*rtemp14[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + R*R*R*rtemp14[i]*rtemp14[i]*(73.49635953848843*R*R*R*rtemp14[i]*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -2.0943951023931953*rtemp14[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp14[i]*rtemp14[i]*(73.49635953848843*R*R*R*rtemp14[i]*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)))/kT)/(R*R) + 1));
 		const double t4 = 1/(rtemp42[i]/rtemp12[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp14[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -0.5*lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp14[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(4.1887902047863905*rtemp14[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + R*R*R*rtemp14[i]*rtemp14[i]*(73.49635953848843*R*R*R*rtemp14[i]*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -2.0943951023931953*rtemp14[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp14[i]*rtemp14[i]*(73.49635953848843*R*R*R*rtemp14[i]*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)))/kT);
@@ -2204,7 +2199,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 		const RelativeReciprocal rvec((xa>gd.Nx/2) ? xa - gd.Nx : xa, (y>gd.Ny/2) ? y - gd.Ny : y, z);
 		const Reciprocal k_i = gd.Lat.toReciprocal(rvec);
 		const complex t1 = sqrt(k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0]);
-		ktemp168[i] = ktemp167[i]*complex(0,1)*k_i[1]*sin(R*t1)*exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1*t1)/t1;
+		ktemp168[i] = ktemp167[i]*complex(0,1)*k_i[1]*sin(R*t1)*vm_exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1*t1)/t1;
 	}
 
 	VectorXd rtemp169(gd.NxNyNz);
@@ -2213,7 +2208,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 	ktemp168.resize(0); // KSpace
 	VectorXd rtemp170(gd.NxNyNz);
 	for (int i=0; i<gd.NxNyNz; i++) {
-		const double t1 = -1.0*1 + exp(epsilon_association/kT);
+		const double t1 = -1.0*1 + vm_exp(epsilon_association/kT);
 		const double t2 = 1/(sqrt(0.15915494309189535*kappa_association*t1*rtemp10[i]*(rtemp42[i]/rtemp12[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp14[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -0.5*lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp14[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(4.1887902047863905*rtemp14[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + R*R*R*rtemp14[i]*rtemp14[i]*(73.49635953848843*R*R*R*rtemp14[i]*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -2.0943951023931953*rtemp14[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp14[i]*rtemp14[i]*(73.49635953848843*R*R*R*rtemp14[i]*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)))/kT)/(R*R) + 1) + -1.0);
 		const double t3 = 1/(sqrt(0.15915494309189535*kappa_association*t1*rtemp10[i]*(rtemp42[i]/rtemp12[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp14[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -0.5*lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp14[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(4.1887902047863905*rtemp14[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + R*R*R*rtemp14[i]*rtemp14[i]*(73.49635953848843*R*R*R*rtemp14[i]*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -2.0943951023931953*rtemp14[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp14[i]*rtemp14[i]*(73.49635953848843*R*R*R*rtemp14[i]*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)))/kT)/(R*R) + 1));
 		const double t4 = 1/(rtemp42[i]/rtemp12[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp14[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -0.5*lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp14[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(4.1887902047863905*rtemp14[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + R*R*R*rtemp14[i]*rtemp14[i]*(73.49635953848843*R*R*R*rtemp14[i]*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -2.0943951023931953*rtemp14[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp14[i]*rtemp14[i]*(73.49635953848843*R*R*R*rtemp14[i]*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)))/kT);
@@ -2234,7 +2229,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 		const RelativeReciprocal rvec((xa>gd.Nx/2) ? xa - gd.Nx : xa, (y>gd.Ny/2) ? y - gd.Ny : y, z);
 		const Reciprocal k_i = gd.Lat.toReciprocal(rvec);
 		const complex t1 = sqrt(k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0]);
-		ktemp172[i] = ktemp171[i]*complex(0,1)*k_i[1]*sin(R*t1)*exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1*t1)/t1;
+		ktemp172[i] = ktemp171[i]*complex(0,1)*k_i[1]*sin(R*t1)*vm_exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1*t1)/t1;
 	}
 
 	VectorXd rtemp173(gd.NxNyNz);
@@ -2243,7 +2238,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 	ktemp172.resize(0); // KSpace
 	VectorXd rtemp174(gd.NxNyNz);
 	for (int i=0; i<gd.NxNyNz; i++) {
-		const double t1 = -1.0*1 + exp(epsilon_association/kT);
+		const double t1 = -1.0*1 + vm_exp(epsilon_association/kT);
 		const double t2 = 1/(sqrt(0.15915494309189535*kappa_association*t1*rtemp10[i]*(rtemp42[i]/rtemp12[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp14[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -0.5*lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp14[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(4.1887902047863905*rtemp14[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + R*R*R*rtemp14[i]*rtemp14[i]*(73.49635953848843*R*R*R*rtemp14[i]*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -2.0943951023931953*rtemp14[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp14[i]*rtemp14[i]*(73.49635953848843*R*R*R*rtemp14[i]*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)))/kT)/(R*R) + 1) + -1.0);
 		const double t3 = 1/(sqrt(0.15915494309189535*kappa_association*t1*rtemp10[i]*(rtemp42[i]/rtemp12[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp14[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -0.5*lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp14[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(4.1887902047863905*rtemp14[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + R*R*R*rtemp14[i]*rtemp14[i]*(73.49635953848843*R*R*R*rtemp14[i]*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -2.0943951023931953*rtemp14[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp14[i]*rtemp14[i]*(73.49635953848843*R*R*R*rtemp14[i]*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)))/kT)/(R*R) + 1));
 		const double t4 = 1/(rtemp42[i]/rtemp12[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp14[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -0.5*lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp14[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(4.1887902047863905*rtemp14[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + R*R*R*rtemp14[i]*rtemp14[i]*(73.49635953848843*R*R*R*rtemp14[i]*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -2.0943951023931953*rtemp14[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp14[i]*rtemp14[i]*(73.49635953848843*R*R*R*rtemp14[i]*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)))/kT);
@@ -2264,7 +2259,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 		const RelativeReciprocal rvec((xa>gd.Nx/2) ? xa - gd.Nx : xa, (y>gd.Ny/2) ? y - gd.Ny : y, z);
 		const Reciprocal k_i = gd.Lat.toReciprocal(rvec);
 		const complex t1 = sqrt(k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0]);
-		ktemp176[i] = ktemp175[i]*complex(0,1)*k_i[1]*sin(R*t1)*exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1*t1)/t1;
+		ktemp176[i] = ktemp175[i]*complex(0,1)*k_i[1]*sin(R*t1)*vm_exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1*t1)/t1;
 	}
 
 	VectorXd rtemp177(gd.NxNyNz);
@@ -2281,7 +2276,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 		const RelativeReciprocal rvec((xa>gd.Nx/2) ? xa - gd.Nx : xa, (y>gd.Ny/2) ? y - gd.Ny : y, z);
 		const Reciprocal k_i = gd.Lat.toReciprocal(rvec);
 		const complex t1 = sqrt(k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0]);
-		ktemp178[i] = ktemp167[i]*complex(0,1)*k_i[2]*sin(R*t1)*exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1*t1)/t1;
+		ktemp178[i] = ktemp167[i]*complex(0,1)*k_i[2]*sin(R*t1)*vm_exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1*t1)/t1;
 	}
 
 	VectorXd rtemp179(gd.NxNyNz);
@@ -2298,7 +2293,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 		const RelativeReciprocal rvec((xa>gd.Nx/2) ? xa - gd.Nx : xa, (y>gd.Ny/2) ? y - gd.Ny : y, z);
 		const Reciprocal k_i = gd.Lat.toReciprocal(rvec);
 		const complex t1 = sqrt(k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0]);
-		ktemp180[i] = ktemp171[i]*complex(0,1)*k_i[2]*sin(R*t1)*exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1*t1)/t1;
+		ktemp180[i] = ktemp171[i]*complex(0,1)*k_i[2]*sin(R*t1)*vm_exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1*t1)/t1;
 	}
 
 	VectorXd rtemp181(gd.NxNyNz);
@@ -2315,7 +2310,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 		const RelativeReciprocal rvec((xa>gd.Nx/2) ? xa - gd.Nx : xa, (y>gd.Ny/2) ? y - gd.Ny : y, z);
 		const Reciprocal k_i = gd.Lat.toReciprocal(rvec);
 		const complex t1 = sqrt(k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0]);
-		ktemp182[i] = ktemp175[i]*complex(0,1)*k_i[2]*sin(R*t1)*exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1*t1)/t1;
+		ktemp182[i] = ktemp175[i]*complex(0,1)*k_i[2]*sin(R*t1)*vm_exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1*t1)/t1;
 	}
 
 	VectorXd rtemp183(gd.NxNyNz);
@@ -2331,7 +2326,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 		const RelativeReciprocal rvec((xa>gd.Nx/2) ? xa - gd.Nx : xa, (y>gd.Ny/2) ? y - gd.Ny : y, z);
 		const Reciprocal k_i = gd.Lat.toReciprocal(rvec);
 		const complex t1 = sqrt(k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0]);
-		ktemp167[i] = ktemp167[i]*complex(0,1)*k_i[0]*sin(R*t1)*exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1*t1)/t1;
+		ktemp167[i] = ktemp167[i]*complex(0,1)*k_i[0]*sin(R*t1)*vm_exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1*t1)/t1;
 	}
 
 	VectorXd rtemp185(gd.NxNyNz);
@@ -2347,7 +2342,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 		const RelativeReciprocal rvec((xa>gd.Nx/2) ? xa - gd.Nx : xa, (y>gd.Ny/2) ? y - gd.Ny : y, z);
 		const Reciprocal k_i = gd.Lat.toReciprocal(rvec);
 		const complex t1 = sqrt(k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0]);
-		ktemp171[i] = ktemp171[i]*complex(0,1)*k_i[0]*sin(R*t1)*exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1*t1)/t1;
+		ktemp171[i] = ktemp171[i]*complex(0,1)*k_i[0]*sin(R*t1)*vm_exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1*t1)/t1;
 	}
 
 	VectorXd rtemp187(gd.NxNyNz);
@@ -2363,7 +2358,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 		const RelativeReciprocal rvec((xa>gd.Nx/2) ? xa - gd.Nx : xa, (y>gd.Ny/2) ? y - gd.Ny : y, z);
 		const Reciprocal k_i = gd.Lat.toReciprocal(rvec);
 		const complex t1 = sqrt(k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0]);
-		ktemp175[i] = ktemp175[i]*complex(0,1)*k_i[0]*sin(R*t1)*exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1*t1)/t1;
+		ktemp175[i] = ktemp175[i]*complex(0,1)*k_i[0]*sin(R*t1)*vm_exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1*t1)/t1;
 	}
 
 	VectorXd rtemp189(gd.NxNyNz);
@@ -2372,7 +2367,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 	ktemp175.resize(0); // KSpace
 	VectorXd rtemp190(gd.NxNyNz);
 	for (int i=0; i<gd.NxNyNz; i++) {
-		const double t1 = -1.0*1 + exp(epsilon_association/kT);
+		const double t1 = -1.0*1 + vm_exp(epsilon_association/kT);
 		const double t2 = 1/(sqrt(0.15915494309189535*kappa_association*t1*rtemp10[i]*(rtemp42[i]/rtemp12[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp14[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -0.5*lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp14[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(4.1887902047863905*rtemp14[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + R*R*R*rtemp14[i]*rtemp14[i]*(73.49635953848843*R*R*R*rtemp14[i]*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -2.0943951023931953*rtemp14[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp14[i]*rtemp14[i]*(73.49635953848843*R*R*R*rtemp14[i]*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)))/kT)/(R*R) + 1) + -1.0);
 		const double t3 = 1/(sqrt(0.15915494309189535*kappa_association*t1*rtemp10[i]*(rtemp42[i]/rtemp12[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp14[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -0.5*lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp14[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(4.1887902047863905*rtemp14[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + R*R*R*rtemp14[i]*rtemp14[i]*(73.49635953848843*R*R*R*rtemp14[i]*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -2.0943951023931953*rtemp14[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp14[i]*rtemp14[i]*(73.49635953848843*R*R*R*rtemp14[i]*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)))/kT)/(R*R) + 1));
 		const double t4 = 1/(rtemp42[i]/rtemp12[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp14[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -0.5*lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp14[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(4.1887902047863905*rtemp14[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + R*R*R*rtemp14[i]*rtemp14[i]*(73.49635953848843*R*R*R*rtemp14[i]*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -2.0943951023931953*rtemp14[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp14[i]*rtemp14[i]*(73.49635953848843*R*R*R*rtemp14[i]*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)))/kT);
@@ -2397,7 +2392,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 		const RelativeReciprocal rvec((xa>gd.Nx/2) ? xa - gd.Nx : xa, (y>gd.Ny/2) ? y - gd.Ny : y, z);
 		const Reciprocal k_i = gd.Lat.toReciprocal(rvec);
 		const complex t1 = sqrt(k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0]);
-		ktemp191[i] = ktemp191[i]*sin(R*t1)*exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1*t1)/t1;
+		ktemp191[i] = ktemp191[i]*sin(R*t1)*vm_exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1*t1)/t1;
 	}
 
 	VectorXd rtemp193(gd.NxNyNz);
@@ -2406,7 +2401,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 	ktemp191.resize(0); // KSpace
 	VectorXd rtemp194(gd.NxNyNz);
 	for (int i=0; i<gd.NxNyNz; i++) {
-		const double t1 = -1.0*1 + exp(epsilon_association/kT);
+		const double t1 = -1.0*1 + vm_exp(epsilon_association/kT);
 		const double t2 = 1/(sqrt(0.15915494309189535*kappa_association*t1*rtemp10[i]*(rtemp42[i]/rtemp12[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp14[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -0.5*lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp14[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(4.1887902047863905*rtemp14[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + R*R*R*rtemp14[i]*rtemp14[i]*(73.49635953848843*R*R*R*rtemp14[i]*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -2.0943951023931953*rtemp14[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp14[i]*rtemp14[i]*(73.49635953848843*R*R*R*rtemp14[i]*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)))/kT)/(R*R) + 1) + -1.0);
 		const double t3 = 1/(sqrt(0.15915494309189535*kappa_association*t1*rtemp10[i]*(rtemp42[i]/rtemp12[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp14[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -0.5*lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp14[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(4.1887902047863905*rtemp14[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + R*R*R*rtemp14[i]*rtemp14[i]*(73.49635953848843*R*R*R*rtemp14[i]*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -2.0943951023931953*rtemp14[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp14[i]*rtemp14[i]*(73.49635953848843*R*R*R*rtemp14[i]*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)))/kT)/(R*R) + 1));
 		const double t4 = 1/(rtemp42[i]/rtemp12[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp14[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -0.5*lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp14[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(4.1887902047863905*rtemp14[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + R*R*R*rtemp14[i]*rtemp14[i]*(73.49635953848843*R*R*R*rtemp14[i]*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -2.0943951023931953*rtemp14[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp14[i]*rtemp14[i]*(73.49635953848843*R*R*R*rtemp14[i]*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)))/kT);
@@ -2431,7 +2426,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 		const RelativeReciprocal rvec((xa>gd.Nx/2) ? xa - gd.Nx : xa, (y>gd.Ny/2) ? y - gd.Ny : y, z);
 		const Reciprocal k_i = gd.Lat.toReciprocal(rvec);
 		const complex t1 = sqrt(k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0]);
-		ktemp195[i] = ktemp195[i]*sin(R*t1)*exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1*t1)/t1;
+		ktemp195[i] = ktemp195[i]*sin(R*t1)*vm_exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1*t1)/t1;
 	}
 
 	VectorXd rtemp197(gd.NxNyNz);
@@ -2440,7 +2435,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 	ktemp195.resize(0); // KSpace
 	VectorXd rtemp198(gd.NxNyNz);
 	for (int i=0; i<gd.NxNyNz; i++) {
-		const double t1 = -1.0*1 + exp(epsilon_association/kT);
+		const double t1 = -1.0*1 + vm_exp(epsilon_association/kT);
 		const double t2 = 1/(sqrt(0.15915494309189535*kappa_association*t1*rtemp10[i]*(rtemp42[i]/rtemp12[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp14[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -0.5*lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp14[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(4.1887902047863905*rtemp14[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + R*R*R*rtemp14[i]*rtemp14[i]*(73.49635953848843*R*R*R*rtemp14[i]*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -2.0943951023931953*rtemp14[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp14[i]*rtemp14[i]*(73.49635953848843*R*R*R*rtemp14[i]*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)))/kT)/(R*R) + 1) + -1.0);
 		const double t3 = 1/(sqrt(0.15915494309189535*kappa_association*t1*rtemp10[i]*(rtemp42[i]/rtemp12[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp14[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -0.5*lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp14[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(4.1887902047863905*rtemp14[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + R*R*R*rtemp14[i]*rtemp14[i]*(73.49635953848843*R*R*R*rtemp14[i]*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -2.0943951023931953*rtemp14[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp14[i]*rtemp14[i]*(73.49635953848843*R*R*R*rtemp14[i]*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)))/kT)/(R*R) + 1));
 		const double t4 = 1/(rtemp42[i]/rtemp12[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp14[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -0.5*lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp14[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(4.1887902047863905*rtemp14[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + R*R*R*rtemp14[i]*rtemp14[i]*(73.49635953848843*R*R*R*rtemp14[i]*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -2.0943951023931953*rtemp14[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp14[i]*rtemp14[i]*(73.49635953848843*R*R*R*rtemp14[i]*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)))/kT);
@@ -2465,7 +2460,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 		const RelativeReciprocal rvec((xa>gd.Nx/2) ? xa - gd.Nx : xa, (y>gd.Ny/2) ? y - gd.Ny : y, z);
 		const Reciprocal k_i = gd.Lat.toReciprocal(rvec);
 		const complex t1 = sqrt(k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0]);
-		ktemp199[i] = ktemp199[i]*sin(R*t1)*exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1*t1)/t1;
+		ktemp199[i] = ktemp199[i]*sin(R*t1)*vm_exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1*t1)/t1;
 	}
 
 	VectorXd rtemp201(gd.NxNyNz);
@@ -2474,7 +2469,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 	ktemp199.resize(0); // KSpace
 	VectorXd rtemp202(gd.NxNyNz);
 	for (int i=0; i<gd.NxNyNz; i++) {
-		const double t1 = -1.0*1 + exp(epsilon_association/kT);
+		const double t1 = -1.0*1 + vm_exp(epsilon_association/kT);
 		const double t2 = 1/(sqrt(0.15915494309189535*kappa_association*t1*rtemp10[i]*(rtemp42[i]/rtemp12[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp14[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -0.5*lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp14[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(4.1887902047863905*rtemp14[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + R*R*R*rtemp14[i]*rtemp14[i]*(73.49635953848843*R*R*R*rtemp14[i]*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -2.0943951023931953*rtemp14[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp14[i]*rtemp14[i]*(73.49635953848843*R*R*R*rtemp14[i]*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)))/kT)/(R*R) + 1) + -1.0);
 		const double t3 = 1/(sqrt(0.15915494309189535*kappa_association*t1*rtemp10[i]*(rtemp42[i]/rtemp12[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp14[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -0.5*lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp14[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(4.1887902047863905*rtemp14[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + R*R*R*rtemp14[i]*rtemp14[i]*(73.49635953848843*R*R*R*rtemp14[i]*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -2.0943951023931953*rtemp14[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp14[i]*rtemp14[i]*(73.49635953848843*R*R*R*rtemp14[i]*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)))/kT)/(R*R) + 1));
 		const double t4 = 1/(rtemp42[i]/rtemp12[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp14[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -0.5*lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp14[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(4.1887902047863905*rtemp14[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + R*R*R*rtemp14[i]*rtemp14[i]*(73.49635953848843*R*R*R*rtemp14[i]*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -2.0943951023931953*rtemp14[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp14[i]*rtemp14[i]*(73.49635953848843*R*R*R*rtemp14[i]*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)))/kT);
@@ -2499,7 +2494,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 		const RelativeReciprocal rvec((xa>gd.Nx/2) ? xa - gd.Nx : xa, (y>gd.Ny/2) ? y - gd.Ny : y, z);
 		const Reciprocal k_i = gd.Lat.toReciprocal(rvec);
 		const complex t1 = sqrt(k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0]);
-		ktemp203[i] = ktemp203[i]*sin(R*t1)*exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1*t1)/t1;
+		ktemp203[i] = ktemp203[i]*sin(R*t1)*vm_exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1*t1)/t1;
 	}
 
 	VectorXd rtemp205(gd.NxNyNz);
@@ -2529,7 +2524,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 		const Reciprocal k_i = gd.Lat.toReciprocal(rvec);
 		const complex t1 = k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0];
 		const complex t2 = R*sqrt(t1);
-		ktemp207[i] = ktemp207[i]*exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1)*(-1.0*sin(t2)/(sqrt(t1)) + -1.0*R*cos(t2));
+		ktemp207[i] = ktemp207[i]*vm_exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1)*(-1.0*sin(t2)/(sqrt(t1)) + -1.0*R*cos(t2));
 	}
 
 	VectorXd rtemp209(gd.NxNyNz);
@@ -2538,7 +2533,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 	ktemp207.resize(0); // KSpace
 	VectorXd rtemp210(gd.NxNyNz);
 	for (int i=0; i<gd.NxNyNz; i++) {
-		const double t1 = -1.0*1 + exp(epsilon_association/kT);
+		const double t1 = -1.0*1 + vm_exp(epsilon_association/kT);
 		const double t2 = sqrt(0.15915494309189535*kappa_association*t1*rtemp10[i]*(rtemp42[i]/rtemp12[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp14[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -0.5*lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp14[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(4.1887902047863905*rtemp14[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + R*R*R*rtemp14[i]*rtemp14[i]*(73.49635953848843*R*R*R*rtemp14[i]*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -2.0943951023931953*rtemp14[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp14[i]*rtemp14[i]*(73.49635953848843*R*R*R*rtemp14[i]*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)))/kT)/(R*R) + 1);
 		rtemp210[i] = 7.957747154594767e-2*kT*kappa_association*t1*rtemp10[i]*x[i]/(R*R*R*t2*rtemp12[i]*(-1.0*1 + t2));
 	}
@@ -2562,7 +2557,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 		const Reciprocal k_i = gd.Lat.toReciprocal(rvec);
 		const complex t1 = k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0];
 		const complex t2 = R*sqrt(t1);
-		ktemp211[i] = ktemp211[i]*exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1)*(-1.0*sin(t2)/(sqrt(t1)) + -1.0*R*cos(t2));
+		ktemp211[i] = ktemp211[i]*vm_exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1)*(-1.0*sin(t2)/(sqrt(t1)) + -1.0*R*cos(t2));
 	}
 
 	VectorXd rtemp213(gd.NxNyNz);
@@ -2606,7 +2601,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 		const Reciprocal k_i = gd.Lat.toReciprocal(rvec);
 		const complex t1 = k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0];
 		const complex t2 = R*sqrt(t1);
-		ktemp216[i] = ktemp216[i]*exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1)*(-1.0*sin(t2)/(sqrt(t1)) + -1.0*R*cos(t2));
+		ktemp216[i] = ktemp216[i]*vm_exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1)*(-1.0*sin(t2)/(sqrt(t1)) + -1.0*R*cos(t2));
 	}
 
 	VectorXd rtemp218(gd.NxNyNz);
@@ -2620,7 +2615,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 	rtemp213.resize(0); // Realspace
 	VectorXd rtemp220(gd.NxNyNz);
 	for (int i=0; i<gd.NxNyNz; i++) {
-		const double t1 = 1/(-1.0*1 + exp(epsilon_association/kT));
+		const double t1 = 1/(-1.0*1 + vm_exp(epsilon_association/kT));
 		const double t2 = rtemp42[i]/rtemp12[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp14[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -0.5*lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp14[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(4.1887902047863905*rtemp14[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + R*R*R*rtemp14[i]*rtemp14[i]*(73.49635953848843*R*R*R*rtemp14[i]*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -2.0943951023931953*rtemp14[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp14[i]*rtemp14[i]*(73.49635953848843*R*R*R*rtemp14[i]*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)))/kT;
 		rtemp220[i] = 50.26548245743669*R*kT*t1*x[i]*(sqrt(0.15915494309189535*kappa_association*t2*rtemp10[i]/(R*R*t1) + 1) + -1.0)/(kappa_association*t2*t2*rtemp10[i]*rtemp12[i]);
 	}
@@ -2644,7 +2639,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 		const Reciprocal k_i = gd.Lat.toReciprocal(rvec);
 		const complex t1 = k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0];
 		const complex t2 = R*sqrt(t1);
-		ktemp221[i] = ktemp221[i]*exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1)*(-1.0*sin(t2)/(sqrt(t1)) + -1.0*R*cos(t2));
+		ktemp221[i] = ktemp221[i]*vm_exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1)*(-1.0*sin(t2)/(sqrt(t1)) + -1.0*R*cos(t2));
 	}
 
 	VectorXd rtemp223(gd.NxNyNz);
@@ -2666,7 +2661,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 		const Reciprocal k_i = gd.Lat.toReciprocal(rvec);
 		const complex t1 = k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0];
 		const complex t2 = R*sqrt(t1);
-		ktemp133[i] = ktemp133[i]*complex(0,1)*k_i[0]*exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1)*(-1.0*sin(t2)/(sqrt(t1)) + R*cos(t2))/t1;
+		ktemp133[i] = ktemp133[i]*complex(0,1)*k_i[0]*vm_exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1)*(-1.0*sin(t2)/(sqrt(t1)) + R*cos(t2))/t1;
 	}
 
 	VectorXd rtemp226(gd.NxNyNz);
@@ -2683,7 +2678,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 		const Reciprocal k_i = gd.Lat.toReciprocal(rvec);
 		const complex t1 = k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0];
 		const complex t2 = R*sqrt(t1);
-		ktemp138[i] = ktemp138[i]*complex(0,1)*k_i[0]*exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1)*(-1.0*sin(t2)/(sqrt(t1)) + R*cos(t2))/t1;
+		ktemp138[i] = ktemp138[i]*complex(0,1)*k_i[0]*vm_exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1)*(-1.0*sin(t2)/(sqrt(t1)) + R*cos(t2))/t1;
 	}
 
 	VectorXd rtemp228(gd.NxNyNz);
@@ -2705,7 +2700,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 		const Reciprocal k_i = gd.Lat.toReciprocal(rvec);
 		const complex t1 = k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0];
 		const complex t2 = R*sqrt(t1);
-		ktemp143[i] = ktemp143[i]*complex(0,1)*k_i[0]*exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1)*(-1.0*sin(t2)/(sqrt(t1)) + R*cos(t2))/t1;
+		ktemp143[i] = ktemp143[i]*complex(0,1)*k_i[0]*vm_exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1)*(-1.0*sin(t2)/(sqrt(t1)) + R*cos(t2))/t1;
 	}
 
 	VectorXd rtemp231(gd.NxNyNz);
@@ -2727,7 +2722,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 		const Reciprocal k_i = gd.Lat.toReciprocal(rvec);
 		const complex t1 = k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0];
 		const complex t2 = R*sqrt(t1);
-		ktemp148[i] = ktemp148[i]*complex(0,1)*k_i[0]*exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1)*(-1.0*sin(t2)/(sqrt(t1)) + R*cos(t2))/t1;
+		ktemp148[i] = ktemp148[i]*complex(0,1)*k_i[0]*vm_exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1)*(-1.0*sin(t2)/(sqrt(t1)) + R*cos(t2))/t1;
 	}
 
 	VectorXd rtemp234(gd.NxNyNz);
@@ -2761,7 +2756,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 	rtemp234.resize(0); // Realspace
 	VectorXd rtemp239(gd.NxNyNz);
 	for (int i=0; i<gd.NxNyNz; i++) {
-		const double t1 = -1.0*1 + exp(epsilon_association/kT);
+		const double t1 = -1.0*1 + vm_exp(epsilon_association/kT);
 		const double t2 = 1/(sqrt(0.15915494309189535*kappa_association*t1*rtemp10[i]*(rtemp42[i]/rtemp12[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp14[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -0.5*lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp14[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(4.1887902047863905*rtemp14[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + R*R*R*rtemp14[i]*rtemp14[i]*(73.49635953848843*R*R*R*rtemp14[i]*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -2.0943951023931953*rtemp14[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp14[i]*rtemp14[i]*(73.49635953848843*R*R*R*rtemp14[i]*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)))/kT)/(R*R) + 1) + -1.0);
 		const double t3 = 1/(sqrt(0.15915494309189535*kappa_association*t1*rtemp10[i]*(rtemp42[i]/rtemp12[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp14[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -0.5*lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp14[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(4.1887902047863905*rtemp14[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + R*R*R*rtemp14[i]*rtemp14[i]*(73.49635953848843*R*R*R*rtemp14[i]*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -2.0943951023931953*rtemp14[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp14[i]*rtemp14[i]*(73.49635953848843*R*R*R*rtemp14[i]*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)))/kT)/(R*R) + 1));
 		const double t4 = 1/(rtemp42[i]/rtemp12[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp14[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -0.5*lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp14[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(4.1887902047863905*rtemp14[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + R*R*R*rtemp14[i]*rtemp14[i]*(73.49635953848843*R*R*R*rtemp14[i]*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -2.0943951023931953*rtemp14[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp14[i]*rtemp14[i]*(73.49635953848843*R*R*R*rtemp14[i]*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)))/kT);
@@ -2787,7 +2782,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 		const Reciprocal k_i = gd.Lat.toReciprocal(rvec);
 		const complex t1 = k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0];
 		const complex t2 = R*sqrt(t1);
-		ktemp240[i] = ktemp240[i]*exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1)*(-1.0*sin(t2)/(sqrt(t1)) + -1.0*R*cos(t2));
+		ktemp240[i] = ktemp240[i]*vm_exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1)*(-1.0*sin(t2)/(sqrt(t1)) + -1.0*R*cos(t2));
 	}
 
 	VectorXd rtemp242(gd.NxNyNz);
@@ -2796,7 +2791,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 	ktemp240.resize(0); // KSpace
 	VectorXd rtemp243(gd.NxNyNz);
 	for (int i=0; i<gd.NxNyNz; i++) {
-		const double t1 = -1.0*1 + exp(epsilon_association/kT);
+		const double t1 = -1.0*1 + vm_exp(epsilon_association/kT);
 		const double t2 = 1/(sqrt(0.15915494309189535*kappa_association*t1*rtemp10[i]*(rtemp42[i]/rtemp12[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp14[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -0.5*lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp14[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(4.1887902047863905*rtemp14[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + R*R*R*rtemp14[i]*rtemp14[i]*(73.49635953848843*R*R*R*rtemp14[i]*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -2.0943951023931953*rtemp14[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp14[i]*rtemp14[i]*(73.49635953848843*R*R*R*rtemp14[i]*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)))/kT)/(R*R) + 1) + -1.0);
 		const double t3 = 1/(sqrt(0.15915494309189535*kappa_association*t1*rtemp10[i]*(rtemp42[i]/rtemp12[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp14[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -0.5*lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp14[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(4.1887902047863905*rtemp14[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + R*R*R*rtemp14[i]*rtemp14[i]*(73.49635953848843*R*R*R*rtemp14[i]*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -2.0943951023931953*rtemp14[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp14[i]*rtemp14[i]*(73.49635953848843*R*R*R*rtemp14[i]*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)))/kT)/(R*R) + 1));
 		const double t4 = 1/(rtemp42[i]/rtemp12[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp14[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -0.5*lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp14[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(4.1887902047863905*rtemp14[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + R*R*R*rtemp14[i]*rtemp14[i]*(73.49635953848843*R*R*R*rtemp14[i]*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -2.0943951023931953*rtemp14[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp14[i]*rtemp14[i]*(73.49635953848843*R*R*R*rtemp14[i]*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)))/kT);
@@ -2822,7 +2817,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 		const Reciprocal k_i = gd.Lat.toReciprocal(rvec);
 		const complex t1 = k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0];
 		const complex t2 = R*sqrt(t1);
-		ktemp244[i] = ktemp244[i]*exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1)*(-1.0*sin(t2)/(sqrt(t1)) + -1.0*R*cos(t2));
+		ktemp244[i] = ktemp244[i]*vm_exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1)*(-1.0*sin(t2)/(sqrt(t1)) + -1.0*R*cos(t2));
 	}
 
 	VectorXd rtemp246(gd.NxNyNz);
@@ -2831,7 +2826,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 	ktemp244.resize(0); // KSpace
 	VectorXd rtemp247(gd.NxNyNz);
 	for (int i=0; i<gd.NxNyNz; i++) {
-		const double t1 = -1.0*1 + exp(epsilon_association/kT);
+		const double t1 = -1.0*1 + vm_exp(epsilon_association/kT);
 		const double t2 = 1/(sqrt(0.15915494309189535*kappa_association*t1*rtemp10[i]*(rtemp42[i]/rtemp12[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp14[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -0.5*lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp14[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(4.1887902047863905*rtemp14[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + R*R*R*rtemp14[i]*rtemp14[i]*(73.49635953848843*R*R*R*rtemp14[i]*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -2.0943951023931953*rtemp14[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp14[i]*rtemp14[i]*(73.49635953848843*R*R*R*rtemp14[i]*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)))/kT)/(R*R) + 1) + -1.0);
 		const double t3 = 1/(sqrt(0.15915494309189535*kappa_association*t1*rtemp10[i]*(rtemp42[i]/rtemp12[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp14[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -0.5*lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp14[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(4.1887902047863905*rtemp14[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + R*R*R*rtemp14[i]*rtemp14[i]*(73.49635953848843*R*R*R*rtemp14[i]*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -2.0943951023931953*rtemp14[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp14[i]*rtemp14[i]*(73.49635953848843*R*R*R*rtemp14[i]*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)))/kT)/(R*R) + 1));
 		const double t4 = 1/(rtemp42[i]/rtemp12[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp14[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -0.5*lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp14[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(4.1887902047863905*rtemp14[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + R*R*R*rtemp14[i]*rtemp14[i]*(73.49635953848843*R*R*R*rtemp14[i]*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -2.0943951023931953*rtemp14[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp14[i]*rtemp14[i]*(73.49635953848843*R*R*R*rtemp14[i]*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)))/kT);
@@ -2857,7 +2852,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 		const Reciprocal k_i = gd.Lat.toReciprocal(rvec);
 		const complex t1 = k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0];
 		const complex t2 = R*sqrt(t1);
-		ktemp248[i] = ktemp248[i]*exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1)*(-1.0*sin(t2)/(sqrt(t1)) + -1.0*R*cos(t2));
+		ktemp248[i] = ktemp248[i]*vm_exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1)*(-1.0*sin(t2)/(sqrt(t1)) + -1.0*R*cos(t2));
 	}
 
 	VectorXd rtemp250(gd.NxNyNz);
@@ -2866,7 +2861,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 	ktemp248.resize(0); // KSpace
 	VectorXd rtemp251(gd.NxNyNz);
 	for (int i=0; i<gd.NxNyNz; i++) {
-		const double t1 = -1.0*1 + exp(epsilon_association/kT);
+		const double t1 = -1.0*1 + vm_exp(epsilon_association/kT);
 		const double t2 = 1/(sqrt(0.15915494309189535*kappa_association*t1*rtemp10[i]*(rtemp42[i]/rtemp12[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp14[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -0.5*lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp14[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(4.1887902047863905*rtemp14[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + R*R*R*rtemp14[i]*rtemp14[i]*(73.49635953848843*R*R*R*rtemp14[i]*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -2.0943951023931953*rtemp14[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp14[i]*rtemp14[i]*(73.49635953848843*R*R*R*rtemp14[i]*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)))/kT)/(R*R) + 1) + -1.0);
 		const double t3 = 1/(sqrt(0.15915494309189535*kappa_association*t1*rtemp10[i]*(rtemp42[i]/rtemp12[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp14[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -0.5*lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp14[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(4.1887902047863905*rtemp14[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + R*R*R*rtemp14[i]*rtemp14[i]*(73.49635953848843*R*R*R*rtemp14[i]*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -2.0943951023931953*rtemp14[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp14[i]*rtemp14[i]*(73.49635953848843*R*R*R*rtemp14[i]*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)))/kT)/(R*R) + 1));
 		const double t4 = 1/(rtemp42[i]/rtemp12[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp14[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -0.5*lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp14[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(4.1887902047863905*rtemp14[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + R*R*R*rtemp14[i]*rtemp14[i]*(73.49635953848843*R*R*R*rtemp14[i]*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -2.0943951023931953*rtemp14[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp14[i]*rtemp14[i]*(73.49635953848843*R*R*R*rtemp14[i]*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)))/kT);
@@ -2892,7 +2887,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 		const Reciprocal k_i = gd.Lat.toReciprocal(rvec);
 		const complex t1 = k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0];
 		const complex t2 = R*sqrt(t1);
-		ktemp252[i] = ktemp252[i]*exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1)*(-1.0*sin(t2)/(sqrt(t1)) + -1.0*R*cos(t2));
+		ktemp252[i] = ktemp252[i]*vm_exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1)*(-1.0*sin(t2)/(sqrt(t1)) + -1.0*R*cos(t2));
 	}
 
 	VectorXd rtemp254(gd.NxNyNz);
@@ -2900,7 +2895,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 
 	ktemp252.resize(0); // KSpace
 	for (int i=0; i<gd.NxNyNz; i++) {
-		const double t1 = -1.0*1 + exp(epsilon_association/kT);
+		const double t1 = -1.0*1 + vm_exp(epsilon_association/kT);
 		const double t2 = sqrt(0.15915494309189535*kappa_association*t1*rtemp10[i]*(rtemp42[i]/rtemp12[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp14[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -0.5*lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp14[i]*(8.377580409572781*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(4.1887902047863905*rtemp14[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + R*R*R*rtemp14[i]*rtemp14[i]*(73.49635953848843*R*R*R*rtemp14[i]*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1) + -2.0943951023931953*rtemp14[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp14[i]*rtemp14[i]*(73.49635953848843*R*R*R*rtemp14[i]*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)*(-4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1)))/kT)/(R*R) + 1);
 		const double t3 = 1/t2;
 		const double t4 = -4.1887902047863905*R*R*R*rtemp14[i]*(lambda_dispersion*(-1.50349*1 + 0.249434*lambda_dispersion) + R*R*R*rtemp14[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp14[i]*(lambda_dispersion*(-15.0427*1 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1;
@@ -2951,7 +2946,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 		const int xa = (n-y)/gd.Ny;
 		const RelativeReciprocal rvec((xa>gd.Nx/2) ? xa - gd.Nx : xa, (y>gd.Ny/2) ? y - gd.Ny : y, z);
 		const Reciprocal k_i = gd.Lat.toReciprocal(rvec);
-		ktemp256[i] = ktemp256[i]*exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*(k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0])) + kT*ktemp1[i]/(R*R);
+		ktemp256[i] = ktemp256[i]*vm_exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*(k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0])) + kT*ktemp1[i]/(R*R);
 	}
 
 	ktemp1.resize(0); // KSpace
@@ -2967,9 +2962,9 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 		const double t5 = rtemp2[i]*rtemp2[i];
 		const double t6 = rtemp4[i]*rtemp4[i];
 		const double t7 = -3.0*t6 + t5 + -3.0*t4 + -3.0*t3;
-		const double t8 = t1*t1*log(t1) + rtemp6[i];
+		const double t8 = t1*t1*vm_log(t1) + rtemp6[i];
 		const double t9 = -0.22222222222222224*1/rtemp6[i] + 0.22222222222222224*1/t1;
-		const double t10 = log(t1);
+		const double t10 = vm_log(t1);
 		const double t11 = t8/(t1*rtemp6[i]) + -1.0*rtemp25[i];
 		const double t12 = (7.957747154594767e-2*t8*t9 + 8.841941282883075e-3)/t1;
 		rtemp259[i] = ((0.3333333333333333*t2*rtemp246[i] + 0.3333333333333333*t2*(t8*rtemp254[i]/t1 + rtemp250[i])/t1)/t1 + 0.3333333333333333*t11*t2*rtemp242[i]/t1)/(rtemp6[i]*rtemp6[i]) + rtemp2[i]*((t7*(rtemp197[i]*(-8.841941282883075e-3*1 + 1.768388256576615e-2*rtemp25[i] + t12) + t8*rtemp193[i]/(t1*rtemp6[i]))/(t1*rtemp6[i]) + 7.957747154594767e-2*t7*t9*(t10*rtemp197[i] + rtemp205[i])/t1 + t7*rtemp201[i]*(-8.841941282883075e-3*1 + 1.768388256576615e-2*rtemp25[i] + 7.957747154594767e-2*t9 + 2.0*t12)/(t1*t1) + t7*rtemp193[i]*(t8/(t1*t1) + 1)/(t1*t1))/(rtemp6[i]*rtemp6[i]) + rtemp4[i]*(((t8*rtemp189[i]/t1 + rtemp187[i])/t1 + rtemp50[i])/t1 + t11*rtemp185[i]/t1)/(rtemp6[i]*rtemp6[i]) + rtemp22[i]*(((t8*rtemp183[i]/t1 + rtemp181[i])/t1 + rtemp92[i])/t1 + t11*rtemp179[i]/t1)/(rtemp6[i]*rtemp6[i]) + rtemp18[i]*(((t8*rtemp177[i]/t1 + rtemp173[i])/t1 + rtemp85[i])/t1 + t11*rtemp169[i]/t1)/(rtemp6[i]*rtemp6[i]) + rtemp223[i]/(t1*t1)) + rtemp259[i]/t1 + rtemp237[i]*rtemp4[i]/(t1*t1) + rtemp164[i]*rtemp22[i]/(t1*t1) + rtemp150[i]*rtemp18[i]/(t1*t1) + kT*rtemp7[i]*(-0.22222222222222224*t10*t7 + (t7*t8*t9 + 0.11111111111111112*t7)/t1 + -0.11111111111111112*t7)/(rtemp6[i]*rtemp6[i]) + (1.5*rtemp2[i]*rtemp68[i]/(t1*t1) + t2*(rtemp129[i]/t1 + 12.566370614359172*kT)/(t1*t1))/R;
@@ -3043,7 +3038,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 		const int xa = (n-y)/gd.Ny;
 		const RelativeReciprocal rvec((xa>gd.Nx/2) ? xa - gd.Nx : xa, (y>gd.Ny/2) ? y - gd.Ny : y, z);
 		const Reciprocal k_i = gd.Lat.toReciprocal(rvec);
-		ktemp261[i] = ktemp261[i]*exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*(k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0])) + ktemp99[i];
+		ktemp261[i] = ktemp261[i]*vm_exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*(k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0])) + ktemp99[i];
 	}
 
 	ktemp99.resize(0); // KSpace
@@ -3058,8 +3053,8 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 		const double t4 = R*R*R*rtemp14[i];
 		const double t5 = 4.1887902047863905*t4;
 		const double t6 = 4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0;
-		const double t7 = 12.566370614359172*R*R*(sqrt(0.15915494309189535*kappa_association*rtemp10[i]*(-1.0*1 + exp(epsilon_association/kT))*(rtemp42[i]/rtemp12[i] + 0.25*epsilon_dispersion*(t3*t6/(t2*t2*t2) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(1 + -2.0943951023931953*t1) + -4.1887902047863905*R*R*R*t6*(-2.0943951023931953*rtemp14[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + 3.0*(1 + -2.0943951023931953*t1)*(4.1887902047863905*rtemp14[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + R*R*R*rtemp14[i]*rtemp14[i]*(73.49635953848843*t4*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion))/t2 + -0.5*R*R*R*rtemp14[i]*rtemp14[i]*(73.49635953848843*t4*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion)))/(t2*t2*t2))/kT)/(R*R) + 1) + -1.0)/(kappa_association*rtemp10[i]*(-1.0*1 + exp(epsilon_association/kT))*(rtemp42[i]/rtemp12[i] + 0.25*epsilon_dispersion*(t3*t6/(t2*t2*t2) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(1 + -2.0943951023931953*t1) + -4.1887902047863905*R*R*R*t6*(-2.0943951023931953*rtemp14[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + 3.0*(1 + -2.0943951023931953*t1)*(4.1887902047863905*rtemp14[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + R*R*R*rtemp14[i]*rtemp14[i]*(73.49635953848843*t4*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion))/t2 + -0.5*R*R*R*rtemp14[i]*rtemp14[i]*(73.49635953848843*t4*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion)))/(t2*t2*t2))/kT));
-		(*outgrad)[i] = ingrad[i]*(kT*(2.0*1 + log(2.6464769766182683e-6*x[i]/(sqrt(kT)*kT)) + 4.0*log(t7) + -2.0*t7) + epsilon_dispersion*t4*t6*(2.0943951023931953*epsilon_dispersion*t3*((1 + -1.0*t5)*(1 + -1.0*t5))*((1 + -1.0*t5)*(1 + -1.0*t5))/(kT*(4.0*t5*t5 + 1 + 4.0*t5)) + -4.1887902047863905*1 + 8.772981689857206*t1)/(t2*t2*t2) + rtemp264[i] + mu) + (*outgrad)[i];
+		const double t7 = 12.566370614359172*R*R*(sqrt(0.15915494309189535*kappa_association*rtemp10[i]*(-1.0*1 + vm_exp(epsilon_association/kT))*(rtemp42[i]/rtemp12[i] + 0.25*epsilon_dispersion*(t3*t6/(t2*t2*t2) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(1 + -2.0943951023931953*t1) + -4.1887902047863905*R*R*R*t6*(-2.0943951023931953*rtemp14[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + 3.0*(1 + -2.0943951023931953*t1)*(4.1887902047863905*rtemp14[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + R*R*R*rtemp14[i]*rtemp14[i]*(73.49635953848843*t4*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion))/t2 + -0.5*R*R*R*rtemp14[i]*rtemp14[i]*(73.49635953848843*t4*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion)))/(t2*t2*t2))/kT)/(R*R) + 1) + -1.0)/(kappa_association*rtemp10[i]*(-1.0*1 + vm_exp(epsilon_association/kT))*(rtemp42[i]/rtemp12[i] + 0.25*epsilon_dispersion*(t3*t6/(t2*t2*t2) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(1 + -2.0943951023931953*t1) + -4.1887902047863905*R*R*R*t6*(-2.0943951023931953*rtemp14[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + 3.0*(1 + -2.0943951023931953*t1)*(4.1887902047863905*rtemp14[i]*(-1.50349*1 + 0.498868*lambda_dispersion) + R*R*R*rtemp14[i]*rtemp14[i]*(73.49635953848843*t4*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion))/t2 + -0.5*R*R*R*rtemp14[i]*rtemp14[i]*(73.49635953848843*t4*(-15.0427*1 + 10.61654*lambda_dispersion) + 24.572946253656237*1 + -29.046956363922856*lambda_dispersion)))/(t2*t2*t2))/kT));
+		(*outgrad)[i] = ingrad[i]*(kT*(2.0*1 + vm_log(2.6464769766182683e-6*x[i]/(sqrt(kT)*kT)) + 4.0*vm_log(t7) + -2.0*t7) + epsilon_dispersion*t4*t6*(2.0943951023931953*epsilon_dispersion*t3*((1 + -1.0*t5)*(1 + -1.0*t5))*((1 + -1.0*t5)*(1 + -1.0*t5))/(kT*(4.0*t5*t5 + 1 + 4.0*t5)) + -4.1887902047863905*1 + 8.772981689857206*t1)/(t2*t2*t2) + rtemp264[i] + mu) + (*outgrad)[i];
 	}
 
 	rtemp264.resize(0); // Realspace
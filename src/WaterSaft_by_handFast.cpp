@@ -3,6 +3,7 @@
 #include "MinimalFunctionals.h"
 #include "utilities.h"
 #include "handymath.h"
+#include "VectorMath.h"
 
 
 class WaterSaft_by_hand_type : public FunctionalInterface {
@@ -44,7 +45,7 @@ double integral(const GridDescription &gd, double kT, const VectorXd &x) const {
 		const RelativeReciprocal rvec((xa>gd.Nx/2) ? xa - gd.Nx : xa, (y>gd.Ny/2) ? y - gd.Ny : y, z);
 		const Reciprocal k_i = gd.Lat.toReciprocal(rvec);
 		const complex t1 = sqrt(k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0]);
-		ktemp1[i] = 25.132741228718345*R*ktemp0[i]*sin(2.0*R*t1)*exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1*t1)/t1;
+		ktemp1[i] = 25.132741228718345*R*ktemp0[i]*sin(2.0*R*t1)*vm_exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1*t1)/t1;
 	}
 
 	VectorXd rtemp2(gd.NxNyNz);
@@ -65,7 +66,7 @@ double integral(const GridDescription &gd, double kT, const VectorXd &x) const {
 		const int xa = (n-y)/gd.Ny;
 		const RelativeReciprocal rvec((xa>gd.Nx/2) ? xa - gd.Nx : xa, (y>gd.Ny/2) ? y - gd.Ny : y, z);
 		const Reciprocal k_i = gd.Lat.toReciprocal(rvec);
-		ktemp3[i] = ktemp0[i]*exp(-4.0*R*R*lambda_dispersion*lambda_dispersion*length_scaling*length_scaling*(0.5*k_i[2]*k_i[2] + 0.5*k_i[1]*k_i[1] + 0.5*k_i[0]*k_i[0]));
+		ktemp3[i] = ktemp0[i]*vm_exp(-4.0*R*R*lambda_dispersion*lambda_dispersion*length_scaling*length_scaling*(0.5*k_i[2]*k_i[2] + 0.5*k_i[1]*k_i[1] + 0.5*k_i[0]*k_i[0]));
 	}
 
 	VectorXd rtemp4(gd.NxNyNz);
@@ -83,7 +84,7 @@ double integral(const GridDescription &gd, double kT, const VectorXd &x) const {
 		const Reciprocal k_i = gd.Lat.toReciprocal(rvec);
 		const complex t1 = k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0];
 		const complex t2 = R*sqrt(t1);
-		ktemp5[i] = 12.566370614359172*ktemp0[i]*complex(0,1)*k_i[0]*exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1)*(-1.0*sin(t2)/(sqrt(t1)) + R*cos(t2))/t1;
+		ktemp5[i] = 12.566370614359172*ktemp0[i]*complex(0,1)*k_i[0]*vm_exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1)*(-1.0*sin(t2)/(sqrt(t1)) + R*cos(t2))/t1;
 	}
 
 	VectorXd rtemp6(gd.NxNyNz);
@@ -106,7 +107,7 @@ double integral(const GridDescription &gd, double kT, const VectorXd &x) const {
 		const Reciprocal k_i = gd.Lat.toReciprocal(rvec);
 		const complex t1 = k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0];
 		const complex t2 = R*sqrt(t1);
-		ktemp7[i] = 12.566370614359172*ktemp0[i]*exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1)*(-1.0*t2*cos(t2) + sin(t2))/(sqrt(t1)*t1);
+		ktemp7[i] = 12.566370614359172*ktemp0[i]*vm_exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1)*(-1.0*t2*cos(t2) + sin(t2))/(sqrt(t1)*t1);
 	}
 
 	VectorXd rtemp8(gd.NxNyNz);
@@ -137,7 +138,7 @@ double integral(const GridDescription &gd, double kT, const VectorXd &x) const {
 		const RelativeReciprocal rvec((xa>gd.Nx/2) ? xa - gd.Nx : xa, (y>gd.Ny/2) ? y - gd.Ny : y, z);
 		const Reciprocal k_i = gd.Lat.toReciprocal(rvec);
 		const complex t1 = sqrt(k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0]);
-		ktemp11[i] = 12.566370614359172*R*ktemp0[i]*sin(R*t1)*exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1*t1)/t1;
+		ktemp11[i] = 12.566370614359172*R*ktemp0[i]*sin(R*t1)*vm_exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1*t1)/t1;
 	}
 
 	VectorXd rtemp12(gd.NxNyNz);
@@ -147,7 +148,7 @@ double integral(const GridDescription &gd, double kT, const VectorXd &x) const {
 	VectorXd rtemp13(gd.NxNyNz);
 	for (int i=0; i<gd.NxNyNz; i++) {
 		const double t1 = 1.0 + -1.0*rtemp8[i];
-		rtemp13[i] = rtemp6[i]*(-5.305164769729845e-2*rtemp12[i]*(t1*t1*log(t1) + rtemp8[i])/(t1*rtemp8[i]*rtemp8[i]) + -0.15915494309189535*1.0/R)/t1;
+		rtemp13[i] = rtemp6[i]*(-5.305164769729845e-2*rtemp12[i]*(t1*t1*vm_log(t1) + rtemp8[i])/(t1*rtemp8[i]*rtemp8[i]) + -0.15915494309189535*1.0/R)/t1;
 	}
 
 	VectorXcd ktemp14(gd.NxNyNzOver2);
@@ -165,7 +166,7 @@ double integral(const GridDescription &gd, double kT, const VectorXd &x) const {
 		const Reciprocal k_i = gd.Lat.toReciprocal(rvec);
 		const complex t1 = k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0];
 		const complex t2 = R*sqrt(t1);
-		ktemp15[i] = 12.566370614359172*ktemp0[i]*complex(0,1)*k_i[1]*exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1)*(-1.0*sin(t2)/(sqrt(t1)) + R*cos(t2))/t1;
+		ktemp15[i] = 12.566370614359172*ktemp0[i]*complex(0,1)*k_i[1]*vm_exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1)*(-1.0*sin(t2)/(sqrt(t1)) + R*cos(t2))/t1;
 	}
 
 	VectorXd rtemp16(gd.NxNyNz);
@@ -175,7 +176,7 @@ double integral(const GridDescription &gd, double kT, const VectorXd &x) const {
 	VectorXd rtemp17(gd.NxNyNz);
 	for (int i=0; i<gd.NxNyNz; i++) {
 		const double t1 = 1.0 + -1.0*rtemp8[i];
-		rtemp17[i] = rtemp16[i]*(-5.305164769729845e-2*rtemp12[i]*(t1*t1*log(t1) + rtemp8[i])/(t1*rtemp8[i]*rtemp8[i]) + -0.15915494309189535*1.0/R)/t1;
+		rtemp17[i] = rtemp16[i]*(-5.305164769729845e-2*rtemp12[i]*(t1*t1*vm_log(t1) + rtemp8[i])/(t1*rtemp8[i]*rtemp8[i]) + -0.15915494309189535*1.0/R)/t1;
 	}
 
 	VectorXcd ktemp18(gd.NxNyNzOver2);
@@ -192,7 +193,7 @@ double integral(const GridDescription &gd, double kT, const VectorXd &x) const {
 		const Reciprocal k_i = gd.Lat.toReciprocal(rvec);
 		const complex t1 = k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0];
 		const complex t2 = R*sqrt(t1);
-		ktemp0[i] = 12.566370614359172*ktemp0[i]*complex(0,1)*k_i[2]*exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1)*(-1.0*sin(t2)/(sqrt(t1)) + R*cos(t2))/t1;
+		ktemp0[i] = 12.566370614359172*ktemp0[i]*complex(0,1)*k_i[2]*vm_exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1)*(-1.0*sin(t2)/(sqrt(t1)) + R*cos(t2))/t1;
 	}
 
 	VectorXd rtemp20(gd.NxNyNz);
@@ -202,7 +203,7 @@ double integral(const GridDescription &gd, double kT, const VectorXd &x) const {
 	VectorXd rtemp21(gd.NxNyNz);
 	for (int i=0; i<gd.NxNyNz; i++) {
 		const double t1 = 1.0 + -1.0*rtemp8[i];
-		rtemp21[i] = rtemp20[i]*(-5.305164769729845e-2*rtemp12[i]*(t1*t1*log(t1) + rtemp8[i])/(t1*rtemp8[i]*rtemp8[i]) + -0.15915494309189535*1.0/R)/t1;
+		rtemp21[i] = rtemp20[i]*(-5.305164769729845e-2*rtemp12[i]*(t1*t1*vm_log(t1) + rtemp8[i])/(t1*rtemp8[i]*rtemp8[i]) + -0.15915494309189535*1.0/R)/t1;
 	}
 
 	VectorXcd ktemp22(gd.NxNyNzOver2);
@@ -211,7 +212,7 @@ double integral(const GridDescription &gd, double kT, const VectorXd &x) const {
 	rtemp21.resize(0); // Realspace
 	VectorXd rtemp23(gd.NxNyNz);
 	for (int i=0; i<gd.NxNyNz; i++) {
-		const double t1 = log(1.0 + -1.0*rtemp8[i]);
+		const double t1 = vm_log(1.0 + -1.0*rtemp8[i]);
 		const double t2 = 1.0 + -1.0*rtemp8[i];
 		const double t3 = rtemp12[i]*rtemp12[i];
 		const double t4 = rtemp16[i]*rtemp16[i];
@@ -244,7 +245,7 @@ double integral(const GridDescription &gd, double kT, const VectorXd &x) const {
 	rtemp27.resize(0); // Realspace
 	VectorXd rtemp29(gd.NxNyNz);
 	for (int i=0; i<gd.NxNyNz; i++) {
-		const double t1 = log(1.0 + -1.0*rtemp8[i]);
+		const double t1 = vm_log(1.0 + -1.0*rtemp8[i]);
 		const double t2 = 1.0/(1.0 + -1.0*rtemp8[i]);
 		rtemp29[i] = t2*(8.841941282883075e-3*t2*(t1/(t2*t2) + rtemp8[i])*(-3.0*rtemp6[i]*rtemp6[i] + -3.0*rtemp20[i]*rtemp20[i] + -3.0*rtemp16[i]*rtemp16[i] + 3.0*rtemp12[i]*rtemp12[i])/(rtemp8[i]*rtemp8[i]) + 7.957747154594767e-2*rtemp12[i]/R) + (7.957747154594767e-2*t2*rtemp12[i] + -7.957747154594767e-2*t1/R)/R;
 	}
@@ -267,7 +268,7 @@ double integral(const GridDescription &gd, double kT, const VectorXd &x) const {
 		const RelativeReciprocal rvec((xa>gd.Nx/2) ? xa - gd.Nx : xa, (y>gd.Ny/2) ? y - gd.Ny : y, z);
 		const Reciprocal k_i = gd.Lat.toReciprocal(rvec);
 		const complex t1 = sin(R*sqrt(k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0]));
-		const complex t2 = exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*(k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0]));
+		const complex t2 = vm_exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*(k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0]));
 		const complex t3 = 1.0/(sqrt(k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0]));
 		const complex t4 = R*cos(R/t3);
 		const complex t5 = t1*t3;
@@ -285,38 +286,33 @@ double integral(const GridDescription &gd, double kT, const VectorXd &x) const {
 	rtemp32 = ifft(gd, ktemp30);
 
 	ktemp30.resize(0); // KSpace
-	double 	s33 = 0;
-	for (int i=0; i<gd.NxNyNz; i++) {
-		s33 += gd.dvolume*kT*x[i]*(-6.283185307179586*R*R*(sqrt(0.15915494309189535*kappa_association*rtemp2[i]*(-1.0*1.0 + exp(epsilon_association/kT))*(rtemp32[i]/rtemp2[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp4[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -0.5*lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp4[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(4.1887902047863905*rtemp4[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + R*R*R*rtemp4[i]*rtemp4[i]*(73.49635953848843*R*R*R*rtemp4[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -2.0943951023931953*rtemp4[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp4[i]*rtemp4[i]*(73.49635953848843*R*R*R*rtemp4[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)))/kT)/(R*R) + 1.0) + -1.0)/(kappa_association*rtemp2[i]*(-1.0*1.0 + exp(epsilon_association/kT))*(rtemp32[i]/rtemp2[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp4[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -0.5*lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp4[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(4.1887902047863905*rtemp4[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + R*R*R*rtemp4[i]*rtemp4[i]*(73.49635953848843*R*R*R*rtemp4[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -2.0943951023931953*rtemp4[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp4[i]*rtemp4[i]*(73.49635953848843*R*R*R*rtemp4[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)))/kT)) + 0.5*1.0 + log(12.566370614359172*R*R*(sqrt(0.15915494309189535*kappa_association*rtemp2[i]*(-1.0*1.0 + exp(epsilon_association/kT))*(rtemp32[i]/rtemp2[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp4[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -0.5*lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp4[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(4.1887902047863905*rtemp4[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + R*R*R*rtemp4[i]*rtemp4[i]*(73.49635953848843*R*R*R*rtemp4[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -2.0943951023931953*rtemp4[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp4[i]*rtemp4[i]*(73.49635953848843*R*R*R*rtemp4[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)))/kT)/(R*R) + 1.0) + -1.0)/(kappa_association*rtemp2[i]*(-1.0*1.0 + exp(epsilon_association/kT))*(rtemp32[i]/rtemp2[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp4[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -0.5*lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp4[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(4.1887902047863905*rtemp4[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + R*R*R*rtemp4[i]*rtemp4[i]*(73.49635953848843*R*R*R*rtemp4[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -2.0943951023931953*rtemp4[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp4[i]*rtemp4[i]*(73.49635953848843*R*R*R*rtemp4[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)))/kT))));
-	}
+	double 	s33 = grid_sum_of(gd.NxNyNz, [&](long i) {
+		return gd.dvolume*kT*x[i]*(-6.283185307179586*R*R*(sqrt(0.15915494309189535*kappa_association*rtemp2[i]*(-1.0*1.0 + vm_exp(epsilon_association/kT))*(rtemp32[i]/rtemp2[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp4[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -0.5*lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp4[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(4.1887902047863905*rtemp4[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + R*R*R*rtemp4[i]*rtemp4[i]*(73.49635953848843*R*R*R*rtemp4[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -2.0943951023931953*rtemp4[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp4[i]*rtemp4[i]*(73.49635953848843*R*R*R*rtemp4[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)))/kT)/(R*R) + 1.0) + -1.0)/(kappa_association*rtemp2[i]*(-1.0*1.0 + vm_exp(epsilon_association/kT))*(rtemp32[i]/rtemp2[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp4[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -0.5*lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp4[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(4.1887902047863905*rtemp4[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + R*R*R*rtemp4[i]*rtemp4[i]*(73.49635953848843*R*R*R*rtemp4[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -2.0943951023931953*rtemp4[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp4[i]*rtemp4[i]*(73.49635953848843*R*R*R*rtemp4[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)))/kT)) + 0.5*1.0 + vm_log(12.566370614359172*R*R*(sqrt(0.15915494309189535*kappa_association*rtemp2[i]*(-1.0*1.0 + vm_exp(epsilon_association/kT))*(rtemp32[i]/rtemp2[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp4[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -0.5*lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp4[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(4.1887902047863905*rtemp4[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + R*R*R*rtemp4[i]*rtemp4[i]*(73.49635953848843*R*R*R*rtemp4[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -2.0943951023931953*rtemp4[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp4[i]*rtemp4[i]*(73.49635953848843*R*R*R*rtemp4[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)))/kT)/(R*R) + 1.0) + -1.0)/(kappa_association*rtemp2[i]*(-1.0*1.0 + vm_exp(epsilon_association/kT))*(rtemp32[i]/rtemp2[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp4[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -0.5*lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp4[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(4.1887902047863905*rtemp4[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + R*R*R*rtemp4[i]*rtemp4[i]*(73.49635953848843*R*R*R*rtemp4[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -2.0943951023931953*rtemp4[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp4[i]*rtemp4[i]*(73.49635953848843*R*R*R*rtemp4[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)))/kT))));
+	});
 
 	rtemp32.resize(0); // Realspace
 	rtemp2.resize(0); // Realspace
 	Fassoc = 4.0*s33;
-	double 	s34 = 0;
-	for (int i=0; i<gd.NxNyNz; i++) {
-		s34 += R*R*R*epsilon_dispersion*gd.dvolume*rtemp4[i]*x[i]*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(-2.0943951023931953*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)/((-4.1887902047863905*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0));
-	}
+	double 	s34 = grid_sum_of(gd.NxNyNz, [&](long i) {
+		return R*R*R*epsilon_dispersion*gd.dvolume*rtemp4[i]*x[i]*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(-2.0943951023931953*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)/((-4.1887902047863905*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0));
+	});
 
 	a1integrated = -4.1887902047863905*s34;
-	double 	s35 = 0;
-	for (int i=0; i<gd.NxNyNz; i++) {
-		s35 += R*R*R*epsilon_dispersion*epsilon_dispersion*gd.dvolume*rtemp4[i]*x[i]*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp4[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -0.5*lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp4[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)*((-4.1887902047863905*R*R*R*rtemp4[i] + 1.0)*(-4.1887902047863905*R*R*R*rtemp4[i] + 1.0))*((-4.1887902047863905*R*R*R*rtemp4[i] + 1.0)*(-4.1887902047863905*R*R*R*rtemp4[i] + 1.0))/(kT*(4.0*(4.1887902047863905*R*R*R*rtemp4[i])*(4.1887902047863905*R*R*R*rtemp4[i]) + 16.755160819145562*R*R*R*rtemp4[i] + 1.0)*(-4.1887902047863905*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0));
-	}
+	double 	s35 = grid_sum_of(gd.NxNyNz, [&](long i) {
+		return R*R*R*epsilon_dispersion*epsilon_dispersion*gd.dvolume*rtemp4[i]*x[i]*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp4[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -0.5*lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp4[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)*((-4.1887902047863905*R*R*R*rtemp4[i] + 1.0)*(-4.1887902047863905*R*R*R*rtemp4[i] + 1.0))*((-4.1887902047863905*R*R*R*rtemp4[i] + 1.0)*(-4.1887902047863905*R*R*R*rtemp4[i] + 1.0))/(kT*(4.0*(4.1887902047863905*R*R*R*rtemp4[i])*(4.1887902047863905*R*R*R*rtemp4[i]) + 16.755160819145562*R*R*R*rtemp4[i] + 1.0)*(-4.1887902047863905*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp4[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp4[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp4[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0));
+	});
 
 	rtemp4.resize(0); // Realspace
 	a2integrated = 2.0943951023931953*s35;
 	Fdisp = a2integrated + a1integrated;
-	double 	s36 = 0;
-	for (int i=0; i<gd.NxNyNz; i++) {
-		s36 += gd.dvolume*kT*x[i]*(-1.0*1.0 + log(2.646476976618268e-6*x[i]/(sqrt(kT)*kT)));
-	}
+	double 	s36 = grid_sum_of(gd.NxNyNz, [&](long i) {
+		return gd.dvolume*kT*x[i]*(-1.0*1.0 + vm_log(2.646476976618268e-6*x[i]/(sqrt(kT)*kT)));
+	});
 
 	Fideal = s36;
-	double 	s37 = 0;
-	for (int i=0; i<gd.NxNyNz; i++) {
-		s37 += gd.dvolume*kT*rtemp12[i]*log(1.0 + -1.0*rtemp8[i])/(R*R);
-	}
+	double 	s37 = grid_sum_of(gd.NxNyNz, [&](long i) {
+		return gd.dvolume*kT*rtemp12[i]*vm_log(1.0 + -1.0*rtemp8[i])/(R*R);
+	});
 
 	kTphi1 = -7.957747154594767e-2*s37;
 	for (int i=0; i<gd.NxNyNz; i++) {
@@ -329,10 +325,9 @@ double integral(const GridDescription &gd, double kT, const VectorXd &x) const {
 	}
 
 	rtemp6.resize(0); // Realspace
-	double 	s40 = 0;
-	for (int i=0; i<gd.NxNyNz; i++) {
-		s40 += gd.dvolume*kT*(7.957747154594767e-2*rtemp12[i]*rtemp12[i] + rtemp20[i])/(R*(1.0 + -1.0*rtemp8[i]));
-	}
+	double 	s40 = grid_sum_of(gd.NxNyNz, [&](long i) {
+		return gd.dvolume*kT*(7.957747154594767e-2*rtemp12[i]*rtemp12[i] + rtemp20[i])/(R*(1.0 + -1.0*rtemp8[i]));
+	});
 
 	kTphi2 = s40;
 	for (int i=0; i<gd.NxNyNz; i++) {
@@ -340,19 +335,17 @@ double integral(const GridDescription &gd, double kT, const VectorXd &x) const {
 	}
 
 	rtemp12.resize(0); // Realspace
-	double 	s42 = 0;
-	for (int i=0; i<gd.NxNyNz; i++) {
-		s42 += gd.dvolume*kT*rtemp20[i]*(log(1.0 + -1.0*rtemp8[i])*(1.0 + -1.0*rtemp8[i])*(1.0 + -1.0*rtemp8[i]) + rtemp8[i])/(rtemp8[i]*rtemp8[i]*(1.0 + -1.0*rtemp8[i])*(1.0 + -1.0*rtemp8[i]));
-	}
+	double 	s42 = grid_sum_of(gd.NxNyNz, [&](long i) {
+		return gd.dvolume*kT*rtemp20[i]*(vm_log(1.0 + -1.0*rtemp8[i])*(1.0 + -1.0*rtemp8[i])*(1.0 + -1.0*rtemp8[i]) + rtemp8[i])/(rtemp8[i]*rtemp8[i]*(1.0 + -1.0*rtemp8[i])*(1.0 + -1.0*rtemp8[i]));
+	});
 
 	rtemp20.resize(0); // Realspace
 	rtemp8.resize(0); // Realspace
 	kTphi3 = 8.841941282883075e-3*s42;
 	whitebear = kTphi3 + kTphi2 + kTphi1;
-	double 	s43 = 0;
-	for (int i=0; i<gd.NxNyNz; i++) {
-		s43 += gd.dvolume*mu*x[i];
-	}
+	double 	s43 = grid_sum_of(gd.NxNyNz, [&](long i) {
+		return gd.dvolume*mu*x[i];
+	});
 
 	FSAFT = whitebear + s43 + Fideal + Fdisp + Fassoc;
 	output = FSAFT;
@@ -373,7 +366,7 @@ double transform(double kT, double x) const {
 	}
 	double output = 0;
 		double 	n = x;
-	double 	boltz = -1.0*1.0 + exp(epsilon_association/kT);
+	double 	boltz = -1.0*1.0 + vm_exp(epsilon_association/kT);
 	double 	eta_d = 4.1887902047863905*R*R*R*n;
 	double 	c1 = lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + 2.25855;
 	double 	c2 = lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + -0.66927;
@@ -390,7 +383,7 @@ double transform(double kT, double x) const {
 	double 	n0 = 7.957747154594767e-2*deltak*n/(R*R);
 	double 	n2 = deltak*n;
 	double 	n1 = 7.957747154594767e-2*deltak*n/R;
-	double 	dAdR = kT*n*(deltaprime*((n2*(n2*((log(1.0 + -1.0*n3)*(-2.6525823848649224e-2*1.0/n3 + 5.305164769729845e-2) + -2.6525823848649224e-2)/n3 + -2.6525823848649224e-2*log(1.0 + -1.0*n3))/(1.0 + -1.0*n3) + -7.957747154594767e-2*1.0/R) + -1.0*n1)/(1.0 + -1.0*n3) + 7.957747154594767e-2*log(1.0 + -1.0*n3)/(R*R)) + deltak*((n2*((n2*n2*(3.53677651315323e-2*log(1.0 + -1.0*n3)/(1.0 + -1.0*n3) + (3.53677651315323e-2*1.0/(1.0 + -1.0*n3) + log(1.0 + -1.0*n3)*(-8.841941282883076e-2*1.0/(1.0 + -1.0*n3) + 1.768388256576615e-2) + (-1.768388256576615e-2*1.0/(1.0 + -1.0*n3) + log(1.0 + -1.0*n3)*((-1.768388256576615e-2*1.0/n3 + 7.07355302630646e-2)/(1.0 + -1.0*n3) + -1.768388256576615e-2))/n3 + 8.841941282883075e-3)/n3) + n1)/(1.0 + -1.0*n3) + -7.957747154594767e-2*1.0/(R*R)) + n0)/(1.0 + -1.0*n3) + 0.15915494309189535*log(1.0 + -1.0*n3)/(R*R*R)));
+	double 	dAdR = kT*n*(deltaprime*((n2*(n2*((vm_log(1.0 + -1.0*n3)*(-2.6525823848649224e-2*1.0/n3 + 5.305164769729845e-2) + -2.6525823848649224e-2)/n3 + -2.6525823848649224e-2*vm_log(1.0 + -1.0*n3))/(1.0 + -1.0*n3) + -7.957747154594767e-2*1.0/R) + -1.0*n1)/(1.0 + -1.0*n3) + 7.957747154594767e-2*vm_log(1.0 + -1.0*n3)/(R*R)) + deltak*((n2*((n2*n2*(3.53677651315323e-2*vm_log(1.0 + -1.0*n3)/(1.0 + -1.0*n3) + (3.53677651315323e-2*1.0/(1.0 + -1.0*n3) + vm_log(1.0 + -1.0*n3)*(-8.841941282883076e-2*1.0/(1.0 + -1.0*n3) + 1.768388256576615e-2) + (-1.768388256576615e-2*1.0/(1.0 + -1.0*n3) + vm_log(1.0 + -1.0*n3)*((-1.768388256576615e-2*1.0/n3 + 7.07355302630646e-2)/(1.0 + -1.0*n3) + -1.768388256576615e-2))/n3 + 8.841941282883075e-3)/n3) + n1)/(1.0 + -1.0*n3) + -7.957747154594767e-2*1.0/(R*R)) + n0)/(1.0 + -1.0*n3) + 0.15915494309189535*vm_log(1.0 + -1.0*n3)/(R*R*R)));
 	double 	dc1_by_dlambda_dispersion = -1.50349*1.0 + 0.498868*lambda_dispersion;
 	double 	dc2_by_dlambda_dispersion = 1.40049*1.0 + -1.655478*lambda_dispersion;
 	double 	dc3_by_dlambda_dispersion = -15.0427*1.0 + 10.61654*lambda_dispersion;
@@ -403,19 +396,19 @@ double transform(double kT, double x) const {
 	double 	delta2k = 50.26548245743669*R*R;
 	double 	nA = 1.9894367886486918e-2*delta2k*n/(R*R);
 	double 	X = (0.25*sqrt(8.0*deltasaft*nA + 1.0) + -0.25)/(deltasaft*nA);
-	double 	Fassoc = kT*n*(2.0*1.0 + 4.0*log(X) + -2.0*X);
+	double 	Fassoc = kT*n*(2.0*1.0 + 4.0*vm_log(X) + -2.0*X);
 	double 	a1 = epsilon_dispersion*eta_d*ghs*(-4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + 4.0);
 	double 	a1integrated = a1*n;
 	double 	KHS = (eta_d*(eta_d*(eta_d*(-4.0*1.0 + eta_d) + 6.0) + -4.0) + 1.0)/(eta_d*(4.0*1.0 + 4.0*eta_d) + 1.0);
 	double 	a2 = 0.5*KHS*da1_by_deta_d*epsilon_dispersion*eta_d;
 	double 	a2integrated = a2*n/kT;
 	double 	Fdisp = a2integrated + a1integrated;
-	double 	Fideal = kT*n*(-1.0*1.0 + log(2.646476976618268e-6*n/(sqrt(kT)*kT)));
-	double 	phi1 = -1.0*n0*log(1.0 + -1.0*n3);
+	double 	Fideal = kT*n*(-1.0*1.0 + vm_log(2.646476976618268e-6*n/(sqrt(kT)*kT)));
+	double 	phi1 = -1.0*n0*vm_log(1.0 + -1.0*n3);
 	double 	kTphi1 = kT*phi1;
 	double 	phi2 = n1*n2/(1.0 + -1.0*n3);
 	double 	kTphi2 = kT*phi2;
-	double 	phi3 = n2*n2*n2*((log(1.0 + -1.0*n3)*(8.841941282883075e-3*1.0/n3 + -1.768388256576615e-2) + 8.841941282883075e-3)/n3 + 8.841941282883075e-3*log(1.0 + -1.0*n3))/((1.0 + -1.0*n3)*(1.0 + -1.0*n3));
+	double 	phi3 = n2*n2*n2*((vm_log(1.0 + -1.0*n3)*(8.841941282883075e-3*1.0/n3 + -1.768388256576615e-2) + 8.841941282883075e-3)/n3 + 8.841941282883075e-3*vm_log(1.0 + -1.0*n3))/((1.0 + -1.0*n3)*(1.0 + -1.0*n3));
 	double 	kTphi3 = kT*phi3;
 	double 	whitebear = kTphi3 + kTphi2 + kTphi1;
 	double 	FSAFT = mu*n + whitebear + Fideal + Fdisp + Fassoc;
@@ -434,7 +427,7 @@ double derive(double kT, double x) const {
 
 	}
 	double output = 0;
-	double 	boltz = -1.0*1.0 + exp(epsilon_association/kT);
+	double 	boltz = -1.0*1.0 + vm_exp(epsilon_association/kT);
 	double 	n = x;
 	double 	eta_d = 4.1887902047863905*R*R*R*n;
 	double 	c1 = lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + 2.25855;
@@ -452,7 +445,7 @@ double derive(double kT, double x) const {
 	double 	n0 = 7.957747154594767e-2*deltak*n/(R*R);
 	double 	n2 = deltak*n;
 	double 	n1 = 7.957747154594767e-2*deltak*n/R;
-	double 	dAdR = kT*n*(deltaprime*((n2*(n2*((log(1.0 + -1.0*n3)*(-2.6525823848649224e-2*1.0/n3 + 5.305164769729845e-2) + -2.6525823848649224e-2)/n3 + -2.6525823848649224e-2*log(1.0 + -1.0*n3))/(1.0 + -1.0*n3) + -7.957747154594767e-2*1.0/R) + -1.0*n1)/(1.0 + -1.0*n3) + 7.957747154594767e-2*log(1.0 + -1.0*n3)/(R*R)) + deltak*((n2*((n2*n2*(3.53677651315323e-2*log(1.0 + -1.0*n3)/(1.0 + -1.0*n3) + (3.53677651315323e-2*1.0/(1.0 + -1.0*n3) + log(1.0 + -1.0*n3)*(-8.841941282883076e-2*1.0/(1.0 + -1.0*n3) + 1.768388256576615e-2) + (-1.768388256576615e-2*1.0/(1.0 + -1.0*n3) + log(1.0 + -1.0*n3)*((-1.768388256576615e-2*1.0/n3 + 7.07355302630646e-2)/(1.0 + -1.0*n3) + -1.768388256576615e-2))/n3 + 8.841941282883075e-3)/n3) + n1)/(1.0 + -1.0*n3) + -7.957747154594767e-2*1.0/(R*R)) + n0)/(1.0 + -1.0*n3) + 0.15915494309189535*log(1.0 + -1.0*n3)/(R*R*R)));
+	double 	dAdR = kT*n*(deltaprime*((n2*(n2*((vm_log(1.0 + -1.0*n3)*(-2.6525823848649224e-2*1.0/n3 + 5.305164769729845e-2) + -2.6525823848649224e-2)/n3 + -2.6525823848649224e-2*vm_log(1.0 + -1.0*n3))/(1.0 + -1.0*n3) + -7.957747154594767e-2*1.0/R) + -1.0*n1)/(1.0 + -1.0*n3) + 7.957747154594767e-2*vm_log(1.0 + -1.0*n3)/(R*R)) + deltak*((n2*((n2*n2*(3.53677651315323e-2*vm_log(1.0 + -1.0*n3)/(1.0 + -1.0*n3) + (3.53677651315323e-2*1.0/(1.0 + -1.0*n3) + vm_log(1.0 + -1.0*n3)*(-8.841941282883076e-2*1.0/(1.0 + -1.0*n3) + 1.768388256576615e-2) + (-1.768388256576615e-2*1.0/(1.0 + -1.0*n3) + vm_log(1.0 + -1.0*n3)*((-1.768388256576615e-2*1.0/n3 + 7.07355302630646e-2)/(1.0 + -1.0*n3) + -1.768388256576615e-2))/n3 + 8.841941282883075e-3)/n3) + n1)/(1.0 + -1.0*n3) + -7.957747154594767e-2*1.0/(R*R)) + n0)/(1.0 + -1.0*n3) + 0.15915494309189535*vm_log(1.0 + -1.0*n3)/(R*R*R)));
 	double 	dc1_by_dlambda_dispersion = -1.50349*1.0 + 0.498868*lambda_dispersion;
 	double 	dc2_by_dlambda_dispersion = 1.40049*1.0 + -1.655478*lambda_dispersion;
 	double 	dc3_by_dlambda_dispersion = -15.0427*1.0 + 10.61654*lambda_dispersion;
@@ -469,7 +462,7 @@ double derive(double kT, double x) const {
 	double 	dn1_by_dx = 7.957747154594767e-2*deltak/R;
 	double 	dn2_by_dx = deltak;
 	double 	dn3_by_dx = step;
-	double 	ddAdR_by_dx = kT*(deltaprime*((n2*(n2*((log(1.0 + -1.0*n3)*(-2.6525823848649224e-2*1.0/n3 + 5.305164769729845e-2) + -2.6525823848649224e-2)/n3 + -2.6525823848649224e-2*log(1.0 + -1.0*n3))/(1.0 + -1.0*n3) + -7.957747154594767e-2*1.0/R) + -1.0*n1)/(1.0 + -1.0*n3) + 7.957747154594767e-2*log(1.0 + -1.0*n3)/(R*R)) + deltak*((n2*((n2*n2*(3.53677651315323e-2*log(1.0 + -1.0*n3)/(1.0 + -1.0*n3) + (3.53677651315323e-2*1.0/(1.0 + -1.0*n3) + log(1.0 + -1.0*n3)*(-8.841941282883076e-2*1.0/(1.0 + -1.0*n3) + 1.768388256576615e-2) + (-1.768388256576615e-2*1.0/(1.0 + -1.0*n3) + log(1.0 + -1.0*n3)*((-1.768388256576615e-2*1.0/n3 + 7.07355302630646e-2)/(1.0 + -1.0*n3) + -1.768388256576615e-2))/n3 + 8.841941282883075e-3)/n3) + n1)/(1.0 + -1.0*n3) + -7.957747154594767e-2*1.0/(R*R)) + n0)/(1.0 + -1.0*n3) + 0.15915494309189535*log(1.0 + -1.0*n3)/(R*R*R))) + deltaprime*dn3_by_dx*kT*n*(n2*(n2*((log(1.0 + -1.0*n3)*(-2.6525823848649224e-2*1.0/n3 + 5.305164769729845e-2) + -2.6525823848649224e-2)/n3 + -2.6525823848649224e-2*log(1.0 + -1.0*n3))/(1.0 + -1.0*n3) + -7.957747154594767e-2*1.0/R) + -1.0*n1)/((1.0 + -1.0*n3)*(1.0 + -1.0*n3)) + deltaprime*dn3_by_dx*kT*n*n2*n2*((log(1.0 + -1.0*n3)*(-2.6525823848649224e-2*1.0/n3 + 5.305164769729845e-2) + -2.6525823848649224e-2)/n3 + -2.6525823848649224e-2*log(1.0 + -1.0*n3))/((1.0 + -1.0*n3)*(1.0 + -1.0*n3)*(1.0 + -1.0*n3)) + 2.6525823848649224e-2*deltaprime*dn3_by_dx*kT*n*n2*n2/((1.0 + -1.0*n3)*(1.0 + -1.0*n3)*(1.0 + -1.0*n3)) + -1.0*deltaprime*dn3_by_dx*kT*n*n2*n2*(-2.6525823848649224e-2*1.0/n3 + 5.305164769729845e-2)/(n3*(1.0 + -1.0*n3)*(1.0 + -1.0*n3)*(1.0 + -1.0*n3)) + -1.0*deltaprime*dn3_by_dx*kT*n*n2*n2*(log(1.0 + -1.0*n3)*(-2.6525823848649224e-2*1.0/n3 + 5.305164769729845e-2) + -2.6525823848649224e-2)/(n3*n3*(1.0 + -1.0*n3)*(1.0 + -1.0*n3)) + 2.6525823848649224e-2*deltaprime*dn3_by_dx*kT*n*n2*n2*log(1.0 + -1.0*n3)/(n3*n3*n3*(1.0 + -1.0*n3)*(1.0 + -1.0*n3)) + deltaprime*dn2_by_dx*kT*n*(n2*((log(1.0 + -1.0*n3)*(-2.6525823848649224e-2*1.0/n3 + 5.305164769729845e-2) + -2.6525823848649224e-2)/n3 + -2.6525823848649224e-2*log(1.0 + -1.0*n3))/(1.0 + -1.0*n3) + -7.957747154594767e-2*1.0/R)/(1.0 + -1.0*n3) + deltaprime*dn2_by_dx*kT*n*n2*((log(1.0 + -1.0*n3)*(-2.6525823848649224e-2*1.0/n3 + 5.305164769729845e-2) + -2.6525823848649224e-2)/n3 + -2.6525823848649224e-2*log(1.0 + -1.0*n3))/((1.0 + -1.0*n3)*(1.0 + -1.0*n3)) + -1.0*deltaprime*dn1_by_dx*kT*n/(1.0 + -1.0*n3) + deltak*dn3_by_dx*kT*n*(n2*((n2*n2*(3.53677651315323e-2*log(1.0 + -1.0*n3)/(1.0 + -1.0*n3) + (3.53677651315323e-2*1.0/(1.0 + -1.0*n3) + log(1.0 + -1.0*n3)*(-8.841941282883076e-2*1.0/(1.0 + -1.0*n3) + 1.768388256576615e-2) + (-1.768388256576615e-2*1.0/(1.0 + -1.0*n3) + log(1.0 + -1.0*n3)*((-1.768388256576615e-2*1.0/n3 + 7.07355302630646e-2)/(1.0 + -1.0*n3) + -1.768388256576615e-2))/n3 + 8.841941282883075e-3)/n3) + n1)/(1.0 + -1.0*n3) + -7.957747154594767e-2*1.0/(R*R)) + n0)/((1.0 + -1.0*n3)*(1.0 + -1.0*n3)) + -3.53677651315323e-2*deltak*dn3_by_dx*kT*n*n2*n2*n2/(((1.0 + -1.0*n3)*(1.0 + -1.0*n3))*((1.0 + -1.0*n3)*(1.0 + -1.0*n3))) + 3.53677651315323e-2*deltak*dn3_by_dx*kT*n*n2*n2*n2*log(1.0 + -1.0*n3)/(((1.0 + -1.0*n3)*(1.0 + -1.0*n3))*((1.0 + -1.0*n3)*(1.0 + -1.0*n3))) + -1.0*deltak*dn3_by_dx*kT*n*n2*n2*n2*(-8.841941282883076e-2*1.0/(1.0 + -1.0*n3) + 1.768388256576615e-2)/(n3*(1.0 + -1.0*n3)*(1.0 + -1.0*n3)*(1.0 + -1.0*n3)) + 3.53677651315323e-2*deltak*dn3_by_dx*kT*n*n2*n2*n2/(n3*((1.0 + -1.0*n3)*(1.0 + -1.0*n3))*((1.0 + -1.0*n3)*(1.0 + -1.0*n3))) + -8.841941282883076e-2*deltak*dn3_by_dx*kT*n*n2*n2*n2*log(1.0 + -1.0*n3)/(n3*((1.0 + -1.0*n3)*(1.0 + -1.0*n3))*((1.0 + -1.0*n3)*(1.0 + -1.0*n3))) + -1.0*deltak*dn3_by_dx*kT*n*n2*n2*n2*(3.53677651315323e-2*1.0/(1.0 + -1.0*n3) + log(1.0 + -1.0*n3)*(-8.841941282883076e-2*1.0/(1.0 + -1.0*n3) + 1.768388256576615e-2) + (-1.768388256576615e-2*1.0/(1.0 + -1.0*n3) + log(1.0 + -1.0*n3)*((-1.768388256576615e-2*1.0/n3 + 7.07355302630646e-2)/(1.0 + -1.0*n3) + -1.768388256576615e-2))/n3 + 8.841941282883075e-3)/(n3*n3*(1.0 + -1.0*n3)*(1.0 + -1.0*n3)) + -1.0*deltak*dn3_by_dx*kT*n*n2*n2*n2*((-1.768388256576615e-2*1.0/n3 + 7.07355302630646e-2)/(1.0 + -1.0*n3) + -1.768388256576615e-2)/(n3*n3*(1.0 + -1.0*n3)*(1.0 + -1.0*n3)*(1.0 + -1.0*n3)) + -1.768388256576615e-2*deltak*dn3_by_dx*kT*n*n2*n2*n2/(n3*n3*((1.0 + -1.0*n3)*(1.0 + -1.0*n3))*((1.0 + -1.0*n3)*(1.0 + -1.0*n3))) + deltak*dn3_by_dx*kT*n*n2*n2*n2*log(1.0 + -1.0*n3)*(-1.768388256576615e-2*1.0/n3 + 7.07355302630646e-2)/(n3*n3*((1.0 + -1.0*n3)*(1.0 + -1.0*n3))*((1.0 + -1.0*n3)*(1.0 + -1.0*n3))) + -1.0*deltak*dn3_by_dx*kT*n*n2*n2*n2*(-1.768388256576615e-2*1.0/(1.0 + -1.0*n3) + log(1.0 + -1.0*n3)*((-1.768388256576615e-2*1.0/n3 + 7.07355302630646e-2)/(1.0 + -1.0*n3) + -1.768388256576615e-2))/(n3*n3*n3*(1.0 + -1.0*n3)*(1.0 + -1.0*n3)) + 1.768388256576615e-2*deltak*dn3_by_dx*kT*n*n2*n2*n2*log(1.0 + -1.0*n3)/((n3*n3)*(n3*n3)*(1.0 + -1.0*n3)*(1.0 + -1.0*n3)*(1.0 + -1.0*n3)) + deltak*dn3_by_dx*kT*n*n2*(n2*n2*(3.53677651315323e-2*log(1.0 + -1.0*n3)/(1.0 + -1.0*n3) + (3.53677651315323e-2*1.0/(1.0 + -1.0*n3) + log(1.0 + -1.0*n3)*(-8.841941282883076e-2*1.0/(1.0 + -1.0*n3) + 1.768388256576615e-2) + (-1.768388256576615e-2*1.0/(1.0 + -1.0*n3) + log(1.0 + -1.0*n3)*((-1.768388256576615e-2*1.0/n3 + 7.07355302630646e-2)/(1.0 + -1.0*n3) + -1.768388256576615e-2))/n3 + 8.841941282883075e-3)/n3) + n1)/((1.0 + -1.0*n3)*(1.0 + -1.0*n3)*(1.0 + -1.0*n3)) + deltak*dn2_by_dx*kT*n*((n2*n2*(3.53677651315323e-2*log(1.0 + -1.0*n3)/(1.0 + -1.0*n3) + (3.53677651315323e-2*1.0/(1.0 + -1.0*n3) + log(1.0 + -1.0*n3)*(-8.841941282883076e-2*1.0/(1.0 + -1.0*n3) + 1.768388256576615e-2) + (-1.768388256576615e-2*1.0/(1.0 + -1.0*n3) + log(1.0 + -1.0*n3)*((-1.768388256576615e-2*1.0/n3 + 7.07355302630646e-2)/(1.0 + -1.0*n3) + -1.768388256576615e-2))/n3 + 8.841941282883075e-3)/n3) + n1)/(1.0 + -1.0*n3) + -7.957747154594767e-2*1.0/(R*R))/(1.0 + -1.0*n3) + 2.0*deltak*dn2_by_dx*kT*n*n2*n2*(3.53677651315323e-2*log(1.0 + -1.0*n3)/(1.0 + -1.0*n3) + (3.53677651315323e-2*1.0/(1.0 + -1.0*n3) + log(1.0 + -1.0*n3)*(-8.841941282883076e-2*1.0/(1.0 + -1.0*n3) + 1.768388256576615e-2) + (-1.768388256576615e-2*1.0/(1.0 + -1.0*n3) + log(1.0 + -1.0*n3)*((-1.768388256576615e-2*1.0/n3 + 7.07355302630646e-2)/(1.0 + -1.0*n3) + -1.768388256576615e-2))/n3 + 8.841941282883075e-3)/n3)/((1.0 + -1.0*n3)*(1.0 + -1.0*n3)) + deltak*dn1_by_dx*kT*n*n2/((1.0 + -1.0*n3)*(1.0 + -1.0*n3)) + deltak*dn0_by_dx*kT*n/(1.0 + -1.0*n3) + -7.957747154594767e-2*deltaprime*dn3_by_dx*kT*n/(R*R*(1.0 + -1.0*n3)) + -0.15915494309189535*deltak*dn3_by_dx*kT*n/(R*R*R*(1.0 + -1.0*n3));
+	double 	ddAdR_by_dx = kT*(deltaprime*((n2*(n2*((vm_log(1.0 + -1.0*n3)*(-2.6525823848649224e-2*1.0/n3 + 5.305164769729845e-2) + -2.6525823848649224e-2)/n3 + -2.6525823848649224e-2*vm_log(1.0 + -1.0*n3))/(1.0 + -1.0*n3) + -7.957747154594767e-2*1.0/R) + -1.0*n1)/(1.0 + -1.0*n3) + 7.957747154594767e-2*vm_log(1.0 + -1.0*n3)/(R*R)) + deltak*((n2*((n2*n2*(3.53677651315323e-2*vm_log(1.0 + -1.0*n3)/(1.0 + -1.0*n3) + (3.53677651315323e-2*1.0/(1.0 + -1.0*n3) + vm_log(1.0 + -1.0*n3)*(-8.841941282883076e-2*1.0/(1.0 + -1.0*n3) + 1.768388256576615e-2) + (-1.768388256576615e-2*1.0/(1.0 + -1.0*n3) + vm_log(1.0 + -1.0*n3)*((-1.768388256576615e-2*1.0/n3 + 7.07355302630646e-2)/(1.0 + -1.0*n3) + -1.768388256576615e-2))/n3 + 8.841941282883075e-3)/n3) + n1)/(1.0 + -1.0*n3) + -7.957747154594767e-2*1.0/(R*R)) + n0)/(1.0 + -1.0*n3) + 0.15915494309189535*vm_log(1.0 + -1.0*n3)/(R*R*R))) + deltaprime*dn3_by_dx*kT*n*(n2*(n2*((vm_log(1.0 + -1.0*n3)*(-2.6525823848649224e-2*1.0/n3 + 5.305164769729845e-2) + -2.6525823848649224e-2)/n3 + -2.6525823848649224e-2*vm_log(1.0 + -1.0*n3))/(1.0 + -1.0*n3) + -7.957747154594767e-2*1.0/R) + -1.0*n1)/((1.0 + -1.0*n3)*(1.0 + -1.0*n3)) + deltaprime*dn3_by_dx*kT*n*n2*n2*((vm_log(1.0 + -1.0*n3)*(-2.6525823848649224e-2*1.0/n3 + 5.305164769729845e-2) + -2.6525823848649224e-2)/n3 + -2.6525823848649224e-2*vm_log(1.0 + -1.0*n3))/((1.0 + -1.0*n3)*(1.0 + -1.0*n3)*(1.0 + -1.0*n3)) + 2.6525823848649224e-2*deltaprime*dn3_by_dx*kT*n*n2*n2/((1.0 + -1.0*n3)*(1.0 + -1.0*n3)*(1.0 + -1.0*n3)) + -1.0*deltaprime*dn3_by_dx*kT*n*n2*n2*(-2.6525823848649224e-2*1.0/n3 + 5.305164769729845e-2)/(n3*(1.0 + -1.0*n3)*(1.0 + -1.0*n3)*(1.0 + -1.0*n3)) + -1.0*deltaprime*dn3_by_dx*kT*n*n2*n2*(vm_log(1.0 + -1.0*n3)*(-2.6525823848649224e-2*1.0/n3 + 5.305164769729845e-2) + -2.6525823848649224e-2)/(n3*n3*(1.0 + -1.0*n3)*(1.0 + -1.0*n3)) + 2.6525823848649224e-2*deltaprime*dn3_by_dx*kT*n*n2*n2*vm_log(1.0 + -1.0*n3)/(n3*n3*n3*(1.0 + -1.0*n3)*(1.0 + -1.0*n3)) + deltaprime*dn2_by_dx*kT*n*(n2*((vm_log(1.0 + -1.0*n3)*(-2.6525823848649224e-2*1.0/n3 + 5.305164769729845e-2) + -2.6525823848649224e-2)/n3 + -2.6525823848649224e-2*vm_log(1.0 + -1.0*n3))/(1.0 + -1.0*n3) + -7.957747154594767e-2*1.0/R)/(1.0 + -1.0*n3) + deltaprime*dn2_by_dx*kT*n*n2*((vm_log(1.0 + -1.0*n3)*(-2.6525823848649224e-2*1.0/n3 + 5.305164769729845e-2) + -2.6525823848649224e-2)/n3 + -2.6525823848649224e-2*vm_log(1.0 + -1.0*n3))/((1.0 + -1.0*n3)*(1.0 + -1.0*n3)) + -1.0*deltaprime*dn1_by_dx*kT*n/(1.0 + -1.0*n3) + deltak*dn3_by_dx*kT*n*(n2*((n2*n2*(3.53677651315323e-2*vm_log(1.0 + -1.0*n3)/(1.0 + -1.0*n3) + (3.53677651315323e-2*1.0/(1.0 + -1.0*n3) + vm_log(1.0 + -1.0*n3)*(-8.841941282883076e-2*1.0/(1.0 + -1.0*n3) + 1.768388256576615e-2) + (-1.768388256576615e-2*1.0/(1.0 + -1.0*n3) + vm_log(1.0 + -1.0*n3)*((-1.768388256576615e-2*1.0/n3 + 7.07355302630646e-2)/(1.0 + -1.0*n3) + -1.768388256576615e-2))/n3 + 8.841941282883075e-3)/n3) + n1)/(1.0 + -1.0*n3) + -7.957747154594767e-2*1.0/(R*R)) + n0)/((1.0 + -1.0*n3)*(1.0 + -1.0*n3)) + -3.53677651315323e-2*deltak*dn3_by_dx*kT*n*n2*n2*n2/(((1.0 + -1.0*n3)*(1.0 + -1.0*n3))*((1.0 + -1.0*n3)*(1.0 + -1.0*n3))) + 3.53677651315323e-2*deltak*dn3_by_dx*kT*n*n2*n2*n2*vm_log(1.0 + -1.0*n3)/(((1.0 + -1.0*n3)*(1.0 + -1.0*n3))*((1.0 + -1.0*n3)*(1.0 + -1.0*n3))) + -1.0*deltak*dn3_by_dx*kT*n*n2*n2*n2*(-8.841941282883076e-2*1.0/(1.0 + -1.0*n3) + 1.768388256576615e-2)/(n3*(1.0 + -1.0*n3)*(1.0 + -1.0*n3)*(1.0 + -1.0*n3)) + 3.53677651315323e-2*deltak*dn3_by_dx*kT*n*n2*n2*n2/(n3*((1.0 + -1.0*n3)*(1.0 + -1.0*n3))*((1.0 + -1.0*n3)*(1.0 + -1.0*n3))) + -8.841941282883076e-2*deltak*dn3_by_dx*kT*n*n2*n2*n2*vm_log(1.0 + -1.0*n3)/(n3*((1.0 + -1.0*n3)*(1.0 + -1.0*n3))*((1.0 + -1.0*n3)*(1.0 + -1.0*n3))) + -1.0*deltak*dn3_by_dx*kT*n*n2*n2*n2*(3.53677651315323e-2*1.0/(1.0 + -1.0*n3) + vm_log(1.0 + -1.0*n3)*(-8.841941282883076e-2*1.0/(1.0 + -1.0*n3) + 1.768388256576615e-2) + (-1.768388256576615e-2*1.0/(1.0 + -1.0*n3) + vm_log(1.0 + -1.0*n3)*((-1.768388256576615e-2*1.0/n3 + 7.07355302630646e-2)/(1.0 + -1.0*n3) + -1.768388256576615e-2))/n3 + 8.841941282883075e-3)/(n3*n3*(1.0 + -1.0*n3)*(1.0 + -1.0*n3)) + -1.0*deltak*dn3_by_dx*kT*n*n2*n2*n2*((-1.768388256576615e-2*1.0/n3 + 7.07355302630646e-2)/(1.0 + -1.0*n3) + -1.768388256576615e-2)/(n3*n3*(1.0 + -1.0*n3)*(1.0 + -1.0*n3)*(1.0 + -1.0*n3)) + -1.768388256576615e-2*deltak*dn3_by_dx*kT*n*n2*n2*n2/(n3*n3*((1.0 + -1.0*n3)*(1.0 + -1.0*n3))*((1.0 + -1.0*n3)*(1.0 + -1.0*n3))) + deltak*dn3_by_dx*kT*n*n2*n2*n2*vm_log(1.0 + -1.0*n3)*(-1.768388256576615e-2*1.0/n3 + 7.07355302630646e-2)/(n3*n3*((1.0 + -1.0*n3)*(1.0 + -1.0*n3))*((1.0 + -1.0*n3)*(1.0 + -1.0*n3))) + -1.0*deltak*dn3_by_dx*kT*n*n2*n2*n2*(-1.768388256576615e-2*1.0/(1.0 + -1.0*n3) + vm_log(1.0 + -1.0*n3)*((-1.768388256576615e-2*1.0/n3 + 7.07355302630646e-2)/(1.0 + -1.0*n3) + -1.768388256576615e-2))/(n3*n3*n3*(1.0 + -1.0*n3)*(1.0 + -1.0*n3)) + 1.768388256576615e-2*deltak*dn3_by_dx*kT*n*n2*n2*n2*vm_log(1.0 + -1.0*n3)/((n3*n3)*(n3*n3)*(1.0 + -1.0*n3)*(1.0 + -1.0*n3)*(1.0 + -1.0*n3)) + deltak*dn3_by_dx*kT*n*n2*(n2*n2*(3.53677651315323e-2*vm_log(1.0 + -1.0*n3)/(1.0 + -1.0*n3) + (3.53677651315323e-2*1.0/(1.0 + -1.0*n3) + vm_log(1.0 + -1.0*n3)*(-8.841941282883076e-2*1.0/(1.0 + -1.0*n3) + 1.768388256576615e-2) + (-1.768388256576615e-2*1.0/(1.0 + -1.0*n3) + vm_log(1.0 + -1.0*n3)*((-1.768388256576615e-2*1.0/n3 + 7.07355302630646e-2)/(1.0 + -1.0*n3) + -1.768388256576615e-2))/n3 + 8.841941282883075e-3)/n3) + n1)/((1.0 + -1.0*n3)*(1.0 + -1.0*n3)*(1.0 + -1.0*n3)) + deltak*dn2_by_dx*kT*n*((n2*n2*(3.53677651315323e-2*vm_log(1.0 + -1.0*n3)/(1.0 + -1.0*n3) + (3.53677651315323e-2*1.0/(1.0 + -1.0*n3) + vm_log(1.0 + -1.0*n3)*(-8.841941282883076e-2*1.0/(1.0 + -1.0*n3) + 1.768388256576615e-2) + (-1.768388256576615e-2*1.0/(1.0 + -1.0*n3) + vm_log(1.0 + -1.0*n3)*((-1.768388256576615e-2*1.0/n3 + 7.07355302630646e-2)/(1.0 + -1.0*n3) + -1.768388256576615e-2))/n3 + 8.841941282883075e-3)/n3) + n1)/(1.0 + -1.0*n3) + -7.957747154594767e-2*1.0/(R*R))/(1.0 + -1.0*n3) + 2.0*deltak*dn2_by_dx*kT*n*n2*n2*(3.53677651315323e-2*vm_log(1.0 + -1.0*n3)/(1.0 + -1.0*n3) + (3.53677651315323e-2*1.0/(1.0 + -1.0*n3) + vm_log(1.0 + -1.0*n3)*(-8.841941282883076e-2*1.0/(1.0 + -1.0*n3) + 1.768388256576615e-2) + (-1.768388256576615e-2*1.0/(1.0 + -1.0*n3) + vm_log(1.0 + -1.0*n3)*((-1.768388256576615e-2*1.0/n3 + 7.07355302630646e-2)/(1.0 + -1.0*n3) + -1.768388256576615e-2))/n3 + 8.841941282883075e-3)/n3)/((1.0 + -1.0*n3)*(1.0 + -1.0*n3)) + deltak*dn1_by_dx*kT*n*n2/((1.0 + -1.0*n3)*(1.0 + -1.0*n3)) + deltak*dn0_by_dx*kT*n/(1.0 + -1.0*n3) + -7.957747154594767e-2*deltaprime*dn3_by_dx*kT*n/(R*R*(1.0 + -1.0*n3)) + -0.15915494309189535*deltak*dn3_by_dx*kT*n/(R*R*R*(1.0 + -1.0*n3));
 	double 	deta_d_by_dx = 4.1887902047863905*R*R*R;
 	double 	ddeta_eff_by_deta_d_by_dx = deta_d_by_dx*(3.0*c3*eta_d + 2.0*c2) + 3.0*c3*deta_d_by_dx*eta_d;
 	double 	deta_eff_by_dx = deta_d_by_dx*(eta_d*(c3*eta_d + c2) + c1) + deta_d_by_dx*eta_d*(c3*eta_d + c2) + c3*deta_d_by_dx*eta_d*eta_d;
@@ -483,7 +476,7 @@ double derive(double kT, double x) const {
 	double 	ddeltasaft_by_dx = boltz*dgSW_by_dx*kappa_association;
 	double 	dnA_by_dx = 1.9894367886486918e-2*delta2k/(R*R);
 	double 	dX_by_dx = dnA_by_dx/(nA*sqrt(8.0*deltasaft*nA + 1.0)) + -1.0*dnA_by_dx*(0.25*sqrt(8.0*deltasaft*nA + 1.0) + -0.25)/(deltasaft*nA*nA) + ddeltasaft_by_dx/(deltasaft*sqrt(8.0*deltasaft*nA + 1.0)) + -1.0*ddeltasaft_by_dx*(0.25*sqrt(8.0*deltasaft*nA + 1.0) + -0.25)/(deltasaft*deltasaft*nA);
-	double 	dFassoc_by_dx = kT*(2.0*1.0 + 4.0*log(X) + -2.0*X) + -2.0*dX_by_dx*kT*n + 4.0*dX_by_dx*kT*n/X;
+	double 	dFassoc_by_dx = kT*(2.0*1.0 + 4.0*vm_log(X) + -2.0*X) + -2.0*dX_by_dx*kT*n + 4.0*dX_by_dx*kT*n/X;
 	double 	a1 = epsilon_dispersion*eta_d*ghs*(-4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + 4.0);
 	double 	da1_by_dx = dghs_by_dx*epsilon_dispersion*eta_d*(-4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + 4.0) + deta_d_by_dx*epsilon_dispersion*ghs*(-4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + 4.0);
 	double 	da1integrated_by_dx = da1_by_dx*n + a1;
@@ -493,12 +486,12 @@ double derive(double kT, double x) const {
 	double 	da2_by_dx = 0.5*dKHS_by_dx*da1_by_deta_d*epsilon_dispersion*eta_d + 0.5*KHS*dda1_by_deta_d_by_dx*epsilon_dispersion*eta_d + 0.5*KHS*da1_by_deta_d*deta_d_by_dx*epsilon_dispersion;
 	double 	da2integrated_by_dx = da2_by_dx*n/kT + a2/kT;
 	double 	dFdisp_by_dx = da2integrated_by_dx + da1integrated_by_dx;
-	double 	dFideal_by_dx = kT*(-1.0*1.0 + log(2.646476976618268e-6*n/(sqrt(kT)*kT))) + kT;
-	double 	dphi1_by_dx = dn3_by_dx*n0/(1.0 + -1.0*n3) + -1.0*dn0_by_dx*log(1.0 + -1.0*n3);
+	double 	dFideal_by_dx = kT*(-1.0*1.0 + vm_log(2.646476976618268e-6*n/(sqrt(kT)*kT))) + kT;
+	double 	dphi1_by_dx = dn3_by_dx*n0/(1.0 + -1.0*n3) + -1.0*dn0_by_dx*vm_log(1.0 + -1.0*n3);
 	double 	dkTphi1_by_dx = dphi1_by_dx*kT;
 	double 	dphi2_by_dx = dn3_by_dx*n1*n2/((1.0 + -1.0*n3)*(1.0 + -1.0*n3)) + dn2_by_dx*n1/(1.0 + -1.0*n3) + dn1_by_dx*n2/(1.0 + -1.0*n3);
 	double 	dkTphi2_by_dx = dphi2_by_dx*kT;
-	double 	dphi3_by_dx = 2.0*dn3_by_dx*n2*n2*n2*((log(1.0 + -1.0*n3)*(8.841941282883075e-3*1.0/n3 + -1.768388256576615e-2) + 8.841941282883075e-3)/n3 + 8.841941282883075e-3*log(1.0 + -1.0*n3))/((1.0 + -1.0*n3)*(1.0 + -1.0*n3)*(1.0 + -1.0*n3)) + -8.841941282883075e-3*dn3_by_dx*n2*n2*n2/((1.0 + -1.0*n3)*(1.0 + -1.0*n3)*(1.0 + -1.0*n3)) + -1.0*dn3_by_dx*n2*n2*n2*(8.841941282883075e-3*1.0/n3 + -1.768388256576615e-2)/(n3*(1.0 + -1.0*n3)*(1.0 + -1.0*n3)*(1.0 + -1.0*n3)) + -1.0*dn3_by_dx*n2*n2*n2*(log(1.0 + -1.0*n3)*(8.841941282883075e-3*1.0/n3 + -1.768388256576615e-2) + 8.841941282883075e-3)/(n3*n3*(1.0 + -1.0*n3)*(1.0 + -1.0*n3)) + -8.841941282883075e-3*dn3_by_dx*n2*n2*n2*log(1.0 + -1.0*n3)/(n3*n3*n3*(1.0 + -1.0*n3)*(1.0 + -1.0*n3)) + 3.0*dn2_by_dx*n2*n2*((log(1.0 + -1.0*n3)*(8.841941282883075e-3*1.0/n3 + -1.768388256576615e-2) + 8.841941282883075e-3)/n3 + 8.841941282883075e-3*log(1.0 + -1.0*n3))/((1.0 + -1.0*n3)*(1.0 + -1.0*n3));
+	double 	dphi3_by_dx = 2.0*dn3_by_dx*n2*n2*n2*((vm_log(1.0 + -1.0*n3)*(8.841941282883075e-3*1.0/n3 + -1.768388256576615e-2) + 8.841941282883075e-3)/n3 + 8.841941282883075e-3*vm_log(1.0 + -1.0*n3))/((1.0 + -1.0*n3)*(1.0 + -1.0*n3)*(1.0 + -1.0*n3)) + -8.841941282883075e-3*dn3_by_dx*n2*n2*n2/((1.0 + -1.0*n3)*(1.0 + -1.0*n3)*(1.0 + -1.0*n3)) + -1.0*dn3_by_dx*n2*n2*n2*(8.841941282883075e-3*1.0/n3 + -1.768388256576615e-2)/(n3*(1.0 + -1.0*n3)*(1.0 + -1.0*n3)*(1.0 + -1.0*n3)) + -1.0*dn3_by_dx*n2*n2*n2*(vm_log(1.0 + -1.0*n3)*(8.841941282883075e-3*1.0/n3 + -1.768388256576615e-2) + 8.841941282883075e-3)/(n3*n3*(1.0 + -1.0*n3)*(1.0 + -1.0*n3)) + -8.841941282883075e-3*dn3_by_dx*n2*n2*n2*vm_log(1.0 + -1.0*n3)/(n3*n3*n3*(1.0 + -1.0*n3)*(1.0 + -1.0*n3)) + 3.0*dn2_by_dx*n2*n2*((vm_log(1.0 + -1.0*n3)*(8.841941282883075e-3*1.0/n3 + -1.768388256576615e-2) + 8.841941282883075e-3)/n3 + 8.841941282883075e-3*vm_log(1.0 + -1.0*n3))/((1.0 + -1.0*n3)*(1.0 + -1.0*n3));
 	double 	dkTphi3_by_dx = dphi3_by_dx*kT;
 	double 	dwhitebear_by_dx = dkTphi3_by_dx + dkTphi2_by_dx + dkTphi1_by_dx;
 	double 	dFSAFT_by_dx = mu + dwhitebear_by_dx + dFideal_by_dx + dFdisp_by_dx + dFassoc_by_dx;
@@ -539,7 +532,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 		const Reciprocal k_i = gd.Lat.toReciprocal(rvec);
 		const complex t1 = k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0];
 		const complex t2 = R*sqrt(t1);
-		ktemp1[i] = 12.566370614359172*ktemp0[i]*complex(0,1)*k_i[0]*exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1)*(-1.0*sin(t2)/(sqrt(t1)) + R*cos(t2))/t1;
+		ktemp1[i] = 12.566370614359172*ktemp0[i]*complex(0,1)*k_i[0]*vm_exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1)*(-1.0*sin(t2)/(sqrt(t1)) + R*cos(t2))/t1;
 	}
 
 	VectorXd rtemp2(gd.NxNyNz);
@@ -561,7 +554,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 		const RelativeReciprocal rvec((xa>gd.Nx/2) ? xa - gd.Nx : xa, (y>gd.Ny/2) ? y - gd.Ny : y, z);
 		const Reciprocal k_i = gd.Lat.toReciprocal(rvec);
 		const complex t1 = sqrt(k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0]);
-		ktemp3[i] = 25.132741228718345*R*ktemp0[i]*sin(2.0*R*t1)*exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1*t1)/t1;
+		ktemp3[i] = 25.132741228718345*R*ktemp0[i]*sin(2.0*R*t1)*vm_exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1*t1)/t1;
 	}
 
 	VectorXd rtemp4(gd.NxNyNz);
@@ -582,7 +575,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 		const int xa = (n-y)/gd.Ny;
 		const RelativeReciprocal rvec((xa>gd.Nx/2) ? xa - gd.Nx : xa, (y>gd.Ny/2) ? y - gd.Ny : y, z);
 		const Reciprocal k_i = gd.Lat.toReciprocal(rvec);
-		ktemp5[i] = ktemp0[i]*exp(-4.0*R*R*lambda_dispersion*lambda_dispersion*length_scaling*length_scaling*(0.5*k_i[2]*k_i[2] + 0.5*k_i[1]*k_i[1] + 0.5*k_i[0]*k_i[0]));
+		ktemp5[i] = ktemp0[i]*vm_exp(-4.0*R*R*lambda_dispersion*lambda_dispersion*length_scaling*length_scaling*(0.5*k_i[2]*k_i[2] + 0.5*k_i[1]*k_i[1] + 0.5*k_i[0]*k_i[0]));
 	}
 
 	VectorXd rtemp6(gd.NxNyNz);
@@ -605,7 +598,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 		const Reciprocal k_i = gd.Lat.toReciprocal(rvec);
 		const complex t1 = k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0];
 		const complex t2 = R*sqrt(t1);
-		ktemp7[i] = 12.566370614359172*ktemp0[i]*exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1)*(-1.0*t2*cos(t2) + sin(t2))/(sqrt(t1)*t1);
+		ktemp7[i] = 12.566370614359172*ktemp0[i]*vm_exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1)*(-1.0*t2*cos(t2) + sin(t2))/(sqrt(t1)*t1);
 	}
 
 	VectorXd rtemp8(gd.NxNyNz);
@@ -636,7 +629,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 		const RelativeReciprocal rvec((xa>gd.Nx/2) ? xa - gd.Nx : xa, (y>gd.Ny/2) ? y - gd.Ny : y, z);
 		const Reciprocal k_i = gd.Lat.toReciprocal(rvec);
 		const complex t1 = sqrt(k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0]);
-		ktemp11[i] = 12.566370614359172*R*ktemp0[i]*sin(R*t1)*exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1*t1)/t1;
+		ktemp11[i] = 12.566370614359172*R*ktemp0[i]*sin(R*t1)*vm_exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1*t1)/t1;
 	}
 
 	VectorXd rtemp12(gd.NxNyNz);
@@ -646,7 +639,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 	VectorXd rtemp13(gd.NxNyNz);
 	for (int i=0; i<gd.NxNyNz; i++) {
 		const double t1 = 1.0 + -1.0*rtemp8[i];
-		rtemp13[i] = rtemp2[i]*(-5.305164769729845e-2*rtemp12[i]*(t1*t1*log(t1) + rtemp8[i])/(t1*rtemp8[i]*rtemp8[i]) + -0.15915494309189535*1.0/R)/t1;
+		rtemp13[i] = rtemp2[i]*(-5.305164769729845e-2*rtemp12[i]*(t1*t1*vm_log(t1) + rtemp8[i])/(t1*rtemp8[i]*rtemp8[i]) + -0.15915494309189535*1.0/R)/t1;
 	}
 
 	VectorXcd ktemp14(gd.NxNyNzOver2);
@@ -664,7 +657,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 		const Reciprocal k_i = gd.Lat.toReciprocal(rvec);
 		const complex t1 = k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0];
 		const complex t2 = R*sqrt(t1);
-		ktemp15[i] = 12.566370614359172*ktemp0[i]*complex(0,1)*k_i[1]*exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1)*(-1.0*sin(t2)/(sqrt(t1)) + R*cos(t2))/t1;
+		ktemp15[i] = 12.566370614359172*ktemp0[i]*complex(0,1)*k_i[1]*vm_exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1)*(-1.0*sin(t2)/(sqrt(t1)) + R*cos(t2))/t1;
 	}
 
 	VectorXd rtemp16(gd.NxNyNz);
@@ -674,7 +667,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 	VectorXd rtemp17(gd.NxNyNz);
 	for (int i=0; i<gd.NxNyNz; i++) {
 		const double t1 = 1.0 + -1.0*rtemp8[i];
-		rtemp17[i] = rtemp16[i]*(-5.305164769729845e-2*rtemp12[i]*(t1*t1*log(t1) + rtemp8[i])/(t1*rtemp8[i]*rtemp8[i]) + -0.15915494309189535*1.0/R)/t1;
+		rtemp17[i] = rtemp16[i]*(-5.305164769729845e-2*rtemp12[i]*(t1*t1*vm_log(t1) + rtemp8[i])/(t1*rtemp8[i]*rtemp8[i]) + -0.15915494309189535*1.0/R)/t1;
 	}
 
 	VectorXcd ktemp18(gd.NxNyNzOver2);
@@ -692,7 +685,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 		const Reciprocal k_i = gd.Lat.toReciprocal(rvec);
 		const complex t1 = k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0];
 		const complex t2 = R*sqrt(t1);
-		ktemp19[i] = 12.566370614359172*ktemp0[i]*complex(0,1)*k_i[2]*exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1)*(-1.0*sin(t2)/(sqrt(t1)) + R*cos(t2))/t1;
+		ktemp19[i] = 12.566370614359172*ktemp0[i]*complex(0,1)*k_i[2]*vm_exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1)*(-1.0*sin(t2)/(sqrt(t1)) + R*cos(t2))/t1;
 	}
 
 	VectorXd rtemp20(gd.NxNyNz);
@@ -702,7 +695,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 	VectorXd rtemp21(gd.NxNyNz);
 	for (int i=0; i<gd.NxNyNz; i++) {
 		const double t1 = 1.0 + -1.0*rtemp8[i];
-		rtemp21[i] = rtemp20[i]*(-5.305164769729845e-2*rtemp12[i]*(t1*t1*log(t1) + rtemp8[i])/(t1*rtemp8[i]*rtemp8[i]) + -0.15915494309189535*1.0/R)/t1;
+		rtemp21[i] = rtemp20[i]*(-5.305164769729845e-2*rtemp12[i]*(t1*t1*vm_log(t1) + rtemp8[i])/(t1*rtemp8[i]*rtemp8[i]) + -0.15915494309189535*1.0/R)/t1;
 	}
 
 	VectorXcd ktemp22(gd.NxNyNzOver2);
@@ -711,7 +704,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 	rtemp21.resize(0); // Realspace
 	VectorXd rtemp23(gd.NxNyNz);
 	for (int i=0; i<gd.NxNyNz; i++) {
-		const double t1 = log(1.0 + -1.0*rtemp8[i]);
+		const double t1 = vm_log(1.0 + -1.0*rtemp8[i]);
 		const double t2 = 1.0 + -1.0*rtemp8[i];
 		const double t3 = rtemp12[i]*rtemp12[i];
 		const double t4 = rtemp16[i]*rtemp16[i];
@@ -744,7 +737,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 	rtemp27.resize(0); // Realspace
 	VectorXd rtemp29(gd.NxNyNz);
 	for (int i=0; i<gd.NxNyNz; i++) {
-		const double t1 = log(1.0 + -1.0*rtemp8[i]);
+		const double t1 = vm_log(1.0 + -1.0*rtemp8[i]);
 		const double t2 = 1.0/(1.0 + -1.0*rtemp8[i]);
 		rtemp29[i] = t2*(8.841941282883075e-3*t2*(t1/(t2*t2) + rtemp8[i])*(-3.0*rtemp2[i]*rtemp2[i] + -3.0*rtemp20[i]*rtemp20[i] + -3.0*rtemp16[i]*rtemp16[i] + 3.0*rtemp12[i]*rtemp12[i])/(rtemp8[i]*rtemp8[i]) + 7.957747154594767e-2*rtemp12[i]/R) + (7.957747154594767e-2*t2*rtemp12[i] + -7.957747154594767e-2*t1/R)/R;
 	}
@@ -767,7 +760,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 		const RelativeReciprocal rvec((xa>gd.Nx/2) ? xa - gd.Nx : xa, (y>gd.Ny/2) ? y - gd.Ny : y, z);
 		const Reciprocal k_i = gd.Lat.toReciprocal(rvec);
 		const complex t1 = sin(R*sqrt(k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0]));
-		const complex t2 = exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*(k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0]));
+		const complex t2 = vm_exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*(k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0]));
 		const complex t3 = 1.0/(sqrt(k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0]));
 		const complex t4 = R*cos(R/t3);
 		const complex t5 = t1*t3;
@@ -787,7 +780,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 	ktemp30.resize(0); // KSpace
 	VectorXd rtemp33(gd.NxNyNz);
 	for (int i=0; i<gd.NxNyNz; i++) {
-		const double t1 = -1.0*1.0 + exp(epsilon_association/kT);
+		const double t1 = -1.0*1.0 + vm_exp(epsilon_association/kT);
 		const double t2 = 1.0/(sqrt(0.15915494309189535*kappa_association*t1*rtemp4[i]*(rtemp32[i]/rtemp4[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp6[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -0.5*lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(4.1887902047863905*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -2.0943951023931953*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)))/kT)/(R*R) + 1.0) + -1.0);
 		const double t3 = 1.0/(sqrt(0.15915494309189535*kappa_association*t1*rtemp4[i]*(rtemp32[i]/rtemp4[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp6[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -0.5*lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(4.1887902047863905*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -2.0943951023931953*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)))/kT)/(R*R) + 1.0));
 		const double t4 = 1.0/(rtemp32[i]/rtemp4[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp6[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -0.5*lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(4.1887902047863905*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -2.0943951023931953*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)))/kT);
@@ -812,7 +805,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 		const RelativeReciprocal rvec((xa>gd.Nx/2) ? xa - gd.Nx : xa, (y>gd.Ny/2) ? y - gd.Ny : y, z);
 		const Reciprocal k_i = gd.Lat.toReciprocal(rvec);
 		const complex t1 = sqrt(k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0]);
-		ktemp34[i] = ktemp34[i]*sin(R*t1)*exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1*t1)/t1;
+		ktemp34[i] = ktemp34[i]*sin(R*t1)*vm_exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1*t1)/t1;
 	}
 
 	VectorXd rtemp36(gd.NxNyNz);
@@ -821,7 +814,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 	ktemp34.resize(0); // KSpace
 	VectorXd rtemp37(gd.NxNyNz);
 	for (int i=0; i<gd.NxNyNz; i++) {
-		const double t1 = -1.0*1.0 + exp(epsilon_association/kT);
+		const double t1 = -1.0*1.0 + vm_exp(epsilon_association/kT);
 		const double t2 = 1.0/(sqrt(0.15915494309189535*kappa_association*t1*rtemp4[i]*(rtemp32[i]/rtemp4[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp6[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -0.5*lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(4.1887902047863905*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -2.0943951023931953*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)))/kT)/(R*R) + 1.0) + -1.0);
 		const double t3 = 1.0/(sqrt(0.15915494309189535*kappa_association*t1*rtemp4[i]*(rtemp32[i]/rtemp4[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp6[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -0.5*lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(4.1887902047863905*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -2.0943951023931953*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)))/kT)/(R*R) + 1.0));
 		const double t4 = 1.0/(rtemp32[i]/rtemp4[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp6[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -0.5*lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(4.1887902047863905*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -2.0943951023931953*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)))/kT);
@@ -848,7 +841,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 		const complex t1 = k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0];
 		const complex t2 = sin(R*sqrt(t1));
 		const complex t3 = t2/(sqrt(t1));
-		ktemp38[i] = exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1)*(ktemp38[i]*(-1.0*R*cos(R*sqrt(t1)) + -1.0*t3) + 8.377580409572783*R*kT*t3*ktemp0[i]);
+		ktemp38[i] = vm_exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1)*(ktemp38[i]*(-1.0*R*cos(R*sqrt(t1)) + -1.0*t3) + 8.377580409572783*R*kT*t3*ktemp0[i]);
 	}
 
 	VectorXd rtemp40(gd.NxNyNz);
@@ -857,7 +850,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 	ktemp38.resize(0); // KSpace
 	VectorXd rtemp41(gd.NxNyNz);
 	for (int i=0; i<gd.NxNyNz; i++) {
-		const double t1 = -1.0*1.0 + exp(epsilon_association/kT);
+		const double t1 = -1.0*1.0 + vm_exp(epsilon_association/kT);
 		const double t2 = 1.0/(sqrt(0.15915494309189535*kappa_association*t1*rtemp4[i]*(rtemp32[i]/rtemp4[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp6[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -0.5*lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(4.1887902047863905*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -2.0943951023931953*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)))/kT)/(R*R) + 1.0) + -1.0);
 		const double t3 = 1.0/(sqrt(0.15915494309189535*kappa_association*t1*rtemp4[i]*(rtemp32[i]/rtemp4[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp6[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -0.5*lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(4.1887902047863905*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -2.0943951023931953*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)))/kT)/(R*R) + 1.0));
 		const double t4 = 1.0/(rtemp32[i]/rtemp4[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp6[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -0.5*lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(4.1887902047863905*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -2.0943951023931953*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)))/kT);
@@ -882,7 +875,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 		const RelativeReciprocal rvec((xa>gd.Nx/2) ? xa - gd.Nx : xa, (y>gd.Ny/2) ? y - gd.Ny : y, z);
 		const Reciprocal k_i = gd.Lat.toReciprocal(rvec);
 		const complex t1 = sqrt(k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0]);
-		ktemp42[i] = ktemp42[i]*sin(R*t1)*exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1*t1)/t1;
+		ktemp42[i] = ktemp42[i]*sin(R*t1)*vm_exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1*t1)/t1;
 	}
 
 	VectorXd rtemp44(gd.NxNyNz);
@@ -891,7 +884,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 	ktemp42.resize(0); // KSpace
 	VectorXd rtemp45(gd.NxNyNz);
 	for (int i=0; i<gd.NxNyNz; i++) {
-		const double t1 = -1.0*1.0 + exp(epsilon_association/kT);
+		const double t1 = -1.0*1.0 + vm_exp(epsilon_association/kT);
 		const double t2 = 1.0/(sqrt(0.15915494309189535*kappa_association*t1*rtemp4[i]*(rtemp32[i]/rtemp4[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp6[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -0.5*lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(4.1887902047863905*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -2.0943951023931953*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)))/kT)/(R*R) + 1.0) + -1.0);
 		const double t3 = 1.0/(sqrt(0.15915494309189535*kappa_association*t1*rtemp4[i]*(rtemp32[i]/rtemp4[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp6[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -0.5*lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(4.1887902047863905*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -2.0943951023931953*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)))/kT)/(R*R) + 1.0));
 		const double t4 = 1.0/(rtemp32[i]/rtemp4[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp6[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -0.5*lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(4.1887902047863905*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -2.0943951023931953*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)))/kT);
@@ -904,7 +897,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 	rtemp45.resize(0); // Realspace
 	VectorXd rtemp47(gd.NxNyNz);
 	for (int i=0; i<gd.NxNyNz; i++) {
-		const double t1 = -1.0*1.0 + exp(epsilon_association/kT);
+		const double t1 = -1.0*1.0 + vm_exp(epsilon_association/kT);
 		const double t2 = 1.0/(sqrt(0.15915494309189535*kappa_association*t1*rtemp4[i]*(rtemp32[i]/rtemp4[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp6[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -0.5*lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(4.1887902047863905*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -2.0943951023931953*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)))/kT)/(R*R) + 1.0) + -1.0);
 		const double t3 = 1.0/(sqrt(0.15915494309189535*kappa_association*t1*rtemp4[i]*(rtemp32[i]/rtemp4[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp6[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -0.5*lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(4.1887902047863905*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -2.0943951023931953*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)))/kT)/(R*R) + 1.0));
 		const double t4 = 1.0/(rtemp32[i]/rtemp4[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp6[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -0.5*lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(4.1887902047863905*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -2.0943951023931953*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)))/kT);
@@ -928,7 +921,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 		const complex t1 = k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0];
 		const complex t2 = R*sqrt(t1);
 		const complex t3 = sin(t2)/(sqrt(t1));
-		ktemp49[i] = complex(0,1)*k_i[0]*exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1)*(t3*ktemp46[i] + ktemp48[i]*(R*cos(t2) + -1.0*t3)/t1);
+		ktemp49[i] = complex(0,1)*k_i[0]*vm_exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1)*(t3*ktemp46[i] + ktemp48[i]*(R*cos(t2) + -1.0*t3)/t1);
 	}
 
 	VectorXd rtemp50(gd.NxNyNz);
@@ -937,7 +930,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 	ktemp49.resize(0); // KSpace
 	VectorXd rtemp51(gd.NxNyNz);
 	for (int i=0; i<gd.NxNyNz; i++) {
-		const double t1 = -1.0*1.0 + exp(epsilon_association/kT);
+		const double t1 = -1.0*1.0 + vm_exp(epsilon_association/kT);
 		const double t2 = 1.0/(sqrt(0.15915494309189535*kappa_association*t1*rtemp4[i]*(rtemp32[i]/rtemp4[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp6[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -0.5*lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(4.1887902047863905*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -2.0943951023931953*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)))/kT)/(R*R) + 1.0) + -1.0);
 		const double t3 = 1.0/(sqrt(0.15915494309189535*kappa_association*t1*rtemp4[i]*(rtemp32[i]/rtemp4[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp6[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -0.5*lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(4.1887902047863905*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -2.0943951023931953*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)))/kT)/(R*R) + 1.0));
 		const double t4 = 1.0/(rtemp32[i]/rtemp4[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp6[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -0.5*lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(4.1887902047863905*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -2.0943951023931953*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)))/kT);
@@ -958,7 +951,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 		const RelativeReciprocal rvec((xa>gd.Nx/2) ? xa - gd.Nx : xa, (y>gd.Ny/2) ? y - gd.Ny : y, z);
 		const Reciprocal k_i = gd.Lat.toReciprocal(rvec);
 		const complex t1 = sqrt(k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0]);
-		ktemp53[i] = ktemp52[i]*complex(0,1)*k_i[0]*sin(R*t1)*exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1*t1)/t1;
+		ktemp53[i] = ktemp52[i]*complex(0,1)*k_i[0]*sin(R*t1)*vm_exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1*t1)/t1;
 	}
 
 	VectorXd rtemp54(gd.NxNyNz);
@@ -967,8 +960,8 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 	ktemp53.resize(0); // KSpace
 	for (int i=0; i<gd.NxNyNz; i++) {
 		const double t1 = 1.0 + -1.0*rtemp8[i];
-		const double t2 = t1*t1*log(t1) + rtemp8[i];
-		rtemp54[i] = rtemp2[i]*((rtemp12[i]*rtemp36[i]*(-1.768388256576615e-2*t1*log(t1) + -8.841941282883075e-3*t2*(2.0*1.0 + -4.0*rtemp8[i])/(t1*rtemp8[i]) + 8.841941282883075e-3*rtemp8[i]) + t2*rtemp40[i])/(t1*t1*rtemp8[i]*rtemp8[i]) + rtemp44[i]/(t1*t1)) + (rtemp54[i]*(-5.305164769729845e-2*t2*rtemp12[i]/(t1*rtemp8[i]*rtemp8[i]) + -7.957747154594767e-2*1.0/R) + rtemp50[i])/t1;
+		const double t2 = t1*t1*vm_log(t1) + rtemp8[i];
+		rtemp54[i] = rtemp2[i]*((rtemp12[i]*rtemp36[i]*(-1.768388256576615e-2*t1*vm_log(t1) + -8.841941282883075e-3*t2*(2.0*1.0 + -4.0*rtemp8[i])/(t1*rtemp8[i]) + 8.841941282883075e-3*rtemp8[i]) + t2*rtemp40[i])/(t1*t1*rtemp8[i]*rtemp8[i]) + rtemp44[i]/(t1*t1)) + (rtemp54[i]*(-5.305164769729845e-2*t2*rtemp12[i]/(t1*rtemp8[i]*rtemp8[i]) + -7.957747154594767e-2*1.0/R) + rtemp50[i])/t1;
 	}
 
 	rtemp50.resize(0); // Realspace
@@ -988,7 +981,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 		const complex t1 = k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0];
 		const complex t2 = R*sqrt(t1);
 		const complex t3 = sin(t2)/(sqrt(t1));
-		ktemp57[i] = complex(0,1)*k_i[1]*exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1)*(t3*ktemp46[i] + ktemp48[i]*(R*cos(t2) + -1.0*t3)/t1);
+		ktemp57[i] = complex(0,1)*k_i[1]*vm_exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1)*(t3*ktemp46[i] + ktemp48[i]*(R*cos(t2) + -1.0*t3)/t1);
 	}
 
 	VectorXd rtemp58(gd.NxNyNz);
@@ -1005,7 +998,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 		const RelativeReciprocal rvec((xa>gd.Nx/2) ? xa - gd.Nx : xa, (y>gd.Ny/2) ? y - gd.Ny : y, z);
 		const Reciprocal k_i = gd.Lat.toReciprocal(rvec);
 		const complex t1 = sqrt(k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0]);
-		ktemp59[i] = ktemp52[i]*complex(0,1)*k_i[1]*sin(R*t1)*exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1*t1)/t1;
+		ktemp59[i] = ktemp52[i]*complex(0,1)*k_i[1]*sin(R*t1)*vm_exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1*t1)/t1;
 	}
 
 	VectorXd rtemp60(gd.NxNyNz);
@@ -1014,8 +1007,8 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 	ktemp59.resize(0); // KSpace
 	for (int i=0; i<gd.NxNyNz; i++) {
 		const double t1 = 1.0 + -1.0*rtemp8[i];
-		const double t2 = t1*t1*log(t1) + rtemp8[i];
-		rtemp60[i] = rtemp16[i]*((rtemp12[i]*rtemp36[i]*(-1.768388256576615e-2*t1*log(t1) + -8.841941282883075e-3*t2*(2.0*1.0 + -4.0*rtemp8[i])/(t1*rtemp8[i]) + 8.841941282883075e-3*rtemp8[i]) + t2*rtemp40[i])/(t1*t1*rtemp8[i]*rtemp8[i]) + rtemp44[i]/(t1*t1)) + (rtemp60[i]*(-5.305164769729845e-2*t2*rtemp12[i]/(t1*rtemp8[i]*rtemp8[i]) + -7.957747154594767e-2*1.0/R) + rtemp58[i])/t1;
+		const double t2 = t1*t1*vm_log(t1) + rtemp8[i];
+		rtemp60[i] = rtemp16[i]*((rtemp12[i]*rtemp36[i]*(-1.768388256576615e-2*t1*vm_log(t1) + -8.841941282883075e-3*t2*(2.0*1.0 + -4.0*rtemp8[i])/(t1*rtemp8[i]) + 8.841941282883075e-3*rtemp8[i]) + t2*rtemp40[i])/(t1*t1*rtemp8[i]*rtemp8[i]) + rtemp44[i]/(t1*t1)) + (rtemp60[i]*(-5.305164769729845e-2*t2*rtemp12[i]/(t1*rtemp8[i]*rtemp8[i]) + -7.957747154594767e-2*1.0/R) + rtemp58[i])/t1;
 	}
 
 	rtemp58.resize(0); // Realspace
@@ -1034,7 +1027,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 		const complex t1 = k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0];
 		const complex t2 = R*sqrt(t1);
 		const complex t3 = sin(t2)/(sqrt(t1));
-		ktemp48[i] = complex(0,1)*k_i[2]*exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1)*(t3*ktemp46[i] + ktemp48[i]*(R*cos(t2) + -1.0*t3)/t1);
+		ktemp48[i] = complex(0,1)*k_i[2]*vm_exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1)*(t3*ktemp46[i] + ktemp48[i]*(R*cos(t2) + -1.0*t3)/t1);
 	}
 
 	ktemp46.resize(0); // KSpace
@@ -1052,7 +1045,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 		const RelativeReciprocal rvec((xa>gd.Nx/2) ? xa - gd.Nx : xa, (y>gd.Ny/2) ? y - gd.Ny : y, z);
 		const Reciprocal k_i = gd.Lat.toReciprocal(rvec);
 		const complex t1 = sqrt(k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0]);
-		ktemp65[i] = ktemp52[i]*complex(0,1)*k_i[2]*sin(R*t1)*exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1*t1)/t1;
+		ktemp65[i] = ktemp52[i]*complex(0,1)*k_i[2]*sin(R*t1)*vm_exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1*t1)/t1;
 	}
 
 	VectorXd rtemp66(gd.NxNyNz);
@@ -1061,8 +1054,8 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 	ktemp65.resize(0); // KSpace
 	for (int i=0; i<gd.NxNyNz; i++) {
 		const double t1 = 1.0 + -1.0*rtemp8[i];
-		const double t2 = t1*t1*log(t1) + rtemp8[i];
-		rtemp66[i] = rtemp20[i]*((rtemp12[i]*rtemp36[i]*(-1.768388256576615e-2*t1*log(t1) + -8.841941282883075e-3*t2*(2.0*1.0 + -4.0*rtemp8[i])/(t1*rtemp8[i]) + 8.841941282883075e-3*rtemp8[i]) + t2*rtemp40[i])/(t1*t1*rtemp8[i]*rtemp8[i]) + rtemp44[i]/(t1*t1)) + (rtemp66[i]*(-5.305164769729845e-2*t2*rtemp12[i]/(t1*rtemp8[i]*rtemp8[i]) + -7.957747154594767e-2*1.0/R) + rtemp64[i])/t1;
+		const double t2 = t1*t1*vm_log(t1) + rtemp8[i];
+		rtemp66[i] = rtemp20[i]*((rtemp12[i]*rtemp36[i]*(-1.768388256576615e-2*t1*vm_log(t1) + -8.841941282883075e-3*t2*(2.0*1.0 + -4.0*rtemp8[i])/(t1*rtemp8[i]) + 8.841941282883075e-3*rtemp8[i]) + t2*rtemp40[i])/(t1*t1*rtemp8[i]*rtemp8[i]) + rtemp44[i]/(t1*t1)) + (rtemp66[i]*(-5.305164769729845e-2*t2*rtemp12[i]/(t1*rtemp8[i]*rtemp8[i]) + -7.957747154594767e-2*1.0/R) + rtemp64[i])/t1;
 	}
 
 	rtemp64.resize(0); // Realspace
@@ -1075,7 +1068,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 	rtemp66.resize(0); // Realspace
 	VectorXd rtemp69(gd.NxNyNz);
 	for (int i=0; i<gd.NxNyNz; i++) {
-		const double t1 = -1.0*1.0 + exp(epsilon_association/kT);
+		const double t1 = -1.0*1.0 + vm_exp(epsilon_association/kT);
 		const double t2 = 1.0/(sqrt(0.15915494309189535*kappa_association*t1*rtemp4[i]*(rtemp32[i]/rtemp4[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp6[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -0.5*lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(4.1887902047863905*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -2.0943951023931953*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)))/kT)/(R*R) + 1.0) + -1.0);
 		const double t3 = -4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0;
 		const double t4 = 1.0/(sqrt(0.15915494309189535*kappa_association*t1*rtemp4[i]*(rtemp32[i]/rtemp4[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp6[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/t3 + -0.5*lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/(t3*t3*t3) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(-2.0943951023931953*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + 3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(4.1887902047863905*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion))/t3 + -0.5*R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion)))/(t3*t3*t3))/kT)/(R*R) + 1.0));
@@ -1134,7 +1127,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 	rtemp69.resize(0); // Realspace
 	VectorXd rtemp71(gd.NxNyNz);
 	for (int i=0; i<gd.NxNyNz; i++) {
-		const double t1 = -1.0*1.0 + exp(epsilon_association/kT);
+		const double t1 = -1.0*1.0 + vm_exp(epsilon_association/kT);
 		const double t2 = 1.0/(sqrt(0.15915494309189535*kappa_association*t1*rtemp4[i]*(rtemp32[i]/rtemp4[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp6[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -0.5*lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(4.1887902047863905*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -2.0943951023931953*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)))/kT)/(R*R) + 1.0) + -1.0);
 		const double t3 = 1.0/(sqrt(0.15915494309189535*kappa_association*t1*rtemp4[i]*(rtemp32[i]/rtemp4[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp6[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -0.5*lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(4.1887902047863905*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -2.0943951023931953*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)))/kT)/(R*R) + 1.0));
 		const double t4 = rtemp32[i]/rtemp4[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp6[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -0.5*lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(4.1887902047863905*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -2.0943951023931953*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)))/kT;
@@ -1149,7 +1142,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 	rtemp71.resize(0); // Realspace
 	VectorXd rtemp73(gd.NxNyNz);
 	for (int i=0; i<gd.NxNyNz; i++) {
-		const double t1 = 1.0/(-1.0*1.0 + exp(epsilon_association/kT));
+		const double t1 = 1.0/(-1.0*1.0 + vm_exp(epsilon_association/kT));
 		const double t2 = sqrt(0.15915494309189535*kappa_association*rtemp4[i]*(rtemp32[i]/rtemp4[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp6[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -0.5*lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(4.1887902047863905*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -2.0943951023931953*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)))/kT)/(R*R*t1) + 1.0) + -1.0;
 		const double t3 = 1.0/(rtemp32[i]/rtemp4[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp6[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -0.5*lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(4.1887902047863905*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -2.0943951023931953*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)))/kT);
 		const double t4 = 1.0/(sqrt(0.15915494309189535*kappa_association*rtemp4[i]/(R*R*t1*t3) + 1.0));
@@ -1174,7 +1167,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 		const RelativeReciprocal rvec((xa>gd.Nx/2) ? xa - gd.Nx : xa, (y>gd.Ny/2) ? y - gd.Ny : y, z);
 		const Reciprocal k_i = gd.Lat.toReciprocal(rvec);
 		const complex t1 = sqrt(k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0]);
-		ktemp74[i] = ktemp74[i]*sin(R*t1)*exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1*t1)/t1;
+		ktemp74[i] = ktemp74[i]*sin(R*t1)*vm_exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1*t1)/t1;
 	}
 
 	VectorXd rtemp76(gd.NxNyNz);
@@ -1183,7 +1176,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 	ktemp74.resize(0); // KSpace
 	VectorXd rtemp77(gd.NxNyNz);
 	for (int i=0; i<gd.NxNyNz; i++) {
-		const double t1 = -1.0*1.0 + exp(epsilon_association/kT);
+		const double t1 = -1.0*1.0 + vm_exp(epsilon_association/kT);
 		const double t2 = 1.0/(sqrt(0.15915494309189535*kappa_association*t1*rtemp4[i]*(rtemp32[i]/rtemp4[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp6[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -0.5*lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(4.1887902047863905*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -2.0943951023931953*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)))/kT)/(R*R) + 1.0) + -1.0);
 		const double t3 = 1.0/(sqrt(0.15915494309189535*kappa_association*t1*rtemp4[i]*(rtemp32[i]/rtemp4[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp6[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -0.5*lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(4.1887902047863905*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -2.0943951023931953*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)))/kT)/(R*R) + 1.0));
 		const double t4 = 1.0/(rtemp32[i]/rtemp4[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp6[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -0.5*lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(4.1887902047863905*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -2.0943951023931953*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)))/kT);
@@ -1209,7 +1202,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 		const Reciprocal k_i = gd.Lat.toReciprocal(rvec);
 		const complex t1 = k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0];
 		const complex t2 = R*sqrt(t1);
-		ktemp78[i] = ktemp78[i]*exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1)*(-1.0*sin(t2)/(sqrt(t1)) + -1.0*R*cos(t2));
+		ktemp78[i] = ktemp78[i]*vm_exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1)*(-1.0*sin(t2)/(sqrt(t1)) + -1.0*R*cos(t2));
 	}
 
 	VectorXd rtemp80(gd.NxNyNz);
@@ -1218,7 +1211,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 	ktemp78.resize(0); // KSpace
 	VectorXd rtemp81(gd.NxNyNz);
 	for (int i=0; i<gd.NxNyNz; i++) {
-		const double t1 = -1.0*1.0 + exp(epsilon_association/kT);
+		const double t1 = -1.0*1.0 + vm_exp(epsilon_association/kT);
 		const double t2 = 1.0/(sqrt(0.15915494309189535*kappa_association*t1*rtemp4[i]*(rtemp32[i]/rtemp4[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp6[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -0.5*lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(4.1887902047863905*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -2.0943951023931953*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)))/kT)/(R*R) + 1.0) + -1.0);
 		const double t3 = 1.0/(sqrt(0.15915494309189535*kappa_association*t1*rtemp4[i]*(rtemp32[i]/rtemp4[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp6[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -0.5*lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(4.1887902047863905*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -2.0943951023931953*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)))/kT)/(R*R) + 1.0));
 		const double t4 = 1.0/(rtemp32[i]/rtemp4[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp6[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -0.5*lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(4.1887902047863905*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -2.0943951023931953*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)))/kT);
@@ -1243,7 +1236,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 		const RelativeReciprocal rvec((xa>gd.Nx/2) ? xa - gd.Nx : xa, (y>gd.Ny/2) ? y - gd.Ny : y, z);
 		const Reciprocal k_i = gd.Lat.toReciprocal(rvec);
 		const complex t1 = sqrt(k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0]);
-		ktemp82[i] = ktemp82[i]*sin(R*t1)*exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1*t1)/t1;
+		ktemp82[i] = ktemp82[i]*sin(R*t1)*vm_exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1*t1)/t1;
 	}
 
 	VectorXd rtemp84(gd.NxNyNz);
@@ -1252,7 +1245,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 	ktemp82.resize(0); // KSpace
 	VectorXd rtemp85(gd.NxNyNz);
 	for (int i=0; i<gd.NxNyNz; i++) {
-		const double t1 = 1.0/(-1.0*1.0 + exp(epsilon_association/kT));
+		const double t1 = 1.0/(-1.0*1.0 + vm_exp(epsilon_association/kT));
 		const double t2 = sqrt(0.15915494309189535*kappa_association*rtemp4[i]*(rtemp32[i]/rtemp4[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp6[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -0.5*lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(4.1887902047863905*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -2.0943951023931953*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)))/kT)/(R*R*t1) + 1.0) + -1.0;
 		const double t3 = 1.0/(rtemp32[i]/rtemp4[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp6[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -0.5*lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(4.1887902047863905*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -2.0943951023931953*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)))/kT);
 		const double t4 = 1.0/(sqrt(0.15915494309189535*kappa_association*rtemp4[i]/(R*R*t1*t3) + 1.0));
@@ -1277,7 +1270,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 		const RelativeReciprocal rvec((xa>gd.Nx/2) ? xa - gd.Nx : xa, (y>gd.Ny/2) ? y - gd.Ny : y, z);
 		const Reciprocal k_i = gd.Lat.toReciprocal(rvec);
 		const complex t1 = sqrt(k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0]);
-		ktemp86[i] = ktemp86[i]*sin(R*t1)*exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1*t1)/t1;
+		ktemp86[i] = ktemp86[i]*sin(R*t1)*vm_exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1*t1)/t1;
 	}
 
 	VectorXd rtemp88(gd.NxNyNz);
@@ -1286,7 +1279,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 	ktemp86.resize(0); // KSpace
 	VectorXd rtemp89(gd.NxNyNz);
 	for (int i=0; i<gd.NxNyNz; i++) {
-		const double t1 = 1.0/(-1.0*1.0 + exp(epsilon_association/kT));
+		const double t1 = 1.0/(-1.0*1.0 + vm_exp(epsilon_association/kT));
 		const double t2 = sqrt(0.15915494309189535*kappa_association*rtemp4[i]*(rtemp32[i]/rtemp4[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp6[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -0.5*lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(4.1887902047863905*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -2.0943951023931953*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)))/kT)/(R*R*t1) + 1.0) + -1.0;
 		const double t3 = 1.0/(rtemp32[i]/rtemp4[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp6[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -0.5*lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(4.1887902047863905*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -2.0943951023931953*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)))/kT);
 		const double t4 = 1.0/(sqrt(0.15915494309189535*kappa_association*rtemp4[i]/(R*R*t1*t3) + 1.0));
@@ -1307,7 +1300,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 		const RelativeReciprocal rvec((xa>gd.Nx/2) ? xa - gd.Nx : xa, (y>gd.Ny/2) ? y - gd.Ny : y, z);
 		const Reciprocal k_i = gd.Lat.toReciprocal(rvec);
 		const complex t1 = sqrt(k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0]);
-		ktemp91[i] = ktemp90[i]*complex(0,1)*k_i[1]*sin(R*t1)*exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1*t1)/t1;
+		ktemp91[i] = ktemp90[i]*complex(0,1)*k_i[1]*sin(R*t1)*vm_exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1*t1)/t1;
 	}
 
 	VectorXd rtemp92(gd.NxNyNz);
@@ -1324,7 +1317,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 		const RelativeReciprocal rvec((xa>gd.Nx/2) ? xa - gd.Nx : xa, (y>gd.Ny/2) ? y - gd.Ny : y, z);
 		const Reciprocal k_i = gd.Lat.toReciprocal(rvec);
 		const complex t1 = sqrt(k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0]);
-		ktemp93[i] = ktemp90[i]*complex(0,1)*k_i[2]*sin(R*t1)*exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1*t1)/t1;
+		ktemp93[i] = ktemp90[i]*complex(0,1)*k_i[2]*sin(R*t1)*vm_exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1*t1)/t1;
 	}
 
 	VectorXd rtemp94(gd.NxNyNz);
@@ -1340,7 +1333,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 		const RelativeReciprocal rvec((xa>gd.Nx/2) ? xa - gd.Nx : xa, (y>gd.Ny/2) ? y - gd.Ny : y, z);
 		const Reciprocal k_i = gd.Lat.toReciprocal(rvec);
 		const complex t1 = sqrt(k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0]);
-		ktemp90[i] = ktemp90[i]*complex(0,1)*k_i[0]*sin(R*t1)*exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1*t1)/t1;
+		ktemp90[i] = ktemp90[i]*complex(0,1)*k_i[0]*sin(R*t1)*vm_exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1*t1)/t1;
 	}
 
 	VectorXd rtemp96(gd.NxNyNz);
@@ -1349,7 +1342,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 	ktemp90.resize(0); // KSpace
 	VectorXd rtemp97(gd.NxNyNz);
 	for (int i=0; i<gd.NxNyNz; i++) {
-		const double t1 = -1.0*1.0 + exp(epsilon_association/kT);
+		const double t1 = -1.0*1.0 + vm_exp(epsilon_association/kT);
 		const double t2 = 1.0/(sqrt(0.15915494309189535*kappa_association*t1*rtemp4[i]*(rtemp32[i]/rtemp4[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp6[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -0.5*lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(4.1887902047863905*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -2.0943951023931953*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)))/kT)/(R*R) + 1.0) + -1.0);
 		const double t3 = 1.0/(sqrt(0.15915494309189535*kappa_association*t1*rtemp4[i]*(rtemp32[i]/rtemp4[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp6[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -0.5*lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(4.1887902047863905*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -2.0943951023931953*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)))/kT)/(R*R) + 1.0));
 		const double t4 = 1.0/(rtemp32[i]/rtemp4[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp6[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -0.5*lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(4.1887902047863905*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -2.0943951023931953*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)))/kT);
@@ -1376,7 +1369,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 		const complex t1 = k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0];
 		const complex t2 = sin(R*sqrt(t1));
 		const complex t3 = t2/(sqrt(t1));
-		ktemp98[i] = exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1)*(ktemp98[i]*(-1.0*R*cos(R*sqrt(t1)) + -1.0*t3) + 25.132741228718345*R*kT*t3*ktemp0[i]);
+		ktemp98[i] = vm_exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1)*(ktemp98[i]*(-1.0*R*cos(R*sqrt(t1)) + -1.0*t3) + 25.132741228718345*R*kT*t3*ktemp0[i]);
 	}
 
 	ktemp0.resize(0); // KSpace
@@ -1385,7 +1378,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 
 	ktemp98.resize(0); // KSpace
 	for (int i=0; i<gd.NxNyNz; i++) {
-		const double t1 = log(1.0 + -1.0*rtemp8[i]);
+		const double t1 = vm_log(1.0 + -1.0*rtemp8[i]);
 		const double t2 = 1.0 + -1.0*rtemp8[i];
 		const double t3 = t1*t2*t2 + rtemp8[i];
 		const double t4 = rtemp12[i]*rtemp12[i];
@@ -1421,7 +1414,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 		const RelativeReciprocal rvec((xa>gd.Nx/2) ? xa - gd.Nx : xa, (y>gd.Ny/2) ? y - gd.Ny : y, z);
 		const Reciprocal k_i = gd.Lat.toReciprocal(rvec);
 		const complex t1 = sqrt(k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0]);
-		ktemp52[i] = ktemp52[i]*sin(R*t1)*exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1*t1)/t1;
+		ktemp52[i] = ktemp52[i]*sin(R*t1)*vm_exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1*t1)/t1;
 	}
 
 	VectorXd rtemp104(gd.NxNyNz);
@@ -1430,7 +1423,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 	ktemp52.resize(0); // KSpace
 	VectorXd rtemp105(gd.NxNyNz);
 	for (int i=0; i<gd.NxNyNz; i++) {
-		const double t1 = -1.0*1.0 + exp(epsilon_association/kT);
+		const double t1 = -1.0*1.0 + vm_exp(epsilon_association/kT);
 		const double t2 = 1.0/(sqrt(0.15915494309189535*kappa_association*t1*rtemp4[i]*(rtemp32[i]/rtemp4[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp6[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -0.5*lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(4.1887902047863905*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -2.0943951023931953*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)))/kT)/(R*R) + 1.0) + -1.0);
 		const double t3 = 1.0/(sqrt(0.15915494309189535*kappa_association*t1*rtemp4[i]*(rtemp32[i]/rtemp4[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp6[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -0.5*lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(4.1887902047863905*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -2.0943951023931953*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)))/kT)/(R*R) + 1.0));
 		const double t4 = 1.0/(rtemp32[i]/rtemp4[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp6[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -0.5*lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(4.1887902047863905*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -2.0943951023931953*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)))/kT);
@@ -1451,7 +1444,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 		const RelativeReciprocal rvec((xa>gd.Nx/2) ? xa - gd.Nx : xa, (y>gd.Ny/2) ? y - gd.Ny : y, z);
 		const Reciprocal k_i = gd.Lat.toReciprocal(rvec);
 		const complex t1 = sqrt(k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0]);
-		ktemp107[i] = ktemp106[i]*complex(0,1)*k_i[1]*sin(R*t1)*exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1*t1)/t1;
+		ktemp107[i] = ktemp106[i]*complex(0,1)*k_i[1]*sin(R*t1)*vm_exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1*t1)/t1;
 	}
 
 	VectorXd rtemp108(gd.NxNyNz);
@@ -1460,7 +1453,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 	ktemp107.resize(0); // KSpace
 	VectorXd rtemp109(gd.NxNyNz);
 	for (int i=0; i<gd.NxNyNz; i++) {
-		const double t1 = -1.0*1.0 + exp(epsilon_association/kT);
+		const double t1 = -1.0*1.0 + vm_exp(epsilon_association/kT);
 		const double t2 = 1.0/(sqrt(0.15915494309189535*kappa_association*t1*rtemp4[i]*(rtemp32[i]/rtemp4[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp6[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -0.5*lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(4.1887902047863905*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -2.0943951023931953*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)))/kT)/(R*R) + 1.0) + -1.0);
 		const double t3 = 1.0/(sqrt(0.15915494309189535*kappa_association*t1*rtemp4[i]*(rtemp32[i]/rtemp4[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp6[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -0.5*lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(4.1887902047863905*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -2.0943951023931953*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)))/kT)/(R*R) + 1.0));
 		const double t4 = 1.0/(rtemp32[i]/rtemp4[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp6[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -0.5*lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(4.1887902047863905*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -2.0943951023931953*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)))/kT);
@@ -1481,7 +1474,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 		const RelativeReciprocal rvec((xa>gd.Nx/2) ? xa - gd.Nx : xa, (y>gd.Ny/2) ? y - gd.Ny : y, z);
 		const Reciprocal k_i = gd.Lat.toReciprocal(rvec);
 		const complex t1 = sqrt(k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0]);
-		ktemp111[i] = ktemp110[i]*complex(0,1)*k_i[1]*sin(R*t1)*exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1*t1)/t1;
+		ktemp111[i] = ktemp110[i]*complex(0,1)*k_i[1]*sin(R*t1)*vm_exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1*t1)/t1;
 	}
 
 	VectorXd rtemp112(gd.NxNyNz);
@@ -1498,7 +1491,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 		const RelativeReciprocal rvec((xa>gd.Nx/2) ? xa - gd.Nx : xa, (y>gd.Ny/2) ? y - gd.Ny : y, z);
 		const Reciprocal k_i = gd.Lat.toReciprocal(rvec);
 		const complex t1 = sqrt(k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0]);
-		ktemp113[i] = ktemp106[i]*complex(0,1)*k_i[2]*sin(R*t1)*exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1*t1)/t1;
+		ktemp113[i] = ktemp106[i]*complex(0,1)*k_i[2]*sin(R*t1)*vm_exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1*t1)/t1;
 	}
 
 	VectorXd rtemp114(gd.NxNyNz);
@@ -1515,7 +1508,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 		const RelativeReciprocal rvec((xa>gd.Nx/2) ? xa - gd.Nx : xa, (y>gd.Ny/2) ? y - gd.Ny : y, z);
 		const Reciprocal k_i = gd.Lat.toReciprocal(rvec);
 		const complex t1 = sqrt(k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0]);
-		ktemp115[i] = ktemp110[i]*complex(0,1)*k_i[2]*sin(R*t1)*exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1*t1)/t1;
+		ktemp115[i] = ktemp110[i]*complex(0,1)*k_i[2]*sin(R*t1)*vm_exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1*t1)/t1;
 	}
 
 	VectorXd rtemp116(gd.NxNyNz);
@@ -1531,7 +1524,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 		const RelativeReciprocal rvec((xa>gd.Nx/2) ? xa - gd.Nx : xa, (y>gd.Ny/2) ? y - gd.Ny : y, z);
 		const Reciprocal k_i = gd.Lat.toReciprocal(rvec);
 		const complex t1 = sqrt(k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0]);
-		ktemp106[i] = ktemp106[i]*complex(0,1)*k_i[0]*sin(R*t1)*exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1*t1)/t1;
+		ktemp106[i] = ktemp106[i]*complex(0,1)*k_i[0]*sin(R*t1)*vm_exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1*t1)/t1;
 	}
 
 	VectorXd rtemp118(gd.NxNyNz);
@@ -1547,7 +1540,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 		const RelativeReciprocal rvec((xa>gd.Nx/2) ? xa - gd.Nx : xa, (y>gd.Ny/2) ? y - gd.Ny : y, z);
 		const Reciprocal k_i = gd.Lat.toReciprocal(rvec);
 		const complex t1 = sqrt(k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0]);
-		ktemp110[i] = ktemp110[i]*complex(0,1)*k_i[0]*sin(R*t1)*exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1*t1)/t1;
+		ktemp110[i] = ktemp110[i]*complex(0,1)*k_i[0]*sin(R*t1)*vm_exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1*t1)/t1;
 	}
 
 	VectorXd rtemp120(gd.NxNyNz);
@@ -1556,7 +1549,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 	ktemp110.resize(0); // KSpace
 	VectorXd rtemp121(gd.NxNyNz);
 	for (int i=0; i<gd.NxNyNz; i++) {
-		const double t1 = -1.0*1.0 + exp(epsilon_association/kT);
+		const double t1 = -1.0*1.0 + vm_exp(epsilon_association/kT);
 		const double t2 = 1.0/(sqrt(0.15915494309189535*kappa_association*t1*rtemp4[i]*(rtemp32[i]/rtemp4[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp6[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -0.5*lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(4.1887902047863905*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -2.0943951023931953*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)))/kT)/(R*R) + 1.0) + -1.0);
 		const double t3 = 1.0/(sqrt(0.15915494309189535*kappa_association*t1*rtemp4[i]*(rtemp32[i]/rtemp4[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp6[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -0.5*lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(4.1887902047863905*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -2.0943951023931953*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)))/kT)/(R*R) + 1.0));
 		const double t4 = 1.0/(rtemp32[i]/rtemp4[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp6[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -0.5*lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(4.1887902047863905*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -2.0943951023931953*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)))/kT);
@@ -1581,7 +1574,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 		const RelativeReciprocal rvec((xa>gd.Nx/2) ? xa - gd.Nx : xa, (y>gd.Ny/2) ? y - gd.Ny : y, z);
 		const Reciprocal k_i = gd.Lat.toReciprocal(rvec);
 		const complex t1 = sqrt(k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0]);
-		ktemp122[i] = ktemp122[i]*sin(R*t1)*exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1*t1)/t1;
+		ktemp122[i] = ktemp122[i]*sin(R*t1)*vm_exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1*t1)/t1;
 	}
 
 	VectorXd rtemp124(gd.NxNyNz);
@@ -1590,7 +1583,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 	ktemp122.resize(0); // KSpace
 	VectorXd rtemp125(gd.NxNyNz);
 	for (int i=0; i<gd.NxNyNz; i++) {
-		const double t1 = -1.0*1.0 + exp(epsilon_association/kT);
+		const double t1 = -1.0*1.0 + vm_exp(epsilon_association/kT);
 		const double t2 = 1.0/(sqrt(0.15915494309189535*kappa_association*t1*rtemp4[i]*(rtemp32[i]/rtemp4[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp6[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -0.5*lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(4.1887902047863905*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -2.0943951023931953*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)))/kT)/(R*R) + 1.0) + -1.0);
 		const double t3 = 1.0/(sqrt(0.15915494309189535*kappa_association*t1*rtemp4[i]*(rtemp32[i]/rtemp4[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp6[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -0.5*lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(4.1887902047863905*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -2.0943951023931953*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)))/kT)/(R*R) + 1.0));
 		const double t4 = 1.0/(rtemp32[i]/rtemp4[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp6[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -0.5*lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(4.1887902047863905*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -2.0943951023931953*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)))/kT);
@@ -1615,7 +1608,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 		const RelativeReciprocal rvec((xa>gd.Nx/2) ? xa - gd.Nx : xa, (y>gd.Ny/2) ? y - gd.Ny : y, z);
 		const Reciprocal k_i = gd.Lat.toReciprocal(rvec);
 		const complex t1 = sqrt(k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0]);
-		ktemp126[i] = ktemp126[i]*sin(R*t1)*exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1*t1)/t1;
+		ktemp126[i] = ktemp126[i]*sin(R*t1)*vm_exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1*t1)/t1;
 	}
 
 	VectorXd rtemp128(gd.NxNyNz);
@@ -1624,7 +1617,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 	ktemp126.resize(0); // KSpace
 	VectorXd rtemp129(gd.NxNyNz);
 	for (int i=0; i<gd.NxNyNz; i++) {
-		const double t1 = -1.0*1.0 + exp(epsilon_association/kT);
+		const double t1 = -1.0*1.0 + vm_exp(epsilon_association/kT);
 		const double t2 = 1.0/(sqrt(0.15915494309189535*kappa_association*t1*rtemp4[i]*(rtemp32[i]/rtemp4[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp6[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -0.5*lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(4.1887902047863905*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -2.0943951023931953*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)))/kT)/(R*R) + 1.0) + -1.0);
 		const double t3 = 1.0/(sqrt(0.15915494309189535*kappa_association*t1*rtemp4[i]*(rtemp32[i]/rtemp4[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp6[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -0.5*lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(4.1887902047863905*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -2.0943951023931953*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)))/kT)/(R*R) + 1.0));
 		const double t4 = 1.0/(rtemp32[i]/rtemp4[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp6[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -0.5*lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(4.1887902047863905*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -2.0943951023931953*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)))/kT);
@@ -1649,7 +1642,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 		const RelativeReciprocal rvec((xa>gd.Nx/2) ? xa - gd.Nx : xa, (y>gd.Ny/2) ? y - gd.Ny : y, z);
 		const Reciprocal k_i = gd.Lat.toReciprocal(rvec);
 		const complex t1 = sqrt(k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0]);
-		ktemp130[i] = ktemp130[i]*sin(R*t1)*exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1*t1)/t1;
+		ktemp130[i] = ktemp130[i]*sin(R*t1)*vm_exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1*t1)/t1;
 	}
 
 	VectorXd rtemp132(gd.NxNyNz);
@@ -1658,7 +1651,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 	ktemp130.resize(0); // KSpace
 	VectorXd rtemp133(gd.NxNyNz);
 	for (int i=0; i<gd.NxNyNz; i++) {
-		const double t1 = -1.0*1.0 + exp(epsilon_association/kT);
+		const double t1 = -1.0*1.0 + vm_exp(epsilon_association/kT);
 		const double t2 = 1.0/(sqrt(0.15915494309189535*kappa_association*t1*rtemp4[i]*(rtemp32[i]/rtemp4[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp6[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -0.5*lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(4.1887902047863905*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -2.0943951023931953*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)))/kT)/(R*R) + 1.0) + -1.0);
 		const double t3 = 1.0/(sqrt(0.15915494309189535*kappa_association*t1*rtemp4[i]*(rtemp32[i]/rtemp4[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp6[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -0.5*lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(4.1887902047863905*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -2.0943951023931953*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)))/kT)/(R*R) + 1.0));
 		const double t4 = 1.0/(rtemp32[i]/rtemp4[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp6[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -0.5*lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(4.1887902047863905*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -2.0943951023931953*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)))/kT);
@@ -1683,7 +1676,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 		const RelativeReciprocal rvec((xa>gd.Nx/2) ? xa - gd.Nx : xa, (y>gd.Ny/2) ? y - gd.Ny : y, z);
 		const Reciprocal k_i = gd.Lat.toReciprocal(rvec);
 		const complex t1 = sqrt(k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0]);
-		ktemp134[i] = ktemp134[i]*sin(R*t1)*exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1*t1)/t1;
+		ktemp134[i] = ktemp134[i]*sin(R*t1)*vm_exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1*t1)/t1;
 	}
 
 	VectorXd rtemp136(gd.NxNyNz);
@@ -1692,7 +1685,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 	ktemp134.resize(0); // KSpace
 	VectorXd rtemp137(gd.NxNyNz);
 	for (int i=0; i<gd.NxNyNz; i++) {
-		const double t1 = -1.0*1.0 + exp(epsilon_association/kT);
+		const double t1 = -1.0*1.0 + vm_exp(epsilon_association/kT);
 		const double t2 = 1.0/(sqrt(0.15915494309189535*kappa_association*t1*rtemp4[i]*(rtemp32[i]/rtemp4[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp6[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -0.5*lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(4.1887902047863905*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -2.0943951023931953*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)))/kT)/(R*R) + 1.0) + -1.0);
 		const double t3 = 1.0/(sqrt(0.15915494309189535*kappa_association*t1*rtemp4[i]*(rtemp32[i]/rtemp4[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp6[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -0.5*lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(4.1887902047863905*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -2.0943951023931953*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)))/kT)/(R*R) + 1.0));
 		const double t4 = 1.0/(rtemp32[i]/rtemp4[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp6[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -0.5*lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(4.1887902047863905*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -2.0943951023931953*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)))/kT);
@@ -1717,7 +1710,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 		const RelativeReciprocal rvec((xa>gd.Nx/2) ? xa - gd.Nx : xa, (y>gd.Ny/2) ? y - gd.Ny : y, z);
 		const Reciprocal k_i = gd.Lat.toReciprocal(rvec);
 		const complex t1 = sqrt(k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0]);
-		ktemp138[i] = ktemp138[i]*sin(R*t1)*exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1*t1)/t1;
+		ktemp138[i] = ktemp138[i]*sin(R*t1)*vm_exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1*t1)/t1;
 	}
 
 	VectorXd rtemp140(gd.NxNyNz);
@@ -1726,7 +1719,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 	ktemp138.resize(0); // KSpace
 	VectorXd rtemp141(gd.NxNyNz);
 	for (int i=0; i<gd.NxNyNz; i++) {
-		const double t1 = -1.0*1.0 + exp(epsilon_association/kT);
+		const double t1 = -1.0*1.0 + vm_exp(epsilon_association/kT);
 		const double t2 = 1.0/(sqrt(0.15915494309189535*kappa_association*t1*rtemp4[i]*(rtemp32[i]/rtemp4[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp6[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -0.5*lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(4.1887902047863905*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -2.0943951023931953*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)))/kT)/(R*R) + 1.0) + -1.0);
 		const double t3 = 1.0/(sqrt(0.15915494309189535*kappa_association*t1*rtemp4[i]*(rtemp32[i]/rtemp4[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp6[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -0.5*lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(4.1887902047863905*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -2.0943951023931953*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)))/kT)/(R*R) + 1.0));
 		const double t4 = 1.0/(rtemp32[i]/rtemp4[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp6[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -0.5*lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(4.1887902047863905*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -2.0943951023931953*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)))/kT);
@@ -1747,7 +1740,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 		const RelativeReciprocal rvec((xa>gd.Nx/2) ? xa - gd.Nx : xa, (y>gd.Ny/2) ? y - gd.Ny : y, z);
 		const Reciprocal k_i = gd.Lat.toReciprocal(rvec);
 		const complex t1 = sqrt(k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0]);
-		ktemp143[i] = ktemp142[i]*complex(0,1)*k_i[1]*sin(R*t1)*exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1*t1)/t1;
+		ktemp143[i] = ktemp142[i]*complex(0,1)*k_i[1]*sin(R*t1)*vm_exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1*t1)/t1;
 	}
 
 	VectorXd rtemp144(gd.NxNyNz);
@@ -1764,7 +1757,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 		const RelativeReciprocal rvec((xa>gd.Nx/2) ? xa - gd.Nx : xa, (y>gd.Ny/2) ? y - gd.Ny : y, z);
 		const Reciprocal k_i = gd.Lat.toReciprocal(rvec);
 		const complex t1 = sqrt(k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0]);
-		ktemp145[i] = ktemp142[i]*complex(0,1)*k_i[2]*sin(R*t1)*exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1*t1)/t1;
+		ktemp145[i] = ktemp142[i]*complex(0,1)*k_i[2]*sin(R*t1)*vm_exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1*t1)/t1;
 	}
 
 	VectorXd rtemp146(gd.NxNyNz);
@@ -1780,7 +1773,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 		const RelativeReciprocal rvec((xa>gd.Nx/2) ? xa - gd.Nx : xa, (y>gd.Ny/2) ? y - gd.Ny : y, z);
 		const Reciprocal k_i = gd.Lat.toReciprocal(rvec);
 		const complex t1 = sqrt(k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0]);
-		ktemp142[i] = ktemp142[i]*complex(0,1)*k_i[0]*sin(R*t1)*exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1*t1)/t1;
+		ktemp142[i] = ktemp142[i]*complex(0,1)*k_i[0]*sin(R*t1)*vm_exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1*t1)/t1;
 	}
 
 	VectorXd rtemp148(gd.NxNyNz);
@@ -1789,7 +1782,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 	ktemp142.resize(0); // KSpace
 	VectorXd rtemp149(gd.NxNyNz);
 	for (int i=0; i<gd.NxNyNz; i++) {
-		const double t1 = -1.0*1.0 + exp(epsilon_association/kT);
+		const double t1 = -1.0*1.0 + vm_exp(epsilon_association/kT);
 		const double t2 = 1.0/(sqrt(0.15915494309189535*kappa_association*t1*rtemp4[i]*(rtemp32[i]/rtemp4[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp6[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -0.5*lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(4.1887902047863905*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -2.0943951023931953*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)))/kT)/(R*R) + 1.0) + -1.0);
 		const double t3 = 1.0/(sqrt(0.15915494309189535*kappa_association*t1*rtemp4[i]*(rtemp32[i]/rtemp4[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp6[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -0.5*lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(4.1887902047863905*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -2.0943951023931953*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)))/kT)/(R*R) + 1.0));
 		const double t4 = 1.0/(rtemp32[i]/rtemp4[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp6[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -0.5*lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(4.1887902047863905*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -2.0943951023931953*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)))/kT);
@@ -1814,7 +1807,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 		const RelativeReciprocal rvec((xa>gd.Nx/2) ? xa - gd.Nx : xa, (y>gd.Ny/2) ? y - gd.Ny : y, z);
 		const Reciprocal k_i = gd.Lat.toReciprocal(rvec);
 		const complex t1 = sqrt(k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0]);
-		ktemp150[i] = ktemp150[i]*sin(R*t1)*exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1*t1)/t1;
+		ktemp150[i] = ktemp150[i]*sin(R*t1)*vm_exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1*t1)/t1;
 	}
 
 	VectorXd rtemp152(gd.NxNyNz);
@@ -1823,7 +1816,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 	ktemp150.resize(0); // KSpace
 	VectorXd rtemp153(gd.NxNyNz);
 	for (int i=0; i<gd.NxNyNz; i++) {
-		const double t1 = -1.0*1.0 + exp(epsilon_association/kT);
+		const double t1 = -1.0*1.0 + vm_exp(epsilon_association/kT);
 		const double t2 = 1.0/(sqrt(0.15915494309189535*kappa_association*t1*rtemp4[i]*(rtemp32[i]/rtemp4[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp6[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -0.5*lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(4.1887902047863905*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -2.0943951023931953*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)))/kT)/(R*R) + 1.0) + -1.0);
 		const double t3 = 1.0/(sqrt(0.15915494309189535*kappa_association*t1*rtemp4[i]*(rtemp32[i]/rtemp4[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp6[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -0.5*lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(4.1887902047863905*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -2.0943951023931953*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)))/kT)/(R*R) + 1.0));
 		const double t4 = 1.0/(rtemp32[i]/rtemp4[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp6[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -0.5*lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(4.1887902047863905*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -2.0943951023931953*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)))/kT);
@@ -1848,7 +1841,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 		const RelativeReciprocal rvec((xa>gd.Nx/2) ? xa - gd.Nx : xa, (y>gd.Ny/2) ? y - gd.Ny : y, z);
 		const Reciprocal k_i = gd.Lat.toReciprocal(rvec);
 		const complex t1 = sqrt(k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0]);
-		ktemp154[i] = -1.0*R*ktemp154[i]*cos(R*t1)*exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1*t1);
+		ktemp154[i] = -1.0*R*ktemp154[i]*cos(R*t1)*vm_exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1*t1);
 	}
 
 	VectorXd rtemp156(gd.NxNyNz);
@@ -1857,7 +1850,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 	ktemp154.resize(0); // KSpace
 	VectorXd rtemp157(gd.NxNyNz);
 	for (int i=0; i<gd.NxNyNz; i++) {
-		const double t1 = -1.0*1.0 + exp(epsilon_association/kT);
+		const double t1 = -1.0*1.0 + vm_exp(epsilon_association/kT);
 		const double t2 = 1.0/(sqrt(0.15915494309189535*kappa_association*t1*rtemp4[i]*(rtemp32[i]/rtemp4[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp6[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -0.5*lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(4.1887902047863905*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -2.0943951023931953*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)))/kT)/(R*R) + 1.0) + -1.0);
 		const double t3 = 1.0/(sqrt(0.15915494309189535*kappa_association*t1*rtemp4[i]*(rtemp32[i]/rtemp4[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp6[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -0.5*lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(4.1887902047863905*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -2.0943951023931953*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)))/kT)/(R*R) + 1.0));
 		const double t4 = 1.0/(rtemp32[i]/rtemp4[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp6[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -0.5*lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(4.1887902047863905*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -2.0943951023931953*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)))/kT);
@@ -1870,7 +1863,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 	rtemp157.resize(0); // Realspace
 	VectorXd rtemp159(gd.NxNyNz);
 	for (int i=0; i<gd.NxNyNz; i++) {
-		const double t1 = -1.0*1.0 + exp(epsilon_association/kT);
+		const double t1 = -1.0*1.0 + vm_exp(epsilon_association/kT);
 		const double t2 = 1.0/(sqrt(0.15915494309189535*kappa_association*t1*rtemp4[i]*(rtemp32[i]/rtemp4[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp6[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -0.5*lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(4.1887902047863905*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -2.0943951023931953*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)))/kT)/(R*R) + 1.0) + -1.0);
 		const double t3 = 1.0/(sqrt(0.15915494309189535*kappa_association*t1*rtemp4[i]*(rtemp32[i]/rtemp4[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp6[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -0.5*lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(4.1887902047863905*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -2.0943951023931953*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)))/kT)/(R*R) + 1.0));
 		const double t4 = 1.0/(rtemp32[i]/rtemp4[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp6[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -0.5*lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(4.1887902047863905*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -2.0943951023931953*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)))/kT);
@@ -1893,7 +1886,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 		const complex t1 = k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0];
 		const complex t2 = R*sqrt(t1);
 		const complex t3 = sin(t2)/(sqrt(t1));
-		ktemp161[i] = complex(0,1)*k_i[1]*exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1)*(t3*ktemp158[i] + ktemp160[i]*(R*cos(t2) + -1.0*t3)/t1);
+		ktemp161[i] = complex(0,1)*k_i[1]*vm_exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1)*(t3*ktemp158[i] + ktemp160[i]*(R*cos(t2) + -1.0*t3)/t1);
 	}
 
 	VectorXd rtemp162(gd.NxNyNz);
@@ -1902,7 +1895,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 	ktemp161.resize(0); // KSpace
 	VectorXd rtemp163(gd.NxNyNz);
 	for (int i=0; i<gd.NxNyNz; i++) {
-		const double t1 = -1.0*1.0 + exp(epsilon_association/kT);
+		const double t1 = -1.0*1.0 + vm_exp(epsilon_association/kT);
 		const double t2 = 1.0/(sqrt(0.15915494309189535*kappa_association*t1*rtemp4[i]*(rtemp32[i]/rtemp4[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp6[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -0.5*lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(4.1887902047863905*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -2.0943951023931953*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)))/kT)/(R*R) + 1.0) + -1.0);
 		const double t3 = 1.0/(sqrt(0.15915494309189535*kappa_association*t1*rtemp4[i]*(rtemp32[i]/rtemp4[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp6[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -0.5*lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(4.1887902047863905*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -2.0943951023931953*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)))/kT)/(R*R) + 1.0));
 		const double t4 = 1.0/(rtemp32[i]/rtemp4[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp6[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -0.5*lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(4.1887902047863905*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -2.0943951023931953*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)))/kT);
@@ -1923,7 +1916,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 		const RelativeReciprocal rvec((xa>gd.Nx/2) ? xa - gd.Nx : xa, (y>gd.Ny/2) ? y - gd.Ny : y, z);
 		const Reciprocal k_i = gd.Lat.toReciprocal(rvec);
 		const complex t1 = sqrt(k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0]);
-		ktemp165[i] = ktemp164[i]*complex(0,1)*k_i[1]*sin(R*t1)*exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1*t1)/t1;
+		ktemp165[i] = ktemp164[i]*complex(0,1)*k_i[1]*sin(R*t1)*vm_exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1*t1)/t1;
 	}
 
 	VectorXd rtemp166(gd.NxNyNz);
@@ -1942,7 +1935,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 		const complex t1 = k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0];
 		const complex t2 = R*sqrt(t1);
 		const complex t3 = sin(t2)/(sqrt(t1));
-		ktemp167[i] = complex(0,1)*k_i[2]*exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1)*(t3*ktemp158[i] + ktemp160[i]*(R*cos(t2) + -1.0*t3)/t1);
+		ktemp167[i] = complex(0,1)*k_i[2]*vm_exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1)*(t3*ktemp158[i] + ktemp160[i]*(R*cos(t2) + -1.0*t3)/t1);
 	}
 
 	VectorXd rtemp168(gd.NxNyNz);
@@ -1959,7 +1952,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 		const RelativeReciprocal rvec((xa>gd.Nx/2) ? xa - gd.Nx : xa, (y>gd.Ny/2) ? y - gd.Ny : y, z);
 		const Reciprocal k_i = gd.Lat.toReciprocal(rvec);
 		const complex t1 = sqrt(k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0]);
-		ktemp169[i] = ktemp164[i]*complex(0,1)*k_i[2]*sin(R*t1)*exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1*t1)/t1;
+		ktemp169[i] = ktemp164[i]*complex(0,1)*k_i[2]*sin(R*t1)*vm_exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1*t1)/t1;
 	}
 
 	VectorXd rtemp170(gd.NxNyNz);
@@ -1977,7 +1970,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 		const complex t1 = k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0];
 		const complex t2 = R*sqrt(t1);
 		const complex t3 = sin(t2)/(sqrt(t1));
-		ktemp160[i] = complex(0,1)*k_i[0]*exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1)*(t3*ktemp158[i] + ktemp160[i]*(R*cos(t2) + -1.0*t3)/t1);
+		ktemp160[i] = complex(0,1)*k_i[0]*vm_exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1)*(t3*ktemp158[i] + ktemp160[i]*(R*cos(t2) + -1.0*t3)/t1);
 	}
 
 	ktemp158.resize(0); // KSpace
@@ -1994,7 +1987,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 		const RelativeReciprocal rvec((xa>gd.Nx/2) ? xa - gd.Nx : xa, (y>gd.Ny/2) ? y - gd.Ny : y, z);
 		const Reciprocal k_i = gd.Lat.toReciprocal(rvec);
 		const complex t1 = sqrt(k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0]);
-		ktemp164[i] = ktemp164[i]*complex(0,1)*k_i[0]*sin(R*t1)*exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1*t1)/t1;
+		ktemp164[i] = ktemp164[i]*complex(0,1)*k_i[0]*sin(R*t1)*vm_exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1*t1)/t1;
 	}
 
 	VectorXd rtemp174(gd.NxNyNz);
@@ -2003,7 +1996,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 	ktemp164.resize(0); // KSpace
 	VectorXd rtemp175(gd.NxNyNz);
 	for (int i=0; i<gd.NxNyNz; i++) {
-		const double t1 = -1.0*1.0 + exp(epsilon_association/kT);
+		const double t1 = -1.0*1.0 + vm_exp(epsilon_association/kT);
 		const double t2 = 1.0/(sqrt(0.15915494309189535*kappa_association*t1*rtemp4[i]*(rtemp32[i]/rtemp4[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp6[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -0.5*lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(4.1887902047863905*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -2.0943951023931953*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)))/kT)/(R*R) + 1.0) + -1.0);
 		const double t3 = 1.0/(sqrt(0.15915494309189535*kappa_association*t1*rtemp4[i]*(rtemp32[i]/rtemp4[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp6[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -0.5*lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(4.1887902047863905*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -2.0943951023931953*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)))/kT)/(R*R) + 1.0));
 		const double t4 = 1.0/(rtemp32[i]/rtemp4[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp6[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -0.5*lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(4.1887902047863905*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -2.0943951023931953*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)))/kT);
@@ -2029,7 +2022,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 		const Reciprocal k_i = gd.Lat.toReciprocal(rvec);
 		const complex t1 = k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0];
 		const complex t2 = R*sqrt(t1);
-		ktemp176[i] = ktemp176[i]*exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1)*(-1.0*sin(t2)/(sqrt(t1)) + -1.0*R*cos(t2));
+		ktemp176[i] = ktemp176[i]*vm_exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1)*(-1.0*sin(t2)/(sqrt(t1)) + -1.0*R*cos(t2));
 	}
 
 	VectorXd rtemp178(gd.NxNyNz);
@@ -2038,7 +2031,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 	ktemp176.resize(0); // KSpace
 	VectorXd rtemp179(gd.NxNyNz);
 	for (int i=0; i<gd.NxNyNz; i++) {
-		const double t1 = -1.0*1.0 + exp(epsilon_association/kT);
+		const double t1 = -1.0*1.0 + vm_exp(epsilon_association/kT);
 		const double t2 = 1.0/(sqrt(0.15915494309189535*kappa_association*t1*rtemp4[i]*(rtemp32[i]/rtemp4[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp6[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -0.5*lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(4.1887902047863905*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -2.0943951023931953*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)))/kT)/(R*R) + 1.0) + -1.0);
 		const double t3 = 1.0/(sqrt(0.15915494309189535*kappa_association*t1*rtemp4[i]*(rtemp32[i]/rtemp4[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp6[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -0.5*lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(4.1887902047863905*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -2.0943951023931953*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)))/kT)/(R*R) + 1.0));
 		const double t4 = 1.0/(rtemp32[i]/rtemp4[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp6[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -0.5*lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(4.1887902047863905*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -2.0943951023931953*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)))/kT);
@@ -2064,7 +2057,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 		const Reciprocal k_i = gd.Lat.toReciprocal(rvec);
 		const complex t1 = k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0];
 		const complex t2 = R*sqrt(t1);
-		ktemp180[i] = ktemp180[i]*exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1)*(-1.0*sin(t2)/(sqrt(t1)) + -1.0*R*cos(t2));
+		ktemp180[i] = ktemp180[i]*vm_exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1)*(-1.0*sin(t2)/(sqrt(t1)) + -1.0*R*cos(t2));
 	}
 
 	VectorXd rtemp182(gd.NxNyNz);
@@ -2073,7 +2066,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 	ktemp180.resize(0); // KSpace
 	VectorXd rtemp183(gd.NxNyNz);
 	for (int i=0; i<gd.NxNyNz; i++) {
-		const double t1 = -1.0*1.0 + exp(epsilon_association/kT);
+		const double t1 = -1.0*1.0 + vm_exp(epsilon_association/kT);
 		const double t2 = 1.0/(sqrt(0.15915494309189535*kappa_association*t1*rtemp4[i]*(rtemp32[i]/rtemp4[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp6[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -0.5*lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(4.1887902047863905*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -2.0943951023931953*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)))/kT)/(R*R) + 1.0) + -1.0);
 		const double t3 = 1.0/(sqrt(0.15915494309189535*kappa_association*t1*rtemp4[i]*(rtemp32[i]/rtemp4[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp6[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -0.5*lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(4.1887902047863905*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -2.0943951023931953*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)))/kT)/(R*R) + 1.0));
 		const double t4 = 1.0/(rtemp32[i]/rtemp4[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp6[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -0.5*lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(4.1887902047863905*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -2.0943951023931953*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)))/kT);
@@ -2086,7 +2079,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 	rtemp183.resize(0); // Realspace
 	VectorXd rtemp185(gd.NxNyNz);
 	for (int i=0; i<gd.NxNyNz; i++) {
-		const double t1 = -1.0*1.0 + exp(epsilon_association/kT);
+		const double t1 = -1.0*1.0 + vm_exp(epsilon_association/kT);
 		const double t2 = 1.0/(sqrt(0.15915494309189535*kappa_association*t1*rtemp4[i]*(rtemp32[i]/rtemp4[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp6[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -0.5*lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(4.1887902047863905*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -2.0943951023931953*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)))/kT)/(R*R) + 1.0) + -1.0);
 		const double t3 = 1.0/(sqrt(0.15915494309189535*kappa_association*t1*rtemp4[i]*(rtemp32[i]/rtemp4[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp6[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -0.5*lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(4.1887902047863905*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -2.0943951023931953*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)))/kT)/(R*R) + 1.0));
 		const double t4 = 1.0/(rtemp32[i]/rtemp4[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp6[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -0.5*lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(4.1887902047863905*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -2.0943951023931953*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)))/kT);
@@ -2114,7 +2107,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 		const complex t1 = k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0];
 		const complex t2 = sin(R*sqrt(t1));
 		const complex t3 = t2/(sqrt(t1));
-		ktemp186[i] = exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1)*(ktemp184[i]*(-1.0*R*cos(R*sqrt(t1)) + -1.0*t3) + t3*ktemp186[i]);
+		ktemp186[i] = vm_exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1)*(ktemp184[i]*(-1.0*R*cos(R*sqrt(t1)) + -1.0*t3) + t3*ktemp186[i]);
 	}
 
 	ktemp184.resize(0); // KSpace
@@ -2124,7 +2117,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 	ktemp186.resize(0); // KSpace
 	VectorXd rtemp189(gd.NxNyNz);
 	for (int i=0; i<gd.NxNyNz; i++) {
-		const double t1 = -1.0*1.0 + exp(epsilon_association/kT);
+		const double t1 = -1.0*1.0 + vm_exp(epsilon_association/kT);
 		const double t2 = 1.0/(sqrt(0.15915494309189535*kappa_association*t1*rtemp4[i]*(rtemp32[i]/rtemp4[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp6[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -0.5*lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(4.1887902047863905*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -2.0943951023931953*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)))/kT)/(R*R) + 1.0) + -1.0);
 		const double t3 = 1.0/(sqrt(0.15915494309189535*kappa_association*t1*rtemp4[i]*(rtemp32[i]/rtemp4[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp6[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -0.5*lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(4.1887902047863905*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -2.0943951023931953*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)))/kT)/(R*R) + 1.0));
 		const double t4 = 1.0/(rtemp32[i]/rtemp4[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp6[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -0.5*lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(4.1887902047863905*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -2.0943951023931953*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)))/kT);
@@ -2150,7 +2143,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 		const Reciprocal k_i = gd.Lat.toReciprocal(rvec);
 		const complex t1 = k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0];
 		const complex t2 = R*sqrt(t1);
-		ktemp190[i] = ktemp190[i]*exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1)*(-1.0*sin(t2)/(sqrt(t1)) + -1.0*R*cos(t2));
+		ktemp190[i] = ktemp190[i]*vm_exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1)*(-1.0*sin(t2)/(sqrt(t1)) + -1.0*R*cos(t2));
 	}
 
 	VectorXd rtemp192(gd.NxNyNz);
@@ -2159,7 +2152,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 	ktemp190.resize(0); // KSpace
 	VectorXd rtemp193(gd.NxNyNz);
 	for (int i=0; i<gd.NxNyNz; i++) {
-		const double t1 = -1.0*1.0 + exp(epsilon_association/kT);
+		const double t1 = -1.0*1.0 + vm_exp(epsilon_association/kT);
 		const double t2 = 1.0/(sqrt(0.15915494309189535*kappa_association*t1*rtemp4[i]*(rtemp32[i]/rtemp4[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp6[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -0.5*lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(4.1887902047863905*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -2.0943951023931953*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)))/kT)/(R*R) + 1.0) + -1.0);
 		const double t3 = 1.0/(sqrt(0.15915494309189535*kappa_association*t1*rtemp4[i]*(rtemp32[i]/rtemp4[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp6[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -0.5*lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(4.1887902047863905*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -2.0943951023931953*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)))/kT)/(R*R) + 1.0));
 		const double t4 = 1.0/(rtemp32[i]/rtemp4[i] + 0.25*epsilon_dispersion*((4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + -4.1887902047863905*R*R*R*rtemp6[i]*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + 2.25855)/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -0.5*lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*(8.377580409572781*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 52.63789013914324*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -5.606863240714776) + -1.129275) + -1.0)/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -4.1887902047863905*R*R*R*(4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0)*(3.0*(-2.0943951023931953*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(4.1887902047863905*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion))/(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0) + -2.0943951023931953*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + -0.5*R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*R*R*R*rtemp6[i]*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion)))/((-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)*(-4.1887902047863905*R*R*R*rtemp6[i]*(lambda_dispersion*(-1.50349*1.0 + 0.249434*lambda_dispersion) + R*R*R*rtemp6[i]*(4.1887902047863905*lambda_dispersion*(1.40049*1.0 + -0.827739*lambda_dispersion) + 17.54596337971441*R*R*R*rtemp6[i]*(lambda_dispersion*(-15.0427*1.0 + 5.30827*lambda_dispersion) + 10.1576) + -2.803431620357388) + 2.25855) + 1.0)))/kT);
@@ -2185,7 +2178,7 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 		const Reciprocal k_i = gd.Lat.toReciprocal(rvec);
 		const complex t1 = k_i[2]*k_i[2] + k_i[1]*k_i[1] + k_i[0]*k_i[0];
 		const complex t2 = R*sqrt(t1);
-		ktemp194[i] = ktemp194[i]*exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1)*(-1.0*sin(t2)/(sqrt(t1)) + -1.0*R*cos(t2));
+		ktemp194[i] = ktemp194[i]*vm_exp(-6.0*pow(gd.dvolume, 0.6666666666666666)*t1)*(-1.0*sin(t2)/(sqrt(t1)) + -1.0*R*cos(t2));
 	}
 
 	VectorXd rtemp196(gd.NxNyNz);
@@ -2202,16 +2195,16 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 		const double t7 = rtemp20[i]*rtemp20[i];
 		const double t8 = rtemp2[i]*rtemp2[i];
 		const double t9 = -3.0*t8 + -3.0*t7 + -3.0*t6 + t5;
-		const double t10 = t1*t1*log(t1) + rtemp8[i];
+		const double t10 = t1*t1*vm_log(t1) + rtemp8[i];
 		const double t11 = 1.0/t1;
 		const double t12 = 1.0/rtemp8[i];
-		const double t13 = t9*log(t1);
-		const double t14 = t10*t11*t12 + log(t1);
+		const double t13 = t9*vm_log(t1);
+		const double t14 = t10*t11*t12 + vm_log(t1);
 		const double t15 = t12*(2.0*1.0 + -4.0*rtemp8[i]);
 		const double t16 = t10*t11 + 1.0;
 		const double t17 = -5.305164769729845e-2*t10*t11*t12*t12*rtemp12[i] + -7.957747154594767e-2*1.0/R;
 		const double t18 = 1.0/t11;
-		const double t19 = -1.768388256576615e-2*t18*log(t1) + -8.841941282883075e-3*t10*t15/t18 + 8.841941282883075e-3*rtemp8[i];
+		const double t19 = -1.768388256576615e-2*t18*vm_log(t1) + -8.841941282883075e-3*t10*t15/t18 + 8.841941282883075e-3*rtemp8[i];
 		rtemp196[i] = rtemp12[i]*(rtemp156[i]/(t18*t18) + t12*t12*((rtemp148[i]*rtemp2[i] + rtemp146[i]*rtemp20[i] + rtemp144[i]*rtemp16[i] + t19*t9*rtemp152[i]/(t18*t18))/t18 + t12*t9*(t19*rtemp136[i] + t10*rtemp140[i]/t18)/(t18*t18))) + (rtemp196[i]*(0.33333333333333337*t10*t12*t12*t4 + 7.957747154594767e-2*t3)/t18 + 37.69911184307752*t12*t12*t2*rtemp192[i] + rtemp188[i])/t18 + rtemp2[i]*(t17*rtemp174[i] + rtemp172[i])/(t18*t18) + rtemp20[i]*(t17*rtemp170[i] + rtemp168[i])/(t18*t18) + rtemp16[i]*(t17*rtemp166[i] + rtemp162[i])/(t18*t18) + t12*t12*t12*t16*t9*rtemp124[i]*rtemp12[i]*(2.0*1.0 + -4.0*rtemp8[i])/(t18*t18*t18) + t12*t12*rtemp128[i]*rtemp12[i]*(t9*(1.0 + 2.0*t18)/(t18*t18) + t15*t9*(t10*t12/t18 + 1.0)/(t18*t18)) + t12*t12*t16*rtemp120[i]*rtemp12[i]*rtemp2[i]/(t18*t18) + t12*t12*t16*rtemp116[i]*rtemp12[i]*rtemp20[i]/(t18*t18) + t12*t12*t16*rtemp112[i]*rtemp12[i]*rtemp16[i]/(t18*t18) + 37.69911184307752*t12*t12*t16*t2*rtemp178[i]/(t18*t18) + 37.69911184307752*t12*t12*t14*t4*rtemp182[i] + t12*t12*t14*rtemp118[i]*rtemp12[i]*rtemp2[i]/t18 + t12*t12*t14*rtemp114[i]*rtemp12[i]*rtemp20[i]/t18 + t12*t12*t14*rtemp108[i]*rtemp12[i]*rtemp16[i]/t18 + t12*t12*t13*rtemp12[i]*rtemp132[i]*(1.0 + t15)/(t18*t18) + kT*t12*t12*rtemp12[i]*((t10*t9*(-0.22222222222222224*t12 + 0.22222222222222224*t11) + 0.11111111111111112*t9)/t18 + -0.11111111111111112*t9 + -0.22222222222222224*t13)/t18 + (rtemp104[i]*(2.0*t4 + 7.957747154594767e-2*t3)/(t18*t18) + 12.566370614359172*kT*t2/(t18*t18))/R;
 	}
 
@@ -2265,11 +2258,11 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 		const RelativeReciprocal rvec((xa>gd.Nx/2) ? xa - gd.Nx : xa, (y>gd.Ny/2) ? y - gd.Ny : y, z);
 		const Reciprocal k_i = gd.Lat.toReciprocal(rvec);
 		const complex t1 = 0.5*k_i[2]*k_i[2] + 0.5*k_i[1]*k_i[1] + 0.5*k_i[0]*k_i[0];
-		const complex t2 = exp(-12.0*pow(gd.dvolume, 0.6666666666666666)*t1);
+		const complex t2 = vm_exp(-12.0*pow(gd.dvolume, 0.6666666666666666)*t1);
 		const complex t3 = R*cos(1.4142135623730951*R*sqrt(t1));
 		const complex t4 = sin(1.4142135623730951*R*sqrt(t1))/(sqrt(t1));
 		const complex t5 = 1.4142135623730951*R*sqrt(t1);
-		ktemp198[i] = ktemp70[i]*exp(-4.0*R*R*lambda_dispersion*lambda_dispersion*length_scaling*length_scaling*t1) + t2*(0.7071067811865476*t4*ktemp102[i] + 0.7071067811865476*ktemp72[i]*sin(2.0*t5)/(sqrt(t1)) + 0.3535533905932738*ktemp198[i]*(-1.4142135623730951*sqrt(t1)*t3 + sin(t5))/(sqrt(t1)*t1)) + 0.5*t2*complex(0,1)*(-0.7071067811865476*t4 + t3)*(ktemp68[i]*k_i[2] + ktemp62[i]*k_i[1] + ktemp56[i]*k_i[0])/t1;
+		ktemp198[i] = ktemp70[i]*vm_exp(-4.0*R*R*lambda_dispersion*lambda_dispersion*length_scaling*length_scaling*t1) + t2*(0.7071067811865476*t4*ktemp102[i] + 0.7071067811865476*ktemp72[i]*sin(2.0*t5)/(sqrt(t1)) + 0.3535533905932738*ktemp198[i]*(-1.4142135623730951*sqrt(t1)*t3 + sin(t5))/(sqrt(t1)*t1)) + 0.5*t2*complex(0,1)*(-0.7071067811865476*t4 + t3)*(ktemp68[i]*k_i[2] + ktemp62[i]*k_i[1] + ktemp56[i]*k_i[0])/t1;
 	}
 
 	ktemp102.resize(0); // KSpace
@@ -2289,8 +2282,8 @@ void grad(const GridDescription &gd, double kT, const VectorXd &x, const VectorX
 		const double t4 = R*R*R*rtemp6[i];
 		const double t5 = 4.1887902047863905*t4;
 		const double t6 = 4.0*lambda_dispersion*lambda_dispersion*lambda_dispersion + -4.0;
-		const double t7 = 12.566370614359172*R*R*(sqrt(0.15915494309189535*kappa_association*rtemp4[i]*(-1.0*1.0 + exp(epsilon_association/kT))*(rtemp32[i]/rtemp4[i] + 0.25*epsilon_dispersion*(t3*t6/(t2*t2*t2) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(1.0 + -2.0943951023931953*t1) + -4.1887902047863905*R*R*R*t6*(-2.0943951023931953*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + 3.0*(1.0 + -2.0943951023931953*t1)*(4.1887902047863905*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*t4*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion))/t2 + -0.5*R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*t4*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion)))/(t2*t2*t2))/kT)/(R*R) + 1.0) + -1.0)/(kappa_association*rtemp4[i]*(-1.0*1.0 + exp(epsilon_association/kT))*(rtemp32[i]/rtemp4[i] + 0.25*epsilon_dispersion*(t3*t6/(t2*t2*t2) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(1.0 + -2.0943951023931953*t1) + -4.1887902047863905*R*R*R*t6*(-2.0943951023931953*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + 3.0*(1.0 + -2.0943951023931953*t1)*(4.1887902047863905*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*t4*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion))/t2 + -0.5*R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*t4*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion)))/(t2*t2*t2))/kT));
-		(*outgrad)[i] = ingrad[i]*(kT*(2.0*1.0 + log(2.646476976618268e-6*x[i]/(sqrt(kT)*kT)) + 4.0*log(t7) + -2.0*t7) + epsilon_dispersion*t4*t6*(2.0943951023931953*epsilon_dispersion*t3*((1.0 + -1.0*t5)*(1.0 + -1.0*t5))*((1.0 + -1.0*t5)*(1.0 + -1.0*t5))/(kT*(4.0*t5*t5 + 1.0 + 4.0*t5)) + -4.1887902047863905*1.0 + 8.772981689857206*t1)/(t2*t2*t2) + rtemp200[i] + mu) + (*outgrad)[i];
+		const double t7 = 12.566370614359172*R*R*(sqrt(0.15915494309189535*kappa_association*rtemp4[i]*(-1.0*1.0 + vm_exp(epsilon_association/kT))*(rtemp32[i]/rtemp4[i] + 0.25*epsilon_dispersion*(t3*t6/(t2*t2*t2) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(1.0 + -2.0943951023931953*t1) + -4.1887902047863905*R*R*R*t6*(-2.0943951023931953*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + 3.0*(1.0 + -2.0943951023931953*t1)*(4.1887902047863905*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*t4*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion))/t2 + -0.5*R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*t4*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion)))/(t2*t2*t2))/kT)/(R*R) + 1.0) + -1.0)/(kappa_association*rtemp4[i]*(-1.0*1.0 + vm_exp(epsilon_association/kT))*(rtemp32[i]/rtemp4[i] + 0.25*epsilon_dispersion*(t3*t6/(t2*t2*t2) + -7.957747154594767e-2*lambda_dispersion*(-50.26548245743669*lambda_dispersion*lambda_dispersion*(1.0 + -2.0943951023931953*t1) + -4.1887902047863905*R*R*R*t6*(-2.0943951023931953*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + 3.0*(1.0 + -2.0943951023931953*t1)*(4.1887902047863905*rtemp6[i]*(-1.50349*1.0 + 0.498868*lambda_dispersion) + R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*t4*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion))/t2 + -0.5*R*R*R*rtemp6[i]*rtemp6[i]*(73.49635953848843*t4*(-15.0427*1.0 + 10.61654*lambda_dispersion) + 24.572946253656237*1.0 + -29.046956363922856*lambda_dispersion)))/(t2*t2*t2))/kT));
+		(*outgrad)[i] = ingrad[i]*(kT*(2.0*1.0 + vm_log(2.646476976618268e-6*x[i]/(sqrt(kT)*kT)) + 4.0*vm_log(t7) + -2.0*t7) + epsilon_dispersion*t4*t6*(2.0943951023931953*epsilon_dispersion*t3*((1.0 + -1.0*t5)*(1.0 + -1.0*t5))*((1.0 + -1.0*t5)*(1.0 + -1.0*t5))/(kT*(4.0*t5*t5 + 1.0 + 4.0*t5)) + -4.1887902047863905*1.0 + 8.772981689857206*t1)/(t2*t2*t2) + rtemp200[i] + mu) + (*outgrad)[i];
 	}
 
 	rtemp200.resize(0); // Realspace
@@ -17,6 +17,9 @@
 #include "equation-of-state.h"
 #include "Functionals.h"
 #include <stdio.h>
+#include <algorithm>
+#include <thread>
+#include <vector>
 
 static inline double sqr(double x) {
   return x*x;
@@ -80,7 +83,7 @@ double find_minimum_slow(Functional f, double kT, double xmin, double xmax) {
   return 0.5*(xmax+xmin);
 }
 
-double find_minimum(Functional f, double kT, double nmin, double nmax) {
+double find_minimum(const Functional &f, double kT, double nmin, double nmax) {
   double nbest = nmin;
   double ebest = f(kT, nmin);
   //printf("Limits are %g and %g\n", nmin, nmax);
@@ -161,7 +164,7 @@ double find_minimum(Functional f, double kT, double nmin, double nmax) {
 }
 
 // p = n df/dn - f = -kT df/dVeff - f
-double pressure(Functional f, double kT, double density) {
+double pressure(const Functional &f, double kT, double density) {
   double V = -kT*log(density);
   //printf("density is %g\n", density);
   //printf("f(V) is %g\n", f(V));
@@ -179,18 +182,48 @@ double pressure_to_density(Functional f, double kT, double p, double nmin, doubl
   return sqrt(nmax*nmin);
 }
 
-double find_density(Functional f, double kT, double nmin, double nmax) {
+double find_density(const Functional &f, double kT, double nmin, double nmax) {
   double Vmax = -kT*log(nmin);
   double Vmin = -kT*log(nmax);
   double V = find_minimum(f, kT, Vmin, Vmax);
   return EffectivePotentialToDensity()(kT, V);
 }
 
-double find_chemical_potential(Functional f, double kT, double n) {
+double find_chemical_potential(const Functional &f, double kT, double n) {
   const double V = -kT*log(n);
   return f.derive(kT, V)*kT/n;
 }
 
+// This computes the same chemical potential and pressure as
+// find_chemical_potential and pressure, sharing the work between the
+// two.
+static void chemical_potential_and_pressure(const Functional &f, double kT, double n,
+                                            double *mu, double *p) {
+  const double V = -kT*log(n);
+  const double dfdV = f.derive(kT, V);
+  *mu = dfdV*kT/n;
+  *p = -dfdV*kT - f(kT, V);
+}
+
+static void chemical_potential_and_pressure(const Functional &f, const VectorXd &kT,
+                                            const VectorXd &n, VectorXd *mu, VectorXd *p) {
+  const VectorXd V = -(kT.cwise()*n.cwise().log());
+  const VectorXd dfdV_kT = f.derive_batch(kT, V).cwise()*kT;
+  *mu = dfdV_kT.cwise()/n;
+  *p = -dfdV_kT - f.transform_batch(kT, V);
+}
+
+VectorXd find_chemical_potential(const Functional &f, const VectorXd &kT, const VectorXd &n) {
+  const VectorXd V = -(kT.cwise()*n.cwise().log());
+  return (f.derive_batch(kT, V).cwise()*kT).cwise()/n;
+}
+
+VectorXd pressure(const Functional &f, const VectorXd &kT, const VectorXd &density) {
+  VectorXd mu, p;
+  chemical_potential_and_pressure(f, kT, density, &mu, &p);
+  return p;
+}
+
 double chemical_potential_to_density(Functional f, double kT, double mu,
                                      double nmin, double nmax) {
   Functional n = EffectivePotentialToDensity();
@@ -276,7 +309,7 @@ double saturated_liquid(Functional f, double kT, double nmin, double nmax,
 }
 
 
-void saturated_liquid_vapor(Functional f, double kT,
+void saturated_liquid_vapor(const Functional &f, double kT,
                             const double nmin, const double ncrit, const double nmax,
                             double *nl_ptr, double *nv_ptr, double *mu_ptr,
                             const double fraccuracy) {
@@ -376,6 +409,210 @@ void saturated_liquid_vapor(Functional f, double kT,
            fabs(*nv_ptr - nv_old) > fraccuracy*nv_old);
 }
 
+// We take derivatives of mu and p with respect to log(n) by finite
+// differences of the analytic first derivative.  This step only
+// needs to be good enough to make the Jacobian reasonably accurate.
+static const double newton_dlogn = 1e-5;
+
+bool saturated_liquid_vapor_newton(const Functional &f, double kT,
+                                   double *nl_ptr, double *nv_ptr, double *mu_ptr,
+                                   const double fraccuracy) {
+  double a = log(*nl_ptr), b = log(*nv_ptr); // we work with log densities
+  if (!(a > b)) return false;
+  const double h = newton_dlogn;
+  for (int i=0; i<50; i++) {
+    double mul, pl, muv, pv, mup, pp, mum, pm;
+    chemical_potential_and_pressure(f, kT, exp(a), &mul, &pl);
+    chemical_potential_and_pressure(f, kT, exp(b), &muv, &pv);
+    chemical_potential_and_pressure(f, kT, exp(a+h), &mup, &pp);
+    chemical_potential_and_pressure(f, kT, exp(a-h), &mum, &pm);
+    const double dmul = (mup - mum)/(2*h), dpl = (pp - pm)/(2*h);
+    chemical_potential_and_pressure(f, kT, exp(b+h), &mup, &pp);
+    chemical_potential_and_pressure(f, kT, exp(b-h), &mum, &pm);
+    const double dmuv = (mup - mum)/(2*h), dpv = (pp - pm)/(2*h);
+
+    // Solve the 2x2 system J*(da, db) = -(mul - muv, pl - pv).
+    const double det = -dmul*dpv + dmuv*dpl;
+    double da = (-(mul - muv)*(-dpv) + dmuv*(-(pl - pv)))/det;
+    double db = (dmul*(-(pl - pv)) - dpl*(-(mul - muv)))/det;
+    if (da != da || db != db) return false;
+    // Don't let a poor Jacobian throw us to a crazy density.
+    const double biggest = std::max(fabs(da), fabs(db));
+    if (biggest > 0.5) {
+      da *= 0.5/biggest;
+      db *= 0.5/biggest;
+    }
+    a += da;
+    b += db;
+    // If the two phases merge, we have found the trivial solution.
+    if (a - b < 1e-6) return false;
+    if (fabs(da) < fraccuracy && fabs(db) < fraccuracy) {
+      *nl_ptr = exp(a);
+      *nv_ptr = exp(b);
+      *mu_ptr = find_chemical_potential(f, kT, *nl_ptr);
+      return true;
+    }
+  }
+  return false;
+}
+
+int saturated_liquid_vapor_batch(const Functional &f, const VectorXd &kT,
+                                 VectorXd *nl, VectorXd *nv, VectorXd *mu,
+                                 const double fraccuracy) {
+  const int N = kT.rows();
+  VectorXd a = nl->cwise().log(), b = nv->cwise().log();
+  VectorXd mul, pl, muv, pv, mup, pp, mum, pm;
+  VectorXd dmul, dpl, dmuv, dpv;
+  std::vector<bool> done(N, false), failed(N, false);
+  const double h = newton_dlogn;
+  for (int i=0; i<N; i++) failed[i] = !(a[i] > b[i]);
+  for (int iter=0; iter<50; iter++) {
+    chemical_potential_and_pressure(f, kT, a.cwise().exp(), &mul, &pl);
+    chemical_potential_and_pressure(f, kT, b.cwise().exp(), &muv, &pv);
+    chemical_potential_and_pressure(f, kT, (a.cwise() + h).cwise().exp(), &mup, &pp);
+    chemical_potential_and_pressure(f, kT, (a.cwise() - h).cwise().exp(), &mum, &pm);
+    dmul = (mup - mum)/(2*h);
+    dpl = (pp - pm)/(2*h);
+    chemical_potential_and_pressure(f, kT, (b.cwise() + h).cwise().exp(), &mup, &pp);
+    chemical_potential_and_pressure(f, kT, (b.cwise() - h).cwise().exp(), &mum, &pm);
+    dmuv = (mup - mum)/(2*h);
+    dpv = (pp - pm)/(2*h);
+
+    bool all_done = true;
+    for (int i=0; i<N; i++) {
+      if (done[i] || failed[i]) continue;
+      const double det = -dmul[i]*dpv[i] + dmuv[i]*dpl[i];
+      double da = (-(mul[i] - muv[i])*(-dpv[i]) + dmuv[i]*(-(pl[i] - pv[i])))/det;
+      double db = (dmul[i]*(-(pl[i] - pv[i])) - dpl[i]*(-(mul[i] - muv[i])))/det;
+      const double biggest = std::max(fabs(da), fabs(db));
+      if (biggest > 0.5) {
+        da *= 0.5/biggest;
+        db *= 0.5/biggest;
+      }
+      a[i] += da;
+      b[i] += db;
+      if (da != da || db != db || a[i] - b[i] < 1e-6) failed[i] = true;
+      else if (fabs(da) < fraccuracy && fabs(db) < fraccuracy) done[i] = true;
+      else all_done = false;
+    }
+    if (all_done) break;
+  }
+  *nl = a.cwise().exp();
+  *nv = b.cwise().exp();
+  *mu = find_chemical_potential(f, kT, *nl);
+  int num_failed = 0;
+  for (int i=0; i<N; i++) {
+    if (!done[i]) {
+      (*nl)[i] = (*nv)[i] = (*mu)[i] = NAN;
+      num_failed++;
+    }
+  }
+  return num_failed;
+}
+
+// The curve tracers split the temperatures into one contiguous run
+// per thread, since each point is started from the previous one.
+struct CurveWork {
+  const Functional *f;
+  const VectorXd *kT;
+  double nmin, ncrit, nmax;
+  VectorXd *nl, *nv, *mu;
+};
+
+static void trace_binodal(CurveWork *w, int start, int end) {
+  const Functional &f = *w->f;
+  bool have_guess = false;
+  for (int i=start; i<end; i++) {
+    const double kT = (*w->kT)[i];
+    double nl = NAN, nv = NAN, mu = NAN;
+    if (have_guess) {
+      nl = (*w->nl)[i-1];
+      nv = (*w->nv)[i-1];
+      if (i-2 >= start && (*w->nl)[i-2] == (*w->nl)[i-2]) {
+        // Extrapolate linearly from the previous two temperatures.
+        const double ratio = (kT - (*w->kT)[i-1])/((*w->kT)[i-1] - (*w->kT)[i-2]);
+        nl += ratio*(nl - (*w->nl)[i-2]);
+        nv += ratio*(nv - (*w->nv)[i-2]);
+      }
+      if (!saturated_liquid_vapor_newton(f, kT, &nl, &nv, &mu)) {
+        nl = (*w->nl)[i-1];
+        nv = (*w->nv)[i-1];
+        saturated_liquid_vapor(f, kT, w->nmin, w->ncrit, w->nmax, &nl, &nv, &mu);
+      }
+    } else {
+      saturated_liquid_vapor(f, kT, w->nmin, w->ncrit, w->nmax, &nl, &nv, &mu);
+    }
+    // Above the critical temperature the two "phases" come out the
+    // same, which is no coexistence at all.
+    if (!(fabs(nl - nv) > 1e-6*nl)) nl = nv = mu = NAN;
+    (*w->nl)[i] = nl;
+    (*w->nv)[i] = nv;
+    (*w->mu)[i] = mu;
+    have_guess = (nl == nl);
+  }
+}
+
+// dmu_by_dlogn is positive wherever the homogeneous fluid is
+// unstable, given the sign convention of find_chemical_potential.
+static double dmu_by_dlogn(const Functional &f, double kT, double n) {
+  const double h = newton_dlogn;
+  return (find_chemical_potential(f, kT, n*exp(h)) -
+          find_chemical_potential(f, kT, n*exp(-h)))/(2*h);
+}
+
+static double find_spinodal(const Functional &f, double kT, double nstable, double nunstable) {
+  if (!(dmu_by_dlogn(f, kT, nunstable) > 0)) return NAN;
+  if (dmu_by_dlogn(f, kT, nstable) > 0) return NAN;
+  while (fabs(log(nstable/nunstable)) > 1e-12) {
+    const double ntry = sqrt(nstable*nunstable);
+    if (dmu_by_dlogn(f, kT, ntry) > 0) nunstable = ntry;
+    else nstable = ntry;
+  }
+  return sqrt(nstable*nunstable);
+}
+
+static void trace_spinodal(CurveWork *w, int start, int end) {
+  for (int i=start; i<end; i++) {
+    const double kT = (*w->kT)[i];
+    (*w->nl)[i] = find_spinodal(*w->f, kT, w->nmax, w->ncrit);
+    (*w->nv)[i] = find_spinodal(*w->f, kT, w->nmin, w->ncrit);
+  }
+}
+
+static void trace_in_threads(void (*trace)(CurveWork *, int, int), CurveWork *w,
+                             int num_threads) {
+  const int N = w->kT->rows();
+  if (num_threads <= 0) num_threads = std::thread::hardware_concurrency();
+  if (num_threads <= 0) num_threads = 1;
+  if (num_threads > N) num_threads = N;
+  if (num_threads < 1) return;
+  std::vector<std::thread> threads;
+  for (int t=1; t<num_threads; t++) {
+    threads.push_back(std::thread(trace, w, t*N/num_threads, (t+1)*N/num_threads));
+  }
+  trace(w, 0, N/num_threads);
+  for (unsigned t=0; t<threads.size(); t++) threads[t].join();
+}
+
+void binodal(const Functional &f, const VectorXd &kT,
+             double nmin, double ncrit, double nmax,
+             VectorXd *nl, VectorXd *nv, VectorXd *mu, int num_threads) {
+  nl->resize(kT.rows());
+  nv->resize(kT.rows());
+  mu->resize(kT.rows());
+  CurveWork w = { &f, &kT, nmin, ncrit, nmax, nl, nv, mu };
+  trace_in_threads(trace_binodal, &w, num_threads);
+}
+
+void spinodal(const Functional &f, const VectorXd &kT,
+              double nmin, double ncrit, double nmax,
+              VectorXd *nl, VectorXd *nv, int num_threads) {
+  nl->resize(kT.rows());
+  nv->resize(kT.rows());
+  CurveWork w = { &f, &kT, nmin, ncrit, nmax, nl, nv, 0 };
+  trace_in_threads(trace_spinodal, &w, num_threads);
+}
+
 void saturated_liquid_properties(Functional f, LiquidProperties *prop) {
   double mu;
   saturated_liquid_vapor(f, prop->kT,
@@ -406,12 +643,20 @@ void other_equation_of_state(FILE *o, Functional f, double kT, double nmin, doub
 
 void equation_of_state(FILE *o, Functional f, double kT, double nmin, double nmax) {
   const double factor = 1.04;
-  for (double ngoal=nmin; ngoal<nmax; ngoal *= factor) {
-    double V = -kT*log(ngoal);
-    double p = pressure(f, kT, ngoal);
-    double der = -f.derive(kT, V)*kT/ngoal;
-    //printf("Got ngoal of %g but mu is %g\n", ngoal, mu);
-    double e = f(kT, V);
-    fprintf(o, "%g\t%g\t%g\t%g\n", ngoal, p, e, der);
+  int N = 0;
+  for (double ngoal=nmin; ngoal<nmax; ngoal *= factor) N++;
+  // We evaluate every density in one batch, which is much cheaper
+  // than walking the functional once per density.
+  VectorXd n(N);
+  N = 0;
+  for (double ngoal=nmin; ngoal<nmax; ngoal *= factor) n[N++] = ngoal;
+  const VectorXd kTs = kT*VectorXd::Ones(N);
+  const VectorXd V = -kT*n.cwise().log();
+  const VectorXd e = f.transform_batch(kTs, V);
+  const VectorXd der = (-kT*f.derive_batch(kTs, V)).cwise()/n;
+  for (int i=0; i<N; i++) {
+    // p = n df/dn - f = -kT df/dVeff - f
+    const double p = der[i]*n[i] - e[i];
+    fprintf(o, "%g\t%g\t%g\t%g\n", n[i], p, e[i], der[i]);
   }
 }
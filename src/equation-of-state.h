@@ -19,11 +19,17 @@ static const double atmospheric_pressure = 101325*3.3989316e-14; // in Hartree/b
 double surface_tension(Minimizer min, Functional f, LiquidProperties prop,
                        bool verbose, const char *plotname=0);
 
-double find_density(Functional f, double kT, double nmin, double nmax);
-double pressure(Functional f, double kT, double density);
+double find_density(const Functional &f, double kT, double nmin, double nmax);
+double pressure(const Functional &f, double kT, double density);
 double pressure_to_density(Functional f, double kT, double p,
                            double nmin = 1e-10, double nmax = 1e-2);
-double find_chemical_potential(Functional f, double kT, double n);
+double find_chemical_potential(const Functional &f, double kT, double n);
+
+// The batched pressure and chemical potential evaluate the
+// homogeneous functional at density n[i] and temperature kT[i] for
+// every i in a single pass over the functional.
+VectorXd pressure(const Functional &f, const VectorXd &kT, const VectorXd &density);
+VectorXd find_chemical_potential(const Functional &f, const VectorXd &kT, const VectorXd &n);
 
 double chemical_potential_to_density(Functional f, double kT, double mu,
                                      double nmin = 1e-10, double nmax = 1e-2);
@@ -32,10 +38,41 @@ double saturated_liquid(Functional f, double kT,
                         double vapor_liquid_ratio = 0.5);
 double coexisting_vapor_density(Functional f, double kT, double liquid_density,
                                 double vapor_liquid_ratio = 0.5);
-void saturated_liquid_vapor(Functional f, double kT, double nmin, double ncrit, double nmax,
+void saturated_liquid_vapor(const Functional &f, double kT, double nmin, double ncrit, double nmax,
                             double *nl_ptr, double *nv_ptr, double *mu_ptr,
                             const double fraccuracy = 1e-13);
 
+// saturated_liquid_vapor_newton refines a nearby guess for the
+// coexisting liquid and vapor densities using Newton's method on the
+// equal-mu and equal-pressure conditions.  It is much faster than
+// saturated_liquid_vapor when the guess is good (e.g. from a nearby
+// temperature), but returns false (leaving the guess untouched) if
+// it fails to converge, in which case you should fall back on the
+// bisection.
+bool saturated_liquid_vapor_newton(const Functional &f, double kT,
+                                   double *nl_ptr, double *nv_ptr, double *mu_ptr,
+                                   const double fraccuracy = 1e-13);
+// This does the same Newton iteration for many temperatures at once,
+// starting from the guesses in nl and nv.  Temperatures that fail to
+// converge are set to NaN, and their number is returned.
+int saturated_liquid_vapor_batch(const Functional &f, const VectorXd &kT,
+                                 VectorXd *nl, VectorXd *nv, VectorXd *mu,
+                                 const double fraccuracy = 1e-13);
+
+// binodal traces the coexistence curve over the temperatures kT,
+// splitting them into contiguous runs for num_threads threads (zero
+// means one per core).  Each run starts with a bisection and then
+// continues with Newton's method from the previous temperature.
+// Temperatures above the critical point come out as NaN.
+void binodal(const Functional &f, const VectorXd &kT,
+             double nmin, double ncrit, double nmax,
+             VectorXd *nl, VectorXd *nv, VectorXd *mu, int num_threads = 0);
+// spinodal finds the liquid and vapor densities at which dmu/dn
+// vanishes, assuming ncrit lies between them.
+void spinodal(const Functional &f, const VectorXd &kT,
+              double nmin, double ncrit, double nmax,
+              VectorXd *nl, VectorXd *nv, int num_threads = 0);
+
 void saturated_liquid_properties(Functional f, LiquidProperties *prop);
 
 void equation_of_state(FILE *o, Functional f, double kT, double nmin, double nmax);
@@ -101,7 +101,7 @@ classCode ewithtransforms arg n = "class " ++ n ++ " : public FunctionalInterfac
       mktransforms _ (z:_) _ = error ("Not a transform: " ++ show z)
 
 generateHeader :: Expression RealSpace -> [String] -> String -> String
-generateHeader e arg n = "// -*- mode: C++; -*-\n\n#include \"MinimalFunctionals.h\"\n#include \"utilities.h\"\n#include \"handymath.h\"\n\n" ++
+generateHeader e arg n = "// -*- mode: C++; -*-\n\n#include \"MinimalFunctionals.h\"\n#include \"utilities.h\"\n#include \"handymath.h\"\n#include \"VectorMath.h\"\n\n" ++
                      classCode e arg (n ++ "_type") ++
                      "\n\nFunctional " ++ n ++"(" ++ codeA arg ++ ") {\n\treturn Functional(new " ++ n ++ "_type(" ++ codeA' arg ++ "), \"" ++ n ++ "\");\n}\n"
     where codeA [] = ""
@@ -276,6 +276,7 @@ defineFunctional e arg n =
            "#include \"MinimalFunctionals.h\"",
            "#include \"utilities.h\"",
            "#include \"handymath.h\"",
+           "#include \"VectorMath.h\"",
            "",
            "",
            scalarClass e arg (n ++ "_type"),
@@ -405,6 +406,7 @@ defineFunctionalNoGradient e arg n =
            "#include \"MinimalFunctionals.h\"",
            "#include \"utilities.h\"",
            "#include \"handymath.h\"",
+           "#include \"VectorMath.h\"",
            "",
            "",
            scalarClassNoGradient e arg (n ++ "_type"),
@@ -517,6 +519,7 @@ defineTransformation e arg n =
            "#include \"MinimalFunctionals.h\"",
            "#include \"utilities.h\"",
            "#include \"handymath.h\"",
+           "#include \"VectorMath.h\"",
            "",
            "",
            transformationClass e arg (n ++ "_type"),
@@ -712,18 +712,17 @@ instance Type Scalar where
   zeroHelper v (Summate e) = summate (setZero v e)
   codeStatementHelper a " = " (Var _ _ _ _ (Just e)) = codeStatementHelper a " = " e
   codeStatementHelper a " = " (Expression (Summate e)) =
-    code a ++ " = 0;\n\tfor (int i=0; i<gd.NxNyNz; i++) {\n\t\t" ++
-    code a ++ " += " ++ code e ++
-    ";\n\t}\n"
+    code a ++ " = grid_sum_of(gd.NxNyNz, [&](long i) {\n\t\treturn " ++ code e ++
+    ";\n\t});\n"
   codeStatementHelper _ op (Expression (Summate _)) = error ("Haven't implemented "++op++" for integrate...")
   codeStatementHelper a op e = code a ++ op ++ code e ++ ";"
 
   newcodeStatementHelper a " = " (Var _ _ _ _ (Just e)) = newcodeStatementHelper a " = " e
   newcodeStatementHelper a " = " (Expression (Summate e)) =
-    newcode a ++ " = 0;\n\tfor (int i=0; i<Nx*Ny*Nz; i++) {\n" ++
+    newcode a ++ " = grid_sum_of(long(Nx*Ny*Nz), [&](long i) {\n" ++
     unlines initialize_position ++
-    "\t\t"++ newcode a ++ " += " ++ newcode e ++
-    ";\n\t}\n"
+    "\t\treturn " ++ newcode e ++
+    ";\n\t});\n"
     where initialize_position =
               if hasexpression (Expression Rx) e || hasexpression (Expression Ry) e || hasexpression (Expression Rz) e
               then ["\t\tint _z = i % int(Nz);",
@@ -1057,9 +1056,9 @@ instance (Type a, Code a) => Code (Expression a) where
   codePrec _ (F Cos x) = showString "cos(" . codePrec 0 x . showString ")"
   codePrec _ (F Sin x) = showString "sin(" . codePrec 0 x . showString ")"
   codePrec _ (F Erfi x) = showString "erfi(" . codePrec 0 x . showString ")"
-  codePrec _ (F Exp x) = showString "exp(" . codePrec 0 x . showString ")"
-  codePrec _ (F Erf x) = showString "erf(" . codePrec 0 x . showString ")"
-  codePrec _ (F Log x) = showString "log(" . codePrec 0 x . showString ")"
+  codePrec _ (F Exp x) = showString "vm_exp(" . codePrec 0 x . showString ")"
+  codePrec _ (F Erf x) = showString "vm_erf(" . codePrec 0 x . showString ")"
+  codePrec _ (F Log x) = showString "vm_log(" . codePrec 0 x . showString ")"
   codePrec _ (F Abs x) = showString "fabs(" . codePrec 0 x . showString ")"
   codePrec _ (F Signum _) = undefined
   codePrec _ (Product p i) | Product p i == 1 = showString "1.0"
@@ -1104,9 +1103,9 @@ instance (Type a, Code a) => Code (Expression a) where
   newcodePrec _ (F Cos x) = showString "cos(" . newcodePrec 0 x . showString ")"
   newcodePrec _ (F Sin x) = showString "sin(" . newcodePrec 0 x . showString ")"
   newcodePrec _ (F Erfi x) = showString "erfi(" . newcodePrec 0 x . showString ")"
-  newcodePrec _ (F Exp x) = showString "exp(" . newcodePrec 0 x . showString ")"
-  newcodePrec _ (F Erf x) = showString "erf(" . newcodePrec 0 x . showString ")"
-  newcodePrec _ (F Log x) = showString "log(" . newcodePrec 0 x . showString ")"
+  newcodePrec _ (F Exp x) = showString "vm_exp(" . newcodePrec 0 x . showString ")"
+  newcodePrec _ (F Erf x) = showString "vm_erf(" . newcodePrec 0 x . showString ")"
+  newcodePrec _ (F Log x) = showString "vm_log(" . newcodePrec 0 x . showString ")"
   newcodePrec _ (F Abs x) = showString "fabs(" . newcodePrec 0 x . showString ")"
   newcodePrec _ (F Signum _) = undefined
   newcodePrec _ (Product p i) | Product p i == 1 = showString "1.0"
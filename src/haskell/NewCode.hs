@@ -37,6 +37,7 @@ create3dHeader e0 n =
    "#include \"new/NewFunctional.h\"",
    "#include \"utilities.h\"",
    "#include \"handymath.h\"",
+   "#include \"VectorMath.h\"",
    "",
    "#pragma GCC diagnostic ignored \"-Wunused-variable\"",
    "class " ++ n ++ " : public NewFunctional {",
@@ -88,6 +89,7 @@ create0dHeader e0 n =
    "#include \"new/NewFunctional.h\"",
    "#include \"utilities.h\"",
    "#include \"handymath.h\"",
+   "#include \"VectorMath.h\"",
    "",
    "",
    "class " ++ n ++ " : public NewFunctional {",
@@ -7,6 +7,8 @@
 #include <string.h>
 #include <math.h>
 
+#include "utilities.h"
+
 
 // A ComplexVector is a reference-counted array of std::complex<double>s.
 // You need to be careful, because a copy of a ComplexVector (or the
@@ -32,12 +34,12 @@ class Vector;
 
 class ComplexVector {
 public:
-  ComplexVector() : size(0), offset(0), data(0), references_count(0) {}
-  explicit ComplexVector(long sz) : size(sz), offset(0), data(new std::complex<double>[size]),
+  ComplexVector() : size(0), offset(0), allocated(0), data(0), references_count(0) {}
+  explicit ComplexVector(long sz) : size(sz), offset(0), allocated(sz), data(new_data(sz)),
                                    references_count(new int) {
     *references_count = 1;
   }
-  ComplexVector(const ComplexVector &a) : size(a.size), offset(a.offset),
+  ComplexVector(const ComplexVector &a) : size(a.size), offset(a.offset), allocated(a.allocated),
                             data(a.data), references_count(a.references_count) {
     *references_count += 1;
   }
@@ -46,13 +48,14 @@ public:
     if (references_count && *references_count) {
       *references_count -= 1;
       if (*references_count == 0) {
-        delete[] data;
+        field_free(data, allocated*sizeof(std::complex<double>));
         delete references_count;
       }
       references_count = 0;
       data = 0;
       size = 0;
       offset = 0;
+      allocated = 0;
     }
   }
   void operator=(const ComplexVector &a) {
@@ -61,6 +64,7 @@ public:
     if (!references_count) {
       size = a.size;
       offset = a.offset;
+      allocated = a.allocated;
       data = a.data;
       references_count = a.references_count;
       *references_count += 1;
@@ -92,6 +96,7 @@ public:
     out.size = num;
     out.data = data;
     out.offset = start;
+    out.allocated = allocated;
     out.references_count = references_count;
     (*references_count) += 1;
     return out;
@@ -238,7 +243,11 @@ public:
   }
 
 private:
-  long size, offset;
+  // new_data gets aligned (and possibly pooled) memory from
+  // field_malloc, which is why we have to remember how many elements
+  // we allocated, since a slice may be the last to let go of it.
+  static std::complex<double> *new_data(long sz) { return (std::complex<double> *)field_malloc(sz*sizeof(std::complex<double>)); }
+  long size, offset, allocated;
   std::complex<double> *data;
   int *references_count; // counts how many objects refer to the data.
   friend Vector ifft(long Nx, long Ny, long Nz, double dV, ComplexVector f);
@@ -7,6 +7,34 @@ inline bool better(double a, double b) {
 }
 
 bool Minimize::improve_energy(Verbosity v) {
+  if (!in_single_precision) return improve_energy_at_this_precision(v);
+
+  const FFTPrecision old_precision = fft_precision();
+  fft_precision() = single_precision_fft;
+  const bool keep_going = improve_energy_at_this_precision(v);
+  const double E = energy(v); // computed (and cached) in single precision
+  fft_precision() = old_precision;
+  if (keep_going && !(error_estimate < single_precision_until*fabs(E))) return true;
+  if (iter >= maxiter) return false;
+
+  // Either we are converged as far as single precision allows, or we
+  // have given up on improving in single precision.  Either way, it
+  // is time to switch to double precision.  The cached energy and
+  // the convergence history all have single-precision errors, so we
+  // throw them away.
+  if (v >= verbose) {
+    printf("Switching to double precision FFTs with error estimate %g after %d iterations.\n",
+           error_estimate, iter);
+  }
+  in_single_precision = false;
+  invalidate_cache();
+  deltaE = 0;
+  dEdn = 0;
+  log_dEdn_ratio_average = 0;
+  return true;
+}
+
+bool Minimize::improve_energy_at_this_precision(Verbosity v) {
   iter++;
   if (iter >= maxiter) {
     if (v >= verbose) {
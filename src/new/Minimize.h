@@ -4,6 +4,7 @@
 
 #include "new/NewFunctional.h"
 #include "handymath.h"
+#include "Profiler.h"
 #include <stdio.h>
 #include <math.h>
 #include <time.h>
@@ -38,6 +39,9 @@ public:
     dEdn = 0;
     log_dEdn_ratio_average = 0;
     error_estimate = 0;
+
+    single_precision_until = 0;
+    in_single_precision = false;
   }
   ~Minimize() {
     invalidate_cache();
@@ -47,6 +51,7 @@ public:
     iter = 0;
     num_energy_calcs = 0;
     num_grad_calcs = 0;
+    in_single_precision = single_precision_until > 0;
     invalidate_cache();
   }
 
@@ -79,6 +84,20 @@ public:
   void check_conjugacy(bool u) {
     do_check_conjugacy = u;
   }
+  // set_single_precision_until makes the minimizer use single
+  // precision FFTs until its error estimate drops below relerr times
+  // the energy, at which point it switches to double precision for
+  // the rest of the minimization.  Since single precision is good to
+  // about 1e-7, something like 1e-5 is a reasonable choice.  Zero
+  // (the default) means always use double precision.
+  void set_single_precision_until(double relerr) {
+    single_precision_until = relerr;
+    in_single_precision = relerr > 0;
+    invalidate_cache();
+  }
+  bool using_single_precision() const {
+    return in_single_precision;
+  }
 
   // improve_energy returns false if the energy is fully converged
   // (i.e. it didn't improve), and there is no reason to call this
@@ -96,7 +115,10 @@ public:
     if (last_energy == 0) {
       const clock_t start = clock();
 
-      last_energy = new double(f->energy());
+      {
+        ProfileScope profile(typeid(*f), "energy");
+        last_energy = new double(f->energy());
+      }
       if (v >= louder(min_details)) { // we need to get really paranoid before we print each energy...
         const clock_t end = clock();
         if (end > start + 10) {
@@ -117,7 +139,10 @@ public:
     if (!last_grad.get_size()) {
       /* We need to compute the gradient because we don't already have its value cached. */
       const clock_t start = clock();
-      last_grad = f->grad();
+      {
+        ProfileScope profile(typeid(*f), "grad");
+        last_grad = f->grad();
+      }
       if (v >= louder(min_details)) { // we need to get really paranoid before we print each grad...
         const clock_t end = clock();
         if (end > start + 10) {
@@ -138,6 +163,7 @@ public:
       if (use_preconditioning && f->have_preconditioner()) {
         invalidate_cache();
         const clock_t start = clock();
+        ProfileScope profile(typeid(*f), "energy_grad_and_precond");
         EnergyGradAndPrecond foo = f->energy_grad_and_precond();
         if (v >= louder(min_details)) { // we need to get really paranoid before we print each energy...
           const clock_t end = clock();
@@ -177,6 +203,10 @@ public:
     return step;
   }
 private:
+  // This does the actual work of improve_energy, at whatever FFT
+  // precision is current.
+  bool improve_energy_at_this_precision(Verbosity verbose);
+
   NewFunctional *f;
   int iter, maxiter, miniter;
 
@@ -195,5 +225,7 @@ private:
 
   double precision, relative_precision, deltaE, dEdn, log_dEdn_ratio_average;
   double error_estimate;
+  double single_precision_until;
+  bool in_single_precision;
   double known_true_energy; // used for checking how well the minimization is working
 };
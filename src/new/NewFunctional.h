@@ -30,6 +30,7 @@ public:
     data = Vector();
   }
   NewFunctional(const NewFunctional &o) : data(o.data) {}
+  virtual ~NewFunctional() {}
   void operator=(const NewFunctional &o) {
     data = o.data;
   }
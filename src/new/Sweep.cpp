@@ -0,0 +1,122 @@
+#include "new/Sweep.h"
+#include <stdlib.h>
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+struct SweepResult {
+  double energy;
+  int iterations;
+  char *text; // the output for this point, as written by SweepProblem::output
+  size_t textsize;
+};
+
+struct SweepWork {
+  const SweepProblem *problem;
+  const Vector *kTs;
+  std::vector<double> xs;
+  std::vector<SweepResult> results;
+  std::atomic<long> next_branch;
+  Verbosity verbose;
+};
+
+static void sweep_branch(SweepWork *w, long iT) {
+  const double kT = (*w->kTs)[iT];
+  const long nx = w->xs.size();
+  NewFunctional *f = 0;
+  for (long ix=0; ix<nx; ix++) {
+    const double x = w->xs[ix];
+    if (f) w->problem->update(f, kT, x);
+    else f = w->problem->create(kT, x);
+
+    Minimize min(f);
+    w->problem->configure(&min);
+    while (min.improve_energy(w->verbose)) {
+    }
+    SweepResult &r = w->results[iT*nx + ix];
+    r.energy = min.energy();
+    r.iterations = min.get_iteration_count();
+    r.text = 0;
+    r.textsize = 0;
+    FILE *o = open_memstream(&r.text, &r.textsize);
+    if (o) {
+      w->problem->output(o, f, kT, x);
+      fclose(o);
+    }
+    if (w->verbose >= verbose) {
+      printf("sweep: kT = %g  x = %g  energy = %.16g after %d iterations\n",
+             kT, x, r.energy, r.iterations);
+      fflush(stdout);
+    }
+    if (r.energy != r.energy) {
+      // A NaN is a lousy initial guess, so start the next point on
+      // this branch from scratch.
+      delete f;
+      f = 0;
+    }
+  }
+  delete f;
+}
+
+static void sweep_worker(SweepWork *w) {
+  const long nT = w->kTs->get_size();
+  for (long iT = w->next_branch++; iT < nT; iT = w->next_branch++) {
+    sweep_branch(w, iT);
+  }
+}
+
+int sweep(const SweepProblem &problem, const Vector &kTs, const Vector &xs,
+          const char *fname, int num_threads, Verbosity v) {
+  SweepWork w;
+  w.problem = &problem;
+  w.kTs = &kTs;
+  for (long i=0; i<xs.get_size(); i++) w.xs.push_back(xs[i]);
+  // We walk each branch from low to high x, since a dilute density is
+  // the safest place for a cold start.
+  std::sort(w.xs.begin(), w.xs.end());
+  const long nT = kTs.get_size(), nx = w.xs.size();
+  w.results.resize(nT*nx);
+  w.next_branch = 0;
+  w.verbose = v;
+
+  if (num_threads <= 0) num_threads = std::thread::hardware_concurrency();
+  if (num_threads <= 0) num_threads = 1;
+  if (num_threads > nT) num_threads = nT;
+  std::vector<std::thread> threads;
+  for (int i=1; i<num_threads; i++) threads.push_back(std::thread(sweep_worker, &w));
+  sweep_worker(&w); // this thread does its share, too
+  for (unsigned i=0; i<threads.size(); i++) threads[i].join();
+
+  FILE *o = fopen(fname, "w");
+  if (!o) {
+    fprintf(stderr, "error creating file %s\n", fname);
+    exit(1);
+  }
+  int failures = 0;
+  fprintf(o, "# sweep over %ld temperatures and %ld values of x\n", nT, nx);
+  fprintf(o, "# index\tkT\tx\tenergy\titerations\n");
+  for (long iT=0; iT<nT; iT++) {
+    for (long ix=0; ix<nx; ix++) {
+      const SweepResult &r = w.results[iT*nx + ix];
+      fprintf(o, "# %ld\t%g\t%g\t%.16g\t%d\n", iT*nx + ix, kTs[iT], w.xs[ix],
+              r.energy, r.iterations);
+      if (r.energy != r.energy) failures++;
+    }
+  }
+  // Each point is its own block, separated by two blank lines so that
+  // gnuplot's "index" picks out a single point.
+  for (long iT=0; iT<nT; iT++) {
+    for (long ix=0; ix<nx; ix++) {
+      const SweepResult &r = w.results[iT*nx + ix];
+      fprintf(o, "\n\n# index %ld: kT = %g  x = %g\n", iT*nx + ix, kTs[iT], w.xs[ix]);
+      if (r.text) {
+        fwrite(r.text, 1, r.textsize, o);
+        if (r.textsize && r.text[r.textsize-1] != '\n') fprintf(o, "\n");
+        free(r.text);
+      }
+    }
+  }
+  fclose(o);
+  return failures;
+}
@@ -0,0 +1,50 @@
+// -*- mode: C++; -*-
+
+#pragma once
+
+#include "new/Minimize.h"
+#include <stdio.h>
+
+// A SweepProblem describes how to minimize a NewFunctional at each
+// point of a grid of temperatures and densities (or chemical
+// potentials, or whatever your second parameter "x" means).  The
+// sweep function below walks along each temperature as a "branch",
+// warm-starting each minimization from the converged density of the
+// previous point on the branch, so you only pay for a cold start
+// once per temperature.
+
+// To use it, create a class with SweepProblem as its parent.  The
+// only subtle method is update, which must change the parameters of
+// a functional that has already been minimized at a neighboring
+// point, *without* touching its density (or Veff), which is the
+// whole point.
+
+class SweepProblem {
+public:
+  virtual ~SweepProblem() {}
+
+  // create allocates a brand new functional (with a sensible initial
+  // guess) at the given point.  This is called once per branch, and
+  // is where any expensive setup (external potentials, etc.) should
+  // go.
+  virtual NewFunctional *create(double kT, double x) const = 0;
+  // update moves an already-minimized functional to a new point,
+  // keeping its current density as the initial guess.
+  virtual void update(NewFunctional *f, double kT, double x) const = 0;
+  // configure lets you set precision, preconditioning, etc. on the
+  // minimizer used at each point.
+  virtual void configure(Minimize *) const {}
+  // output writes the results for a single point.  Each point ends
+  // up in its own block of the output file, so you can pick it out
+  // with gnuplot's "index" or numpy.
+  virtual void output(FILE *o, const NewFunctional *f, double kT, double x) const = 0;
+};
+
+// sweep minimizes problem at every (kT, x) pair and writes the
+// results to fname.  The x values are visited in increasing order
+// along each temperature branch, and the branches are divided among
+// num_threads worker threads (zero means use every core).  It
+// returns the number of points that failed to produce a finite
+// energy.
+int sweep(const SweepProblem &problem, const Vector &kTs, const Vector &xs,
+          const char *fname, int num_threads = 0, Verbosity v = quiet);
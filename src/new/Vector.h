@@ -7,8 +7,35 @@
 #include <math.h>
 #include <fftw3.h>
 #include <stdio.h>
+#include <stdlib.h>
+#include <mutex>
 
 #include "ComplexVector.h"
+#include "FieldFile.h"
+#include "Profiler.h"
+#include "Reduction.h"
+
+// The FFTW planner is not thread-safe (only fftw_execute is), so
+// every plan creation and destruction goes through this lock.  This
+// lets several minimizations run in separate threads while still
+// sharing the wisdom accumulated by whichever one planned first.
+inline std::mutex &fftw_planner_mutex() {
+  static std::mutex m;
+  return m;
+}
+
+// The precision of our FFTs can be lowered to single precision, which
+// roughly doubles their speed and halves the memory they need for
+// scratch space.  The fields themselves stay double, so this only
+// loses accuracy in the convolutions, which is fine far from the
+// minimum.  Minimize uses this for its early iterations (see
+// Minimize::set_single_precision_until).  The setting is per thread,
+// so that separate minimizations don't interfere with one another.
+enum FFTPrecision { double_precision_fft, single_precision_fft };
+inline FFTPrecision &fft_precision() {
+  static thread_local FFTPrecision p = double_precision_fft;
+  return p;
+}
 
 // A Vector is a reference-counted array of doubles.  You need to be
 // careful, because a copy of a Vector (or the use of assignment,
@@ -31,15 +58,15 @@
 
 class Vector {
 public:
-  Vector() : size(0), offset(0), data(0), references_count(0) {}
-  explicit Vector(long sz) : size(sz), offset(0), data(new double[size]), references_count(new int) {
+  Vector() : size(0), offset(0), allocated(0), data(0), references_count(0) {}
+  explicit Vector(long sz) : size(sz), offset(0), allocated(sz), data(new_data(sz)), references_count(new int) {
     *references_count = 1;
   }
-  Vector(const Vector &a) : size(a.size), offset(a.offset),
+  Vector(const Vector &a) : size(a.size), offset(a.offset), allocated(a.allocated),
                             data(a.data), references_count(a.references_count) {
     *references_count += 1;
   }
-  Vector(double x, double y, double z) : size(3), offset(0), data(new double[3]), references_count(new int) {
+  Vector(double x, double y, double z) : size(3), offset(0), allocated(3), data(new_data(3)), references_count(new int) {
     *references_count = 1;
     data[0] = x;
     data[1] = y;
@@ -50,13 +77,14 @@ public:
     if (references_count && *references_count) {
       *references_count -= 1;
       if (*references_count == 0) {
-        delete[] data;
+        field_free(data, allocated*sizeof(double));
         delete references_count;
       }
       references_count = 0;
       data = 0;
       size = 0;
       offset = 0;
+      allocated = 0;
     }
   }
   void operator=(const Vector &a) {
@@ -65,6 +93,7 @@ public:
     if (!references_count && a.size) {
       size = a.size;
       offset = a.offset;
+      allocated = a.allocated;
       data = a.data;
       references_count = a.references_count;
       *references_count += 1;
@@ -98,6 +127,7 @@ public:
     out.size = num;
     out.data = data;
     out.offset = start;
+    out.allocated = allocated;
     out.references_count = references_count;
     (*references_count) += 1;
     return out;
@@ -192,30 +222,19 @@ public:
       p1[i] /= a;
     }
   }
+  // sum, dot and norm add up in a fixed order (see Reduction.h), so
+  // they give the same answer however many threads we use.
   double sum() const {
-    const double *p1 = data + offset;
-    double out = 0;
-    for (long i=0; i<size; i++) {
-      out += p1[i];
-    }
-    return out;
+    return grid_sum(data + offset, size);
   }
   double dot(const Vector &a) const {
     assert(a.size == size);
-    double out = 0;
     const double *p1 = data + offset, *p2 = a.data + a.offset;
-    for (long i=0; i<size; i++) {
-      out += p1[i]*p2[i];
-    }
-    return out;
+    return grid_sum_of(size, [p1, p2](long i) { return p1[i]*p2[i]; });
   }
   double norm() const {
-    double out = 0;
     const double *p1 = data + offset;
-    for (long i=0; i<size; i++) {
-      out += p1[i]*p1[i];
-    }
-    return sqrt(out);
+    return sqrt(grid_sum_of(size, [p1](long i) { return p1[i]*p1[i]; }));
   }
   long get_size() const {
     return size;
@@ -306,8 +325,36 @@ public:
     }
     fclose(f);
   }
+  // save writes this Vector to a field file (see FieldFile.h), whose
+  // header must describe a grid with as many points as we have.
+  bool save(const char *fname, const FieldHeader &h) const {
+    assert(h.size() == size);
+    return write_field_file(fname, h, data + offset);
+  }
+  // mapped returns a Vector whose data is a field file mapped
+  // copy-on-write, so nothing is read until it is used, and changing
+  // the Vector does not change the file.  The file must not be
+  // overwritten while it is mapped.  It exits if the file can't be
+  // read.
+  static Vector mapped(const char *fname, FieldHeader *header = 0) {
+    FieldFile file;
+    if (!file.open(fname)) exit(1);
+    if (header) *header = file.header();
+    Vector out;
+    out.size = out.allocated = file.header().size();
+    if (out.size == 0) return out;
+    out.data = (double *)field_map_file(fname, field_header_bytes, out.size*sizeof(double));
+    if (!out.data) exit(1);
+    out.references_count = new int;
+    *out.references_count = 1;
+    return out;
+  }
 private:
-  long size, offset;
+  // new_data gets aligned (and possibly pooled) memory from
+  // field_malloc, which is why we have to remember how many elements
+  // we allocated, since a slice may be the last to let go of it.
+  static double *new_data(long sz) { return (double *)field_malloc(sz*sizeof(double)); }
+  long size, offset, allocated;
   double *data;
   int *references_count; // counts how many objects refer to the data.
   friend Vector ifft(long Nx, long Ny, long Nz, double dV, ComplexVector f);
@@ -329,6 +376,29 @@ inline ComplexVector fft(long Nx, long Ny, long Nz, double dV, Vector f) {
   assert(!(Ny&1)); // We want an even number of grid points in each direction.
   assert(!(Nz&1)); // We want an even number of grid points in each direction.
   ComplexVector out(Nx*Ny*(long(Nz)/2 + 1));
+  if (fft_precision() == single_precision_fft) {
+    const long N = Nx*Ny*Nz;
+    float *r = (float *)fftwf_malloc(N*sizeof(float));
+    fftwf_complex *c = (fftwf_complex *)fftwf_malloc(out.size*sizeof(fftwf_complex));
+    std::unique_lock<std::mutex> lock(fftw_planner_mutex());
+    // We own both arrays, so we can plan (trashing them) before
+    // filling in the input.
+    fftwf_plan p = fftwf_plan_dft_r2c_3d(Nx, Ny, Nz, r, c, FFTW_WISDOM_ONLY);
+    if (!p) p = fftwf_plan_dft_r2c_3d(Nx, Ny, Nz, r, c, FFTW_MEASURE);
+    lock.unlock();
+    const double *fp = f.data + f.offset;
+    for (long i=0; i<N; i++) r[i] = fp[i];
+    profile_fft();
+    fftwf_execute(p);
+    lock.lock();
+    fftwf_destroy_plan(p);
+    lock.unlock();
+    for (long i=0; i<out.size; i++) out.data[i] = std::complex<double>(dV*c[i][0], dV*c[i][1]);
+    fftwf_free(r);
+    fftwf_free(c);
+    return out;
+  }
+  std::unique_lock<std::mutex> lock(fftw_planner_mutex());
   fftw_plan p = fftw_plan_dft_r2c_3d(Nx, Ny, Nz, (double *)f.data+f.offset, (fftw_complex *)out.data, FFTW_WISDOM_ONLY);
   if (!p) {
     // It seems that fftw has not yet done enough measurement to make
@@ -343,8 +413,12 @@ inline ComplexVector fft(long Nx, long Ny, long Nz, double dV, Vector f) {
     // Now we will create the plan we actually use.
     p = fftw_plan_dft_r2c_3d(Nx, Ny, Nz, (double *)f.data+f.offset, (fftw_complex *)out.data, FFTW_WISDOM_ONLY);
   }
+  lock.unlock();
+  profile_fft();
   fftw_execute(p);
+  lock.lock();
   fftw_destroy_plan(p);
+  lock.unlock();
   out *= dV;
   return out;
 }
@@ -353,11 +427,37 @@ inline Vector ifft(long Nx, long Ny, long Nz, double dV, ComplexVector f) {
   assert(!(Nx&1)); // We want an even number of grid points in each direction.
   assert(!(Ny&1)); // We want an even number of grid points in each direction.
   assert(!(Nz&1)); // We want an even number of grid points in each direction.
+  if (fft_precision() == single_precision_fft) {
+    const long N = Nx*Ny*Nz;
+    fftwf_complex *c = (fftwf_complex *)fftwf_malloc(f.size*sizeof(fftwf_complex));
+    float *r = (float *)fftwf_malloc(N*sizeof(float));
+    std::unique_lock<std::mutex> lock(fftw_planner_mutex());
+    fftwf_plan p = fftwf_plan_dft_c2r_3d(Nx, Ny, Nz, c, r, FFTW_WISDOM_ONLY);
+    if (!p) p = fftwf_plan_dft_c2r_3d(Nx, Ny, Nz, c, r, FFTW_MEASURE);
+    lock.unlock();
+    const std::complex<double> *fp = f.data + f.offset;
+    for (long i=0; i<f.size; i++) {
+      c[i][0] = fp[i].real();
+      c[i][1] = fp[i].imag();
+    }
+    profile_fft();
+    fftwf_execute(p);
+    lock.lock();
+    fftwf_destroy_plan(p);
+    lock.unlock();
+    Vector out(N);
+    const double norm = 1.0/(N*dV);
+    for (long i=0; i<N; i++) out.data[i] = norm*r[i];
+    fftwf_free(c);
+    fftwf_free(r);
+    return out;
+  }
   // Allocate a scratch array, since FFTW always overwrites its input
   // when performing a c2r transform.
   fftw_complex *c = (fftw_complex *)fftw_malloc(Nx*Ny*(long(Nz)/2+2)*sizeof(fftw_complex));
   memcpy(c, f.data+f.offset, 2*f.size*sizeof(double)); // faster than manual loop?
   Vector out(Nx*Ny*Nz); // create output vector
+  std::unique_lock<std::mutex> lock(fftw_planner_mutex());
   fftw_plan p = fftw_plan_dft_c2r_3d(Nx, Ny, Nz, c, (double *)out.data, FFTW_WISDOM_ONLY);
   if (!p) {
     // We need measurements!
@@ -365,8 +465,12 @@ inline Vector ifft(long Nx, long Ny, long Nz, double dV, ComplexVector f) {
     // Now recopy data, which was trashed above
     memcpy(c, f.data+f.offset, 2*f.size*sizeof(double)); // faster than manual loop?
   }
+  lock.unlock();
+  profile_fft();
   fftw_execute(p);
+  lock.lock();
   fftw_destroy_plan(p);
+  lock.unlock();
   fftw_free(c);
   out *= 1.0/(Nx*Ny*Nz*dV);
   return out;
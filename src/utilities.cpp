@@ -16,6 +16,16 @@
 
 #include "utilities.h"
 
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/mman.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <atomic>
+#include <map>
+#include <mutex>
+#include <vector>
+
 #pragma GCC diagnostic push
 #if __GNUC__ > 5
 #pragma GCC diagnostic ignored "-Wignored-attributes"
@@ -24,8 +34,8 @@
 #include <Eigen/Core>
 #pragma GCC diagnostic pop
 
-long Eigen::djr_memused = 0;
-long Eigen::djr_mempeak = 0;
+std::atomic<long> Eigen::djr_memused(0);
+std::atomic<long> Eigen::djr_mempeak(0);
 
 long peak_memory() {
   return Eigen::djr_mempeak;
@@ -36,5 +46,245 @@ long current_memory() {
 }
 
 void reset_peak_memory() {
-  Eigen::djr_mempeak = Eigen::djr_memused;
+  Eigen::djr_mempeak = Eigen::djr_memused.load();
+}
+
+// Arrays smaller than this come straight from posix_memalign and go
+// straight back to free, since malloc handles them well.
+static const size_t field_pool_minimum = 64*1024;
+// Arrays at least this big are mmapped, and may use huge pages.
+static const size_t field_huge_page = 2*1024*1024;
+static const size_t field_alignment = 64;
+
+// field_size_class rounds a size up to the form m*2^k with m = 4, 5,
+// 6 or 7, so we waste at most a quarter of an array while letting
+// arrays of similar size share a pool.  Above field_pool_minimum this
+// is always a multiple of the page size.
+static size_t field_size_class(size_t bytes) {
+  size_t k = 1;
+  while (7*k < bytes) k *= 2;
+  for (size_t m=4; m<7; m++) if (m*k >= bytes) return m*k;
+  return 7*k;
+}
+
+struct FieldPool {
+  std::mutex lock;
+  std::map<size_t, std::vector<void *> > free_arrays;
+  long pooled, limit;
+  bool huge_pages;
+  // The arrays made by field_map_file, with the start and length of
+  // each mapping (which may begin before the array).
+  std::map<void *, std::pair<void *, size_t> > mapped_files;
+  std::atomic<long> num_mapped_files;
+  FieldPool() : pooled(0), num_mapped_files(0) {
+    const char *mb = getenv("DEFT_FIELD_POOL_MB");
+    limit = mb ? atol(mb)*1024*1024 : 1024L*1024*1024;
+    const char *huge = getenv("DEFT_HUGE_PAGES");
+    huge_pages = !huge || atol(huge) != 0;
+  }
+};
+
+static FieldPool &field_pool() {
+  static FieldPool *pool = new FieldPool(); // never destroyed, since Grids may outlive it
+  return *pool;
+}
+
+static void *field_allocate_fresh(size_t capacity, bool huge_pages) {
+  if (capacity < field_huge_page) {
+    void *ptr;
+    if (posix_memalign(&ptr, field_alignment, capacity)) return 0;
+    return ptr;
+  }
+  // We map an extra huge page so that we can trim the mapping down to
+  // one that starts on a huge page boundary.
+  const size_t extra = field_huge_page;
+  char *raw = (char *)mmap(0, capacity + extra, PROT_READ | PROT_WRITE,
+                           MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (raw == MAP_FAILED) return 0;
+  char *start = (char *)(((size_t)raw + extra - 1) & ~(extra - 1));
+  if (start > raw) munmap(raw, start - raw);
+  if (raw + extra > start) munmap(start + capacity, raw + extra - start);
+#ifdef MADV_HUGEPAGE
+  if (huge_pages) madvise(start, capacity, MADV_HUGEPAGE);
+#endif
+  return start;
+}
+
+static void field_release_fresh(void *ptr, size_t capacity) {
+  if (capacity < field_huge_page) free(ptr);
+  else munmap(ptr, capacity);
+}
+
+// These count the bytes handed out by field_malloc (but not the
+// mappings of field_map_file), for the profiler.
+static std::atomic<long> field_total_bytes(0), field_live_bytes(0), field_peak_bytes(0);
+
+static void *field_allocate(size_t bytes) {
+  if (bytes < field_pool_minimum) {
+    void *ptr;
+    if (posix_memalign(&ptr, field_alignment, bytes)) ptr = 0;
+    if (!ptr) {
+      printf("Out of memory allocating %lu bytes!\n", (unsigned long)bytes);
+      exit(1);
+    }
+    return ptr;
+  }
+  const size_t capacity = field_size_class(bytes);
+  FieldPool &pool = field_pool();
+  bool huge_pages;
+  {
+    std::lock_guard<std::mutex> guard(pool.lock);
+    std::vector<void *> &arrays = pool.free_arrays[capacity];
+    if (arrays.size()) {
+      void *ptr = arrays.back();
+      arrays.pop_back();
+      pool.pooled -= capacity;
+      return ptr;
+    }
+    huge_pages = pool.huge_pages;
+  }
+  void *ptr = field_allocate_fresh(capacity, huge_pages);
+  if (!ptr) {
+    // Perhaps the pool is hogging memory we need.
+    field_allocator_release();
+    ptr = field_allocate_fresh(capacity, huge_pages);
+  }
+  if (!ptr) {
+    printf("Out of memory allocating %lu bytes!\n", (unsigned long)bytes);
+    exit(1);
+  }
+  return ptr;
+}
+
+void *field_malloc(size_t bytes) {
+  if (bytes == 0) return 0;
+  void *ptr = field_allocate(bytes);
+  field_total_bytes += bytes;
+  const long live = field_live_bytes += bytes;
+  long peak = field_peak_bytes;
+  while (live > peak && !field_peak_bytes.compare_exchange_weak(peak, live)) {}
+  return ptr;
+}
+
+void field_free(void *ptr, size_t bytes) {
+  if (!ptr) return;
+  if (field_pool().num_mapped_files) {
+    // This might be a file mapping, which must not go in the pool.
+    FieldPool &pool = field_pool();
+    std::pair<void *, size_t> mapping(0, 0);
+    {
+      std::lock_guard<std::mutex> guard(pool.lock);
+      std::map<void *, std::pair<void *, size_t> >::iterator i = pool.mapped_files.find(ptr);
+      if (i != pool.mapped_files.end()) {
+        mapping = i->second;
+        pool.mapped_files.erase(i);
+        pool.num_mapped_files--;
+      }
+    }
+    if (mapping.first) {
+      munmap(mapping.first, mapping.second);
+      return;
+    }
+  }
+  field_live_bytes -= bytes;
+  if (bytes < field_pool_minimum) {
+    free(ptr);
+    return;
+  }
+  const size_t capacity = field_size_class(bytes);
+  FieldPool &pool = field_pool();
+  {
+    std::lock_guard<std::mutex> guard(pool.lock);
+    if (pool.pooled + long(capacity) <= pool.limit) {
+      pool.free_arrays[capacity].push_back(ptr);
+      pool.pooled += capacity;
+      return;
+    }
+  }
+  field_release_fresh(ptr, capacity);
+}
+
+void field_allocator_use_huge_pages(bool use_them) {
+  FieldPool &pool = field_pool();
+  std::lock_guard<std::mutex> guard(pool.lock);
+  pool.huge_pages = use_them;
+}
+
+void field_allocator_set_pool_limit(long bytes) {
+  FieldPool &pool = field_pool();
+  {
+    std::lock_guard<std::mutex> guard(pool.lock);
+    pool.limit = bytes;
+    if (pool.pooled <= bytes) return;
+  }
+  field_allocator_release();
+}
+
+long field_allocator_pooled_memory() {
+  FieldPool &pool = field_pool();
+  std::lock_guard<std::mutex> guard(pool.lock);
+  return pool.pooled;
+}
+
+long field_allocator_total_allocated() {
+  return field_total_bytes;
+}
+
+long field_allocator_memory_in_use() {
+  return field_live_bytes;
+}
+
+long field_allocator_peak_memory() {
+  return field_peak_bytes;
+}
+
+void field_allocator_set_peak_memory(long bytes) {
+  const long live = field_live_bytes;
+  field_peak_bytes = bytes > live ? bytes : live;
+}
+
+void field_allocator_release() {
+  FieldPool &pool = field_pool();
+  std::map<size_t, std::vector<void *> > arrays;
+  {
+    std::lock_guard<std::mutex> guard(pool.lock);
+    arrays.swap(pool.free_arrays);
+    pool.pooled = 0;
+  }
+  for (std::map<size_t, std::vector<void *> >::iterator i = arrays.begin(); i != arrays.end(); ++i) {
+    for (unsigned j=0; j<i->second.size(); j++) field_release_fresh(i->second[j], i->first);
+  }
+}
+
+// These are what Eigen's matrix storage uses (see ei_aligned_new in
+// include/Eigen/src/Core/util/Memory.h).
+void *Eigen::ei_field_malloc(std::size_t bytes) {
+  return field_malloc(bytes);
+}
+
+void Eigen::ei_field_free(void *ptr, std::size_t bytes) {
+  field_free(ptr, bytes);
+}
+
+void *field_map_file(const char *fname, long offset, size_t bytes) {
+  const int fd = open(fname, O_RDONLY);
+  if (fd < 0) {
+    printf("Unable to open %s!\n", fname);
+    return 0;
+  }
+  // mmap wants an offset that is a multiple of the page size.
+  const long page = sysconf(_SC_PAGESIZE);
+  const long skip = offset % page;
+  char *start = (char *)mmap(0, bytes + skip, PROT_READ | PROT_WRITE, MAP_PRIVATE,
+                             fd, offset - skip);
+  close(fd); // the mapping keeps the file open
+  if (start == MAP_FAILED) {
+    printf("Unable to map %s!\n", fname);
+    return 0;
+  }
+  FieldPool &pool = field_pool();
+  std::lock_guard<std::mutex> guard(pool.lock);
+  pool.mapped_files[start + skip] = std::make_pair((void *)start, bytes + skip);
+  pool.num_mapped_files++;
+  return start + skip;
 }
@@ -2,6 +2,58 @@
 
 #pragma once
 
+#include <stddef.h>
+
 long peak_memory();
 long current_memory();
 void reset_peak_memory();
+
+// field_malloc and field_free manage the big arrays that hold our
+// fields, both the Eigen vectors behind Grid and the data of the new
+// Vector and ComplexVector.  Every array is 64-byte aligned (a cache
+// line, and the width of an AVX-512 register).  Arrays of 2 MB or more
+// are mapped directly with mmap, aligned to 2 MB and marked with
+// madvise as candidates for transparent huge pages, which cuts down on
+// TLB misses when sweeping over a 256^3 grid.
+//
+// When a large array is freed, we keep it in a pool sorted by size
+// class rather than handing it back to the system, since the very
+// next thing we do is usually to allocate a temporary of the same
+// size.  The memory held in the pool is *not* counted by
+// current_memory or peak_memory, which count only arrays in use.
+//
+// field_free must be given the same number of bytes that was passed
+// to field_malloc.
+void *field_malloc(size_t bytes);
+void field_free(void *ptr, size_t bytes);
+
+// field_allocator_use_huge_pages turns the madvise on or off (it is on
+// unless the environment variable DEFT_HUGE_PAGES is set to 0).
+void field_allocator_use_huge_pages(bool use_them);
+// field_allocator_set_pool_limit sets how many bytes of freed arrays
+// we hold on to (by default 1 GB, or DEFT_FIELD_POOL_MB megabytes).
+// Setting it to zero turns off the pool.
+void field_allocator_set_pool_limit(long bytes);
+// field_allocator_pooled_memory returns the number of bytes sitting
+// idle in the pool, and field_allocator_release returns them all to
+// the system.
+long field_allocator_pooled_memory();
+void field_allocator_release();
+
+// These count the arrays of field_malloc (including those that come
+// from the pool), and are what the profiler uses: the total bytes
+// ever allocated, the bytes in use now, and the most that has been in
+// use at once.  field_allocator_set_peak_memory sets the peak to the
+// larger of bytes and what is in use now, so passing zero starts a
+// fresh measurement.
+long field_allocator_total_allocated();
+long field_allocator_memory_in_use();
+long field_allocator_peak_memory();
+void field_allocator_set_peak_memory(long bytes);
+
+// field_map_file maps bytes of the file fname, starting at offset,
+// as a private copy-on-write array: the file is read lazily as pages
+// are touched, and writes to the array never reach the file.  The
+// array may be freed with field_free (given the same bytes) like any
+// other.  It prints a message and returns 0 if the mapping fails.
+void *field_map_file(const char *fname, long offset, size_t bytes);
@@ -1,6 +1,6 @@
 #include "vector3d.h"
 
-Rand random::my_rand = Rand(0);
+thread_local Rand random::my_rand = Rand(0);
 unsigned long random::seedval = 0;
 
 vector3d vector3d::ran(double scale) {
@@ -12,7 +12,9 @@ vector3d vector3d::ran(double scale) {
   } while(r2 >= 1 || r2 == 0);
   double fac = scale*sqrt(-2*log(r2)/r2);
   vector3d out(x*fac, y*fac, 0);
-  static double extra_z = 0;
+  // Like the generator itself, the left-over z belongs to the thread,
+  // so that threads with their own streams stay independent.
+  static thread_local double extra_z = 0;
   if (extra_z) {
     // We have a z value left over from last time!
     out[2] = extra_z;
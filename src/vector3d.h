@@ -5,12 +5,20 @@
 
 #pragma once
 
+// Each thread has its own generator, so that threads never race on
+// it.  A new thread's generator starts out as if seeded with zero, so
+// each thread that wants its own stream should call seed_thread.
 struct random {
   static unsigned long seedval;
   static void seed(unsigned long seedme) {
     seedval = seedme;
     my_rand = Rand(seedval);
   }
+  // seed_thread seeds the calling thread's generator alone, leaving
+  // seedval (which describes the run as a whole) alone.
+  static void seed_thread(uint64_t seedme) {
+    my_rand = Rand(seedme);
+  }
   static double ran() {
     return my_rand.rand();
   }
@@ -36,7 +44,7 @@ struct random {
     return seedval;
   }
 private:
-  static Rand my_rand;
+  static thread_local Rand my_rand;
 };
 
 class vector3d {
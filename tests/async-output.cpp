@@ -0,0 +1,121 @@
+// Deft is a density functional package developed by the research
+// group of Professor David Roundy
+//
+// Copyright 2010 The Deft Authors
+//
+// Deft is free software; you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// You should have received a copy of the GNU General Public License
+// along with deft; if not, write to the Free Software Foundation,
+// Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+//
+// Please see the file AUTHORS for a list of authors.
+
+// This checks that async_output writes snapshots (not the live
+// grid) in order, that it doesn't hold more than its limit, that
+// async_output_flush waits for everything, that the memory count
+// stays right while grids are made and freed on both threads, and that
+// a write may itself ask for more output.
+
+#include <stdio.h>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "AsyncOutput.h"
+#include "utilities.h"
+
+int retval = 0;
+
+std::atomic<int> waiting(0), most_waiting(0);
+
+int main(int, char **argv) {
+  const Lattice lat(Cartesian(2,0,0), Cartesian(0,2,0), Cartesian(0,0,2));
+  GridDescription gd(lat, 0.1);
+  Grid g(gd);
+  const long bytes = gd.NxNyNz*sizeof(double);
+  // Room for three snapshots at a time.
+  async_output_set_limit(3*bytes);
+  const long memory_before = current_memory();
+
+  const int num = 20;
+  std::vector<double> written;
+  std::mutex written_lock;
+  for (int i=0; i<num; i++) {
+    g.setConstant(i);
+    const int now = ++waiting;
+    if (now > most_waiting) most_waiting = now;
+    async_output(g, [&](const Grid &snapshot) {
+        for (int j=0; j<100; j++) {
+          Grid doubled(snapshot);
+          doubled *= 2;
+        }
+        std::lock_guard<std::mutex> guard(written_lock);
+        written.push_back(snapshot.sum()/snapshot.rows());
+        waiting--;
+      });
+    g.setConstant(-1); // this must not show up in the output
+    for (int j=0; j<100; j++) {
+      Grid tripled(g);
+      tripled *= 3;
+    }
+  }
+  async_output_flush();
+  if (current_memory() != memory_before) {
+    printf("FAIL: we are using %ld bytes rather than %ld after the writes!\n",
+           current_memory(), memory_before);
+    retval++;
+  }
+
+  if (int(written.size()) != num) {
+    printf("FAIL: wrote %d snapshots rather than %d!\n", int(written.size()), num);
+    retval++;
+  }
+  for (int i=0; i<int(written.size()); i++) {
+    if (written[i] != i) {
+      printf("FAIL: snapshot %d came out as %g!\n", i, written[i]);
+      retval++;
+    }
+  }
+  // One more than the limit can be counted, since we count each one
+  // before it is queued.
+  printf("At most %d snapshots were waiting.\n", int(most_waiting));
+  if (most_waiting > 4) {
+    printf("FAIL: more than 3 snapshots were held at once!\n");
+    retval++;
+  }
+
+  // A write that asks for more output, when the queue is already
+  // full, must not wait for itself.
+  async_output_set_limit(bytes);
+  std::vector<int> order;
+  async_run(bytes, [&]() {
+      order.push_back(1);
+      async_output(g, [&](const Grid &) { order.push_back(2); });
+      async_output_flush();
+      order.push_back(3);
+    });
+  async_output_flush();
+  if (order.size() != 3 || order[0] != 1 || order[1] != 2 || order[2] != 3) {
+    printf("FAIL: the output asked for by a write was not written in place!\n");
+    retval++;
+  }
+
+  // This one is still waiting when main returns, so the exit handler
+  // has to wait for it.
+  async_run(0, []() {
+      std::this_thread::sleep_for(std::chrono::milliseconds(100));
+      printf("This was written at exit.\n");
+    });
+
+  if (retval == 0) {
+    printf("\n%s passes!\n", argv[0]);
+  } else {
+    printf("\n%s fails %d tests!\n", argv[0], retval);
+    return retval;
+  }
+}
@@ -0,0 +1,381 @@
+// Deft is a density functional package developed by the research
+// group of Professor David Roundy
+//
+// Copyright 2010 The Deft Authors
+//
+// Deft is free software; you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// You should have received a copy of the GNU General Public License
+// along with deft; if not, write to the Free Software Foundation,
+// Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+//
+// Please see the file AUTHORS for a list of authors.
+
+// This times the things we spend our time on: the energy, gradient
+// and preconditioned gradient of a functional, FFTs and a minimizer
+// step, for both the old (Functional) and new (NewFunctional) code at
+// several grid sizes, and Monte Carlo moves at several numbers of
+// balls.  Each benchmark is run several times, and we report the
+// median and the median absolute deviation (MAD) of the wall time,
+// along with a throughput in grid points (or moves) per second.
+//
+// Rather than keeping separate timings for each computer, every time
+// is also given relative to a fixed calibration loop that we time on
+// the spot, and it is that ratio which we compare against the baseline
+// in tests/bench/baseline.json.  So one baseline serves for any
+// machine, give or take the differences between processors, which is
+// what the tolerance is for.
+//
+// Usage: benchmark [--quick] [--filter TEXT] [--repeats N] [--tolerance FRACTION]
+//                  [--json FILE] [--baseline FILE] [--write-baseline]
+//
+// The tolerance (by default 0.5, or DEFT_BENCH_TOLERANCE) is the
+// fraction by which a relative time may exceed its baseline before we
+// call it a regression.  --write-baseline saves the current results as
+// the new baseline.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include <functional>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include "OptimizedFunctionals.h"
+#include "equation-of-state.h"
+#include "LineMinimizer.h"
+#include "new/WhiteBearFast.h"
+#include "new/Minimize.h"
+#include "Monte-Carlo/square-well.h"
+
+int retval = 0;
+
+struct BenchResult {
+  std::string name, unit;
+  int repeats;
+  double median, mad; // in seconds
+  double throughput; // units per second
+  double relative; // median over the calibration time
+};
+
+std::vector<BenchResult> results;
+double calibration_time = 0;
+int repeats = 7;
+const char *filter = 0;
+
+double wall_time() {
+  return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+double median(std::vector<double> x) {
+  std::sort(x.begin(), x.end());
+  const int n = x.size();
+  return n % 2 ? x[n/2] : 0.5*(x[n/2-1] + x[n/2]);
+}
+
+// time_it runs f once to warm up, and then times it the given number
+// of times, giving the median and MAD.
+void time_it(const std::function<void()> &f, int reps, double *med, double *mad) {
+  f();
+  std::vector<double> t(reps);
+  for (int i=0; i<reps; i++) {
+    const double start = wall_time();
+    f();
+    t[i] = wall_time() - start;
+  }
+  *med = median(t);
+  for (int i=0; i<reps; i++) t[i] = fabs(t[i] - *med);
+  *mad = median(t);
+}
+
+// calibrate times a fixed mix of arithmetic and memory traffic, which
+// is what our other times are measured in.
+double calibration_sink = 0;
+void calibrate() {
+  const long n = 1 << 22;
+  std::vector<double> a(n);
+  for (long i=0; i<n; i++) a[i] = 1.0/(i + 1);
+  double med, mad;
+  time_it([&]() {
+      double s = 0;
+      for (int r=0; r<10; r++) {
+        for (long i=0; i<n; i++) {
+          a[i] = a[i]*0.999 + 1e-3;
+          s += a[i];
+        }
+      }
+      calibration_sink += s;
+    }, 2*repeats + 1, &med, &mad);
+  calibration_time = med;
+  printf("Calibration loop takes %.4g s (MAD %.2g s)\n\n", med, mad);
+}
+
+void bench(const std::string &name, const char *unit, double units_per_run,
+           const std::function<void()> &f) {
+  if (filter && !strstr(name.c_str(), filter)) return;
+  BenchResult r;
+  r.name = name;
+  r.unit = unit;
+  r.repeats = repeats;
+  time_it(f, repeats, &r.median, &r.mad);
+  r.throughput = units_per_run/r.median;
+  r.relative = r.median/calibration_time;
+  printf("%-34s %10.4g s  (MAD %8.2g s)  %10.4g %s/s  %8.4g x calibration\n",
+         name.c_str(), r.median, r.mad, r.throughput, unit, r.relative);
+  fflush(stdout);
+  results.push_back(r);
+}
+
+std::string with_size(const char *what, long n) {
+  char buf[1024];
+  snprintf(buf, sizeof(buf), "%s/%ld", what, n);
+  return buf;
+}
+
+void bench_old_code(int N) {
+  const double kT = hughes_water_prop.kT;
+  const double R = 2.7;
+  const double eta_one = 3.0/(4*M_PI*R*R*R);
+  const double nliquid = 0.3*eta_one;
+  const double len = 0.4*N;
+  Lattice lat(Cartesian(len,0,0), Cartesian(0,len,0), Cartesian(0,0,len));
+  GridDescription gd(lat, N, N, N);
+  const double points = gd.NxNyNz;
+
+  Functional n = EffectivePotentialToDensity();
+  const double mu = find_chemical_potential(HardSpheres(R)(n) + IdealGasOfVeff(), kT, nliquid);
+  Functional f = (HardSpheresNoTensor2(R) + ChemicalPotential(mu))(n) + IdealGasOfVeff();
+  Grid potential(gd);
+  potential.setConstant(-kT*log(nliquid));
+
+  bench(with_size("old/fft", N), "points", points, [&]() { ifft(gd, potential.fft()); });
+  bench(with_size("old/energy", N), "points", points, [&]() { f.integral(kT, potential); });
+  Grid grad(gd), pgrad(gd);
+  bench(with_size("old/grad", N), "points", points, [&]() {
+      grad.setZero();
+      f.integralgrad(kT, potential, &grad);
+    });
+  bench(with_size("old/pgrad", N), "points", points, [&]() {
+      pgrad.setZero();
+      f.integralpgrad(kT, potential, &pgrad);
+    });
+  Minimizer min = Precision(0, PreconditionedConjugateGradient(f, gd, kT, &potential,
+                                                               QuadraticLineMinimizer));
+  bench(with_size("old/minimizer-step", N), "points", points, [&]() { min.improve_energy(false); });
+}
+
+void bench_new_code(int N) {
+  WhiteBear wb(N, N, N);
+  wb.R() = 1;
+  wb.a1() = wb.a2() = wb.a3() = 0.4*N;
+  wb.kT() = 1;
+  wb.n() = 0.2;
+  const double points = double(N)*N*N;
+  const double dV = pow(0.4, 3);
+
+  Vector x = wb.n();
+  bench(with_size("new/fft", N), "points", points, [&]() { ifft(N, N, N, dV, fft(N, N, N, dV, x)); });
+  bench(with_size("new/energy", N), "points", points, [&]() { wb.energy(); });
+  bench(with_size("new/grad", N), "points", points, [&]() { wb.grad(); });
+  if (wb.have_preconditioner()) {
+    bench(with_size("new/pgrad", N), "points", points, [&]() { wb.energy_grad_and_precond(); });
+  }
+  Minimize min(&wb);
+  min.set_maxiter(1 << 30);
+  bench(with_size("new/minimizer-step", N), "points", points, [&]() { min.improve_energy(); });
+}
+
+// bench_monte_carlo times square-well moves of N balls at a filling
+// fraction of 0.3, starting from an fcc lattice.
+void bench_monte_carlo(int N) {
+  sw_simulation sw;
+  const double R = 1;
+  sw.N = N;
+  sw.filling_fraction = 0.3;
+  sw.well_width = 1.3;
+  sw.walls = 0;
+  sw.sticky_wall = 0;
+  sw.min_T = 0.2;
+  // We want a cube that holds an fcc lattice with at least N spots.
+  int cells = 1;
+  while (4*cells*cells*cells < N) cells++;
+  const double volume = N*4*M_PI/3*R*R*R/sw.filling_fraction;
+  sw.len[0] = sw.len[1] = sw.len[2] = cbrt(volume);
+  if (sw.len[0]/cells < 2*sqrt(2)*R) {
+    printf("FAIL: can't fit %d balls in an fcc lattice!\n", N);
+    retval++;
+    return;
+  }
+  const double neighbor_scale = 2;
+  sw.balls = new ball[N];
+  for (int i=0; i<N; i++) sw.balls[i].R = R;
+  sw.neighbor_R = neighbor_scale*R*sw.well_width;
+  sw.max_neighbors = 2*max_balls_within(2 + neighbor_scale*sw.well_width);
+  sw.interaction_distance = 2*R*sw.well_width;
+  sw.energy_levels = N*max_balls_within(sw.interaction_distance*1.1)/2 + 1;
+  sw.energy_histogram = new long[sw.energy_levels]();
+  sw.ln_energy_weights = new double[sw.energy_levels]();
+  sw.optimistic_samples = new long[sw.energy_levels]();
+  sw.pessimistic_samples = new long[sw.energy_levels]();
+  sw.pessimistic_observation = new bool[sw.energy_levels]();
+  sw.biggest_energy_transition = max_balls_within(sw.interaction_distance + 1);
+  sw.collection_matrix = new long[sw.energy_levels*(2*sw.biggest_energy_transition+1)]();
+  sw.translation_scale = 0.1*R;
+  sw.max_entropy_state = 0;
+  sw.min_important_energy = 0;
+
+  const double w = sw.len[0]/cells;
+  const vector3d offset[4] = { vector3d(0,0,0), vector3d(0,w,w)/2,
+                               vector3d(w,0,w)/2, vector3d(w,w,0)/2 };
+  int b = 0;
+  for (int i=0; i<cells && b<N; i++) {
+    for (int j=0; j<cells && b<N; j++) {
+      for (int k=0; k<cells && b<N; k++) {
+        for (int l=0; l<4 && b<N; l++) sw.balls[b++].pos = vector3d(i*w, j*w, k*w) + offset[l];
+      }
+    }
+  }
+  if (initialize_neighbor_tables(sw.balls, N, sw.neighbor_R, sw.max_neighbors, sw.len, sw.walls) < 0) {
+    printf("FAIL: too many neighbors for the Monte Carlo benchmark!\n");
+    retval++;
+    return;
+  }
+  sw.energy = count_all_interactions(sw.balls, N, sw.interaction_distance, sw.len,
+                                     sw.walls, sw.sticky_wall);
+  sw.reset_histograms();
+
+  const long moves = 100000;
+  bench(with_size("mc/square-well-move", N), "moves", moves, [&]() {
+      for (long i=0; i<moves; i++) sw.move_a_ball();
+    });
+  for (int i=0; i<N; i++) delete[] sw.balls[i].neighbors;
+  delete[] sw.balls;
+  delete[] sw.energy_histogram;
+  delete[] sw.ln_energy_weights;
+  delete[] sw.optimistic_samples;
+  delete[] sw.pessimistic_samples;
+  delete[] sw.pessimistic_observation;
+  delete[] sw.collection_matrix;
+}
+
+void write_json(const char *fname) {
+  FILE *f = fopen(fname, "w");
+  if (!f) {
+    printf("FAIL: unable to create %s!\n", fname);
+    retval++;
+    return;
+  }
+  fprintf(f, "{\n  \"calibration_seconds\": %.6g,\n  \"results\": [", calibration_time);
+  for (unsigned i=0; i<results.size(); i++) {
+    const BenchResult &r = results[i];
+    // Each result is on a line of its own, which is what read_baseline expects.
+    fprintf(f, "%s\n    {\"name\": \"%s\", \"unit\": \"%s\", \"repeats\": %d,"
+            " \"median_seconds\": %.6g, \"mad_seconds\": %.6g, \"throughput\": %.6g,"
+            " \"relative\": %.6g}",
+            i ? "," : "", r.name.c_str(), r.unit.c_str(), r.repeats,
+            r.median, r.mad, r.throughput, r.relative);
+  }
+  fprintf(f, "\n  ]\n}\n");
+  fclose(f);
+}
+
+// baseline_relative finds the relative time of a benchmark in a file
+// written by write_json, or returns 0 if it isn't there.
+double baseline_relative(const char *fname, const std::string &name) {
+  FILE *f = fopen(fname, "r");
+  if (!f) return 0;
+  const std::string want = "{\"name\": \"" + name + "\",";
+  char line[4096];
+  double relative = 0;
+  while (fgets(line, sizeof(line), f)) {
+    const char *r = strstr(line, "\"relative\": ");
+    if (strstr(line, want.c_str()) && r) relative = atof(r + strlen("\"relative\": "));
+  }
+  fclose(f);
+  return relative;
+}
+
+void compare_with_baseline(const char *fname, double tolerance) {
+  FILE *f = fopen(fname, "r");
+  if (!f) {
+    printf("\nThere is no baseline in %s, so there is nothing to compare with.\n", fname);
+    printf("Run with --write-baseline to create one.\n");
+    return;
+  }
+  fclose(f);
+  printf("\nComparing with %s (tolerance %g%%):\n", fname, 100*tolerance);
+  for (unsigned i=0; i<results.size(); i++) {
+    const BenchResult &r = results[i];
+    const double base = baseline_relative(fname, r.name);
+    if (base == 0) {
+      printf("%-34s is not in the baseline\n", r.name.c_str());
+      continue;
+    }
+    const double change = r.relative/base - 1;
+    printf("%-34s %+7.1f%%", r.name.c_str(), 100*change);
+    if (change > tolerance) {
+      printf("  FAIL: slower than the baseline!\n");
+      retval++;
+    } else if (change < -tolerance) {
+      printf("  (faster than the baseline, which could use updating)\n");
+    } else {
+      printf("\n");
+    }
+  }
+}
+
+int main(int argc, char **argv) {
+  bool quick = false, write_baseline = false;
+  const char *json = 0;
+  const char *baseline = "tests/bench/baseline.json";
+  double tolerance = getenv("DEFT_BENCH_TOLERANCE") ? atof(getenv("DEFT_BENCH_TOLERANCE")) : 0.5;
+  for (int i=1; i<argc; i++) {
+    if (!strcmp(argv[i], "--quick")) {
+      quick = true;
+    } else if (!strcmp(argv[i], "--write-baseline")) {
+      write_baseline = true;
+    } else if (i+1 < argc && !strcmp(argv[i], "--filter")) {
+      filter = argv[++i];
+    } else if (i+1 < argc && !strcmp(argv[i], "--repeats")) {
+      repeats = atoi(argv[++i]);
+    } else if (i+1 < argc && !strcmp(argv[i], "--tolerance")) {
+      tolerance = atof(argv[++i]);
+    } else if (i+1 < argc && !strcmp(argv[i], "--json")) {
+      json = argv[++i];
+    } else if (i+1 < argc && !strcmp(argv[i], "--baseline")) {
+      baseline = argv[++i];
+    } else {
+      printf("Usage: %s [--quick] [--filter TEXT] [--repeats N] [--tolerance FRACTION]\n"
+             "          [--json FILE] [--baseline FILE] [--write-baseline]\n", argv[0]);
+      return 1;
+    }
+  }
+  if (repeats < 1) repeats = 1;
+
+  calibrate();
+  const int grid_sizes[] = { 32, 64, 96 };
+  const int num_sizes = quick ? 1 : 3;
+  for (int i=0; i<num_sizes; i++) bench_old_code(grid_sizes[i]);
+  for (int i=0; i<num_sizes; i++) bench_new_code(grid_sizes[i]);
+  const int ball_numbers[] = { 32, 256, 2048 };
+  for (int i=0; i<num_sizes; i++) bench_monte_carlo(ball_numbers[i]);
+
+  if (json) write_json(json);
+  if (write_baseline) {
+    write_json(baseline);
+    printf("\nWrote the baseline to %s\n", baseline);
+  } else {
+    compare_with_baseline(baseline, tolerance);
+  }
+
+  if (retval == 0) {
+    printf("\n%s passes!\n", argv[0]);
+  } else {
+    printf("\n%s fails %d tests!\n", argv[0], retval);
+    return retval;
+  }
+}
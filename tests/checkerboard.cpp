@@ -0,0 +1,196 @@
+// Deft is a density functional package developed by the research
+// group of Professor David Roundy
+//
+// Copyright 2010 The Deft Authors
+//
+// Deft is free software; you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// You should have received a copy of the GNU General Public License
+// along with deft; if not, write to the Free Software Foundation,
+// Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+//
+// Please see the file AUTHORS for a list of authors.
+
+// This checks that checkerboard sweeps never leave spheres overlapping
+// or outside their walls, for each of the geometries our drivers use,
+// and that they move the spheres to the same place however many
+// threads we use.  It then times sweeps of a large system on 1 to 64
+// threads, to see how well they scale.
+
+#include <stdio.h>
+#include <math.h>
+#include <chrono>
+#include "Monte-Carlo/monte-carlo.h"
+#include "Monte-Carlo/sphere-cells.h"
+#include "Monte-Carlo/checkerboard.h"
+
+int retval = 0;
+
+static MTRand my_mtrand(0ul);
+double ran() {
+  return my_mtrand.randExc();
+}
+
+Vector3d nearest(const SphereGeometry &g, Vector3d r) {
+  for (int k=0; k<3; k++) {
+    if (g.periodic[k]) r[k] -= g.len[k]*floor(r[k]/g.len[k] + 0.5);
+  }
+  return r;
+}
+
+// fcc puts spheres on an fcc lattice with cells cells on a side,
+// scaled to fill a cube of side len centered on the origin.
+long fcc(Vector3d *spheres, int cells, double len) {
+  const double a = len/cells;
+  const Vector3d basis[4] = { Vector3d(0,0,0), Vector3d(0.5,0.5,0),
+                              Vector3d(0.5,0,0.5), Vector3d(0,0.5,0.5) };
+  long n = 0;
+  for (int x=0; x<cells; x++) {
+    for (int y=0; y<cells; y++) {
+      for (int z=0; z<cells; z++) {
+        for (int b=0; b<4; b++) {
+          spheres[n++] = a*(Vector3d(x + 0.25, y + 0.25, z + 0.25) + basis[b]) - Vector3d(len/2, len/2, len/2);
+        }
+      }
+    }
+  }
+  return n;
+}
+
+void check_spheres(const char *name, const SphereGeometry &g, const Vector3d *spheres, long N) {
+  const double fuzz = 1e-9;
+  for (long i=0; i<N; i++) {
+    if (g.outside(spheres[i])) {
+      printf("FAIL: %s has sphere %ld in a wall\n", name, i);
+      retval++;
+      return;
+    }
+    for (long j=i+1; j<N; j++) {
+      if (nearest(g, spheres[j] - spheres[i]).norm() < 2*g.R - fuzz) {
+        printf("FAIL: %s has spheres %ld and %ld overlapping\n", name, i, j);
+        retval++;
+        return;
+      }
+    }
+  }
+}
+
+void check_geometry(const char *name, const SphereGeometry &g, Vector3d *spheres, long N) {
+  Vector3d *copy = new Vector3d[N];
+  for (long i=0; i<N; i++) copy[i] = spheres[i];
+  const MTRand saved = my_mtrand;
+  Checkerboard serial(g, spheres, N, 0.3, 1);
+  long accepted = 0;
+  for (int s=0; s<200; s++) accepted += serial.sweep();
+  printf("%s: %ld domains, %.1f%% of moves accepted\n", name, serial.num_domains(),
+         100.0*accepted/(200*N));
+  check_spheres(name, g, spheres, N);
+
+  my_mtrand = saved;
+  Checkerboard parallel(g, copy, N, 0.3, 4);
+  for (int s=0; s<200; s++) parallel.sweep();
+  for (long i=0; i<N; i++) {
+    if ((copy[i] - spheres[i]).squaredNorm() != 0) {
+      printf("FAIL: %s moved sphere %ld differently on four threads\n", name, i);
+      retval++;
+      break;
+    }
+  }
+  delete[] copy;
+}
+
+int main(int, char **argv) {
+  {
+    const int cells = 3;
+    const long N = 4*cells*cells*cells;
+    Vector3d *spheres = new Vector3d[N];
+    {
+      SphereGeometry g;
+      for (int k=0; k<3; k++) {
+        g.len[k] = 11;
+        g.periodic[k] = true;
+      }
+      fcc(spheres, cells, g.len[0]);
+      check_geometry("periodic", g, spheres, N);
+    }
+    {
+      SphereGeometry g;
+      for (int k=0; k<3; k++) g.len[k] = 11;
+      g.periodic[0] = g.periodic[1] = true;
+      g.wall[2] = true;
+      fcc(spheres, cells, g.len[0]);
+      check_geometry("wallz", g, spheres, N);
+    }
+    {
+      SphereGeometry g;
+      for (int k=0; k<3; k++) {
+        g.len[k] = 11;
+        g.wall[k] = true;
+      }
+      fcc(spheres, cells, g.len[0]);
+      check_geometry("walls", g, spheres, N);
+    }
+    {
+      SphereGeometry g;
+      g.outer_radius = 9;
+      g.inner_radius = 1.5;
+      const long n = fcc(spheres, cells, 12);
+      long kept = 0;
+      for (long i=0; i<n; i++) {
+        if (spheres[i].norm() <= g.outer_radius && spheres[i].norm() >= g.inner_radius) {
+          spheres[kept++] = spheres[i];
+        }
+      }
+      check_geometry("outerSphere innerSphere", g, spheres, kept);
+    }
+    delete[] spheres;
+  }
+
+  // We time sweeps of a large periodic system at a packing fraction of
+  // 0.3.  The speedup can be no better than the number of cores we have.
+  {
+    const int cells = 20;
+    const long N = 4*cells*cells*cells;
+    const double eta = 0.3;
+    Vector3d *spheres = new Vector3d[N];
+    SphereGeometry g;
+    for (int k=0; k<3; k++) {
+      g.len[k] = cells*pow(16*M_PI/3/eta, 1.0/3);
+      g.periodic[k] = true;
+    }
+    fcc(spheres, cells, g.len[0]);
+    Checkerboard checkerboard(g, spheres, N, 0.3);
+    printf("\nStrong scaling for %ld spheres in %ld domains:\n", N, checkerboard.num_domains());
+    checkerboard.sweep(); // so the first timing is not of a cold cache
+    double one_thread = 0;
+    for (int threads=1; threads<=64; threads *= 2) {
+      checkerboard.set_threads(threads);
+      const int sweeps = 5;
+      const auto start = std::chrono::steady_clock::now();
+      for (int s=0; s<sweeps; s++) checkerboard.sweep();
+      const double secs =
+        std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count()/sweeps;
+      if (threads == 1) one_thread = secs;
+      printf("%2d threads: %.3g seconds per sweep, speedup %.2f\n", threads, secs, one_thread/secs);
+    }
+    SphereCells cell_list(g, spheres, N);
+    for (long i=0; i<N; i++) {
+      if (cell_list.overlaps(spheres[i], i)) {
+        printf("FAIL: strong scaling left sphere %ld overlapping\n", i);
+        retval++;
+        break;
+      }
+    }
+    delete[] spheres;
+  }
+
+  if (retval == 0) {
+    printf("\n%s passes!\n", argv[0]);
+  } else {
+    printf("\n%s fails %d tests!\n", argv[0], retval);
+    return retval;
+  }
+}
@@ -157,6 +157,49 @@ int main(int, char **argv) {
       }
     }
 
+    {
+      // Check that Newton's method, the batched Newton and the
+      // threaded binodal all agree with the bisection.
+      double nl, nv, mu;
+      saturated_liquid_vapor(f, hughes_water_prop.kT, 1e-14, 0.0017, 0.0055, &nl, &nv, &mu, 1e-12);
+      double nl_newton = 1.01*nl, nv_newton = 1.1*nv, mu_newton;
+      if (!saturated_liquid_vapor_newton(f, hughes_water_prop.kT, &nl_newton, &nv_newton, &mu_newton)) {
+        printf("FAIL: Newton's method failed to find coexistence!\n");
+        retval++;
+      } else if (fabs(nl_newton/nl - 1) > 1e-6 || fabs(nv_newton/nv - 1) > 1e-6) {
+        printf("FAIL: Newton gives nl = %g and nv = %g versus %g and %g\n",
+               nl_newton, nv_newton, nl, nv);
+        retval++;
+      }
+
+      VectorXd kTs(4), nls, nvs, mus;
+      for (int i=0; i<kTs.rows(); i++) kTs[i] = hughes_water_prop.kT*(1 + 0.01*i);
+      binodal(f, kTs, 1e-14, 0.0017, 0.0055, &nls, &nvs, &mus, 2);
+      if (fabs(nls[0]/nl - 1) > 1e-6 || fabs(nvs[0]/nv - 1) > 1e-6) {
+        printf("FAIL: binodal gives nl = %g and nv = %g versus %g and %g\n",
+               nls[0], nvs[0], nl, nv);
+        retval++;
+      }
+      VectorXd nls_batch = 1.01*nls, nvs_batch = 1.1*nvs, mus_batch;
+      if (saturated_liquid_vapor_batch(f, kTs, &nls_batch, &nvs_batch, &mus_batch)) {
+        printf("FAIL: batched Newton failed to find coexistence!\n");
+        retval++;
+      }
+      for (int i=0; i<kTs.rows(); i++) {
+        printf("kT = %g: nl = %g (%g), nv = %g (%g)\n", kTs[i],
+               nls[i], nls_batch[i], nvs[i], nvs_batch[i]);
+        if (fabs(nls_batch[i]/nls[i] - 1) > 1e-6 || fabs(nvs_batch[i]/nvs[i] - 1) > 1e-6) {
+          printf("FAIL: batched Newton disagrees with binodal!\n");
+          retval++;
+        }
+      }
+      const VectorXd pbatch = pressure(f, kTs, nvs);
+      if (fabs(pbatch[0]/pressure(f, kTs[0], nvs[0]) - 1) > 1e-12) {
+        printf("FAIL: batched pressure is %g versus %g\n", pbatch[0], pressure(f, kTs[0], nvs[0]));
+        retval++;
+      }
+    }
+
     {
       o = stdout; // fopen("room-temperature.dat", "w");
       Functional f = OfEffectivePotential(SaftFluid2(hughes_water_prop.lengthscale,
@@ -0,0 +1,275 @@
+// Deft is a density functional package developed by the research
+// group of Professor David Roundy
+//
+// Copyright 2010 The Deft Authors
+//
+// Deft is free software; you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// You should have received a copy of the GNU General Public License
+// along with deft; if not, write to the Free Software Foundation,
+// Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+//
+// Please see the file AUTHORS for a list of authors.
+
+// This checks that event chains never leave spheres overlapping or
+// outside their walls, for each of the geometries our drivers use, and
+// then compares how fast event chains and the single sphere moves of
+// monte-carlo.cpp decorrelate dense hard spheres.  We measure
+// decorrelation by the number of sphere displacements it takes for the
+// mean-square displacement of the spheres to reach the square of two
+// diameters.  Each displacement (a trial move, or one sphere's part of
+// a chain) costs one search of the nearby cells, so this stands in for
+// the CPU time, which we print but do not check, since it depends on
+// the load on the machine.
+
+#include <stdio.h>
+#include <time.h>
+#include <math.h>
+#include "Monte-Carlo/monte-carlo.h"
+#include "Monte-Carlo/sphere-cells.h"
+#include "Monte-Carlo/event-chain.h"
+
+int retval = 0;
+
+double ran() {
+  static MTRand my_mtrand(0ul);
+  return my_mtrand.randExc();
+}
+
+Vector3d ran3() {
+  double x, y, r2;
+  do {
+    x = 2 * ran() - 1;
+    y = 2 * ran() - 1;
+    r2 = x * x + y * y;
+  } while(r2 >= 1 || r2 == 0);
+  double fac = sqrt(-2*log(r2)/r2);
+  Vector3d out(x*fac,y*fac,0);
+  do {
+    x = 2 * ran() - 1;
+    y = 2 * ran() - 1;
+    r2 = x * x + y * y;
+  } while(r2 >= 1 || r2 == 0);
+  fac = sqrt(-2*log(r2)/r2);
+  out[2]=x*fac;
+  return out;
+}
+
+Vector3d nearest(const SphereGeometry &g, Vector3d r) {
+  for (int k=0; k<3; k++) {
+    if (g.periodic[k]) r[k] -= g.len[k]*floor(r[k]/g.len[k] + 0.5);
+  }
+  return r;
+}
+
+// fcc puts spheres on an fcc lattice with cells cells on a side,
+// scaled to fill a cube of side len centered on the origin.
+long fcc(Vector3d *spheres, int cells, double len) {
+  const double a = len/cells;
+  const Vector3d basis[4] = { Vector3d(0,0,0), Vector3d(0.5,0.5,0),
+                              Vector3d(0.5,0,0.5), Vector3d(0,0.5,0.5) };
+  long n = 0;
+  for (int x=0; x<cells; x++) {
+    for (int y=0; y<cells; y++) {
+      for (int z=0; z<cells; z++) {
+        for (int b=0; b<4; b++) {
+          spheres[n++] = a*(Vector3d(x + 0.25, y + 0.25, z + 0.25) + basis[b]) - Vector3d(len/2, len/2, len/2);
+        }
+      }
+    }
+  }
+  return n;
+}
+
+void check_spheres(const char *name, const SphereGeometry &g, const Vector3d *spheres, long N) {
+  const double fuzz = 1e-9;
+  for (long i=0; i<N; i++) {
+    for (int k=0; k<3; k++) {
+      if ((g.periodic[k] || g.wall[k]) && fabs(spheres[i][k]) > g.len[k]/2 + fuzz) {
+        printf("FAIL: %s has sphere %ld outside the cell at %g %g %g\n",
+               name, i, spheres[i][0], spheres[i][1], spheres[i][2]);
+        retval++;
+        return;
+      }
+    }
+    if (g.outer_radius > 0 && spheres[i].norm() > g.outer_radius + fuzz) {
+      printf("FAIL: %s has sphere %ld outside the outer wall\n", name, i);
+      retval++;
+      return;
+    }
+    if (g.inner_radius > 0 && spheres[i].norm() < g.inner_radius - fuzz) {
+      printf("FAIL: %s has sphere %ld inside the inner wall\n", name, i);
+      retval++;
+      return;
+    }
+    for (long j=i+1; j<N; j++) {
+      if (nearest(g, spheres[j] - spheres[i]).norm() < 2*g.R - fuzz) {
+        printf("FAIL: %s has spheres %ld and %ld overlapping\n", name, i, j);
+        retval++;
+        return;
+      }
+    }
+  }
+}
+
+void check_geometry(const char *name, const SphereGeometry &g, Vector3d *spheres, long N) {
+  EventChain ec(g, spheres, N);
+  long lifts = 0;
+  for (int i=0; i<20000; i++) lifts += ec.chain(5);
+  printf("%s: %.1f lifts per chain\n", name, lifts/20000.0);
+  check_spheres(name, g, spheres, N);
+}
+
+// These return the number of sphere displacements it takes for the
+// mean-square displacement to reach 16R^2, starting from the given
+// spheres.
+long metropolis_decorrelation(const SphereGeometry &g, Vector3d *spheres, long N, double scale) {
+  Vector3d *displacement = new Vector3d[N];
+  for (long i=0; i<N; i++) displacement[i] = Vector3d(0,0,0);
+  double msd = 0;
+  long moves = 0;
+  SphereCells cells(g, spheres, N);
+  const clock_t start = clock();
+  while (msd < 16*g.R*g.R) {
+    for (long i=0; i<N; i++) {
+      // This is the same move monte-carlo.cpp makes.
+      const Vector3d trial = g.wrap(spheres[i] + scale*ran3());
+      moves++;
+      if (!cells.overlaps(trial, i)) {
+        displacement[i] += nearest(g, trial - spheres[i]);
+        spheres[i] = trial;
+        cells.moved(i);
+      }
+    }
+    msd = 0;
+    for (long i=0; i<N; i++) msd += displacement[i].squaredNorm()/N;
+  }
+  const double secs = double(clock() - start)/CLOCKS_PER_SEC;
+  printf("Metropolis moves: %ld sweeps in %g seconds\n", moves/N, secs);
+  delete[] displacement;
+  return moves;
+}
+
+long event_chain_decorrelation(const SphereGeometry &g, Vector3d *spheres, long N, double length) {
+  Vector3d *displacement = new Vector3d[N];
+  Vector3d *old = new Vector3d[N];
+  Vector3d *initial = new Vector3d[N];
+  for (long i=0; i<N; i++) {
+    displacement[i] = Vector3d(0,0,0);
+    initial[i] = spheres[i];
+  }
+  // Unwrapping the displacements after every chain costs about as
+  // much as the chain itself, so first we count how many chains it
+  // takes, and then we time that many chains on their own.
+  long chains = 0, lifts = 0;
+  {
+    EventChain ec(g, spheres, N);
+    double msd = 0;
+    while (msd < 16*g.R*g.R) {
+      for (long i=0; i<N; i++) {
+        for (long j=0; j<N; j++) old[j] = spheres[j];
+        lifts += ec.chain(length);
+        chains++;
+        // A chain moves no sphere further than its length, which is
+        // less than half the cell, so nearest() unwraps this.
+        for (long j=0; j<N; j++) displacement[j] += nearest(g, spheres[j] - old[j]);
+      }
+      msd = 0;
+      for (long i=0; i<N; i++) msd += displacement[i].squaredNorm()/N;
+    }
+  }
+  for (long i=0; i<N; i++) spheres[i] = initial[i];
+  EventChain ec(g, spheres, N);
+  const clock_t start = clock();
+  for (long i=0; i<chains; i++) ec.chain(length);
+  const double secs = double(clock() - start)/CLOCKS_PER_SEC;
+  printf("Event chains: %ld chains (%ld displacements) in %g seconds\n",
+         chains, chains + lifts, secs);
+  delete[] displacement;
+  delete[] old;
+  delete[] initial;
+  // Each chain displaces its first sphere, and one more for each lift.
+  return chains + lifts;
+}
+
+int main(int, char **argv) {
+  const int cells = 3;
+  const long N = 4*cells*cells*cells;
+  Vector3d *spheres = new Vector3d[N];
+
+  {
+    SphereGeometry g;
+    for (int k=0; k<3; k++) {
+      g.len[k] = 11;
+      g.periodic[k] = true;
+    }
+    fcc(spheres, cells, g.len[0]);
+    check_geometry("periodic", g, spheres, N);
+  }
+  {
+    SphereGeometry g;
+    for (int k=0; k<3; k++) g.len[k] = 11;
+    g.periodic[0] = g.periodic[1] = true;
+    g.wall[2] = true;
+    fcc(spheres, cells, g.len[0]);
+    check_geometry("wallz", g, spheres, N);
+  }
+  {
+    SphereGeometry g;
+    for (int k=0; k<3; k++) {
+      g.len[k] = 11;
+      g.wall[k] = true;
+    }
+    fcc(spheres, cells, g.len[0]);
+    check_geometry("walls", g, spheres, N);
+  }
+  {
+    SphereGeometry g;
+    g.outer_radius = 9;
+    g.inner_radius = 1.5;
+    const long n = fcc(spheres, cells, 12);
+    long kept = 0;
+    for (long i=0; i<n; i++) {
+      if (spheres[i].norm() <= g.outer_radius && spheres[i].norm() >= g.inner_radius) {
+        spheres[kept++] = spheres[i];
+      }
+    }
+    check_geometry("outerSphere innerSphere", g, spheres, kept);
+  }
+
+  // At a packing fraction of 0.5, most single sphere moves are
+  // rejected, and the crystal we start from is slow to melt.
+  {
+    const double eta = 0.5;
+    SphereGeometry g;
+    for (int k=0; k<3; k++) {
+      g.len[k] = cells*pow(16*M_PI/3/eta, 1.0/3);
+      g.periodic[k] = true;
+    }
+    printf("\nDecorrelating %ld spheres at packing fraction %g:\n", N, eta);
+    fcc(spheres, cells, g.len[0]);
+    // This is the move scale monte-carlo.cpp would use.
+    const double mean_spacing = pow(g.len[0]*g.len[1]*g.len[2]/N, 1.0/3);
+    const long metropolis = metropolis_decorrelation(g, spheres, N, 2*(mean_spacing - 2*g.R));
+    fcc(spheres, cells, g.len[0]);
+    const long event_chain = event_chain_decorrelation(g, spheres, N, 2*mean_spacing);
+    check_spheres("decorrelation", g, spheres, N);
+    printf("Event chains decorrelate %.1f times faster per displacement\n",
+           metropolis/double(event_chain));
+    if (event_chain > metropolis) {
+      printf("FAIL: event chains decorrelate more slowly than single sphere moves!\n");
+      retval++;
+    }
+  }
+
+  delete[] spheres;
+  if (retval == 0) {
+    printf("\n%s passes!\n", argv[0]);
+  } else {
+    printf("\n%s fails %d tests!\n", argv[0], retval);
+    return retval;
+  }
+}
@@ -0,0 +1,76 @@
+// Deft is a density functional package developed by the research
+// group of Professor David Roundy
+//
+// Copyright 2010 The Deft Authors
+//
+// Deft is free software; you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// You should have received a copy of the GNU General Public License
+// along with deft; if not, write to the Free Software Foundation,
+// Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+//
+// Please see the file AUTHORS for a list of authors.
+
+// This checks that the fields of both the old (Eigen) and new
+// (Vector) code come out aligned, that freed arrays are reused, and
+// that peak_memory still counts only the arrays in use.
+
+#include <stdio.h>
+#include "Grid.h"
+#include "new/Vector.h"
+#include "utilities.h"
+
+int retval = 0;
+
+void check_aligned(const char *name, const void *ptr) {
+  if ((unsigned long)ptr & 63) {
+    printf("FAIL: %s at %p is not 64-byte aligned!\n", name, ptr);
+    retval++;
+  }
+}
+
+int main(int, char **argv) {
+  const long sizes[] = { 3, 1000, 100000, 3000000, 32*32*32*8 };
+  for (unsigned i=0; i<sizeof(sizes)/sizeof(sizes[0]); i++) {
+    const long n = sizes[i];
+    VectorXd a(n);
+    a.setZero();
+    check_aligned("VectorXd", a.data());
+    Vector b(n);
+    b = 1.0;
+    Vector s = b.slice(1, 1);
+    b.free(); // the slice is now the last to hold the data
+    s[0] = 2;
+  }
+
+  VectorXd first(1 << 20);
+  const double *where = first.data();
+  first.resize(0);
+  VectorXd second(1 << 20);
+  if (second.data() != where) {
+    printf("FAIL: a freed array was not reused.\n");
+    retval++;
+  }
+  const long pooled = field_allocator_pooled_memory();
+  printf("peak memory %g M, current %g M, pooled %g M\n", peak_memory()/1024.0/1024,
+         current_memory()/1024.0/1024, pooled/1024.0/1024);
+  if (current_memory() != long(8 << 20)) {
+    printf("FAIL: current memory should count just the one array!\n");
+    retval++;
+  }
+  field_allocator_release();
+  if (field_allocator_pooled_memory() != 0) {
+    printf("FAIL: field_allocator_release left memory in the pool.\n");
+    retval++;
+  }
+
+  if (retval == 0) {
+    printf("\n%s passes!\n", argv[0]);
+  } else {
+    printf("\n%s fails %d tests!\n", argv[0], retval);
+    return retval;
+  }
+}
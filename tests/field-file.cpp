@@ -0,0 +1,158 @@
+// Deft is a density functional package developed by the research
+// group of Professor David Roundy
+//
+// Copyright 2010 The Deft Authors
+//
+// Deft is free software; you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// You should have received a copy of the GNU General Public License
+// along with deft; if not, write to the Free Software Foundation,
+// Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+//
+// Please see the file AUTHORS for a list of authors.
+
+// This checks that fields survive a trip through a field file, both
+// for Grid and for the mapped Vectors of the new code, and that the
+// slices of a FieldFile agree with indexing it directly.
+
+#include <stdio.h>
+#include <string.h>
+#include "Grid.h"
+#include "new/Vector.h"
+
+int retval = 0;
+
+double bumpy(Cartesian r) {
+  return exp(-r.norm()) + 0.1*cos(3*r(0))*sin(2*r(1)+r(2));
+}
+
+void check(const char *name, bool ok) {
+  if (!ok) {
+    printf("FAIL: %s\n", name);
+    retval++;
+  }
+}
+
+// count_mappings returns how many times fname shows up in our memory
+// map, so we can check that mappings are undone.
+int count_mappings(const char *fname) {
+  FILE *f = fopen("/proc/self/maps", "r");
+  if (!f) return 0;
+  int count = 0;
+  char line[4096];
+  while (fgets(line, sizeof(line), f)) {
+    if (strstr(line, fname)) count++;
+  }
+  fclose(f);
+  return count;
+}
+
+int main(int, char **argv) {
+  const char *fname = "/tmp/deft-field-file-test.dat";
+  const char *fname2 = "/tmp/deft-field-file-test-2.dat";
+  const Lattice lat(Cartesian(4,0,0), Cartesian(1,5,0), Cartesian(0.5,1,6));
+  GridDescription gd(lat, 0.25);
+  Grid g(gd);
+  g.Set(bumpy);
+
+  FieldParameters parameters;
+  parameters.push_back(std::make_pair(std::string("kT"), 0.0025));
+  parameters.push_back(std::make_pair(std::string("R"), 2.7));
+  check("Grid::Save", g.Save(fname, parameters));
+
+  {
+    Grid loaded(gd);
+    loaded.setZero();
+    FieldParameters p;
+    check("Grid::Load", loaded.Load(fname, &p));
+    check("Grid::Load gives back the same data", loaded == g);
+    check("Grid::Load gives back the parameters", p == parameters);
+
+    GridDescription other(lat, 0.3);
+    Grid wrong(other);
+    check("Grid::Load refuses a grid of a different size", !wrong.Load(fname));
+  }
+
+  {
+    FieldFile f;
+    check("FieldFile::open", f.open(fname));
+    const FieldHeader &h = f.header();
+    check("the header has the grid size",
+          h.Nx == gd.Nx && h.Ny == gd.Ny && h.Nz == gd.Nz);
+    double kT = 0, mu = 7;
+    check("get_parameter finds kT", h.get_parameter("kT", &kT) && kT == 0.0025);
+    check("get_parameter misses mu", !h.get_parameter("mu", &mu) && mu == 7);
+
+    const int N[3] = { gd.Nx, gd.Ny, gd.Nz };
+    double *buffer = new double[gd.NxNyNz];
+    bool lines_ok = true, planes_ok = true;
+    for (int axis=0; axis<3; axis++) {
+      const int ai = axis == 0 ? 1 : 0, aj = axis == 2 ? 1 : 2;
+      for (int i=0; i<N[ai]; i++) {
+        for (int j=0; j<N[aj]; j++) {
+          f.line(axis, i, j, buffer);
+          for (int n=0; n<N[axis]; n++) {
+            int r[3];
+            r[axis] = n;
+            r[ai] = i;
+            r[aj] = j;
+            if (buffer[n] != g(r[0], r[1], r[2])) lines_ok = false;
+          }
+        }
+      }
+      for (int n=0; n<N[axis]; n++) {
+        f.plane(axis, n, buffer);
+        for (int i=0; i<N[ai]; i++) {
+          for (int j=0; j<N[aj]; j++) {
+            int r[3];
+            r[axis] = n;
+            r[ai] = i;
+            r[aj] = j;
+            if (buffer[i*N[aj] + j] != g(r[0], r[1], r[2])) planes_ok = false;
+          }
+        }
+      }
+    }
+    check("FieldFile::line agrees with Grid", lines_ok);
+    check("FieldFile::plane agrees with Grid", planes_ok);
+    check("FieldFile indexing agrees with Grid", f(3, 5, 7) == g(3, 5, 7));
+    delete[] buffer;
+  }
+  check("FieldFile unmaps when it is done", count_mappings(fname) == 0);
+
+  {
+    FieldHeader h;
+    Vector v = Vector::mapped(fname, &h);
+    check("Vector::mapped gives the header", h.parameters == parameters);
+    check("Vector::mapped has the right size", v.get_size() == gd.NxNyNz);
+    bool same = true;
+    for (int i=0; i<gd.NxNyNz; i++) if (v[i] != g[i]) same = false;
+    check("Vector::mapped gives back the same data", same);
+    check("Vector::mapped maps the file", count_mappings(fname) == 1);
+
+    v[0] = 1e10;
+    Vector w = Vector::mapped(fname);
+    check("changing a mapped Vector leaves the file alone", w[0] == g[0]);
+    check("a mapped Vector can be changed", v[0] == 1e10);
+
+    // We can't save over the file we are mapping, since unchanged pages
+    // are read from it.
+    check("Vector::save", v.save(fname2, h));
+    Vector u = Vector::mapped(fname2);
+    check("Vector::save writes what we changed", u[0] == 1e10 && u[1] == g[1]);
+  }
+  check("Vector unmaps when it is freed",
+        count_mappings(fname) == 0 && count_mappings(fname2) == 0);
+  remove(fname);
+  remove(fname2);
+
+  if (retval == 0) {
+    printf("\n%s passes!\n", argv[0]);
+  } else {
+    printf("\n%s fails %d tests!\n", argv[0], retval);
+    return retval;
+  }
+}
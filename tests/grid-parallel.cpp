@@ -0,0 +1,113 @@
+// Deft is a density functional package developed by the research
+// group of Professor David Roundy
+//
+// Copyright 2010 The Deft Authors
+//
+// Deft is free software; you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// You should have received a copy of the GNU General Public License
+// along with deft; if not, write to the Free Software Foundation,
+// Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+//
+// Please see the file AUTHORS for a list of authors.
+
+// This checks that the threaded grid expressions give just what
+// Eigen gives, and that grid_sum and grid_sum_of come out bit for bit
+// the same however many threads we use.
+
+#include <stdio.h>
+#include <math.h>
+#include <atomic>
+#include "GridParallel.h"
+#include "ReciprocalOperators.h"
+
+int retval = 0;
+
+void check_same(const char *name, const VectorXd &a, const VectorXd &b) {
+  const double err = (a - b).cwise().abs().maxCoeff();
+  if (err != 0) {
+    printf("FAIL: %s is off by %g!\n", name, err);
+    retval++;
+  }
+}
+
+int main(int, char **argv) {
+  const Lattice lat(Cartesian(4,0,0), Cartesian(0,4,0), Cartesian(0,0,4));
+  GridDescription gd(lat, 0.05); // 80^3, or about 31 chunks
+  const long N = gd.NxNyNz;
+  VectorXd x(N), y(N);
+  for (long i=0; i<N; i++) {
+    x[i] = sin(0.001*i) + 1e-3*(i % 7);
+    y[i] = 1.5 + cos(0.0003*i);
+  }
+
+  double first_sum = 0, first_dot = 0;
+  const int threads[] = { 1, 2, 3, 8 };
+  for (int t=0; t<4; t++) {
+    grid_set_threads(threads[t]);
+    printf("Using %d threads:\n", grid_threads());
+
+    const double sum = grid_sum(x);
+    if (t == 0) first_sum = sum;
+    printf("  grid_sum is %.17g (Eigen gives %.17g)\n", sum, x.sum());
+    if (sum != first_sum) {
+      printf("FAIL: grid_sum differs from %.17g with one thread!\n", first_sum);
+      retval++;
+    }
+    if (fabs(sum - x.sum()) > 1e-9*fabs(sum)) {
+      printf("FAIL: grid_sum is wrong!\n");
+      retval++;
+    }
+
+    const double dot = grid_sum_of(N, [&](long i) { return x[i]*y[i]; });
+    if (t == 0) first_dot = dot;
+    printf("  grid_sum_of x*y is %.17g (Eigen gives %.17g)\n", dot, x.dot(y));
+    if (dot != first_dot || fabs(dot - x.dot(y)) > 1e-9*fabs(dot)) {
+      printf("FAIL: grid_sum_of x*y is wrong or differs from %.17g with one thread!\n", first_dot);
+      retval++;
+    }
+
+    VectorXd out(N);
+    grid_assign(&out, x.cwise()/y);
+    check_same("grid_assign", out, x.cwise()/y);
+    VectorXd expected = out + x.cwise()*y;
+    grid_add(&out, x.cwise()*y);
+    check_same("grid_add", out, expected);
+    expected = out.cwise()*out;
+    grid_multiply(&out, out); // this refers to itself
+    check_same("grid_multiply", out, expected);
+
+    VectorXcd recip(gd.NxNyNzOver2), recip_expected(gd.NxNyNzOver2);
+    recip.setConstant(complex(1, 2));
+    recip_expected = recip;
+    recip_expected.cwise() *= Eigen::CwiseNullaryOp<g2_op<complex>, VectorXcd>(gd.NxNyNzOver2, 1, g2_op<complex>(gd));
+    grid_multiply(&recip, Eigen::CwiseNullaryOp<g2_op<complex>, VectorXcd>(gd.NxNyNzOver2, 1, g2_op<complex>(gd)));
+    const double recip_err = (recip - recip_expected).cwise().abs().maxCoeff();
+    if (recip_err != 0) {
+      printf("FAIL: reciprocal-space grid_multiply is off by %g!\n", recip_err);
+      retval++;
+    }
+
+    // A grid_parallel_for inside another one must still cover
+    // everything, just without the pool.
+    std::atomic<long> covered(0);
+    grid_parallel_for(N, [&](long start, long end) {
+        covered += end - start;
+        if (start == 0) covered -= long(grid_sum(x) != first_sum);
+      });
+    if (covered != N) {
+      printf("FAIL: nested grid_parallel_for covered %ld points out of %ld!\n", long(covered), N);
+      retval++;
+    }
+  }
+
+  if (retval == 0) {
+    printf("\n%s passes!\n", argv[0]);
+  } else {
+    printf("\n%s fails %d tests!\n", argv[0], retval);
+    return retval;
+  }
+}
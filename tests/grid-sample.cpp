@@ -0,0 +1,152 @@
+// Deft is a density functional package developed by the research
+// group of Professor David Roundy
+//
+// Copyright 2010 The Deft Authors
+//
+// Deft is free software; you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// You should have received a copy of the GNU General Public License
+// along with deft; if not, write to the Free Software Foundation,
+// Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+//
+// Please see the file AUTHORS for a list of authors.
+
+// This checks Grid::Sample against operator() and against the exact
+// values and gradients of a smooth periodic function, and times it
+// against calling operator() once per point.
+
+#include <stdio.h>
+#include <time.h>
+#include "Grid.h"
+
+int retval = 0;
+
+const Lattice *lattice = 0;
+
+// smooth is periodic in the lattice, so that interpolating it is only
+// limited by the grid spacing.
+double smooth(Cartesian r) {
+  const Relative s = lattice->toRelative(r);
+  return cos(2*M_PI*s(0)) * sin(2*M_PI*s(1)) + 0.5*cos(2*M_PI*(s(2) + s(0)));
+}
+
+Cartesian smooth_gradient(Cartesian r) {
+  // The gradient of each term is its derivative with respect to the
+  // relative coordinates, taken back to Cartesian by the transpose of
+  // the inverse of the lattice.
+  const Relative s = lattice->toRelative(r);
+  const double c0 = cos(2*M_PI*s(0)), s0 = sin(2*M_PI*s(0));
+  const double c1 = cos(2*M_PI*s(1)), s1 = sin(2*M_PI*s(1));
+  const double s02 = sin(2*M_PI*(s(2) + s(0)));
+  const Vector3d ds(2*M_PI*(-s0*s1 - 0.5*s02), 2*M_PI*c0*c1, 2*M_PI*(-0.5*s02));
+  Vector3d out(0,0,0);
+  for (int k=0; k<3; k++) {
+    out[k] = Vector3d(lattice->toRelative(Cartesian(Vector3d::Unit(k)))).dot(ds);
+  }
+  return Cartesian(out);
+}
+
+double ran() {
+  return rand()/(RAND_MAX + 1.0);
+}
+
+void check(const char *name, const Lattice &lat, double resolution) {
+  printf("\nChecking %s...\n", name);
+  lattice = &lat;
+  GridDescription gd(lat, resolution);
+  Grid g(gd);
+  g.Set(smooth);
+
+  // We sample points well outside the cell, too, to check wrapping.
+  const long n = 200000;
+  Cartesian *r = new Cartesian[n];
+  for (long i=0; i<n; i++) {
+    r[i] = lat.toCartesian(Relative(4*ran() - 2, 4*ran() - 2, 4*ran() - 2));
+  }
+  double *values = new double[n];
+  Cartesian *gradients = new Cartesian[n];
+
+  clock_t start = clock();
+  double sum = 0;
+  for (long i=0; i<n; i++) sum += g(r[i]);
+  const double slow_time = (clock() - double(start))/CLOCKS_PER_SEC;
+  start = clock();
+  g.Sample(r, n, values);
+  const double fast_time = (clock() - double(start))/CLOCKS_PER_SEC;
+  printf("Sample took %g seconds versus %g for operator()\n", fast_time, slow_time);
+
+  double worst = 0;
+  for (long i=0; i<n; i++) worst = fmax(worst, fabs(values[i] - g(r[i])));
+  printf("trilinear Sample differs from operator() by %g\n", worst);
+  if (worst > 1e-12) {
+    printf("FAIL: trilinear Sample disagrees with operator()!\n");
+    retval++;
+  }
+
+  double error[2], gradient_error[2];
+  const Grid::Interpolation how[2] = { Grid::trilinear, Grid::tricubic };
+  for (int h=0; h<2; h++) {
+    g.Sample(r, n, values, gradients, how[h]);
+    error[h] = gradient_error[h] = 0;
+    for (long i=0; i<n; i++) {
+      error[h] = fmax(error[h], fabs(values[i] - smooth(r[i])));
+      gradient_error[h] = fmax(gradient_error[h], (gradients[i] - smooth_gradient(r[i])).norm());
+    }
+    printf("%s: worst error %g, worst gradient error %g\n",
+           h ? "tricubic" : "trilinear", error[h], gradient_error[h]);
+  }
+  // Both interpolations should be close, and tricubic should be much
+  // closer.
+  if (error[0] > 0.05 || gradient_error[0] > 1) {
+    printf("FAIL: trilinear interpolation is too far off!\n");
+    retval++;
+  }
+  if (error[1] > 0.2*error[0] || gradient_error[1] > 0.5*gradient_error[0]) {
+    printf("FAIL: tricubic interpolation is not much better than trilinear!\n");
+    retval++;
+  }
+
+  // The tricubic gradient should be the derivative of the tricubic
+  // values.
+  const double dx = 1e-6;
+  double worst_fd = 0;
+  for (long i=0; i<1000; i++) {
+    Cartesian pts[7];
+    pts[0] = r[i];
+    for (int k=0; k<3; k++) {
+      pts[1+2*k] = Cartesian(r[i] + dx*Vector3d::Unit(k));
+      pts[2+2*k] = Cartesian(r[i] - dx*Vector3d::Unit(k));
+    }
+    double v[7];
+    Cartesian grad[7];
+    g.Sample(pts, 7, v, grad, Grid::tricubic);
+    for (int k=0; k<3; k++) {
+      worst_fd = fmax(worst_fd, fabs((v[1+2*k] - v[2+2*k])/(2*dx) - grad[0](k)));
+    }
+  }
+  printf("tricubic gradient differs from finite differences by %g\n", worst_fd);
+  if (worst_fd > 1e-6) {
+    printf("FAIL: tricubic gradient is not the derivative of the tricubic values!\n");
+    retval++;
+  }
+
+  delete[] r;
+  delete[] values;
+  delete[] gradients;
+}
+
+int main(int, char **argv) {
+  check("a cubic cell", Lattice(Cartesian(5,0,0), Cartesian(0,5,0), Cartesian(0,0,5)), 0.2);
+  check("an fcc cell", Lattice(Cartesian(0,5,5), Cartesian(5,0,5), Cartesian(5,5,0)), 0.2);
+  check("a skewed cell", Lattice(Cartesian(4,0,0), Cartesian(1,5,0), Cartesian(0.5,1,6)), 0.25);
+
+  if (retval == 0) {
+    printf("\n%s passes!\n", argv[0]);
+  } else {
+    printf("\n%s fails %d tests!\n", argv[0], retval);
+    return retval;
+  }
+}
@@ -14,14 +14,11 @@
 //
 // Please see the file AUTHORS for a list of authors.
 
-// #include <sched.h> // linux-specific, for sched_setaffinity
-
 #include <sys/time.h>
 #include <sys/resource.h>
 
 #include <stdio.h>
 #include <time.h>
-#include <unistd.h>
 #include <string.h>
 #include "OptimizedFunctionals.h"
 #include "ContactDensity.h"
@@ -30,31 +27,21 @@
 #include "utilities.h"
 
 int retval = 0;
-int numoops = 0;
-static double majorfaults = 0.0;
 double get_time() {
   struct rusage usage;
   getrusage(RUSAGE_SELF, &usage);
-  majorfaults = usage.ru_majflt/1024.0/4.0;
   return usage.ru_utime.tv_sec + 1e-6*usage.ru_utime.tv_usec;
-  // return clock()/double(CLOCKS_PER_SEC);
 }
 
 double last_time = get_time();
 
-char *hn = new char[80+1];
-
 double check_peak(const char *name, const char *name2, FILE *out,
-                  double peakmin, double peakmax,
-                  double cpu = 0, double cpurat = 1.6) {
+                  double peakmin, double peakmax) {
   printf("===> Testing %s of %s <===\n", name, name2);
-  
+
   double cputime = get_time() - last_time;
   double peak = peak_memory()/1024.0/1024;
-  if (cpu)
-    printf("CPU time is %g s (%.0f%%, with memory use %.0f M)\n", cputime, (cputime - cpu)/cpu*100, peak);
-  else
-    printf("CPU time is %g s (with memory use %.0f M)\n", cputime, peak);
+  printf("CPU time is %g s (with memory use %.0f M)\n", cputime, peak);
   if (peak < peakmin) {
     printf("FAIL: Peak memory use of %s %s should be at least %g (but it's %g)!\n", name, name2, peakmin, peak);
     retval++;
@@ -63,18 +50,6 @@ double check_peak(const char *name, const char *name2, FILE *out,
     printf("FAIL: Peak memory use of %s %s should be under %g (but it's %g)!\n", name, name2, peakmax, peak);
     retval++;
   }
-  if (cpu) {
-    if (cputime < cpu/cpurat) {
-      printf("OOPS: CPU time of %s %s should be at least %g!\n", name, name2, cpu/cpurat);
-      //retval++;
-      numoops++;
-    }
-    if (cputime > cpu*cpurat) {
-      printf("OOPS: CPU time of %s %s should be under %g!\n", name, name2, cpu*cpurat);
-      //retval++;
-      numoops++;
-    }
-  }
   if (out) {
     fprintf(out, "%g\t%g\n", peak, cputime);
     fflush(out);
@@ -100,7 +75,11 @@ double incavity(Cartesian r) {
   return 1 - notincavity(r);
 }
 
-void check_a_functional(const char *name, Functional f, const Grid &x) {
+// The mem arguments are the peak memory use in megabytes of the
+// energy, the gradient, the gradient with the preconditioned gradient,
+// and the preconditioned gradient alone.
+void check_a_functional(const char *name, Functional f, const Grid &x,
+                        double memE, double memG, double memP, double memPonly) {
   const double kT = hughes_water_prop.kT; // room temperature in Hartree
 
   printf("\n***********");
@@ -110,67 +89,23 @@ void check_a_functional(const char *name, Functional f, const Grid &x) {
   printf("***********\n\n");
   fflush(stdout);
 
-  double memE, cpuE, memG, cpuG, memP, cpuP, memPonly, cpuPonly;
-
-  FILE *out;
-  {
-    char *fname = new char[1024];
-    snprintf(fname, 1024, "tests/bench/good/%s.%s", name, hn);
-    FILE *good = fopen(fname, "r");
-    bool nocpu = false;
-    if (majorfaults) {
-      printf("Refusing to test cpu times, since there is swapping going on! (%g M)\n", majorfaults);
-      nocpu = true;
-    }
-    if (!good || fscanf(good, " mem cpu %lg %lg %lg %lg %lg %lg %lg %lg",
-                        &memE, &cpuE,
-                        &memG, &cpuG,
-                        &memP, &cpuP,
-                        &memPonly, &cpuPonly) != 8) {
-      printf("Unable to open file %s, will not check cpu times!\n", fname);
-      nocpu = true;
-    } else {
-      fclose(good);
-    }
-    snprintf(fname, 1024, "tests/bench/good/%s.kipu", name);
-    good = fopen(fname, "r");
-    if (!good) {
-      printf("Unable to open file %s, so I have to fail!\n", fname);
-      exit(1);
-    }
-    if (fscanf(good, " mem cpu %lg %*g %lg %*g %lg %*g %lg %*g",
-               &memE, &memG, &memP, &memPonly) != 4) {
-      printf("Unable to read file %s\n", fname);
-      exit(1);
-    }
-    fclose(good);
-    if (nocpu) {
-      cpuE = cpuG = cpuP = cpuPonly = 0;
-    }
-    // snprintf(fname, 1024, "tests/bench/%s.%s", name, hn);
-    // out = fopen(fname, "w");
-    // if (!out) {
-    //   printf("Unable to create file %s\n", fname);
-    //   exit(1);
-    // }
-    // fprintf(out, "mem\tcpu\n");
-    out = stdout;
-    delete[] fname;
-  }
+  // The CPU times are checked by tests/benchmark.cpp, so here we only
+  // check the memory use, which doesn't depend on the computer.
+  FILE *out = stdout;
 
   reset_peak_memory();
   last_time = get_time();
 
   f.integral(kT, x);
   //printf("\n\nEnergy of %s is %g\n", name, f.integral(x));
-  check_peak("Energy", name, out, memE-0.1, memE+0.1, cpuE);
+  check_peak("Energy", name, out, memE-0.1, memE+0.1);
 
   Grid mygrad(x);
   mygrad.setZero();
   f.integralgrad(kT, x, &mygrad);
   //printf("Grad of %s is: %g\n", name, out, mygrad.norm());
 
-  check_peak("Gradient", name, out, memG-0.1, memG+0.1, cpuG);
+  check_peak("Gradient", name, out, memG-0.1, memG+0.1);
   
   {
     Grid mypgrad(x);
@@ -178,34 +113,13 @@ void check_a_functional(const char *name, Functional f, const Grid &x) {
     mypgrad.setZero();
     f.integralgrad(kT, x, &mygrad, &mypgrad);
   }
-  check_peak("Gradient and preconditioned gradient", name, out, memP-0.1, memP+0.1, cpuP);
+  check_peak("Gradient and preconditioned gradient", name, out, memP-0.1, memP+0.1);
 
   f.integralpgrad(kT, x, &mygrad);
-  check_peak("Preconditioned gradient", name, out, memPonly-0.1, memPonly+0.1, cpuPonly);
-
-  fclose(out);
+  check_peak("Preconditioned gradient", name, out, memPonly-0.1, memPonly+0.1);
 }
 
 int main(int, char **argv) {
-  // {
-  //   // Here I set this test to continue running on its current cpu.
-  //   // This is a slightly hokey trick to try to avoid any timings
-  //   // variation due to NUMA and the process bouncing from one CPU to
-  //   // another.  Ideally we'd figure out a better way to decide on
-  //   // which CPU to use for real jobs.
-  //   cpu_set_t cpus;
-  //   CPU_ZERO(&cpus);
-  //   CPU_SET(sched_getcpu(), &cpus);
-  //   int err = sched_setaffinity(0, sizeof(cpu_set_t), &cpus);
-  //   if (err != 0) {
-  //     printf("Error from sched_setaffinity: %d\n", err);
-  //   }
-  // }
-  // Let's figure out which machine we're running on (since we only
-  // want to test CPU time if we have timings for this particular
-  // machine).
-  gethostname(hn, 80);
-
   const double kT = hughes_water_prop.kT; // room temperature in Hartree
   const double eta_one = 3.0/(4*M_PI*R*R*R);
   const double nliquid = 0.324*eta_one;
@@ -246,7 +160,7 @@ int main(int, char **argv) {
 
   ff = OfEffectivePotential(SaftFluid2(R, eps, kappa, hughes_water_prop.epsilon_dispersion,
                                        hughes_water_prop.lambda_dispersion, hughes_water_prop.length_scaling, mu));
-  check_a_functional("SaftFluid2", ff, potential);
+  check_a_functional("SaftFluid2", ff, potential, 38.4495, 69.9328, 73.4159, 73.4159);
 
   //ff = OfEffectivePotential(SaftFluid(R, eps, kappa, hughes_water_prop.epsilon_dispersion,
   //                                    hughes_water_prop.lambda_dispersion, hughes_water_prop.length_scaling, mu));
@@ -269,19 +183,14 @@ int main(int, char **argv) {
   //check_a_functional("Dispersion", ff, potential);
 
   ff = constrain(constraint, (HardSpheresWBnotensor(R) + ChemicalPotential(mu))(n) + IdealGasOfVeff());
-  check_a_functional("HardSpheresWBnotensor", ff, potential);
+  check_a_functional("HardSpheresWBnotensor", ff, potential, 52.3365, 87.1672, 94.1334, 90.6503);
 
   //ff = constrain(constraint, (HardSpheresNoTensor(R) + ChemicalPotential(mu))(n) + IdealGasOfVeff());
   //check_a_functional("HardSphereNoTensor", ff, potential);
 
   ff = constrain(constraint, (HardSpheresNoTensor2(R) + ChemicalPotential(mu))(n) + IdealGasOfVeff());
-  check_a_functional("HardSpheresNoTensor2", ff, potential);
+  check_a_functional("HardSpheresNoTensor2", ff, potential, 45.4156, 66.4045, 73.3707, 69.8876);
 
-  if (numoops == 0) {
-    printf("\n%s has no oopses!\n", argv[0]);
-  } else {
-    printf("\n%s sort of fails %d tests!\n", argv[0], numoops);
-  }
   if (retval == 0) {
     printf("\n%s passes!\n", argv[0]);
   } else {
@@ -0,0 +1,103 @@
+// Deft is a density functional package developed by the research
+// group of Professor David Roundy
+//
+// Copyright 2010 The Deft Authors
+//
+// Deft is free software; you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// You should have received a copy of the GNU General Public License
+// along with deft; if not, write to the Free Software Foundation,
+// Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+//
+// Please see the file AUTHORS for a list of authors.
+
+// This checks that MoveScheduler tunes the steps of two kinds of move
+// to the acceptance goal, leaves them alone once frozen, and shares
+// out the moves so that each kind gets its share of the CPU time.  The
+// "moves" are a point taking uniform steps between hard walls at -1
+// and 1, where bigger steps are rejected more often.
+
+#include <stdio.h>
+#include <math.h>
+#include "vector3d.h"
+#include "Monte-Carlo/move-scheduler.h"
+
+int retval = 0;
+
+double x[2] = { 0, 0 };
+
+// sweep makes 100 moves of kind m, pretending that each one takes
+// cost seconds, and returns how many were accepted.
+long sweep(MoveScheduler &scheduler, int m, double cost) {
+  long accepted = 0;
+  for (int i=0; i<100; i++) {
+    const double trial = x[m] + scheduler.step(m)*(2*random::ran() - 1);
+    if (fabs(trial) <= 1) {
+      x[m] = trial;
+      accepted++;
+    }
+  }
+  scheduler.record(m, 100, accepted, 100*cost);
+  return accepted;
+}
+
+void check_rate(const char *name, double rate, double goal, double fuzz) {
+  printf("%s acceptance rate is %g\n", name, rate);
+  if (fabs(rate - goal) > fuzz) {
+    printf("FAIL: %s acceptance rate should be %g!\n", name, goal);
+    retval++;
+  }
+}
+
+int main(int, char **argv) {
+  random::seed(0);
+  const double goal = 0.5;
+  const double cost[2] = { 1e-6, 3e-6 };
+  MoveScheduler scheduler(goal);
+  const int cheap = scheduler.add("cheap", 0.01, 10);
+  const int costly = scheduler.add("costly", 5, 3, 2);
+  if (scheduler.step(costly) != 3) {
+    printf("FAIL: the step should start out no bigger than its maximum!\n");
+    retval++;
+  }
+
+  for (int i=0; i<20000; i++) {
+    const int m = scheduler.choose();
+    sweep(scheduler, m, cost[m]);
+  }
+  scheduler.print(stdout, "tuned ");
+  scheduler.freeze();
+  const double cheap_step = scheduler.step(cheap), costly_step = scheduler.step(costly);
+
+  long attempts[2] = { 0, 0 }, accepted[2] = { 0, 0 };
+  for (int i=0; i<20000; i++) {
+    const int m = scheduler.choose();
+    attempts[m] += 100;
+    accepted[m] += sweep(scheduler, m, cost[m]);
+  }
+  scheduler.print(stdout, "frozen ");
+  if (scheduler.step(cheap) != cheap_step || scheduler.step(costly) != costly_step) {
+    printf("FAIL: the steps changed after we froze them!\n");
+    retval++;
+  }
+  check_rate("cheap", double(accepted[cheap])/attempts[cheap], goal, 0.03);
+  check_rate("costly", double(accepted[costly])/attempts[costly], goal, 0.03);
+  // The costly moves take three times as long, and should get twice the
+  // CPU time, so there should be 2/3 as many of them.
+  const double ratio = double(attempts[costly])/attempts[cheap];
+  printf("costly moves per cheap move: %g\n", ratio);
+  if (fabs(ratio - 2.0/3) > 0.05) {
+    printf("FAIL: there should be 2/3 as many costly moves as cheap ones!\n");
+    retval++;
+  }
+
+  if (retval == 0) {
+    printf("\n%s passes!\n", argv[0]);
+  } else {
+    printf("\n%s fails %d tests!\n", argv[0], retval);
+    return retval;
+  }
+}
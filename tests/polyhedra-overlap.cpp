@@ -0,0 +1,105 @@
+// Deft is a density functional package developed by the research
+// group of Professor David Roundy
+//
+// Copyright 2010 The Deft Authors
+//
+// Deft is free software; you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// You should have received a copy of the GNU General Public License
+// along with deft; if not, write to the Free Software Foundation,
+// Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+//
+// Please see the file AUTHORS for a list of authors.
+
+// This checks the overlap tests of polyhedra.h, which use each
+// polyhedron's cached orientation, against a straightforward
+// separating axis test that rotates every vertex for every pair, for
+// random pairs of each shape that are close enough to sometimes
+// overlap.
+
+#include <stdio.h>
+#include "Monte-Carlo/polyhedra.h"
+#include "handymath.h"
+
+int retval = 0;
+
+// extent finds the extent of p along axis, after moving p by shift.
+void extent(const polyhedron &p, const vector3d &axis, const vector3d &shift, double dr,
+            double *pmin, double *pmax) {
+  *pmin = 1e300;
+  *pmax = -1e300;
+  for (int j=0; j<p.mypoly->nvertices; j++) {
+    const double x = axis.dot(p.rot.rotate_vector(p.mypoly->vertices[j]*(p.R+dr)) + shift);
+    *pmin = min(x, *pmin);
+    *pmax = max(x, *pmax);
+  }
+}
+
+bool slow_overlap(const polyhedron &a, const polyhedron &b, const double periodic[3], double dr) {
+  const vector3d ab = periodic_diff(a.pos, b.pos, periodic);
+  if (ab.normsquared() > sqr(a.R + b.R + 2*dr)) return false;
+  const polyhedron *both[2] = { &a, &b };
+  for (int s=0; s<2; s++) {
+    for (int i=0; i<both[s]->mypoly->nfaces; i++) {
+      const vector3d axis = both[s]->rot.rotate_vector(both[s]->mypoly->faces[i]);
+      double amin, amax, bmin, bmax;
+      extent(a, axis, vector3d(), dr, &amin, &amax);
+      extent(b, axis, ab, dr, &bmin, &bmax);
+      if (amin > bmax || bmin > amax) return false;
+    }
+  }
+  return true;
+}
+
+void check_shape(const char *name) {
+  const poly_shape shape(name);
+  const double periodic[3] = { 6, 6, 6 };
+  const int N = 2;
+  polyhedron p[N];
+  for (int i=0; i<N; i++) {
+    p[i].mypoly = &shape;
+    p[i].R = 1;
+  }
+  initialize_neighbor_tables(p, N, 10, N, periodic);
+  long disagreements = 0, overlaps = 0;
+  const long trials = 200000;
+  for (long trial=0; trial<trials; trial++) {
+    for (int i=0; i<N; i++) {
+      p[i].pos = fix_periodic(vector3d::ran(1.5), periodic);
+      p[i].rot = rotation::ran();
+    }
+    const double dr = (trial % 3 == 0) ? 0.1 : 0;
+    const bool slow = slow_overlap(p[0], p[1], periodic, dr);
+    overlaps += slow;
+    if (overlap(p[0], p[1], periodic, dr) != slow) disagreements++;
+    if ((overlaps_with_any(p[0], p, periodic, false, dr) != 0) != slow) disagreements++;
+    // Rotating a copy must not change the original.
+    polyhedron moved = random_move(p[1], 0.1, 0.5, periodic);
+    if (overlap(p[0], moved, periodic, dr) != slow_overlap(p[0], moved, periodic, dr)) disagreements++;
+    if (overlap(p[0], p[1], periodic, dr) != slow) disagreements++;
+  }
+  printf("%s: %ld of %ld pairs overlap\n", name, overlaps, trials);
+  // Pairs that just touch could come out either way with roundoff, so
+  // we allow a very few disagreements.
+  if (disagreements > trials/100000) {
+    printf("FAIL: %s overlap disagrees with the slow version %ld times!\n", name, disagreements);
+    retval++;
+  }
+}
+
+int main(int, char **argv) {
+  random::seed(0);
+  check_shape("cube");
+  check_shape("tetrahedron");
+  check_shape("truncated_tetrahedron");
+
+  if (retval == 0) {
+    printf("\n%s passes!\n", argv[0]);
+  } else {
+    printf("\n%s fails %d tests!\n", argv[0], retval);
+    return retval;
+  }
+}
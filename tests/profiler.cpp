@@ -0,0 +1,111 @@
+// Deft is a density functional package developed by the research
+// group of Professor David Roundy
+//
+// Copyright 2010 The Deft Authors
+//
+// Deft is free software; you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// You should have received a copy of the GNU General Public License
+// along with deft; if not, write to the Free Software Foundation,
+// Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+//
+// Please see the file AUTHORS for a list of authors.
+
+// This checks that the profiler counts calls, FFTs and memory for
+// nested terms, and writes them to its report.
+
+#include <stdio.h>
+#include <string.h>
+#include "ReciprocalGrid.h"
+#include "Profiler.h"
+
+int retval = 0;
+
+// find_term returns the line of the report that describes a term, or
+// an empty string.
+std::string find_term(const char *fname, const char *term, const char *call) {
+  FILE *f = fopen(fname, "r");
+  if (!f) return "";
+  char want[1024];
+  snprintf(want, sizeof(want), "{\"term\": \"%s\", \"call\": \"%s\"", term, call);
+  char line[4096];
+  std::string out;
+  while (fgets(line, sizeof(line), f)) {
+    if (strstr(line, want)) out = line;
+  }
+  fclose(f);
+  return out;
+}
+
+long get(const std::string &line, const char *what) {
+  const std::string key = std::string("\"") + what + "\": ";
+  const size_t i = line.find(key);
+  if (i == std::string::npos) return -1;
+  return atol(line.c_str() + i + key.size());
+}
+
+void check(const char *name, long value, long lo, long hi) {
+  printf("%s is %ld\n", name, value);
+  if (value < lo || value > hi) {
+    printf("FAIL: %s should be from %ld to %ld!\n", name, lo, hi);
+    retval++;
+  }
+}
+
+int main(int, char **argv) {
+  const char *report = "/tmp/deft-profiler-test.json";
+  const char *trace = "/tmp/deft-profiler-test-trace.json";
+  profile_start(report, trace);
+
+  const Lattice lat(Cartesian(4,0,0), Cartesian(0,4,0), Cartesian(0,0,4));
+  GridDescription gd(lat, 0.0625); // 64^3, or 2 MB per grid
+  const long bytes = gd.NxNyNz*sizeof(double);
+  Grid g(gd);
+  g.setZero();
+
+  for (int i=0; i<3; i++) {
+    ProfileScope outer("outer", "integral");
+    Grid scratch(g);
+    {
+      ProfileScope inner("inner", "grad");
+      Grid a(g), b(g);
+      a.fft();
+    }
+    scratch.fft();
+  }
+  profile_write();
+
+  const std::string outer = find_term(report, "outer", "integral");
+  const std::string inner = find_term(report, "inner", "grad");
+  check("outer calls", get(outer, "calls"), 3, 3);
+  check("inner calls", get(inner, "calls"), 3, 3);
+  check("outer ffts", get(outer, "ffts"), 6, 6);
+  check("inner ffts", get(inner, "ffts"), 3, 3);
+  // Each fft allocates a ReciprocalGrid about the size of a Grid.
+  check("inner bytes allocated", get(inner, "bytes_allocated"), 3*3*bytes, 4*3*bytes);
+  check("outer bytes allocated", get(outer, "bytes_allocated"), 3*5*bytes, 6*3*bytes);
+  // The inner peak has a, b and the transform; the outer adds scratch.
+  check("inner peak", get(inner, "peak_bytes"), 3*bytes, 4*bytes);
+  check("outer peak", get(outer, "peak_bytes"), 4*bytes, 5*bytes);
+
+  FILE *f = fopen(trace, "r");
+  int events = 0;
+  if (f) {
+    char line[4096];
+    while (fgets(line, sizeof(line), f)) if (strstr(line, "\"ph\": \"X\"")) events++;
+    fclose(f);
+  }
+  check("trace events", events, 6, 6);
+
+  remove(report);
+  remove(trace);
+  if (retval == 0) {
+    printf("\n%s passes!\n", argv[0]);
+  } else {
+    printf("\n%s fails %d tests!\n", argv[0], retval);
+    return retval;
+  }
+}
@@ -0,0 +1,107 @@
+// Deft is a density functional package developed by the research
+// group of Professor David Roundy
+//
+// Copyright 2010 The Deft Authors
+//
+// Deft is free software; you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// You should have received a copy of the GNU General Public License
+// along with deft; if not, write to the Free Software Foundation,
+// Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+//
+// Please see the file AUTHORS for a list of authors.
+
+// This checks that a RadialDistributionTable gives back the Monte-Carlo
+// g(r) it was read from at the points of the table, interpolates
+// linearly between them, and is unchanged by saving and loading it.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include "RadialDistributionTable.h"
+
+int retval = 0;
+
+void check(const char *name, double fast, double slow) {
+  if (fabs(fast - slow) > 1e-12) {
+    printf("FAIL: %s gives %.15g rather than %.15g\n", name, fast, slow);
+    retval++;
+  }
+}
+
+int main(int, char **argv) {
+  RadialDistributionTable t;
+  if (!t.ReadMonteCarlo("papers/pair-correlation/figs/gr", 10, 0.05, 1300)) {
+    printf("FAIL: could not read the Monte-Carlo g(r)!\n");
+    return 1;
+  }
+
+  // At each packing fraction in the table, and at each radius in the
+  // file, we should get just what is in the file.
+  for (int ieta = 1; ieta < t.num_eta(); ieta++) {
+    const double eta = ieta*t.eta_step();
+    char fname[4096];
+    snprintf(fname, sizeof fname, "papers/pair-correlation/figs/gr-%2.2f.dat", eta);
+    FILE *in = fopen(fname, "r");
+    double r, etag;
+    int lines = 0;
+    while (fscanf(in, " %lg %lg", &r, &etag) == 2) {
+      if (lines < t.num_r() - 1) check(fname, t(eta, r), etag/eta);
+      lines++;
+    }
+    fclose(in);
+  }
+
+  // Between packing fractions and between radii, we should get the
+  // average.
+  const double eta0 = 2*t.eta_step(), eta1 = 3*t.eta_step();
+  const double r0 = 2 + 99.5*t.r_step(), r1 = r0 + t.r_step();
+  check("halfway", t((eta0 + eta1)/2, (r0 + r1)/2),
+        (t(eta0, r0) + t(eta1, r0) + t(eta0, r1) + t(eta1, r1))/4);
+  check("inside contact", t(0.3, 1.9), 0);
+  check("beyond the table", t(0.3, 20), 1);
+  if (t(0.6, 3) == t(0.6, 3)) {
+    printf("FAIL: a packing fraction beyond the table does not give NaN\n");
+    retval++;
+  }
+
+  // Saving and loading the table, and looking up many points at once,
+  // should give just the same numbers.
+  const char *saved = "/tmp/radial-distribution-table.field";
+  RadialDistributionTable loaded;
+  if (!t.Save(saved) || !loaded.Load(saved)) {
+    printf("FAIL: could not save and load the table!\n");
+    return 1;
+  }
+  remove(saved);
+  const long n = 100000;
+  double *etas = new double[n], *rs = new double[n], *g = new double[n];
+  for (long i=0; i<n; i++) {
+    etas[i] = 0.5*rand()/(RAND_MAX + 1.0);
+    rs[i] = 16*rand()/(RAND_MAX + 1.0);
+  }
+  loaded.Evaluate(etas, rs, n, g);
+  long disagreements = 0;
+  for (long i=0; i<n; i++) {
+    if (g[i] != t(etas[i], rs[i]) && !(g[i] != g[i] && t(etas[i], rs[i]) != t(etas[i], rs[i]))) {
+      disagreements++;
+    }
+  }
+  if (disagreements) {
+    printf("FAIL: the loaded table disagrees %ld times!\n", disagreements);
+    retval++;
+  }
+  delete[] etas;
+  delete[] rs;
+  delete[] g;
+
+  if (retval == 0) {
+    printf("\n%s passes!\n", argv[0]);
+  } else {
+    printf("\n%s fails %d tests!\n", argv[0], retval);
+    return retval;
+  }
+}
@@ -0,0 +1,137 @@
+// Deft is a density functional package developed by the research
+// group of Professor David Roundy
+//
+// Copyright 2010 The Deft Authors
+//
+// Deft is free software; you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// You should have received a copy of the GNU General Public License
+// along with deft; if not, write to the Free Software Foundation,
+// Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+//
+// Please see the file AUTHORS for a list of authors.
+
+// This checks Grid::ShellProjection and Grid::RadialHistogram against
+// the straightforward loop over every grid point and every radius.
+
+#include <stdio.h>
+#include <time.h>
+#include "Grid.h"
+
+int retval = 0;
+
+double bumpy(Cartesian r) {
+  return exp(-r.norm()) + 0.1*cos(3*r(0))*sin(2*r(1)+r(2));
+}
+
+void brute_shell_projection(const Grid &g, const VectorXd &R, VectorXd *output) {
+  const GridDescription gd = g.description();
+  output->setZero();
+  VectorXd norm(*output);
+  const double wid = 0.5*pow(gd.fineLat.volume(), 1.0/3);
+  for (int x=0; x<gd.Nx; x++) {
+    for (int y=0; y<gd.Ny; y++) {
+      for (int z=0; z<gd.Nz; z++) {
+        Cartesian h(gd.Lat.wignerSeitz(gd.Lat.toCartesian(Relative(x*gd.dx,y*gd.dy,z*gd.dz))));
+        double r = h.norm();
+        for (int ir=0;ir<R.rows();ir++) {
+          double dr = fabs(r-R[ir]);
+          if (dr < 3*wid) {
+            double w = exp(-dr*dr/(wid*wid));
+            norm[ir] += w;
+            (*output)[ir] += w*g(x,y,z);
+          }
+        }
+      }
+    }
+  }
+  output->cwise() /= norm;
+}
+
+void brute_histogram(const Grid &g, double dr, VectorXd *output) {
+  const GridDescription gd = g.description();
+  output->setZero();
+  VectorXd count(*output);
+  for (int x=0; x<gd.Nx; x++) {
+    for (int y=0; y<gd.Ny; y++) {
+      for (int z=0; z<gd.Nz; z++) {
+        Cartesian h(gd.Lat.wignerSeitz(gd.Lat.toCartesian(Relative(x*gd.dx,y*gd.dy,z*gd.dz))));
+        int bin = floor(h.norm()/dr);
+        if (bin < output->rows()) {
+          (*output)[bin] += g(x,y,z);
+          count[bin] += 1;
+        }
+      }
+    }
+  }
+  output->cwise() /= count;
+}
+
+void compare(const char *name, const VectorXd &fast, const VectorXd &slow) {
+  double worst = 0;
+  for (int i=0; i<fast.rows(); i++) {
+    if (slow[i] != slow[i]) {
+      if (fast[i] == fast[i]) {
+        printf("FAIL: %s gives %g rather than NaN in empty shell %d\n", name, fast[i], i);
+        retval++;
+      }
+    } else {
+      worst = fmax(worst, fabs(fast[i] - slow[i]));
+    }
+  }
+  printf("%s: worst error %g\n", name, worst);
+  if (worst > 1e-12) {
+    printf("FAIL: %s disagrees with the brute force version!\n", name);
+    retval++;
+  }
+}
+
+void check(const char *name, const Lattice &lat, double resolution) {
+  printf("\nChecking %s...\n", name);
+  GridDescription gd(lat, resolution);
+  Grid g(gd);
+  g.Set(bumpy);
+
+  const double rmax = pow(lat.volume(), 1.0/3);
+  const int NR = 200;
+  // We project onto the radii in a scrambled order, to check that the
+  // fast version doesn't count on them being sorted.
+  VectorXd R(NR);
+  for (int i=0; i<NR; i++) R[i] = rmax*((37*i) % NR)/NR;
+
+  VectorXd fast(NR), slow(NR);
+  clock_t start = clock();
+  brute_shell_projection(g, R, &slow);
+  const double slow_time = (clock() - double(start))/CLOCKS_PER_SEC;
+  start = clock();
+  g.ShellProjection(R, &fast);
+  const double first_time = (clock() - double(start))/CLOCKS_PER_SEC;
+  start = clock();
+  g.ShellProjection(R, &fast);
+  const double fast_time = (clock() - double(start))/CLOCKS_PER_SEC;
+  printf("ShellProjection took %g seconds (%g the first time) versus %g\n",
+         fast_time, first_time, slow_time);
+  compare("ShellProjection", fast, slow);
+
+  const double dr = 0.37*resolution;
+  VectorXd hfast(int(rmax/dr)), hslow(int(rmax/dr));
+  g.RadialHistogram(dr, &hfast);
+  brute_histogram(g, dr, &hslow);
+  compare("RadialHistogram", hfast, hslow);
+}
+
+int main(int, char **argv) {
+  check("a cubic cell", Lattice(Cartesian(5,0,0), Cartesian(0,5,0), Cartesian(0,0,5)), 0.2);
+  check("an fcc cell", Lattice(Cartesian(0,5,5), Cartesian(5,0,5), Cartesian(5,5,0)), 0.2);
+  check("a skewed cell", Lattice(Cartesian(4,0,0), Cartesian(1,5,0), Cartesian(0.5,1,6)), 0.25);
+
+  if (retval == 0) {
+    printf("\n%s passes!\n", argv[0]);
+  } else {
+    printf("\n%s fails %d tests!\n", argv[0], retval);
+    return retval;
+  }
+}
@@ -0,0 +1,192 @@
+// Deft is a density functional package developed by the research
+// group of Professor David Roundy
+//
+// Copyright 2010 The Deft Authors
+//
+// Deft is free software; you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// You should have received a copy of the GNU General Public License
+// along with deft; if not, write to the Free Software Foundation,
+// Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+//
+// Please see the file AUTHORS for a list of authors.
+
+// This checks that Reweighting gets the same thermodynamics as a
+// straightforward sum in long double, for a density of states far too
+// big for exp() in double, that it ignores the energies an -lndos.dat
+// file lists but the run never reached, that it reads the density of
+// states from an energy histogram and its weights just as from an
+// -lndos.dat file, that
+// it normalizes and reweights g(r), and that saving and loading it, or
+// using more threads, changes nothing.
+
+#include <stdio.h>
+#include <math.h>
+#include <vector>
+#include "Monte-Carlo/reweighting.h"
+
+int retval = 0;
+
+const int levels = 200;
+double lndos(int i) { return 900 + 3*i - 0.02*i*i; }
+
+void check(const char *name, double T, double got, double want, double fuzz) {
+  if (!(fabs(got - want) <= fuzz*(1 + fabs(want)))) {
+    printf("FAIL: %s at T = %g is %.15g rather than %.15g\n", name, T, got, want);
+    retval++;
+  }
+}
+
+void check_same(const char *name, const std::vector<double> &a, const std::vector<double> &b) {
+  for (unsigned j=0; j<a.size(); j++) {
+    if (a[j] != b[j]) {
+      printf("FAIL: %s gives %.17g rather than %.17g at %u\n", name, a[j], b[j], j);
+      retval++;
+      return;
+    }
+  }
+}
+
+// thermodynamics returns U, C_V, S and F at each temperature, one after
+// another.
+std::vector<double> thermodynamics(const Reweighting &rw, const std::vector<double> &T) {
+  const long n = T.size();
+  std::vector<double> out(4*n);
+  rw.Thermodynamics(&T[0], n, &out[0], &out[n], &out[2*n], &out[3*n]);
+  return out;
+}
+
+int main(int, char **argv) {
+  // Like a real -lndos.dat file, ours has no pessimistic samples at
+  // the highest energies (at or above the max_entropy_state), and
+  // carries ln D flat on down to energies the run never reached, which
+  // would dominate at low temperature if we believed them.
+  const char *dos_fname = "/tmp/reweighting-lndos.dat";
+  FILE *f = fopen(dos_fname, "w");
+  fprintf(f, "# energy\tlndos\tps\n");
+  for (int i=0; i<levels; i++) fprintf(f, "%d\t%.17g\t%d\n", i, lndos(i), i < 5 ? 0 : 1);
+  for (int i=levels; i<levels+100; i++) fprintf(f, "%d\t%.17g\t%d\n", i, lndos(levels-1), 0);
+  fclose(f);
+
+  std::vector<double> T;
+  for (double t=0.02; t<5; t *= 1.1) T.push_back(t);
+  const long nT = T.size();
+
+  Reweighting rw;
+  rw.set_threads(1);
+  if (!rw.ReadDos(dos_fname) || rw.num_energies() != levels) {
+    printf("FAIL: could not read %s\n", dos_fname);
+    return 1;
+  }
+  const std::vector<double> thermo = thermodynamics(rw, T);
+  long double Zinf = 0;
+  for (int i=0; i<levels; i++) Zinf += expl(lndos(i));
+  for (long j=0; j<nT; j++) {
+    long double Z = 0, ZE = 0, ZEE = 0;
+    for (int i=0; i<levels; i++) {
+      const long double w = expl(lndos(i) + i/T[j]);
+      Z += w;
+      ZE -= w*i;
+      ZEE += w*i*i;
+    }
+    const double U = ZE/Z;
+    const double CV = (ZEE/Z - (ZE/Z)*(ZE/Z))/(T[j]*T[j]);
+    const double S = logl(Z) + U/T[j] - logl(Zinf);
+    // Our reference C_V loses digits at low temperature, where the
+    // energy hardly fluctuates.
+    check("U", T[j], thermo[j], U, 1e-10);
+    check("C_V", T[j], thermo[nT + j], CV, 1e-6);
+    check("S", T[j], thermo[2*nT + j], S, 1e-10);
+    check("F", T[j], thermo[3*nT + j], U - T[j]*S, 1e-10);
+  }
+  printf("U(%g) = %g, C_V(%g) = %g\n", T[0], thermo[0], T[nT-1], thermo[2*nT-1]);
+
+  rw.set_threads(4);
+  check_same("four threads", thermodynamics(rw, T), thermo);
+
+  // An energy histogram H(E) with weights w(E) gives D(E) = H(E)/w(E).
+  {
+    FILE *e_out = fopen("/tmp/reweighting-E.dat", "w");
+    FILE *w_out = fopen("/tmp/reweighting-lnw.dat", "w");
+    fprintf(e_out, "# energy   counts\n");
+    fprintf(w_out, "# energy\tln(weight)\n");
+    for (int i=0; i<levels; i++) {
+      const long counts = 1000 + i;
+      fprintf(e_out, "%i  %ld\n", i, counts);
+      fprintf(w_out, "%i  %.17g\n", i, log(double(counts)) - lndos(i));
+    }
+    // The weights go beyond the energies we visited.
+    fprintf(w_out, "%i  0\n", levels);
+    fclose(e_out);
+    fclose(w_out);
+    Reweighting hist;
+    if (!hist.ReadHistogram("/tmp/reweighting-E.dat", "/tmp/reweighting-lnw.dat")) {
+      printf("FAIL: could not read the energy histogram\n");
+      return 1;
+    }
+    for (long i=0; i<hist.num_energies(); i++) check("ln D", -i, hist.ln_dos(i), lndos(i), 1e-12);
+  }
+
+  // We make a g(r) file for a cell with 10 spheres in 1000 cubic
+  // units, with g = 1 + b at energy -b for the first two energies, so
+  // the rest are dropped.
+  {
+    const int N = 10, bins = 4;
+    const double len = 10, de_g = 0.5;
+    FILE *g_out = fopen("/tmp/reweighting-g.dat", "w");
+    fprintf(g_out, "# N: %i\n# cell dimensions: (%g, %g, %g)\n# de_g: %g\n",
+            N, len, len, len, de_g);
+    fprintf(g_out, "0\t0\t0\t");
+    for (int b=0; b<bins; b++) fprintf(g_out, "%g ", de_g*(b + 0.5));
+    fprintf(g_out, "\n");
+    for (int e=0; e<2; e++) {
+      const long counts = 50 + e;
+      fprintf(g_out, "%d\t%ld\t%g\t", -e, counts, 0.0);
+      for (int b=0; b<bins; b++) {
+        const double shell = 4*M_PI/3*(pow(de_g*(b + 1), 3) - pow(de_g*b, 3));
+        fprintf(g_out, "%.17g ", (1 + e)*counts*N*(N - 1)/(len*len*len)*shell);
+      }
+      fprintf(g_out, "\n");
+    }
+    fclose(g_out);
+    if (!rw.ReadG("/tmp/reweighting-g.dat")) {
+      printf("FAIL: could not read g(r)\n");
+      return 1;
+    }
+    if (rw.num_energies() != 2 || rw.num_observables() != bins || rw.r_step() != de_g) {
+      printf("FAIL: g(r) should leave 2 energies and %d bins, not %ld and %d\n",
+             bins, rw.num_energies(), rw.num_observables());
+      return 1;
+    }
+    std::vector<double> g(nT*bins);
+    rw.Observables(&T[0], nT, &g[0]);
+    for (long j=0; j<nT; j++) {
+      // The second energy is lower by one, so its relative weight is
+      // D(-1)/D(0) exp(1/T).
+      const double p = 1/(1 + exp(lndos(0) - lndos(1) - 1/T[j]));
+      for (int b=0; b<bins; b++) check("g", T[j], g[j*bins + b], 1 + p, 1e-12);
+    }
+
+    const char *saved = "/tmp/reweighting.field";
+    Reweighting loaded;
+    loaded.set_threads(3);
+    if (!rw.Save(saved) || !loaded.Load(saved)) {
+      printf("FAIL: could not save and load %s\n", saved);
+      return 1;
+    }
+    std::vector<double> loaded_g(nT*bins);
+    loaded.Observables(&T[0], nT, &loaded_g[0]);
+    check_same("loaded g", loaded_g, g);
+    check_same("loaded thermodynamics", thermodynamics(loaded, T), thermodynamics(rw, T));
+  }
+
+  if (retval == 0) {
+    printf("\n%s passes!\n", argv[0]);
+  } else {
+    printf("\n%s fails %d tests!\n", argv[0], retval);
+    return retval;
+  }
+}
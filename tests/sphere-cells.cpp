@@ -0,0 +1,127 @@
+// Deft is a density functional package developed by the research
+// group of Professor David Roundy
+//
+// Copyright 2010 The Deft Authors
+//
+// Deft is free software; you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// You should have received a copy of the GNU General Public License
+// along with deft; if not, write to the Free Software Foundation,
+// Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+//
+// Please see the file AUTHORS for a list of authors.
+
+// This checks SphereCells::overlaps against a brute-force check of
+// every sphere and every periodic image, for random trial positions
+// in each of the geometries our drivers use, while spheres move
+// around underneath it.
+
+#include <stdio.h>
+#include <math.h>
+#include "Monte-Carlo/monte-carlo.h"
+#include "Monte-Carlo/sphere-cells.h"
+
+int retval = 0;
+
+double ran() {
+  static MTRand my_mtrand(0ul);
+  return my_mtrand.randExc();
+}
+
+bool brute_force_overlaps(const SphereGeometry &g, const Vector3d *spheres, long N,
+                          const Vector3d &v, long s) {
+  if (g.outside(v)) return true;
+  for (long i=0; i<N; i++) {
+    if (i == s) continue;
+    for (int x=-1; x<=1; x++) {
+      for (int y=-1; y<=1; y++) {
+        for (int z=-1; z<=1; z++) {
+          const int shift[3] = { x, y, z };
+          Vector3d image = spheres[i];
+          bool possible = true;
+          for (int k=0; k<3; k++) {
+            if (shift[k] && !g.periodic[k]) possible = false;
+            image[k] += shift[k]*g.len[k];
+          }
+          if (possible && (image - v).norm() < 2*g.R) return true;
+        }
+      }
+    }
+  }
+  return false;
+}
+
+Vector3d random_point(const SphereGeometry &g) {
+  Vector3d v;
+  for (int k=0; k<3; k++) {
+    const double half = (g.periodic[k] || g.wall[k]) ? g.len[k]/2 : g.outer_radius;
+    v[k] = half*(2*ran() - 1);
+  }
+  return v;
+}
+
+void check_geometry(const char *name, const SphereGeometry &g) {
+  const long N = 60;
+  Vector3d spheres[N];
+  long n = 0;
+  while (n < N) {
+    const Vector3d v = random_point(g);
+    if (!brute_force_overlaps(g, spheres, n, v, -1)) spheres[n++] = v;
+  }
+  SphereCells cells(g, spheres, N);
+  long disagreements = 0, overlaps = 0;
+  for (long trial=0; trial<20000; trial++) {
+    const long s = trial % N;
+    const Vector3d v = g.wrap(spheres[s] + 1.5*Vector3d(ran() - 0.5, ran() - 0.5, ran() - 0.5));
+    const bool fast = cells.overlaps(v, s);
+    if (fast != brute_force_overlaps(g, spheres, N, v, s)) disagreements++;
+    if (fast) {
+      overlaps++;
+    } else {
+      spheres[s] = v;
+      cells.moved(s);
+    }
+  }
+  printf("%s: %ld of 20000 moves rejected\n", name, overlaps);
+  if (disagreements) {
+    printf("FAIL: %s disagrees with brute force %ld times!\n", name, disagreements);
+    retval++;
+  }
+}
+
+int main(int, char **argv) {
+  {
+    SphereGeometry g;
+    for (int k=0; k<3; k++) {
+      g.len[k] = 10;
+      g.periodic[k] = true;
+    }
+    check_geometry("periodxyz", g);
+    g.len[0] = g.len[1] = 14;
+    g.len[2] = 4.5; // too thin for more than one cell
+    check_geometry("periodxyz with thin z", g);
+  }
+  {
+    SphereGeometry g;
+    for (int k=0; k<3; k++) g.len[k] = 12;
+    g.periodic[0] = g.periodic[1] = true;
+    g.wall[2] = true;
+    check_geometry("periodxy wallz", g);
+  }
+  {
+    SphereGeometry g;
+    g.outer_radius = 8;
+    g.inner_radius = 3;
+    check_geometry("outerSphere innerSphere", g);
+  }
+
+  if (retval == 0) {
+    printf("\n%s passes!\n", argv[0]);
+  } else {
+    printf("\n%s fails %d tests!\n", argv[0], retval);
+    return retval;
+  }
+}
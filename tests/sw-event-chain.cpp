@@ -0,0 +1,150 @@
+// Deft is a density functional package developed by the research
+// group of Professor David Roundy
+//
+// Copyright 2010 The Deft Authors
+//
+// Deft is free software; you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// You should have received a copy of the GNU General Public License
+// along with deft; if not, write to the Free Software Foundation,
+// Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+//
+// Please see the file AUTHORS for a list of authors.
+
+// This checks that square-well event chains keep the balls from
+// overlapping and keep the running energy right, and that at a fixed
+// temperature they give the same mean energy as move_a_ball does.
+
+#include <stdio.h>
+#include <math.h>
+#include "Monte-Carlo/square-well.h"
+
+int retval = 0;
+
+const int N = 30;
+const double kT = 0.6;
+
+void setup(sw_simulation &sw) {
+  const double R = 1;
+  sw.N = N;
+  sw.filling_fraction = 0.3;
+  sw.well_width = 1.3;
+  sw.walls = 0;
+  sw.sticky_wall = 0;
+  sw.min_T = kT;
+  // We start from an fcc lattice, which needs 2 cells on a side.
+  const int cells = 2;
+  const double volume = N*4*M_PI/3*R*R*R/sw.filling_fraction;
+  sw.len[0] = sw.len[1] = sw.len[2] = cbrt(volume);
+  const double neighbor_scale = 2;
+  sw.balls = new ball[N];
+  for (int i=0; i<N; i++) sw.balls[i].R = R;
+  sw.neighbor_R = neighbor_scale*R*sw.well_width;
+  sw.max_neighbors = 2*max_balls_within(2 + neighbor_scale*sw.well_width);
+  sw.interaction_distance = 2*R*sw.well_width;
+  sw.energy_levels = N*max_balls_within(sw.interaction_distance*1.1)/2 + 1;
+  sw.energy_histogram = new long[sw.energy_levels]();
+  sw.ln_energy_weights = new double[sw.energy_levels]();
+  sw.optimistic_samples = new long[sw.energy_levels]();
+  sw.pessimistic_samples = new long[sw.energy_levels]();
+  sw.pessimistic_observation = new bool[sw.energy_levels]();
+  sw.biggest_energy_transition = max_balls_within(sw.interaction_distance + 1);
+  sw.collection_matrix = new long[sw.energy_levels*(2*sw.biggest_energy_transition+1)]();
+  sw.translation_scale = 0.5*R;
+  sw.max_entropy_state = 0;
+  sw.min_important_energy = 0;
+  for (int i=0; i<sw.energy_levels; i++) sw.ln_energy_weights[i] = i/kT;
+
+  const double w = sw.len[0]/cells;
+  const vector3d offset[4] = { vector3d(0,0,0), vector3d(0,w,w)/2,
+                               vector3d(w,0,w)/2, vector3d(w,w,0)/2 };
+  int b = 0;
+  for (int i=0; i<cells; i++) {
+    for (int j=0; j<cells; j++) {
+      for (int k=0; k<cells; k++) {
+        for (int l=0; l<4 && b<N; l++) sw.balls[b++].pos = vector3d(i*w, j*w, k*w) + offset[l];
+      }
+    }
+  }
+  initialize_neighbor_tables(sw.balls, N, sw.neighbor_R, sw.max_neighbors, sw.len, sw.walls);
+  sw.energy = count_all_interactions(sw.balls, N, sw.interaction_distance, sw.len,
+                                     sw.walls, sw.sticky_wall);
+  sw.reset_histograms();
+}
+
+// check_balls makes sure nothing overlaps and that the energy is
+// right, returning true if all is well.
+bool check_balls(sw_simulation &sw, const char *name) {
+  for (int i=0; i<N; i++) {
+    for (int j=i+1; j<N; j++) {
+      if (overlap(sw.balls[i], sw.balls[j], sw.len, sw.walls)) {
+        printf("FAIL: %s left balls %d and %d overlapping!\n", name, i, j);
+        retval++;
+        return false;
+      }
+    }
+  }
+  const int energy = count_all_interactions(sw.balls, N, sw.interaction_distance, sw.len,
+                                            sw.walls, sw.sticky_wall);
+  if (energy != sw.energy) {
+    printf("FAIL: %s has energy %d rather than %d!\n", name, sw.energy, energy);
+    retval++;
+    return false;
+  }
+  return true;
+}
+
+// mean_energy runs sweeps of N moves (or chains), skipping the first
+// tenth, and returns the mean number of interactions.
+double mean_energy(sw_simulation &sw, const char *name, long sweeps, double chain_length) {
+  double total = 0;
+  long samples = 0;
+  for (long s=0; s<sweeps; s++) {
+    for (int i=0; i<N; i++) {
+      if (chain_length) sw.event_chain(chain_length);
+      else sw.move_a_ball();
+    }
+    if (s % 1000 == 0 && !check_balls(sw, name)) return 0;
+    if (s >= sweeps/10) {
+      total += sw.energy;
+      samples++;
+    }
+  }
+  const double mean = total/samples;
+  printf("%s gives a mean energy of %g\n", name, -mean/N);
+  return mean;
+}
+
+int main(int, char **argv) {
+  random::seed(0);
+  sw_simulation chains;
+  setup(chains);
+  const double chain_mean = mean_energy(chains, "event chains", 40000, 2);
+  if (chains.moves.total != 40000*N || chains.iteration != 40000) {
+    printf("FAIL: event chains made %ld moves in %ld iterations!\n",
+           chains.moves.total, chains.iteration);
+    retval++;
+  }
+
+  sw_simulation moves;
+  setup(moves);
+  const double move_mean = mean_energy(moves, "move_a_ball", 200000, 0);
+
+  // The moves decorrelate slowly enough that their mean is only good
+  // to about half an interaction.
+  if (fabs(chain_mean - move_mean) > 1.5) {
+    printf("FAIL: event chains give %g interactions, but moves give %g!\n",
+           chain_mean, move_mean);
+    retval++;
+  }
+
+  if (retval == 0) {
+    printf("\n%s passes!\n", argv[0]);
+  } else {
+    printf("\n%s fails %d tests!\n", argv[0], retval);
+    return retval;
+  }
+}
@@ -0,0 +1,181 @@
+// Deft is a density functional package developed by the research
+// group of Professor David Roundy
+//
+// Copyright 2010 The Deft Authors
+//
+// Deft is free software; you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// You should have received a copy of the GNU General Public License
+// along with deft; if not, write to the Free Software Foundation,
+// Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+//
+// Please see the file AUTHORS for a list of authors.
+
+// This checks that initialize_windows lays out energy windows that
+// each overlap the next, and that for Wang-Landau and SAD the weights
+// it stitches together from the windows agree with the density of
+// states given by the transitions all of the windows counted.
+
+#include <stdio.h>
+#include <math.h>
+#include "Monte-Carlo/square-well.h"
+
+int retval = 0;
+
+const int N = 20;
+
+void setup(sw_simulation &sw) {
+  const double R = 1;
+  sw.N = N;
+  sw.filling_fraction = 0.3;
+  sw.well_width = 1.3;
+  sw.walls = 0;
+  sw.sticky_wall = 0;
+  sw.min_T = 0.5;
+  sw.fractional_dos_precision = 1e-7;
+  sw.end_condition = init_iter_limit;
+  sw.init_iters = 200000;
+  // We start from an fcc lattice, which needs 2 cells on a side.
+  const int cells = 2;
+  const double volume = N*4*M_PI/3*R*R*R/sw.filling_fraction;
+  sw.len[0] = sw.len[1] = sw.len[2] = cbrt(volume);
+  const double neighbor_scale = 2;
+  sw.balls = new ball[N];
+  for (int i=0; i<N; i++) sw.balls[i].R = R;
+  sw.neighbor_R = neighbor_scale*R*sw.well_width;
+  sw.max_neighbors = 2*max_balls_within(2 + neighbor_scale*sw.well_width);
+  sw.interaction_distance = 2*R*sw.well_width;
+  sw.energy_levels = N*max_balls_within(sw.interaction_distance*1.1)/2 + 1;
+  sw.energy_histogram = new long[sw.energy_levels]();
+  sw.ln_energy_weights = new double[sw.energy_levels]();
+  sw.optimistic_samples = new long[sw.energy_levels]();
+  sw.pessimistic_samples = new long[sw.energy_levels]();
+  sw.pessimistic_observation = new bool[sw.energy_levels]();
+  sw.biggest_energy_transition = max_balls_within(sw.interaction_distance + 1);
+  sw.collection_matrix = new long[sw.energy_levels*(2*sw.biggest_energy_transition+1)]();
+  sw.translation_scale = 0.5*R;
+  sw.max_entropy_state = 0;
+  sw.min_important_energy = 0;
+
+  const double w = sw.len[0]/cells;
+  const vector3d offset[4] = { vector3d(0,0,0), vector3d(0,w,w)/2,
+                               vector3d(w,0,w)/2, vector3d(w,w,0)/2 };
+  int b = 0;
+  for (int i=0; i<cells; i++) {
+    for (int j=0; j<cells; j++) {
+      for (int k=0; k<cells; k++) {
+        for (int l=0; l<4 && b<N; l++) sw.balls[b++].pos = vector3d(i*w, j*w, k*w) + offset[l];
+      }
+    }
+  }
+  initialize_neighbor_tables(sw.balls, N, sw.neighbor_R, sw.max_neighbors, sw.len, sw.walls);
+  sw.energy = count_all_interactions(sw.balls, N, sw.interaction_distance, sw.len,
+                                     sw.walls, sw.sticky_wall);
+  // We melt the lattice with a few sweeps at infinite temperature, so
+  // that cooling passes through the whole energy range.
+  for (int i=0; i<1000*N; i++) sw.move_a_ball();
+  sw.iteration = 0;
+  sw.reset_histograms();
+}
+
+// check_layout makes sure that the windows cover the whole energy
+// range, and that each one overlaps the next.
+void check_layout(int max_entropy_state, int min_important_energy,
+                  int num_windows, double window_overlap) {
+  sw_simulation sw;
+  sw.max_entropy_state = max_entropy_state;
+  sw.min_important_energy = min_important_energy;
+  int last_first = 0, last_last = 0;
+  for (int k=0; k<num_windows; k++) {
+    int first, last;
+    sw.window_range(k, num_windows, window_overlap, &first, &last);
+    if (first >= last || first < max_entropy_state || last > min_important_energy) {
+      printf("FAIL: window %d of %d covers %d -> %d, outside of %d -> %d!\n",
+             k, num_windows, first, last, max_entropy_state, min_important_energy);
+      retval++;
+    }
+    if (k == 0 && first != max_entropy_state) {
+      printf("FAIL: the first of %d windows starts at %d rather than %d!\n",
+             num_windows, first, max_entropy_state);
+      retval++;
+    }
+    if (k == num_windows-1 && last != min_important_energy) {
+      printf("FAIL: the last of %d windows ends at %d rather than %d!\n",
+             num_windows, last, min_important_energy);
+      retval++;
+    }
+    if (k > 0 && (first <= last_first || first >= last_last)) {
+      printf("FAIL: window %d of %d covers %d -> %d, which does not overlap %d -> %d!\n",
+             k, num_windows, first, last, last_first, last_last);
+      retval++;
+    }
+    last_first = first;
+    last_last = last;
+  }
+}
+
+// check_stitching runs initialize_windows, and compares the weights it
+// gives with the density of states from the transitions, at the
+// energies that were sampled often enough for both to be good.
+void check_stitching(sw_simulation &sw, const char *name, int num_windows,
+                     double tolerance) {
+  printf("\n** %s with %d windows **\n\n", name, num_windows);
+  sw.initialize_windows(num_windows, 0.25, 2, 0.8, 1e-6);
+  const int lo = sw.max_entropy_state, hi = sw.min_important_energy;
+  double *ln_dos = sw.compute_ln_dos(transition_dos);
+  double worst = 0;
+  for (int i=lo; i<=hi; i++) {
+    // Wang-Landau keeps resetting its histogram, so we count the moves
+    // made from each energy by way of the transitions.
+    long samples = 0;
+    for (int de=-sw.biggest_energy_transition; de<=sw.biggest_energy_transition; de++) {
+      samples += sw.transitions(i, de);
+    }
+    if (samples < 10000) continue;
+    const double error = (sw.ln_energy_weights[i] - sw.ln_energy_weights[lo])
+                         + (ln_dos[i] - ln_dos[lo]);
+    printf("%3d: lnw = %8.3f  -ln D = %8.3f  (%ld moves)\n", i,
+           sw.ln_energy_weights[i] - sw.ln_energy_weights[lo],
+           ln_dos[lo] - ln_dos[i], samples);
+    if (fabs(error) > fabs(worst)) worst = error;
+  }
+  delete[] ln_dos;
+  if (fabs(worst) > tolerance) {
+    printf("FAIL: %s weights are off by as much as %g from the transitions!\n",
+           name, worst);
+    retval++;
+  }
+}
+
+int main(int, char **argv) {
+  for (int range=1; range<40; range++) {
+    for (int num_windows=1; num_windows<=range/2 && num_windows<=8; num_windows++) {
+      check_layout(3, 3 + range, num_windows, 0);
+      check_layout(3, 3 + range, num_windows, 0.25);
+      check_layout(3, 3 + range, num_windows, 0.5);
+    }
+  }
+
+  random::seed(0);
+  sw_simulation wl;
+  setup(wl);
+  wl.use_wl = true;
+  wl.wl_factor = 1;
+  check_stitching(wl, "Wang-Landau", 3, 0.5);
+
+  random::seed(0);
+  sw_simulation sad;
+  setup(sad);
+  sad.use_sad = 1;
+  check_stitching(sad, "SAD", 2, 0.5);
+
+  if (retval == 0) {
+    printf("\n%s passes!\n", argv[0]);
+  } else {
+    printf("\n%s fails %d tests!\n", argv[0], retval);
+    return retval;
+  }
+}
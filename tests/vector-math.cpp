@@ -0,0 +1,148 @@
+// Deft is a density functional package developed by the research
+// group of Professor David Roundy
+//
+// Copyright 2010 The Deft Authors
+//
+// Deft is free software; you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// You should have received a copy of the GNU General Public License
+// along with deft; if not, write to the Free Software Foundation,
+// Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+//
+// Please see the file AUTHORS for a list of authors.
+
+// This checks the accuracy of VectorMath against libm for every
+// instruction set this processor supports, and then times each of
+// them against the libm loop it replaces.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "VectorMath.h"
+
+int retval = 0;
+
+const long N = 1 << 20;
+
+// ulps returns the difference between a and b in units of the last
+// place of b.
+double ulps(double a, double b) {
+  if (a == b || (a != a && b != b)) return 0;
+  if (b == 0 || isinf(b)) return fabs(a - b) < 1e-300 ? 0 : 1e300;
+  int e;
+  frexp(b, &e);
+  // Subnormals can't have more than 1074 bits after the binary point.
+  return fabs(a - b)/fmax(ldexp(1.0, e - 53), 4.9406564584124654e-324);
+}
+
+typedef void (*array_function)(const double *, double *, long);
+
+void check(const char *name, array_function vf, double (*sf)(double), double (*libm)(double),
+           const double *x, long n, double maxulps) {
+  double *out = new double[n];
+  vf(x, out, n);
+  double worst = 0, worst_scalar = 0, worstx = 0;
+  for (long i=0; i<n; i++) {
+    const double correct = libm(x[i]);
+    const double err = ulps(out[i], correct);
+    if (err > worst) {
+      worst = err;
+      worstx = x[i];
+    }
+    if (sf) worst_scalar = fmax(worst_scalar, ulps(sf(x[i]), correct));
+  }
+  printf("%8s %-6s: worst error %.3g ulps at x = %.17g (inline version %.3g ulps)\n",
+         vm_instruction_set(), name, worst, worstx, worst_scalar);
+  if (worst > maxulps || worst_scalar > maxulps) {
+    printf("FAIL: %s is off by more than %g ulps!\n", name, maxulps);
+    retval++;
+  }
+  delete[] out;
+}
+
+double libm_sqrt(double x) { return sqrt(x); }
+double libm_exp(double x) { return exp(x); }
+double libm_log(double x) { return log(x); }
+double libm_erf(double x) { return erf(x); }
+const double pow_y = 1.0/3;
+double libm_pow(double x) { return pow(x, pow_y); }
+void vm_pow_array(const double *x, double *out, long n) { vm_pow(x, pow_y, out, n); }
+double vm_pow_scalar(double x) { return vm_pow(x, pow_y); }
+
+double vm_exp_scalar(double x) { return vm_exp(x); }
+double vm_log_scalar(double x) { return vm_log(x); }
+double vm_erf_scalar(double x) { return vm_erf(x); }
+
+// We time libm and the inline functions through a volatile pointer,
+// so that the compiler can't notice that every repeat does the same
+// thing.
+void time_it(const char *name, array_function vf, double (*libm)(double), const double *x) {
+  double *out = new double[N];
+  const int repeats = 20;
+  clock_t start = clock();
+  for (int r=0; r<repeats; r++) vf(x, out, N);
+  const double vtime = (clock() - double(start))/CLOCKS_PER_SEC/repeats;
+  double (*volatile f)(double) = libm;
+  start = clock();
+  for (int r=0; r<repeats; r++) {
+    double (*fr)(double) = f;
+    for (long i=0; i<N; i++) out[i] = fr(x[i]);
+  }
+  const double ltime = (clock() - double(start))/CLOCKS_PER_SEC/repeats;
+  printf("%8s %-6s: %6.2f ns per element versus %6.2f for libm (speedup %.2f)\n",
+         vm_instruction_set(), name, 1e9*vtime/N, 1e9*ltime/N, ltime/vtime);
+  delete[] out;
+}
+
+int main(int, char **argv) {
+  double *expx = new double[N], *logx = new double[N], *erfx = new double[N];
+  srand(0);
+  for (long i=0; i<N; i++) {
+    const double u = rand()/double(RAND_MAX);
+    expx[i] = -750 + 1465*u;
+    logx[i] = exp(-745 + 1454*rand()/double(RAND_MAX));
+    erfx[i] = -7 + 14*u;
+  }
+  // A few special values, which have to come out right.
+  const double special[] = { 0, -0.0, 1, -1, HUGE_VAL, -HUGE_VAL, NAN, 5e-324, 2.2250738585072014e-308,
+                             1.5, -1.5, 30, 1e-300, 709.7, 709.8, -745.1, -745.2 };
+  const long nspecial = sizeof(special)/sizeof(special[0]);
+
+  const char *sets[] = { "generic", "avx2", "avx512" };
+  for (int s=0; s<3; s++) {
+    if (!vm_use_instruction_set(sets[s])) {
+      printf("Skipping %s, which this processor does not support.\n", sets[s]);
+      continue;
+    }
+    check("exp", vm_exp, vm_exp_scalar, libm_exp, expx, N, 2);
+    check("exp", vm_exp, vm_exp_scalar, libm_exp, special, nspecial, 2);
+    check("log", vm_log, vm_log_scalar, libm_log, logx, N, 2);
+    check("log", vm_log, vm_log_scalar, libm_log, special, nspecial, 2);
+    check("sqrt", vm_sqrt, 0, libm_sqrt, logx, N, 0);
+    check("erf", vm_erf, vm_erf_scalar, libm_erf, erfx, N, 4);
+    check("erf", vm_erf, vm_erf_scalar, libm_erf, special, nspecial, 4);
+    check("pow", vm_pow_array, vm_pow_scalar, libm_pow, logx, N, 2 + fabs(pow_y)*745);
+  }
+
+  for (int s=0; s<3; s++) {
+    if (!vm_use_instruction_set(sets[s])) continue;
+    time_it("exp", vm_exp, libm_exp, expx);
+    time_it("log", vm_log, libm_log, logx);
+    time_it("sqrt", vm_sqrt, libm_sqrt, logx);
+    time_it("erf", vm_erf, libm_erf, erfx);
+    time_it("pow", vm_pow_array, libm_pow, logx);
+  }
+
+  delete[] expx;
+  delete[] logx;
+  delete[] erfx;
+  if (retval == 0) {
+    printf("\n%s passes!\n", argv[0]);
+  } else {
+    printf("\n%s fails %d tests!\n", argv[0], retval);
+    return retval;
+  }
+}